@@ -70,4 +70,6 @@ extern "C" {
 }
 #endif
 
+#include <saImmOm_A_2_19.h>
+
 #endif   /* _SA_IMM_OM_A_2_17_H */
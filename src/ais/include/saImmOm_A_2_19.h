@@ -0,0 +1,60 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * DESCRIPTION:
+ *   This file provides the suggested additions to the C language binding for
+ *   the Service Availability(TM) Forum Information Model Management Service (IMM).
+ *   It contains only the prototypes and type definitions that are part of this
+ *   proposed addition.
+ *   These additions are currently NON STANDARD. But the intention is to get these
+ *   additions approved formally by SAF in the future.
+ *
+ *   For detailed explanation of the new API, see src/imm/README.
+ */
+
+
+#ifndef _SA_IMM_OM_A_2_19_H
+#define _SA_IMM_OM_A_2_19_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/* 5.21.03 Pipelined ccb operations */
+
+	extern SaAisErrorT
+	 saImmOmCcbObjectCreateAsync(SaImmCcbHandleT ccbHandle,
+			 const SaImmClassNameT className, const SaNameT *parentName,
+			 const SaImmAttrValuesT_2 **attrValues);
+
+	extern SaAisErrorT
+	 saImmOmCcbObjectModifyAsync(SaImmCcbHandleT ccbHandle,
+			 const SaNameT *objectName,
+			 const SaImmAttrModificationT_2 **attrMods);
+
+	extern SaAisErrorT
+	 saImmOmCcbObjectDeleteAsync(SaImmCcbHandleT ccbHandle,
+			 const SaNameT *objectName);
+
+	extern SaAisErrorT
+	 saImmOmCcbSync(SaImmCcbHandleT ccbHandle);
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif   /* _SA_IMM_OM_A_2_19_H */
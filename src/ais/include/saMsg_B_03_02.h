@@ -0,0 +1,108 @@
+/*	  -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * DESCRIPTION:
+ *   This file provides the suggested additions to the C language binding for
+ *   the Service Availability(TM) Forum Message Service (MSG).
+ *   It contains only the prototypes and type definitions that are part of this
+ *   proposed addition.
+ *   These additions are currently NON STANDARD. But the intention is to get these
+ *   additions approved formally by SAF in the future.
+ *
+ */
+
+#ifndef _SA_MSG_B_03_02_H
+#define _SA_MSG_B_03_02_H
+
+#include "saMsg.h"
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+	/***************************************************************************
+	@brief	    : One message received by saMsgMessageGetBatch. The message
+			field is used as by saMsgMessageGet, i.e. if message.data
+			is NULL the Message Service allocates the buffer and the
+			caller frees it with saMsgMessageDataFree.
+	****************************************************************************/
+	typedef struct {
+		SaMsgMessageT message;
+		SaTimeT sendTime;
+		SaMsgSenderIdT senderId;
+	} SaMsgMessageBatchEntryT;
+
+	/***************************************************************************
+	@brief	    : saMsgMessageGetBatch receives up to *numberOfMessages
+			messages from a message queue in one call. If no message
+			is available it waits, like saMsgMessageGet, up to timeout
+			for the first one. Messages available after that are
+			returned without waiting. The queue status is updated
+			asynchronously for all messages of the batch.
+	@param[in]  : queueHandle - The handle of the message queue, obtained
+			with saMsgQueueOpen.
+	@param[in/out] : entries - An array of *numberOfMessages entries.
+	@param[in/out] : numberOfMessages - In: the number of entries. Out: the
+			number of messages received, at least one if
+			SA_AIS_OK is returned.
+	@param[in]  : timeout - Time to wait for the first message.
+	@return	    : SA_AIS_OK if successful otherwise the error code that
+			saMsgMessageGet would return for the first message.
+			A message that does not fit the buffer of its entry
+			ends the batch, it is left in the queue unless it is
+			the first one, for which SA_AIS_ERR_NO_SPACE is
+			returned.
+	****************************************************************************/
+	extern SaAisErrorT
+		saMsgMessageGetBatch(SaMsgQueueHandleT queueHandle,
+				     SaMsgMessageBatchEntryT *entries,
+				     SaUint32T *numberOfMessages,
+				     SaTimeT timeout);
+
+	/***************************************************************************
+	@brief	    : saMsgMessageSendBatch sends *numberOfMessages messages
+			to a message queue in one operation. The messages are
+			put in the queue in the order given, up to the first
+			one that fails. If the queue can not hold all of them
+			none is put. If destination is a message queue group,
+			each message is sent as by saMsgMessageSend.
+	@param[in]  : msgHandle - The handle obtained with saMsgInitialize.
+	@param[in]  : destination - Name of the message queue or group.
+	@param[in]  : messages - An array of *numberOfMessages messages.
+	@param[in/out] : numberOfMessages - In: the number of messages. Out:
+			the number of messages put in the queue, the first
+			ones of the array. All of them if SA_AIS_OK is
+			returned. Messages of a batch that timed out may have
+			been put in the queue without being counted.
+	@param[in]  : timeout - Time to wait for the messages to be put in the
+			queue.
+	@return	    : SA_AIS_OK if successful otherwise the error code that
+			saMsgMessageSend would return for the first message not
+			put in the queue. SA_AIS_ERR_TOO_BIG is returned if the
+			batch does not fit one transport message, about 64 KB.
+	****************************************************************************/
+	extern SaAisErrorT
+		saMsgMessageSendBatch(SaMsgHandleT msgHandle,
+				      const SaNameT *destination,
+				      const SaMsgMessageT *messages,
+				      SaUint32T *numberOfMessages,
+				      SaTimeT timeout);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif   /* _SA_MSG_B_03_02_H */
@@ -87,6 +87,7 @@ typedef enum {
  */
 typedef struct avsv_nd_msg_queue {
   NCSMDS_INFO snd_msg;
+  bool susi_batch; /* may be sent in a AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG */
   struct avsv_nd_msg_queue *next;
 } AVSV_ND_MSG_QUEUE;
 
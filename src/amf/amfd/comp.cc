@@ -1463,8 +1463,7 @@ done:
  */
 SaAisErrorT avd_comp_config_get(const std::string &su_name, AVD_SU *su) {
   SaAisErrorT rc, error = SA_AIS_ERR_FAILED_OPERATION;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT comp_name;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfComp";
@@ -1499,23 +1498,14 @@ SaAisErrorT avd_comp_config_get(const std::string &su_name, AVD_SU *su) {
 
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  if ((rc = immutil_saImmOmSearchInitialize_o2(
-           avd_cb->immOmHandle, su_name.c_str(), SA_IMM_SUBTREE,
-           SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR, &searchParam,
-           configAttributes, &searchHandle)) != SA_AIS_OK) {
+  if ((rc = search.initialize(su_name, className, SA_IMM_SEARCH_GET_SOME_ATTR,
+                              configAttributes)) != SA_AIS_OK) {
     LOG_ER("%s: saImmOmSearchInitialize_2 failed: %u", __FUNCTION__, rc);
     error = rc;
     goto done1;
   }
 
-  while ((rc = immutil_saImmOmSearchNext_2(
-              searchHandle, &comp_name, (SaImmAttrValuesT_2 ***)&attributes)) ==
-         SA_AIS_OK) {
+  while ((rc = search.next(&comp_name, &attributes)) == SA_AIS_OK) {
     if (!is_config_valid(Amf::to_string(&comp_name), attributes, nullptr))
       goto done2;
 
@@ -1550,7 +1540,7 @@ SaAisErrorT avd_comp_config_get(const std::string &su_name, AVD_SU *su) {
   }
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
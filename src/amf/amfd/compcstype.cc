@@ -283,8 +283,7 @@ done:
  */
 SaAisErrorT avd_compcstype_config_get(const std::string &name, AVD_COMP *comp) {
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION, rc;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT dn;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfCompCsType";
@@ -294,24 +293,15 @@ SaAisErrorT avd_compcstype_config_get(const std::string &name, AVD_COMP *comp) {
       const_cast<SaImmAttrNameT>("saAmfCompNumMaxStandbyCSIs"), nullptr};
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  rc = immutil_saImmOmSearchInitialize_o2(
-      avd_cb->immOmHandle, name.c_str(), SA_IMM_SUBTREE,
-      SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR, &searchParam,
-      attributeNames, &searchHandle);
+  rc = search.initialize(name, className, SA_IMM_SEARCH_GET_SOME_ATTR,
+                         attributeNames);
   if (SA_AIS_OK != rc) {
     LOG_ER("saImmOmSearchInitialize_2 failed: %u", rc);
     error = rc;
     goto done1;
   }
 
-  while ((rc = immutil_saImmOmSearchNext_2(
-              searchHandle, &dn, (SaImmAttrValuesT_2 ***)&attributes)) ==
-         SA_AIS_OK) {
+  while ((rc = search.next(&dn, &attributes)) == SA_AIS_OK) {
     if (!is_config_valid(Amf::to_string(&dn), nullptr)) {
       goto done2;
     }
@@ -326,7 +316,7 @@ SaAisErrorT avd_compcstype_config_get(const std::string &name, AVD_COMP *comp) {
   error = SA_AIS_OK;
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
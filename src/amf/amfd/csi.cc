@@ -474,31 +474,21 @@ done:
  */
 SaAisErrorT avd_csi_config_get(const std::string &si_name, AVD_SI *si) {
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION, rc;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT temp_csi_name;
 
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfCSI";
   AVD_CSI *csi;
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  if ((rc = immutil_saImmOmSearchInitialize_o2(
-          avd_cb->immOmHandle, si_name.c_str(), SA_IMM_SUBTREE,
-          SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_ALL_ATTR, &searchParam,
-          nullptr, &searchHandle)) != SA_AIS_OK) {
+  if ((rc = search.initialize(si_name, className, SA_IMM_SEARCH_GET_ALL_ATTR,
+                              nullptr)) != SA_AIS_OK) {
     LOG_ER("saImmOmSearchInitialize_2 failed");
     error = rc;
     goto done1;
   }
 
-  while (immutil_saImmOmSearchNext_2(searchHandle, &temp_csi_name,
-                                     (SaImmAttrValuesT_2 ***)&attributes) ==
-         SA_AIS_OK) {
+  while (search.next(&temp_csi_name, &attributes) == SA_AIS_OK) {
     const std::string csi_name(Amf::to_string(&temp_csi_name));
     if (!is_config_valid(csi_name, attributes, nullptr)) goto done2;
 
@@ -520,7 +510,7 @@ SaAisErrorT avd_csi_config_get(const std::string &si_name, AVD_SI *si) {
   error = SA_AIS_OK;
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
 
   return error;
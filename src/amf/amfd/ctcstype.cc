@@ -125,8 +125,7 @@ static AVD_CTCS_TYPE *ctcstype_create(const std::string &dn,
 SaAisErrorT avd_ctcstype_config_get(const std::string &comp_type_dn,
                                     AVD_COMP_TYPE *comp_type) {
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT dn;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfCtCsType";
@@ -134,22 +133,13 @@ SaAisErrorT avd_ctcstype_config_get(const std::string &comp_type_dn,
 
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  if (immutil_saImmOmSearchInitialize_o2(
-          avd_cb->immOmHandle, comp_type_dn.c_str(), SA_IMM_SUBTREE,
-          SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_ALL_ATTR, &searchParam,
-          nullptr, &searchHandle) != SA_AIS_OK) {
+  if (search.initialize(comp_type_dn, className, SA_IMM_SEARCH_GET_ALL_ATTR,
+                        nullptr) != SA_AIS_OK) {
     LOG_ER("saImmOmSearchInitialize_2 failed: %u", error);
     goto done1;
   }
 
-  while (immutil_saImmOmSearchNext_2(searchHandle, &dn,
-                                     (SaImmAttrValuesT_2 ***)&attributes) ==
-         SA_AIS_OK) {
+  while (search.next(&dn, &attributes) == SA_AIS_OK) {
     if (!is_config_valid(Amf::to_string(&dn), attributes, nullptr)) goto done2;
 
     if ((ctcstype = ctcstype_db->find(Amf::to_string(&dn))) == nullptr) {
@@ -164,7 +154,7 @@ SaAisErrorT avd_ctcstype_config_get(const std::string &comp_type_dn,
   error = SA_AIS_OK;
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
@@ -57,6 +57,7 @@
 #include <stdint.h>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 /* ========================================================================
  *   DEFINITIONS
@@ -228,25 +229,35 @@ AvdJobDequeueResultT ImmObjUpdate::exec(AVD_CL_CB *cb) {
   AvdJobDequeueResultT res;
   const SaImmOiHandleT immOiHandle = cb->immOiHandle;
 
-  SaImmAttrModificationT_2 attrMod;
-  const SaImmAttrModificationT_2 *attrMods[] = {&attrMod, nullptr};
-  SaImmAttrValueT attrValues[] = {value_};
+  std::vector<SaImmAttrModificationT_2> attrMods(1 + merged_.size());
+  std::vector<const SaImmAttrModificationT_2 *> attrModPtrs;
 
-  TRACE_ENTER2("Update '%s' %s", dn.c_str(), attributeName_);
+  TRACE_ENTER2("Update '%s' %s, %zu more attributes", dn.c_str(),
+               attributeName_, merged_.size());
 
-  // update latest values.
-  if (immobj_update_required() == false) {
+  for (size_t i = 0; i < attrMods.size(); ++i) {
+    ImmObjUpdate *update = (i == 0) ? this : merged_[i - 1];
+
+    // update latest values.
+    if (update->immobj_update_required() == false) continue;
+
+    SaImmAttrModificationT_2 &attrMod = attrMods[i];
+    attrMod.modType = SA_IMM_ATTR_VALUES_REPLACE;
+    attrMod.modAttr.attrName = update->attributeName_;
+    attrMod.modAttr.attrValuesNumber = 1;
+    attrMod.modAttr.attrValueType = update->attrValueType_;
+    attrMod.modAttr.attrValues = &update->value_;
+    attrModPtrs.push_back(&attrMod);
+  }
+
+  if (attrModPtrs.empty()) {
     delete Fifo::dequeue();
     res = JOB_EXECUTED;
     goto done;
   }
-  attrMod.modType = SA_IMM_ATTR_VALUES_REPLACE;
-  attrMod.modAttr.attrName = attributeName_;
-  attrMod.modAttr.attrValuesNumber = 1;
-  attrMod.modAttr.attrValueType = attrValueType_;
-  attrMod.modAttr.attrValues = attrValues;
+  attrModPtrs.push_back(nullptr);
 
-  rc = saImmOiRtObjectUpdate_o3(immOiHandle, dn.c_str(), attrMods);
+  rc = saImmOiRtObjectUpdate_o3(immOiHandle, dn.c_str(), attrModPtrs.data());
   cb->avd_imm_status = AVD_IMM_INIT_DONE;
 
   if ((rc == SA_AIS_OK) || (rc == SA_AIS_ERR_NOT_EXIST)) {
@@ -273,8 +284,49 @@ done:
   return res;
 }
 
+/**
+ * Takes over a later update of the same object. The value of an attribute
+ * already updated is replaced, other attributes are added.
+ * @param update
+ */
+void ImmObjUpdate::merge(ImmObjUpdate *update) {
+  ImmObjUpdate *same = nullptr;
+
+  if (strcmp(attributeName_, update->attributeName_) == 0) {
+    same = this;
+  } else {
+    for (auto merged : merged_) {
+      if (strcmp(merged->attributeName_, update->attributeName_) == 0) {
+        same = merged;
+        break;
+      }
+    }
+  }
+
+  if (same == nullptr) {
+    merged_.push_back(update);
+  } else {
+    osafassert(same->attrValueType_ == update->attrValueType_);
+    std::swap(same->value_, update->value_);
+    delete update;
+  }
+}
+
+/**
+ * Returns true if the attribute is updated by this job
+ * @param attribute
+ */
+bool ImmObjUpdate::updates(const std::string &attribute) const {
+  if (attribute == attributeName_) return true;
+  for (auto merged : merged_) {
+    if (attribute == merged->attributeName_) return true;
+  }
+  return false;
+}
+
 //
 ImmObjUpdate::~ImmObjUpdate() {
+  for (auto merged : merged_) delete merged;
   if (attrValueType_ == SA_IMM_ATTR_SANAMET) {
     osaf_extended_name_free(static_cast<SaNameT *>(value_));
   }
@@ -368,6 +420,10 @@ AvdJobDequeueResultT ImmAdminResponse::exec(AVD_CL_CB *cb) {
   return res;
 }
 
+// Queue statistics are logged when a queue of at least this size has been
+// executed
+static const uint32_t FIFO_STATS_MIN_PEAK_SIZE = 100;
+
 Job *Fifo::peek() {
   Job *tmp;
 
@@ -381,7 +437,31 @@ Job *Fifo::peek() {
 }
 
 //
-void Fifo::queue(Job *job) { job_.push_back(job); }
+void Fifo::queue(Job *job) {
+  job_.push_back(job);
+  if (job_.size() > peak_size_) peak_size_ = job_.size();
+}
+
+//
+void Fifo::queue_update(ImmObjUpdate *job) {
+  updates_++;
+
+  auto it = pending_updates_.find(job->dn);
+  if (it != pending_updates_.end()) {
+    TRACE("Coalesced with pending update of '%s'", job->dn.c_str());
+    coalesced_updates_++;
+    it->second->merge(job);
+    return;
+  }
+
+  pending_updates_[job->dn] = job;
+  queue(job);
+}
+
+//
+void Fifo::stop_coalescing(const std::string &dn) {
+  pending_updates_.erase(dn);
+}
 
 //
 Job *Fifo::dequeue() {
@@ -392,6 +472,12 @@ Job *Fifo::dequeue() {
   } else {
     tmp = job_.front();
     job_.pop_front();
+
+    if (typeid(*tmp) == typeid(ImmObjUpdate)) {
+      auto it = pending_updates_.find(static_cast<ImmObjUpdate *>(tmp)->dn);
+      if (it != pending_updates_.end() && it->second == tmp)
+        pending_updates_.erase(it);
+    }
   }
 
   return tmp;
@@ -420,9 +506,17 @@ AvdJobDequeueResultT Fifo::execute(AVD_CL_CB *cb) {
 
   ret = ajob->exec(cb);
 
-  // If no jobs then send a ckpt update to standby to flush its job queue.
-  if (((ajob = peek()) == nullptr) && (cb->stby_sync_state == AVD_STBY_IN_SYNC))
-    ckpt_job_queue_size();
+  if ((ajob = peek()) == nullptr) {
+    // If no jobs then send a ckpt update to standby to flush its job queue.
+    if (cb->stby_sync_state == AVD_STBY_IN_SYNC) ckpt_job_queue_size();
+
+    if (peak_size_ >= FIFO_STATS_MIN_PEAK_SIZE)
+      LOG_NO("IMM job queue empty, peak depth %u, %u of %u updates coalesced",
+             peak_size_, coalesced_updates_, updates_);
+    peak_size_ = 0;
+    updates_ = 0;
+    coalesced_updates_ = 0;
+  }
 
   TRACE_LEAVE2("%d", ret);
 
@@ -528,8 +622,7 @@ bool Fifo::pendingImmUpdateOp(const std::string& dn,
     if (job->getJobType() == JOB_TYPE_IMM &&
         typeid(*job) == typeid(ImmObjUpdate)) {
       ImmObjUpdate *update_job = dynamic_cast<ImmObjUpdate*>(job);
-      if (update_job->dn == dn &&
-          update_job->attributeName_ == attribute) {
+      if (update_job->dn == dn && update_job->updates(attribute)) {
         TRACE("Found an existing update on '%s'", dn.c_str());
         return true;
       }
@@ -541,6 +634,10 @@ bool Fifo::pendingImmUpdateOp(const std::string& dn,
 
 //
 std::deque<Job *> Fifo::job_;
+std::unordered_map<std::string, ImmObjUpdate *> Fifo::pending_updates_;
+uint32_t Fifo::peak_size_;
+uint32_t Fifo::updates_;
+uint32_t Fifo::coalesced_updates_;
 //
 
 extern struct ImmutilWrapperProfile immutilWrapperProfile;
@@ -1571,11 +1668,184 @@ SaAisErrorT avd_imm_default_OK_completed_cb(CcbUtilOperationData_t *opdata) {
   }
 }
 
+// Instances of one class in a bulk load, by parent DN
+typedef std::vector<std::pair<std::string, SaImmAttrValuesT_2 **>>
+    ConfigObjects;
+typedef std::unordered_map<std::string, ConfigObjects> ConfigExtent;
+
+static const uint32_t BULK_LOAD_OBJECTS_PER_MEM = 16;
+static const size_t BULK_LOAD_MEM_SIZE = 8192;
+static bool bulk_load_active;
+static std::vector<void *> bulk_load_mems;
+static std::unordered_map<std::string, ConfigExtent> bulk_load_extents;
+static uint32_t bulk_load_searches;
+static uint32_t bulk_load_objects;
+
+/**
+ * Returns the parent of a DN. Unlike avd_getparent() escaped commas are
+ * skipped in all RDNs, not only in the first.
+ * @param dn
+ */
+static std::string config_parent(const std::string &dn) {
+  for (std::string::size_type i = 0; i < dn.size(); ++i) {
+    if (dn[i] == '\\')
+      ++i;
+    else if (dn[i] == ',')
+      return dn.substr(i + 1);
+  }
+  return "";
+}
+
+/**
+ * Reads all instances of a class from IMM into the bulk load.
+ * @param class_name
+ * @param options
+ * @param attribute_names
+ *
+ * @return SaAisErrorT
+ */
+static SaAisErrorT config_extent_load(const char *class_name,
+                                      SaImmSearchOptionsT options,
+                                      SaImmAttrNameT *attribute_names) {
+  SaImmSearchHandleT search_handle;
+  SaImmSearchParametersT_2 search_param;
+  SaNameT dn;
+  const SaImmAttrValuesT_2 **attributes;
+  ConfigExtent &extent = bulk_load_extents[class_name];
+  SaAisErrorT rc;
+
+  TRACE_ENTER2("%s", class_name);
+
+  search_param.searchOneAttr.attrName =
+      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
+  search_param.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
+  search_param.searchOneAttr.attrValue = &class_name;
+
+  rc = immutil_saImmOmSearchInitialize_o2(
+      avd_cb->immOmHandle, nullptr, SA_IMM_SUBTREE,
+      SA_IMM_SEARCH_ONE_ATTR | options, &search_param, attribute_names,
+      &search_handle);
+  if (rc != SA_AIS_OK) {
+    LOG_ER("%s: saImmOmSearchInitialize_2 '%s' failed: %u", __FUNCTION__,
+           class_name, rc);
+    bulk_load_extents.erase(class_name);
+    goto done;
+  }
+  bulk_load_searches++;
+
+  while ((rc = immutil_saImmOmSearchNext_2(
+              search_handle, &dn, (SaImmAttrValuesT_2 ***)&attributes)) ==
+         SA_AIS_OK) {
+    const std::string name(Amf::to_string(&dn));
+    // immutil memory allocation walks all chunks of a memory reference,
+    // keep the chains short
+    if (bulk_load_objects % BULK_LOAD_OBJECTS_PER_MEM == 0)
+      bulk_load_mems.push_back(immutil_getMem(BULK_LOAD_MEM_SIZE));
+    extent[config_parent(name)].emplace_back(
+        name, immutil_dupSaImmAttrValuesT_array(bulk_load_mems.back(),
+                                                attributes));
+    bulk_load_objects++;
+  }
+
+  if (rc == SA_AIS_ERR_NOT_EXIST) {
+    rc = SA_AIS_OK;
+  } else {
+    LOG_ER("%s: saImmOmSearchNext_2 '%s' failed: %u", __FUNCTION__,
+           class_name, rc);
+    bulk_load_extents.erase(class_name);
+  }
+
+  (void)immutil_saImmOmSearchFinalize(search_handle);
+done:
+  TRACE_LEAVE2("%u", rc);
+  return rc;
+}
+
+SaAisErrorT ConfigSearch::initialize(const std::string &parent,
+                                     const char *class_name,
+                                     SaImmSearchOptionsT options,
+                                     SaImmAttrNameT *attribute_names) {
+  SaImmSearchParametersT_2 search_param;
+  SaAisErrorT rc;
+
+  finalize();
+
+  if (bulk_load_active) {
+    auto extent = bulk_load_extents.find(class_name);
+    if (extent == bulk_load_extents.end()) {
+      rc = config_extent_load(class_name, options, attribute_names);
+      if (rc != SA_AIS_OK) return rc;
+      extent = bulk_load_extents.find(class_name);
+    }
+
+    auto children = extent->second.find(parent);
+    if (children != extent->second.end()) objects_ = &children->second;
+    next_ = 0;
+    return SA_AIS_OK;
+  }
+
+  search_param.searchOneAttr.attrName =
+      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
+  search_param.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
+  search_param.searchOneAttr.attrValue = &class_name;
+
+  return immutil_saImmOmSearchInitialize_o2(
+      avd_cb->immOmHandle, parent.c_str(), SA_IMM_SUBTREE,
+      SA_IMM_SEARCH_ONE_ATTR | options, &search_param, attribute_names,
+      &handle_);
+}
+
+SaAisErrorT ConfigSearch::next(SaNameT *object_name,
+                               const SaImmAttrValuesT_2 ***attributes) {
+  if (handle_ != 0)
+    return immutil_saImmOmSearchNext_2(handle_, object_name,
+                                       (SaImmAttrValuesT_2 ***)attributes);
+
+  if (objects_ == nullptr || next_ == objects_->size())
+    return SA_AIS_ERR_NOT_EXIST;
+
+  const auto &object = (*objects_)[next_++];
+  osaf_extended_name_lend(object.first.c_str(), object_name);
+  *attributes = const_cast<const SaImmAttrValuesT_2 **>(object.second);
+  return SA_AIS_OK;
+}
+
+void ConfigSearch::finalize() {
+  if (handle_ != 0) {
+    (void)immutil_saImmOmSearchFinalize(handle_);
+    handle_ = 0;
+  }
+  objects_ = nullptr;
+  next_ = 0;
+}
+
+void ConfigSearch::begin_bulk_load() {
+  osafassert(bulk_load_active == false);
+  bulk_load_searches = 0;
+  bulk_load_objects = 0;
+  bulk_load_active = true;
+}
+
+void ConfigSearch::end_bulk_load() {
+  bulk_load_active = false;
+  bulk_load_extents.clear();
+  for (void *mem : bulk_load_mems) immutil_freeMem(mem);
+  bulk_load_mems.clear();
+}
+
+uint32_t ConfigSearch::bulk_searches() { return bulk_load_searches; }
+
+uint32_t ConfigSearch::bulk_objects() { return bulk_load_objects; }
+
 unsigned int avd_imm_config_get(void) {
   uint32_t rc = NCSCC_RC_FAILURE;
+  struct timespec start_time, end_time, load_time;
 
   TRACE_ENTER();
 
+  osaf_clock_gettime(CLOCK_MONOTONIC, &start_time);
+  ConfigSearch::begin_bulk_load();
+
   /*
   ** Get types first since instances are dependent of them.
   **
@@ -1633,8 +1903,15 @@ unsigned int avd_imm_config_get(void) {
   rc = NCSCC_RC_SUCCESS;
 
 done:
+  ConfigSearch::end_bulk_load();
+  osaf_clock_gettime(CLOCK_MONOTONIC, &end_time);
+  osaf_timespec_subtract(&end_time, &start_time, &load_time);
+
   if (rc == NCSCC_RC_SUCCESS)
-    TRACE("AMF Configuration successfully read from IMM");
+    LOG_NO("AMF Configuration read from IMM in %.3f s, %u objects bulk "
+           "loaded with %u searches",
+           osaf_timespec_to_double(&load_time), ConfigSearch::bulk_objects(),
+           ConfigSearch::bulk_searches());
   else
     LOG_WA("Failed to read configuration.");
 
@@ -1812,11 +2089,35 @@ void avd_saImmOiRtObjectUpdate(const std::string &dn,
   } else {
     memcpy(ajob->value_, value, sz);
   }
-  Fifo::queue(ajob);
+  Fifo::queue_update(ajob);
 
   TRACE_LEAVE();
 }
 
+/**
+ * Updates queued before an object is created or deleted must not be
+ * coalesced with later ones, that would move them before the create or
+ * delete. AMF runtime objects are created with the RDN as first attribute.
+ * @param parentName
+ * @param attrValues
+ */
+static void stop_coalescing_created(const std::string &parentName,
+                                    const SaImmAttrValuesT_2 **attrValues) {
+  const SaImmAttrValuesT_2 *rdn = attrValues[0];
+
+  if (rdn == nullptr || rdn->attrValuesNumber == 0) return;
+
+  if (rdn->attrValueType == SA_IMM_ATTR_SANAMET) {
+    Fifo::stop_coalescing(
+        Amf::to_string(static_cast<SaNameT *>(rdn->attrValues[0])) + "," +
+        parentName);
+  } else if (rdn->attrValueType == SA_IMM_ATTR_SASTRINGT) {
+    Fifo::stop_coalescing(
+        std::string(*static_cast<SaStringT *>(rdn->attrValues[0])) + "," +
+        parentName);
+  }
+}
+
 /**
  * Create IMM object, blocking call at active AMFD. If fails, move this create
  * job to queue and to be executed later
@@ -1832,6 +2133,8 @@ void avd_saImmOiRtObjectCreate_sync(const std::string &className,
   SaAisErrorT rc = SA_AIS_OK;
   bool isImmReady = isImmServiceReady(avd_cb);
 
+  stop_coalescing_created(parentName, attrValues);
+
   if (isImmReady == true) {
     const SaNameTWrapper parent_name(parentName);
     rc = saImmOiRtObjectCreate_2(avd_cb->immOiHandle,
@@ -1866,6 +2169,8 @@ void avd_saImmOiRtObjectCreate(const std::string &className,
       (check_to_create_immjob_at_standby_amfd(parentName) == false))
     return;
 
+  stop_coalescing_created(parentName, attrValues);
+
   ImmObjCreate *ajob = new ImmObjCreate;
   if (avd_cb->avail_state_avd != SA_AMF_HA_ACTIVE) ajob->implementer = false;
 
@@ -1889,6 +2194,8 @@ void avd_saImmOiRtObjectDelete_sync(const std::string &dn) {
   SaAisErrorT rc = SA_AIS_OK;
   bool isImmReady = isImmServiceReady(avd_cb);
 
+  Fifo::stop_coalescing(dn);
+
   if (isImmReady == true) {
     rc = saImmOiRtObjectDelete_o3(avd_cb->immOiHandle, dn.c_str());
     if (rc != SA_AIS_OK  && rc != SA_AIS_ERR_NOT_EXIST) {
@@ -1913,6 +2220,8 @@ void avd_saImmOiRtObjectDelete(const std::string &dn) {
       (check_to_create_immjob_at_standby_amfd(dn) == false))
     return;
 
+  Fifo::stop_coalescing(dn);
+
   ImmObjDelete *ajob = new ImmObjDelete;
   if (avd_cb->avail_state_avd != SA_AMF_HA_ACTIVE) ajob->implementer = false;
 
@@ -28,6 +28,9 @@
 
 #include <deque>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include "amf/amfd/cb.h"
 #include "osaf/immutil/immutil.h"
 
@@ -109,6 +112,8 @@ class ImmObjUpdate : public ImmJob {
   ImmObjUpdate() : ImmJob(){};
   bool immobj_update_required();
   AvdJobDequeueResultT exec(AVD_CL_CB *cb);
+  void merge(ImmObjUpdate *update);
+  bool updates(const std::string &attribute) const;
   bool si_get_attr_value();
   bool siass_get_attr_value();
   bool csiass_get_attr_value();
@@ -117,6 +122,11 @@ class ImmObjUpdate : public ImmJob {
   bool node_get_attr_value();
 
   ~ImmObjUpdate();
+
+ private:
+  // Later updates of other attributes of the same object, sent in the same
+  // saImmOiRtObjectUpdate call.
+  std::vector<ImmObjUpdate *> merged_;
 };
 
 //
@@ -168,6 +178,14 @@ class Fifo {
 
   static void queue(Job *job);
 
+  // Queue an attribute update. If an update of the same object is pending
+  // the attribute is added to it, or its value replaced, instead.
+  static void queue_update(ImmObjUpdate *job);
+
+  // Later updates of the object must not be added to pending updates, e.g.
+  // because the object is created or deleted.
+  static void stop_coalescing(const std::string &dn);
+
   static Job *dequeue();
 
   static AvdJobDequeueResultT execute(AVD_CL_CB *cb);
@@ -186,9 +204,52 @@ class Fifo {
 
  private:
   static std::deque<Job *> job_;
+  // Pending updates that later updates can be added to, by object DN
+  static std::unordered_map<std::string, ImmObjUpdate *> pending_updates_;
+  // Statistics, reset when the queue is empty
+  static uint32_t peak_size_;
+  static uint32_t updates_;
+  static uint32_t coalesced_updates_;
 };
 //
 
+// Search for the instances of a configuration class that are children of a
+// parent object. While a bulk load is active (see avd_imm_config_get) the
+// first search for a class reads all instances of the class with one search
+// from the IMM root and keeps them in memory indexed by parent. That search
+// and the following ones for the class are served from memory, so reading
+// the model costs one IMM search per class instead of one per parent object.
+// Outside a bulk load the search is passed to IMM.
+//
+// All searches for a class must ask for the same attributes.
+class ConfigSearch {
+ public:
+  ConfigSearch() : handle_(0), objects_(nullptr), next_(0) {}
+  ~ConfigSearch() { finalize(); }
+
+  SaAisErrorT initialize(const std::string &parent, const char *class_name,
+                         SaImmSearchOptionsT options,
+                         SaImmAttrNameT *attribute_names);
+  // Returns SA_AIS_ERR_NOT_EXIST when there are no more objects. The name and
+  // attributes are valid until the next call or finalize().
+  SaAisErrorT next(SaNameT *object_name,
+                   const SaImmAttrValuesT_2 ***attributes);
+  void finalize();
+
+  static void begin_bulk_load();
+  static void end_bulk_load();
+  static uint32_t bulk_searches();
+  static uint32_t bulk_objects();
+
+ private:
+  SaImmSearchHandleT handle_;
+  const std::vector<std::pair<std::string, SaImmAttrValuesT_2 **>> *objects_;
+  size_t next_;
+
+  ConfigSearch(const ConfigSearch &) = delete;
+  ConfigSearch &operator=(const ConfigSearch &) = delete;
+};
+
 /**
  * Install callbacks associated with classNames
  * @param className
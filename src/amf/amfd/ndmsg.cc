@@ -44,6 +44,7 @@
  * Module Inclusion Control...
  */
 
+#include <unordered_map>
 #include "amf/amfd/amfd.h"
 
 /****************************************************************************
@@ -185,12 +186,15 @@ uint32_t avd_mds_dec_flat(MDS_CALLBACK_DEC_FLAT_INFO *dec_info) {
 
   Arguments     : cb     :  The control block of AvD
                   snd_msg: the send message that needs to be sent.
+                  susi_batch: the message may be sent in a SU-SI assignment
+                              batch message.
 
   Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
 
   Notes         : None.
 ******************************************************************************/
-static void avd_d2n_msg_enqueue(AVD_CL_CB *cb, NCSMDS_INFO *snd_mds) {
+static void avd_d2n_msg_enqueue(AVD_CL_CB *cb, NCSMDS_INFO *snd_mds,
+                                bool susi_batch) {
   AVSV_ND_MSG_QUEUE *nd_msg;
   /*
    * Allocate the message and put it in the queue.
@@ -199,10 +203,36 @@ static void avd_d2n_msg_enqueue(AVD_CL_CB *cb, NCSMDS_INFO *snd_mds) {
   nd_msg = new AVSV_ND_MSG_QUEUE();
 
   memcpy(&nd_msg->snd_msg, snd_mds, sizeof(NCSMDS_INFO));
+  nd_msg->susi_batch = susi_batch;
 
   cb->nd_msg_queue_list.push(nd_msg);
 }
 
+/****************************************************************************
+  Name          : avd_d2n_msg_queue_elem_snd
+
+  Description   : Sends a dequeued message to the node director and frees it.
+
+  Arguments     : queue_elem : the dequeued message
+
+  Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+
+  Notes         : None.
+******************************************************************************/
+static uint32_t avd_d2n_msg_queue_elem_snd(AVSV_ND_MSG_QUEUE *queue_elem) {
+  uint32_t rc;
+
+  if ((rc = ncsmds_api(&queue_elem->snd_msg)) != NCSCC_RC_SUCCESS) {
+    LOG_ER("%s: ncsmds_api failed %u", __FUNCTION__, rc);
+  }
+
+  d2n_msg_free((AVD_DND_MSG *)queue_elem->snd_msg.info.svc_send.i_msg);
+
+  delete queue_elem;
+
+  return rc;
+}
+
 /****************************************************************************
   Name          : avd_d2n_msg_dequeue
 
@@ -213,9 +243,20 @@ static void avd_d2n_msg_enqueue(AVD_CL_CB *cb, NCSMDS_INFO *snd_mds) {
 
   Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
 
-  Notes         : None.
+  Notes         : SU-SI assignment messages to a node director that supports
+                  it are sent together in one AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG,
+                  which the node director processes in the same order. The
+                  batch of a node director is sent before any other message to
+                  it, so the order of the messages to each node director is
+                  kept.
 ******************************************************************************/
 uint32_t avd_d2n_msg_dequeue(AVD_CL_CB *cb) {
+  struct SusiBatch {
+    AVSV_ND_MSG_QUEUE *queue_elem;
+    AVD_DND_MSG *batch_msg;  // nullptr while only one message is queued
+    AVSV_DND_MSG_LIST **tail;
+  };
+  std::unordered_map<MDS_DEST, SusiBatch> batches;
   AVSV_ND_MSG_QUEUE *queue_elem;
   uint32_t rc = NCSCC_RC_SUCCESS;
   /*
@@ -225,16 +266,60 @@ uint32_t avd_d2n_msg_dequeue(AVD_CL_CB *cb) {
   while (!cb->nd_msg_queue_list.empty()) {
     queue_elem = cb->nd_msg_queue_list.front();
     cb->nd_msg_queue_list.pop();
-    /*
-     * Now do MDS send.
-     */
-    if ((rc = ncsmds_api(&queue_elem->snd_msg)) != NCSCC_RC_SUCCESS) {
-      LOG_ER("%s: ncsmds_api failed %u", __FUNCTION__, rc);
+
+    MDS_DEST dest = queue_elem->snd_msg.info.svc_send.info.snd.i_to_dest;
+    auto it = batches.find(dest);
+
+    if (queue_elem->susi_batch) {
+      AVD_DND_MSG *msg =
+          static_cast<AVD_DND_MSG *>(queue_elem->snd_msg.info.svc_send.i_msg);
+
+      if (it == batches.end()) {
+        batches[dest] = {queue_elem, nullptr, nullptr};
+        continue;
+      }
+
+      SusiBatch &batch = it->second;
+      if (batch.batch_msg == nullptr) {
+        // Replace the first message with a batch message holding it
+        AVSV_DND_MSG_LIST *first = new AVSV_DND_MSG_LIST();
+        first->msg = static_cast<AVD_DND_MSG *>(
+            batch.queue_elem->snd_msg.info.svc_send.i_msg);
+        batch.batch_msg = new AVD_DND_MSG();
+        batch.batch_msg->msg_type = AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG;
+        batch.batch_msg->msg_info.d2n_su_si_assign_batch.node_id =
+            first->msg->msg_info.d2n_su_si_assign.node_id;
+        batch.batch_msg->msg_info.d2n_su_si_assign_batch.num_msgs = 1;
+        batch.batch_msg->msg_info.d2n_su_si_assign_batch.list = first;
+        batch.queue_elem->snd_msg.info.svc_send.i_msg = batch.batch_msg;
+        batch.tail = &first->next;
+      }
+
+      AVSV_DND_MSG_LIST *entry = new AVSV_DND_MSG_LIST();
+      entry->msg = msg;
+      *batch.tail = entry;
+      batch.tail = &entry->next;
+      batch.batch_msg->msg_info.d2n_su_si_assign_batch.num_msgs++;
+      delete queue_elem;
+      continue;
     }
 
-    d2n_msg_free((AVD_DND_MSG *)queue_elem->snd_msg.info.svc_send.i_msg);
+    // Send the pending batch first to keep the order of the messages
+    if (it != batches.end()) {
+      rc = avd_d2n_msg_queue_elem_snd(it->second.queue_elem);
+      batches.erase(it);
+    }
+
+    rc = avd_d2n_msg_queue_elem_snd(queue_elem);
+  }
 
-    delete queue_elem;
+  for (const auto &batch : batches) {
+    if (batch.second.batch_msg != nullptr) {
+      TRACE("Sending %u SU-SI assignments to %x in one message",
+            batch.second.batch_msg->msg_info.d2n_su_si_assign_batch.num_msgs,
+            batch.second.batch_msg->msg_info.d2n_su_si_assign_batch.node_id);
+    }
+    rc = avd_d2n_msg_queue_elem_snd(batch.second.queue_elem);
   }
 
   return rc;
@@ -276,7 +361,15 @@ uint32_t avd_d2n_msg_snd(AVD_CL_CB *cb, AVD_AVND *nd_node,
   snd_mds.info.svc_send.i_sendtype = MDS_SENDTYPE_SND;
   snd_mds.info.svc_send.info.snd.i_to_dest = nd_node->adest;
 
-  avd_d2n_msg_enqueue(cb, &snd_mds);
+  // SU-SI assignments are batched to node directors supporting version 9
+  bool susi_batch = false;
+  if (snd_msg->msg_type == AVSV_D2N_INFO_SU_SI_ASSIGN_MSG) {
+    const auto it = nds_mds_ver_db.find(nd_node->node_info.nodeId);
+    susi_batch = (it != nds_mds_ver_db.end() &&
+                  it->second >= AVSV_AVD_AVND_MSG_FMT_VER_9);
+  }
+
+  avd_d2n_msg_enqueue(cb, &snd_mds, susi_batch);
 
   return NCSCC_RC_SUCCESS;
 }
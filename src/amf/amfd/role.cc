@@ -47,6 +47,7 @@
 #include "amf/amfd/cluster.h"
 #include "amf/amfd/clm.h"
 #include "amf/amfd/si_dep.h"
+#include "base/osaf_failover_timeline.h"
 #include "base/osaf_utility.h"
 #include "role.h"
 #include "nid/agent/nid_api.h"
@@ -381,6 +382,7 @@ static uint32_t avd_role_failover(AVD_CL_CB *cb, SaAmfHAStateT role) {
 
   TRACE_ENTER();
   LOG_NO("FAILOVER StandBy --> Active");
+  osaf_failover_timeline_mark("failover start");
 
   /* If we are in the middle of admin switch, ignore it */
   if (cb->swap_switch == true) {
@@ -430,6 +432,7 @@ static uint32_t avd_role_failover(AVD_CL_CB *cb, SaAmfHAStateT role) {
    * Queue to be processed, now drop all of them.
    */
   avsv_dequeue_async_update_msgs(cb, false);
+  osaf_failover_timeline_mark("checkpoints processed");
 
   /* Take mutex before changing role as it may impact logic
      in avd_imm_reinit_bg_thread. If mutex is taken for imm
@@ -460,6 +463,7 @@ static uint32_t avd_role_failover(AVD_CL_CB *cb, SaAmfHAStateT role) {
 
   /* Time to send fail-over messages to all the AVND's */
   avd_fail_over_event(cb);
+  osaf_failover_timeline_mark("node directors informed");
 
   /* We need to send the role to AvND. */
   status = avd_avnd_send_role_change(cb, cb->node_id_avd, cb->avail_state_avd);
@@ -502,6 +506,7 @@ static uint32_t avd_role_failover(AVD_CL_CB *cb, SaAmfHAStateT role) {
   avd_act_on_sis_in_tol_timer_state();
 
   LOG_NO("FAILOVER StandBy --> Active DONE!");
+  osaf_failover_timeline_mark("failover done");
   status = NCSCC_RC_SUCCESS;
 
 done:
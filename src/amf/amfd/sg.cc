@@ -436,8 +436,7 @@ static AVD_SG *sg_create(const std::string &sg_name,
 SaAisErrorT avd_sg_config_get(const std::string &app_dn, AVD_APP *app) {
   AVD_SG *sg;
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION, rc;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT dn;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfSG";
@@ -463,15 +462,8 @@ SaAisErrorT avd_sg_config_get(const std::string &app_dn, AVD_APP *app) {
 
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  rc = immutil_saImmOmSearchInitialize_o2(
-      avd_cb->immOmHandle, app_dn.c_str(), SA_IMM_SUBTREE,
-      SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR, &searchParam,
-      configAttributes, &searchHandle);
+  rc = search.initialize(app_dn, className, SA_IMM_SEARCH_GET_SOME_ATTR,
+                         configAttributes);
 
   if (SA_AIS_OK != rc) {
     LOG_ER("%s: saImmOmSearchInitialize_2 failed: %u", __FUNCTION__, rc);
@@ -479,9 +471,7 @@ SaAisErrorT avd_sg_config_get(const std::string &app_dn, AVD_APP *app) {
     goto done1;
   }
 
-  while ((rc = immutil_saImmOmSearchNext_2(
-              searchHandle, &dn, (SaImmAttrValuesT_2 ***)&attributes)) ==
-         SA_AIS_OK) {
+  while ((rc = search.next(&dn, &attributes)) == SA_AIS_OK) {
     if (!is_config_valid(Amf::to_string(&dn), attributes, nullptr)) {
       goto done2;
     }
@@ -508,7 +498,7 @@ SaAisErrorT avd_sg_config_get(const std::string &app_dn, AVD_APP *app) {
   }
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
@@ -776,8 +776,7 @@ done:
  */
 SaAisErrorT avd_si_config_get(AVD_APP *app) {
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION, rc;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT si_name;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfSI";
@@ -796,23 +795,14 @@ SaAisErrorT avd_si_config_get(AVD_APP *app) {
 
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  if ((rc = immutil_saImmOmSearchInitialize_o2(
-           avd_cb->immOmHandle, app->name.c_str(), SA_IMM_SUBTREE,
-           SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR, &searchParam,
-           configAttributes, &searchHandle)) != SA_AIS_OK) {
+  if ((rc = search.initialize(app->name, className, SA_IMM_SEARCH_GET_SOME_ATTR,
+                              configAttributes)) != SA_AIS_OK) {
     LOG_ER("%s: saImmOmSearchInitialize_2 failed: %u", __FUNCTION__, rc);
     error = rc;
     goto done1;
   }
 
-  while ((rc = immutil_saImmOmSearchNext_2(
-              searchHandle, &si_name, (SaImmAttrValuesT_2 ***)&attributes)) ==
-         SA_AIS_OK) {
+  while ((rc = search.next(&si_name, &attributes)) == SA_AIS_OK) {
     const std::string si_str(Amf::to_string(&si_name));
     if (!is_config_valid(si_str, attributes, nullptr)) goto done2;
 
@@ -852,7 +842,7 @@ SaAisErrorT avd_si_config_get(AVD_APP *app) {
   }
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
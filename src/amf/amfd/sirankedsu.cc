@@ -503,8 +503,7 @@ static SaAisErrorT sirankedsu_ccb_completed_cb(CcbUtilOperationData_t *opdata) {
 
 SaAisErrorT avd_sirankedsu_config_get(const std::string &si_name, AVD_SI *si) {
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfSIRankedSU";
   SaNameT dn;
@@ -513,22 +512,13 @@ SaAisErrorT avd_sirankedsu_config_get(const std::string &si_name, AVD_SI *si) {
 
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  if (immutil_saImmOmSearchInitialize_o2(
-          avd_cb->immOmHandle, si_name.c_str(), SA_IMM_SUBTREE,
-          SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_ALL_ATTR, &searchParam,
-          nullptr, &searchHandle) != SA_AIS_OK) {
+  if (search.initialize(si_name, className, SA_IMM_SEARCH_GET_ALL_ATTR,
+                        nullptr) != SA_AIS_OK) {
     LOG_ER("No objects found (1)");
     goto done1;
   }
 
-  while (immutil_saImmOmSearchNext_2(searchHandle, &dn,
-                                     (SaImmAttrValuesT_2 ***)&attributes) ==
-         SA_AIS_OK) {
+  while (search.next(&dn, &attributes) == SA_AIS_OK) {
     LOG_NO("'%s'", osaf_extended_name_borrow(&dn));
 
     if (immutil_getAttr(const_cast<SaImmAttrNameT>("saAmfRank"), attributes, 0,
@@ -556,7 +546,7 @@ SaAisErrorT avd_sirankedsu_config_get(const std::string &si_name, AVD_SI *si) {
   error = SA_AIS_OK;
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
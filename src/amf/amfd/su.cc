@@ -696,8 +696,7 @@ done:
 
 SaAisErrorT avd_su_config_get(const std::string &sg_name, AVD_SG *sg) {
   SaAisErrorT error = SA_AIS_ERR_FAILED_OPERATION, rc;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT tmp_su_name;
   std::string su_name;
   const SaImmAttrValuesT_2 **attributes;
@@ -715,15 +714,8 @@ SaAisErrorT avd_su_config_get(const std::string &sg_name, AVD_SG *sg) {
 
   TRACE_ENTER();
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  rc = immutil_saImmOmSearchInitialize_o2(
-      avd_cb->immOmHandle, sg_name.c_str(), SA_IMM_SUBTREE,
-      SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR, &searchParam,
-      configAttributes, &searchHandle);
+  rc = search.initialize(sg_name, className, SA_IMM_SEARCH_GET_SOME_ATTR,
+                         configAttributes);
 
   if (SA_AIS_OK != rc) {
     LOG_ER("%s: saImmOmSearchInitialize_2 failed: %u", __FUNCTION__, rc);
@@ -731,9 +723,7 @@ SaAisErrorT avd_su_config_get(const std::string &sg_name, AVD_SG *sg) {
     goto done1;
   }
 
-  while ((rc = immutil_saImmOmSearchNext_2(
-              searchHandle, &tmp_su_name,
-              (SaImmAttrValuesT_2 ***)&attributes)) == SA_AIS_OK) {
+  while ((rc = search.next(&tmp_su_name, &attributes)) == SA_AIS_OK) {
     su_name = Amf::to_string(&tmp_su_name);
     if (!is_config_valid(su_name, attributes, nullptr)) {
       goto done2;
@@ -778,7 +768,7 @@ SaAisErrorT avd_su_config_get(const std::string &sg_name, AVD_SG *sg) {
   }
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   TRACE_LEAVE2("%u", error);
   return error;
@@ -60,30 +60,20 @@ static AVD_SVC_TYPE_CS_TYPE *svctypecstypes_create(
 SaAisErrorT avd_svctypecstypes_config_get(const std::string &svctype_name) {
   AVD_SVC_TYPE_CS_TYPE *svctypecstype;
   SaAisErrorT error;
-  SaImmSearchHandleT searchHandle;
-  SaImmSearchParametersT_2 searchParam;
+  ConfigSearch search;
   SaNameT dn;
   const SaImmAttrValuesT_2 **attributes;
   const char *className = "SaAmfSvcTypeCSTypes";
 
-  searchParam.searchOneAttr.attrName =
-      const_cast<SaImmAttrNameT>("SaImmAttrClassName");
-  searchParam.searchOneAttr.attrValueType = SA_IMM_ATTR_SASTRINGT;
-  searchParam.searchOneAttr.attrValue = &className;
-
-  error = immutil_saImmOmSearchInitialize_o2(
-      avd_cb->immOmHandle, svctype_name.c_str(), SA_IMM_SUBTREE,
-      SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_ALL_ATTR, &searchParam,
-      nullptr, &searchHandle);
+  error = search.initialize(svctype_name, className, SA_IMM_SEARCH_GET_ALL_ATTR,
+                            nullptr);
 
   if (SA_AIS_OK != error) {
     LOG_ER("saImmOmSearchInitialize_2 failed: %u", error);
     goto done1;
   }
 
-  while (immutil_saImmOmSearchNext_2(searchHandle, &dn,
-                                     (SaImmAttrValuesT_2 ***)&attributes) ==
-         SA_AIS_OK) {
+  while (search.next(&dn, &attributes) == SA_AIS_OK) {
     if ((svctypecstype = svctypecstypes_db->find(Amf::to_string(&dn))) ==
         nullptr) {
       if ((svctypecstype = svctypecstypes_create(Amf::to_string(&dn),
@@ -98,7 +88,7 @@ SaAisErrorT avd_svctypecstypes_config_get(const std::string &svctype_name) {
   error = SA_AIS_OK;
 
 done2:
-  (void)immutil_saImmOmSearchFinalize(searchHandle);
+  search.finalize();
 done1:
   return error;
 }
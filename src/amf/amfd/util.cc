@@ -1807,6 +1807,14 @@ void d2n_msg_free(AVSV_DND_MSG *msg) {
     case AVSV_D2N_COMPCSI_ASSIGN_MSG:
       free_d2n_compcsi_info(msg);
       break;
+    case AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG:
+      while (msg->msg_info.d2n_su_si_assign_batch.list != nullptr) {
+        AVSV_DND_MSG_LIST *entry = msg->msg_info.d2n_su_si_assign_batch.list;
+        msg->msg_info.d2n_su_si_assign_batch.list = entry->next;
+        d2n_msg_free(entry->msg);
+        delete entry;
+      }
+      break;
     default:
       break;
   }
@@ -54,6 +54,8 @@ uint32_t avnd_comp_proxied_del(struct avnd_cb_tag *, struct avnd_comp_tag *,
                                struct avnd_pxied_rec *);
 uint32_t avnd_evt_avd_info_su_si_assign_evh(struct avnd_cb_tag *,
                                             struct avnd_evt_tag *);
+uint32_t avnd_evt_avd_su_si_assign_batch_evh(struct avnd_cb_tag *,
+                                             struct avnd_evt_tag *);
 uint32_t avnd_evt_avd_pg_track_act_rsp_evh(struct avnd_cb_tag *,
                                            struct avnd_evt_tag *);
 uint32_t avnd_evt_avd_pg_upd_evh(struct avnd_cb_tag *, struct avnd_evt_tag *);
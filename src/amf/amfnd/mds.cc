@@ -45,14 +45,16 @@ const MDS_CLIENT_MSG_FORMAT_VER avnd_avd_msg_fmt_map_table[] = {
     AVSV_AVD_AVND_MSG_FMT_VER_1, AVSV_AVD_AVND_MSG_FMT_VER_2,
     AVSV_AVD_AVND_MSG_FMT_VER_3, AVSV_AVD_AVND_MSG_FMT_VER_4,
     AVSV_AVD_AVND_MSG_FMT_VER_4, AVSV_AVD_AVND_MSG_FMT_VER_6,
-    AVSV_AVD_AVND_MSG_FMT_VER_7, AVSV_AVD_AVND_MSG_FMT_VER_8};
+    AVSV_AVD_AVND_MSG_FMT_VER_7, AVSV_AVD_AVND_MSG_FMT_VER_8,
+    AVSV_AVD_AVND_MSG_FMT_VER_9};
 
 /* messages from director */
 const MDS_CLIENT_MSG_FORMAT_VER avd_avnd_msg_fmt_map_table[] = {
     AVSV_AVD_AVND_MSG_FMT_VER_1, AVSV_AVD_AVND_MSG_FMT_VER_2,
     AVSV_AVD_AVND_MSG_FMT_VER_3, AVSV_AVD_AVND_MSG_FMT_VER_4,
     AVSV_AVD_AVND_MSG_FMT_VER_5, AVSV_AVD_AVND_MSG_FMT_VER_6,
-    AVSV_AVD_AVND_MSG_FMT_VER_7, AVSV_AVD_AVND_MSG_FMT_VER_8};
+    AVSV_AVD_AVND_MSG_FMT_VER_7, AVSV_AVD_AVND_MSG_FMT_VER_8,
+    AVSV_AVD_AVND_MSG_FMT_VER_9};
 
 const MDS_CLIENT_MSG_FORMAT_VER avnd_avnd_msg_fmt_map_table[] = {
     AVSV_AVND_AVND_MSG_FMT_VER_1};
@@ -383,6 +385,8 @@ uint32_t avnd_mds_rcv(AVND_CB *cb, MDS_CALLBACK_RECEIVE_INFO *rcv_info) {
         type = AVND_EVT_AVD_COMPCSI_ASSIGN_MSG;
       else if (msg.info.avd->msg_type == AVSV_D2N_CONTAINED_SU_MSG)
         type = AVND_EVT_AVD_CONTAINED_SU_MSG;
+      else if (msg.info.avd->msg_type == AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG)
+        type = AVND_EVT_AVD_SU_SI_ASSIGN_BATCH_MSG;
       else
         type = static_cast<AVND_EVT_TYPE>(
             (msg.info.avd->msg_type - AVSV_D2N_NODE_UP_MSG) +
@@ -472,6 +472,47 @@ done:
   return rc;
 }
 
+/****************************************************************************
+  Name          : avnd_evt_avd_su_si_assign_batch_evh
+
+  Description   : This routine processes a batch of SU-SI assignment messages
+                  from AvD. The messages are processed in order, each as if it
+                  was received alone.
+
+  Arguments     : cb  - ptr to the AvND control block
+                  evt - ptr to the AvND event
+
+  Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+
+  Notes         : None.
+******************************************************************************/
+uint32_t avnd_evt_avd_su_si_assign_batch_evh(AVND_CB *cb, AVND_EVT *evt) {
+  AVSV_DND_MSG *batch_msg = evt->info.avd;
+  AVSV_DND_MSG_LIST *entry;
+  uint32_t rc = NCSCC_RC_SUCCESS;
+
+  TRACE_ENTER2("%u assignments",
+               batch_msg->msg_info.d2n_su_si_assign_batch.num_msgs);
+
+  for (entry = batch_msg->msg_info.d2n_su_si_assign_batch.list;
+       entry != nullptr; entry = entry->next) {
+    if (entry->msg->msg_type != AVSV_D2N_INFO_SU_SI_ASSIGN_MSG) {
+      LOG_ER("%s: unexpected message type %u", __FUNCTION__,
+             entry->msg->msg_type);
+      continue;
+    }
+
+    // The event keeps the batch, the message stays owned by it
+    evt->info.avd = entry->msg;
+    if (avnd_evt_avd_info_su_si_assign_evh(cb, evt) != NCSCC_RC_SUCCESS)
+      rc = NCSCC_RC_FAILURE;
+  }
+  evt->info.avd = batch_msg;
+
+  TRACE_LEAVE2("%u", rc);
+  return rc;
+}
+
 /****************************************************************************
   Name          : avnd_evt_tmr_su_err_esc
 
@@ -60,6 +60,10 @@ uint32_t avsv_edp_susi_asgn(EDU_HDL *hdl, EDU_TKN *edu_tkn, NCSCONTEXT ptr,
                             uint32_t *ptr_data_len, EDU_BUF_ENV *buf_env,
                             EDP_OP_TYPE op, EDU_ERR *o_err);
 
+uint32_t avsv_edp_dnd_msg_list(EDU_HDL *hdl, EDU_TKN *edu_tkn, NCSCONTEXT ptr,
+                               uint32_t *ptr_data_len, EDU_BUF_ENV *buf_env,
+                               EDP_OP_TYPE op, EDU_ERR *o_err);
+
 uint32_t avsv_edp_sisu_state_info_msg(EDU_HDL *hdl, EDU_TKN *edu_tkn,
                                       NCSCONTEXT ptr, uint32_t *ptr_data_len,
                                       EDU_BUF_ENV *buf_env, EDP_OP_TYPE op,
@@ -53,6 +53,7 @@ extern "C" {
 #define AVSV_AVD_AVND_MSG_FMT_VER_6 6
 #define AVSV_AVD_AVND_MSG_FMT_VER_7 7
 #define AVSV_AVD_AVND_MSG_FMT_VER_8 8
+#define AVSV_AVD_AVND_MSG_FMT_VER_9 9
 
 /* Internode/External Components Validation result */
 typedef enum {
@@ -112,6 +113,7 @@ typedef enum {
   AVSV_N2D_ND_CSICOMP_STATE_INFO_MSG,
   AVSV_D2N_COMPCSI_ASSIGN_MSG,
   AVSV_D2N_CONTAINED_SU_MSG,
+  AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG,
   AVSV_DND_MSG_MAX
 } AVSV_DND_MSG_TYPE;
 
@@ -677,6 +679,22 @@ typedef struct avsv_d2n_compcsi_assign_msg {
   } info;
 } AVSV_D2N_COMPCSI_ASSIGN_MSG_INFO;
 
+typedef struct avsv_dnd_msg_list_tag {
+  struct avsv_dnd_msg *msg;
+  struct avsv_dnd_msg_list_tag *next;
+} AVSV_DND_MSG_LIST;
+
+/*
+        Message structure to send several AVSV_D2N_INFO_SU_SI_ASSIGN_MSG
+        messages to AMFND in one message, in the order they are to be
+        processed. Sent to AMFND supporting version 9 and higher.
+*/
+typedef struct avsv_d2n_su_si_assign_batch_msg_info_tag {
+  SaClmNodeIdT node_id;
+  uint32_t num_msgs;
+  AVSV_DND_MSG_LIST *list;
+} AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG_INFO;
+
 typedef struct avsv_dnd_msg {
   AVSV_DND_MSG_TYPE msg_type;
   union {
@@ -712,6 +730,7 @@ typedef struct avsv_dnd_msg {
     AVSV_D2N_REBOOT_MSG_INFO d2n_reboot_info;
     AVSV_D2N_COMPCSI_ASSIGN_MSG_INFO d2n_compcsi_assign_msg_info;
     AVSV_D2N_CONTAINED_SU_MSG_INFO d2n_contained_su_msg_info;
+    AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG_INFO d2n_su_si_assign_batch;
   } msg_info;
 } AVSV_DND_MSG;
 
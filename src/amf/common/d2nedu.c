@@ -575,6 +575,19 @@ uint32_t avsv_edp_dnd_msg(EDU_HDL *hdl, EDU_TKN *edu_tkn, NCSCONTEXT ptr,
              (long)&((AVSV_DND_MSG *)0)->
 		 msg_info.d2n_contained_su_msg_info.term_state, 0, NULL},
 
+	    /* AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG_INFO */
+	    {EDU_EXEC, m_NCS_EDP_SACLMNODEIDT, 0, 0, 0,
+	     (long)&((AVSV_DND_MSG *)0)
+		 ->msg_info.d2n_su_si_assign_batch.node_id,
+	     0, NULL},
+	    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+	     (long)&((AVSV_DND_MSG *)0)
+		 ->msg_info.d2n_su_si_assign_batch.num_msgs,
+	     0, NULL},
+	    {EDU_EXEC, avsv_edp_dnd_msg_list, EDQ_POINTER, 0, EDU_EXIT,
+	     (long)&((AVSV_DND_MSG *)0)->msg_info.d2n_su_si_assign_batch.list,
+	     0, NULL},
+
 	    {EDU_END, 0, 0, 0, 0, 0, 0, NULL},
 	};
 
@@ -644,7 +657,8 @@ int avsv_dnd_msg_test_type_fnc(NCSCONTEXT arg)
 	       LCL_JMP_OFFSET_AVSV_N2D_ND_SISU_STATE_INFO_MSG = 125,
 	       LCL_JMP_OFFSET_AVSV_N2D_ND_CSICOMP_STATE_INFO_MSG = 131,
 	       LCL_JMP_OFFSET_AVSV_D2N_COMPCSI_ASSIGN_MSG = 137,
-	       LCL_JMP_OFFSET_AVSV_D2N_CONTAINED_SU_MSG = 143 };
+	       LCL_JMP_OFFSET_AVSV_D2N_CONTAINED_SU_MSG = 143,
+	       LCL_JMP_OFFSET_AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG = 148 };
 	AVSV_DND_MSG_TYPE type;
 
 	if (arg == NULL)
@@ -717,6 +731,8 @@ int avsv_dnd_msg_test_type_fnc(NCSCONTEXT arg)
 		return LCL_JMP_OFFSET_AVSV_D2N_COMPCSI_ASSIGN_MSG;
 	case AVSV_D2N_CONTAINED_SU_MSG:
 		return LCL_JMP_OFFSET_AVSV_D2N_CONTAINED_SU_MSG;
+	case AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG:
+		return LCL_JMP_OFFSET_AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG;
 
 	default:
 		break;
@@ -1060,6 +1076,57 @@ uint32_t avsv_edp_susi_asgn(EDU_HDL *hdl, EDU_TKN *edu_tkn, NCSCONTEXT ptr,
 				 ptr_data_len, buf_env, op, o_err);
 	return rc;
 }
+
+/*****************************************************************************
+
+  PROCEDURE NAME:   avsv_edp_dnd_msg_list
+
+  DESCRIPTION:      EDU program handler for "AVSV_DND_MSG_LIST" data. This
+		    function is invoked by EDU for performing encode/decode
+		    operation on "AVSV_DND_MSG_LIST" data.
+
+  RETURNS:          NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+
+*****************************************************************************/
+uint32_t avsv_edp_dnd_msg_list(EDU_HDL *hdl, EDU_TKN *edu_tkn, NCSCONTEXT ptr,
+			       uint32_t *ptr_data_len, EDU_BUF_ENV *buf_env,
+			       EDP_OP_TYPE op, EDU_ERR *o_err)
+{
+	uint32_t rc = NCSCC_RC_SUCCESS;
+	AVSV_DND_MSG_LIST *struct_ptr = NULL, **d_ptr = NULL;
+
+	EDU_INST_SET avsv_dnd_msg_list_rules[] = {
+	    {EDU_START, avsv_edp_dnd_msg_list, EDQ_LNKLIST, 0, 0,
+	     sizeof(AVSV_DND_MSG_LIST), 0, NULL},
+
+	    {EDU_EXEC, avsv_edp_dnd_msg, EDQ_POINTER, 0, 0,
+	     (long)&((AVSV_DND_MSG_LIST *)0)->msg, 0, NULL},
+
+	    {EDU_TEST_LL_PTR, avsv_edp_dnd_msg_list, 0, 0, 0,
+	     (long)&((AVSV_DND_MSG_LIST *)0)->next, 0, NULL},
+	    {EDU_END, 0, 0, 0, 0, 0, 0, NULL},
+	};
+
+	if (op == EDP_OP_TYPE_ENC) {
+		struct_ptr = (AVSV_DND_MSG_LIST *)ptr;
+	} else if (op == EDP_OP_TYPE_DEC) {
+		d_ptr = (AVSV_DND_MSG_LIST **)ptr;
+		if (*d_ptr == NULL) {
+			*d_ptr = malloc(sizeof(AVSV_DND_MSG_LIST));
+			if (*d_ptr == NULL) {
+				*o_err = EDU_ERR_MEM_FAIL;
+				return NCSCC_RC_FAILURE;
+			}
+		}
+		memset(*d_ptr, '\0', sizeof(AVSV_DND_MSG_LIST));
+		struct_ptr = *d_ptr;
+	} else {
+		struct_ptr = ptr;
+	}
+	rc = m_NCS_EDU_RUN_RULES(hdl, edu_tkn, avsv_dnd_msg_list_rules,
+				 struct_ptr, ptr_data_len, buf_env, op, o_err);
+	return rc;
+}
 /*****************************************************************************
 
   PROCEDURE NAME:   avsv_edp_sisu_state_info_msg
@@ -563,6 +563,82 @@ static void free_d2n_compcsi_info(AVSV_DND_MSG *compcsi_msg)
 	}
 }
 
+/*****************************************************************************
+ * Function: free_d2n_susi_batch_msg_info
+ *
+ * Purpose:  This function frees the SU SI messages of a d2n SU SI batch
+ *           message.
+ *
+ * Input: batch_msg - Pointer to the batch message contents to be freed.
+ *
+ * Returns: None
+ *
+ * NOTES: None
+ *
+ *
+ **************************************************************************/
+
+static void free_d2n_susi_batch_msg_info(AVSV_DND_MSG *batch_msg)
+{
+	AVSV_DND_MSG_LIST *entry;
+
+	while (batch_msg->msg_info.d2n_su_si_assign_batch.list != NULL) {
+		entry = batch_msg->msg_info.d2n_su_si_assign_batch.list;
+		batch_msg->msg_info.d2n_su_si_assign_batch.list = entry->next;
+		avsv_dnd_msg_free(entry->msg);
+		free(entry);
+	}
+}
+
+/*****************************************************************************
+ * Function: cpy_d2n_susi_batch_msg
+ *
+ * Purpose:  This function makes a copy of the SU SI messages of a d2n SU SI
+ *           batch message, in the same order.
+ *
+ * Input: d_batch_msg - Pointer to the batch message to be copied to.
+ *        s_batch_msg - Pointer to the batch message to be copied.
+ *
+ * Returns: NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ *
+ * NOTES: None
+ *
+ **************************************************************************/
+
+static uint32_t cpy_d2n_susi_batch_msg(AVSV_DND_MSG *d_batch_msg,
+				       AVSV_DND_MSG *s_batch_msg)
+{
+	AVSV_DND_MSG_LIST *s_entry, *d_entry;
+	AVSV_DND_MSG_LIST **tail;
+
+	tail = &d_batch_msg->msg_info.d2n_su_si_assign_batch.list;
+	*tail = NULL;
+
+	for (s_entry = s_batch_msg->msg_info.d2n_su_si_assign_batch.list;
+	     s_entry != NULL; s_entry = s_entry->next) {
+		d_entry = calloc(1, sizeof(AVSV_DND_MSG_LIST));
+		if (d_entry == NULL) {
+			free_d2n_susi_batch_msg_info(d_batch_msg);
+			return NCSCC_RC_FAILURE;
+		}
+
+		d_entry->msg = malloc(sizeof(AVSV_DND_MSG));
+		if (d_entry->msg == NULL ||
+		    avsv_dnd_msg_copy(d_entry->msg, s_entry->msg) !=
+			NCSCC_RC_SUCCESS) {
+			free(d_entry->msg);
+			free(d_entry);
+			free_d2n_susi_batch_msg_info(d_batch_msg);
+			return NCSCC_RC_FAILURE;
+		}
+
+		*tail = d_entry;
+		tail = &d_entry->next;
+	}
+
+	return NCSCC_RC_SUCCESS;
+}
+
 /****************************************************************************
   Name          : avsv_dnd_msg_free
 
@@ -675,6 +751,9 @@ void avsv_dnd_msg_free(AVSV_DND_MSG *msg)
 	case AVSV_D2N_COMPCSI_ASSIGN_MSG:
 		free_d2n_compcsi_info(msg);
 		break;
+	case AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG:
+		free_d2n_susi_batch_msg_info(msg);
+		break;
 	default:
 		break;
 	}
@@ -721,6 +800,8 @@ uint32_t avsv_dnd_msg_copy(AVSV_DND_MSG *dmsg, AVSV_DND_MSG *smsg)
 		return cpy_d2n_susi_msg(dmsg, smsg);
 	case AVSV_D2N_PG_TRACK_ACT_RSP_MSG:
 		return cpy_d2n_pg_msg(dmsg, smsg);
+	case AVSV_D2N_SU_SI_ASSIGN_BATCH_MSG:
+		return cpy_d2n_susi_batch_msg(dmsg, smsg);
 	case AVSV_D2N_PG_UPD_MSG:
 		osaf_extended_name_alloc(
 		    osaf_extended_name_borrow(
@@ -0,0 +1,130 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#include "base/osaf_failover_timeline.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "base/osaf_time.h"
+
+static pthread_once_t timeline_once = PTHREAD_ONCE_INIT;
+static struct OsafFailoverTimeline *timeline;
+
+static void *map_timeline(int oflag, int prot)
+{
+	void *addr;
+	int fd;
+
+	do {
+		fd = shm_open(OSAF_FAILOVER_TIMELINE_SHM, oflag, 0664);
+	} while (fd == -1 && errno == EINTR);
+	if (fd == -1)
+		return NULL;
+
+	if ((oflag & O_CREAT) != 0) {
+		/* The record is shared by daemons running as different users */
+		(void)fchmod(fd, 0664);
+		if (ftruncate(fd, sizeof(struct OsafFailoverTimeline)) != 0) {
+			close(fd);
+			return NULL;
+		}
+	}
+
+	addr = mmap(NULL, sizeof(struct OsafFailoverTimeline), prot,
+		    MAP_SHARED, fd, 0);
+	close(fd);
+	return addr != MAP_FAILED ? addr : NULL;
+}
+
+static void init_timeline(void)
+{
+	struct OsafFailoverTimeline *t;
+	uint32_t expected = 0;
+
+	t = map_timeline(O_RDWR | O_CREAT, PROT_READ | PROT_WRITE);
+	if (t == NULL)
+		return;
+
+	/* A new record is all zeroes and only needs the magic number */
+	if (!__atomic_compare_exchange_n(&t->magic, &expected,
+					 kOsafFailoverTimelineMagic, false,
+					 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) &&
+	    expected != kOsafFailoverTimelineMagic) {
+		munmap(t, sizeof(struct OsafFailoverTimeline));
+		return;
+	}
+	timeline = t;
+}
+
+static void record_stage(const char *i_stage, bool i_begin)
+{
+	struct OsafFailoverStage *s;
+	uint64_t sequence;
+	uint32_t failover;
+
+	pthread_once(&timeline_once, init_timeline);
+	if (timeline == NULL)
+		return;
+
+	if (i_begin) {
+		failover = __atomic_add_fetch(&timeline->failover, 1,
+					      __ATOMIC_ACQ_REL);
+	} else {
+		failover =
+		    __atomic_load_n(&timeline->failover, __ATOMIC_ACQUIRE);
+	}
+	sequence = __atomic_add_fetch(&timeline->stages, 1, __ATOMIC_ACQ_REL);
+	s = &timeline->stage[(sequence - 1) % kOsafFailoverTimelineSize];
+
+	/* Readers skip the stage until its sequence number is published */
+	__atomic_store_n(&s->sequence, 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	osaf_clock_gettime(CLOCK_MONOTONIC, &s->monotonic);
+	osaf_clock_gettime(CLOCK_REALTIME, &s->realtime);
+	s->failover = failover;
+	s->pid = getpid();
+	strncpy(s->process, program_invocation_short_name,
+		sizeof(s->process) - 1);
+	s->process[sizeof(s->process) - 1] = '\0';
+	strncpy(s->stage, i_stage, sizeof(s->stage) - 1);
+	s->stage[sizeof(s->stage) - 1] = '\0';
+	__atomic_store_n(&s->sequence, sequence, __ATOMIC_RELEASE);
+}
+
+void osaf_failover_timeline_begin(const char *i_stage)
+{
+	record_stage(i_stage, true);
+}
+
+void osaf_failover_timeline_mark(const char *i_stage)
+{
+	record_stage(i_stage, false);
+}
+
+const struct OsafFailoverTimeline *osaf_failover_timeline_open(void)
+{
+	const struct OsafFailoverTimeline *t;
+
+	t = map_timeline(O_RDONLY, PROT_READ);
+	if (t != NULL && t->magic != kOsafFailoverTimelineMagic) {
+		munmap((void *)t, sizeof(struct OsafFailoverTimeline));
+		return NULL;
+	}
+	return t;
+}
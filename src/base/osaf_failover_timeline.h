@@ -0,0 +1,109 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/** @file
+ *
+ * This file contains functions for recording the timeline of controller
+ * failovers. The stages of a failover are recorded by the daemons taking part
+ * in it into a record in shared memory, common to all OpenSAF processes on the
+ * node. Each stage is stored with monotonic and realtime timestamps, the
+ * process that recorded it and the number of the failover it belongs to. The
+ * record keeps the last kOsafFailoverTimelineSize stages and is printed by the
+ * rdetimeline tool.
+ *
+ * The definitions in this file are for internal use within OpenSAF only.
+ */
+
+#ifndef BASE_OSAF_FAILOVER_TIMELINE_H_
+#define BASE_OSAF_FAILOVER_TIMELINE_H_
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OSAF_FAILOVER_TIMELINE_SHM "/opensaf_failover_timeline"
+
+enum {
+  kOsafFailoverTimelineMagic = 0x4f465431,
+  kOsafFailoverTimelineSize = 512,
+  kOsafFailoverProcessLength = 16,
+  kOsafFailoverStageLength = 48
+};
+
+/**
+ * A stage of a failover, as stored in shared memory.
+ */
+struct OsafFailoverStage {
+  /* Number of the stage since the record was created, 0 while the stage is
+   * being written */
+  uint64_t sequence;
+  /* Number of the failover the stage belongs to, 0 for stages recorded
+   * before the first failover */
+  uint32_t failover;
+  uint32_t pid;
+  struct timespec monotonic;
+  struct timespec realtime;
+  char process[kOsafFailoverProcessLength];
+  char stage[kOsafFailoverStageLength];
+};
+
+/**
+ * The record in shared memory.
+ */
+struct OsafFailoverTimeline {
+  uint32_t magic;
+  /* Number of the latest failover */
+  uint32_t failover;
+  /* Number of stages recorded, the stage with sequence number n is stored at
+   * index (n - 1) % kOsafFailoverTimelineSize */
+  uint64_t stages;
+  struct OsafFailoverStage stage[kOsafFailoverTimelineSize];
+};
+
+/**
+ * @brief Start a new failover and record its first stage.
+ *
+ * Called where a failover is detected, e.g. when the peer controller goes
+ * down. The stages recorded after this call, by any process on the node,
+ * belong to the new failover.
+ */
+extern void osaf_failover_timeline_begin(const char* i_stage);
+
+/**
+ * @brief Record a stage of the current failover.
+ *
+ * The name of the calling process is recorded with the stage. The call is
+ * cheap and never blocks, it is silently ignored if the record is not
+ * available.
+ */
+extern void osaf_failover_timeline_mark(const char* i_stage);
+
+/**
+ * @brief Map the record for reading.
+ *
+ * Returns NULL if the record does not exist. Stages may be written while the
+ * record is read, a stage is consistent if its sequence number is the same
+ * before and after it is copied.
+ */
+extern const struct OsafFailoverTimeline* osaf_failover_timeline_open(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BASE_OSAF_FAILOVER_TIMELINE_H_
@@ -3559,6 +3559,7 @@ saCkptSectionIterationNext(SaCkptSectionIterationHandleT sectionIterationHandle,
 	bool is_local_get_next = false;
 	CPA_CLIENT_NODE *cl_node = NULL;
 	CPA_LOCAL_CKPT_NODE *lc_node = NULL;
+	SaCkptSectionDescriptorT *desc = NULL;
 
 	if (sectionDescriptor == NULL)
 		return SA_AIS_ERR_INVALID_PARAM;
@@ -3718,6 +3719,25 @@ saCkptSectionIterationNext(SaCkptSectionIterationHandleT sectionIterationHandle,
 		}
 	}
 
+	/* Return the next section prefetched from CPND, if any */
+	if (sect_iter_node->next_desc < sect_iter_node->num_descs) {
+		desc = &sect_iter_node->descs[sect_iter_node->next_desc++];
+		if (sect_iter_node->section_id.id) {
+			/* EDU Library forced us to use NCS_SERVICE_ID_CPND for
+			 * freeing section_id.id */
+			m_MMGR_FREE_CPSV_DEFAULT_VAL(
+			    sect_iter_node->section_id.id, NCS_SERVICE_ID_CPND);
+		}
+		*sectionDescriptor = *desc;
+		sect_iter_node->section_id = desc->sectionId;
+		desc->sectionId.id = NULL;
+		m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
+		TRACE_1(
+		    "Cpa SectIterNext Api Success with return value:%d,sectionInterationHandle:%llx",
+		    rc, sectionIterationHandle);
+		goto prefetched;
+	}
+
 	/* Populate the event & send it to CPND */
 	memset(&evt, 0, sizeof(CPSV_EVT));
 	evt.type = CPSV_EVT_TYPE_CPND;
@@ -3729,6 +3749,7 @@ saCkptSectionIterationNext(SaCkptSectionIterationHandleT sectionIterationHandle,
 	evt.info.cpnd.info.iter_getnext.n_secs_trav =
 	    sect_iter_node->n_secs_trav;
 	evt.info.cpnd.info.iter_getnext.exp_tmr = sect_iter_node->exp_time;
+	evt.info.cpnd.info.iter_getnext.batch_size = cb->sect_iter_batch;
 
 	m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 	if (is_local_get_next == false) {
@@ -3780,6 +3801,15 @@ saCkptSectionIterationNext(SaCkptSectionIterationHandleT sectionIterationHandle,
 			sect_iter_node->section_id =
 			    out_evt->info.cpa.info.iter_next_rsp.sect_desc
 				.sectionId;
+
+			/* Keep the following sections for the next calls */
+			cpa_sect_iter_node_descs_free(sect_iter_node);
+			sect_iter_node->descs =
+			    out_evt->info.cpa.info.iter_next_rsp.descs;
+			sect_iter_node->num_descs =
+			    out_evt->info.cpa.info.iter_next_rsp.num_descs;
+			out_evt->info.cpa.info.iter_next_rsp.descs = NULL;
+			out_evt->info.cpa.info.iter_next_rsp.num_descs = 0;
 			if (sect_iter_node->out_evt != NULL) {
 				m_MMGR_FREE_CPSV_EVT(sect_iter_node->out_evt,
 						     NCS_SERVICE_ID_CPA);
@@ -3800,6 +3830,7 @@ saCkptSectionIterationNext(SaCkptSectionIterationHandleT sectionIterationHandle,
 		    "Cpa SectIterNext Api failed with return value:%d,sectionInterationHandle:%llx",
 		    rc, sectionIterationHandle);
 	}
+prefetched:
 sect_iter_get_fail:
 fail1:
 lock_fail:
@@ -76,6 +76,11 @@ typedef struct cpa_sect_iter_node {
 
   /* current section the iterator pointing to */
   SaCkptSectionIdT section_id;
+
+  /* Sections prefetched from CPND, returned from descs[next_desc] on */
+  SaCkptSectionDescriptorT *descs;
+  uint32_t num_descs;
+  uint32_t next_desc;
 } CPA_SECT_ITER_NODE;
 
 /*****************************************************************************
@@ -110,6 +115,8 @@ typedef struct cpa_cb {
 
   NCS_PATRICIA_TREE sect_iter_tree; /* CPA_SECT_ITER_NODE - node */
   bool is_sect_iter_tree_up;
+  /* Max number of sections fetched from CPND per iteration request */
+  uint32_t sect_iter_batch;
   NCS_QUEUE cpa_evt_process_queue;
 
   /* Sync up with CPND ( MDS ) */
@@ -146,11 +153,15 @@ typedef struct cpa_prcess_evt_sync {
 #define m_CPA_IS_COLLOCATED_ATTR_SET(attr) \
   (((attr & SA_CKPT_CHECKPOINT_COLLOCATED) != 0) ? true : false)
 
+/* Default number of sections fetched from CPND per iteration request,
+   overridden by OSAF_CKPT_SECT_ITER_BATCH. 1 disables prefetching */
+#define CPA_SECT_ITER_BATCH 512
+
 /*30B Versioning Changes */
-#define CPA_MDS_PVT_SUBPART_VERSION 4
+#define CPA_MDS_PVT_SUBPART_VERSION 5
 /*CPA - CPND communication */
 #define CPA_WRT_CPND_SUBPART_VER_MIN 1
-#define CPA_WRT_CPND_SUBPART_VER_MAX 4
+#define CPA_WRT_CPND_SUBPART_VER_MAX 7
 
 #define CPA_WRT_CPND_SUBPART_VER_RANGE \
   (CPA_WRT_CPND_SUBPART_VER_MAX - CPA_WRT_CPND_SUBPART_VER_MIN + 1)
@@ -205,6 +216,7 @@ uint32_t cpa_sect_iter_node_add(NCS_PATRICIA_TREE *sect_iter_tree,
                                 CPA_SECT_ITER_NODE *sect_iter_node);
 uint32_t cpa_sect_iter_node_delete(CPA_CB *cb,
                                    CPA_SECT_ITER_NODE *sect_iter_node);
+void cpa_sect_iter_node_descs_free(CPA_SECT_ITER_NODE *sect_iter_node);
 void cpa_sect_iter_tree_destroy(CPA_CB *cb);
 void cpa_sect_iter_node_getnext(NCS_PATRICIA_TREE *sect_iter_tree,
                                 SaCkptSectionIterationHandleT *sect_iter_hdl,
@@ -588,6 +588,7 @@ uint32_t cpa_sect_iter_node_delete(CPA_CB *cb,
 
 	/* Free the Client Node */
 	if (sect_iter_node) {
+		cpa_sect_iter_node_descs_free(sect_iter_node);
 		if (sect_iter_node->section_id.id) {
 			m_MMGR_FREE_CPSV_DEFAULT_VAL(
 			    sect_iter_node->section_id.id, NCS_SERVICE_ID_CPND);
@@ -602,6 +603,33 @@ uint32_t cpa_sect_iter_node_delete(CPA_CB *cb,
 	return rc;
 }
 
+/****************************************************************************
+  Name          : cpa_sect_iter_node_descs_free
+  Description   : This routine frees the sections prefetched by a Section
+		  Iteration node, that are not yet returned.
+  Arguments     : CPA_SECT_ITER_NODE *sect_iter_node - Section Iteration Node.
+  Return Values : None
+  Notes         : None
+******************************************************************************/
+void cpa_sect_iter_node_descs_free(CPA_SECT_ITER_NODE *sect_iter_node)
+{
+	uint32_t i;
+
+	for (i = sect_iter_node->next_desc; i < sect_iter_node->num_descs;
+	     i++) {
+		/* EDU Library forced us to use NCS_SERVICE_ID_CPND for
+		 * freeing section ids */
+		if (sect_iter_node->descs[i].sectionId.id)
+			m_MMGR_FREE_CPSV_DEFAULT_VAL(
+			    sect_iter_node->descs[i].sectionId.id,
+			    NCS_SERVICE_ID_CPND);
+	}
+	free(sect_iter_node->descs);
+	sect_iter_node->descs = NULL;
+	sect_iter_node->num_descs = 0;
+	sect_iter_node->next_desc = 0;
+}
+
 /****************************************************************************
   Name          : cpa_gbl_ckpt_tree_destroy
   Description   : This routine destroys the CPA Section Iteration tree.
@@ -126,6 +126,7 @@ void cpa_sync_with_cpnd(CPA_CB *cb)
 static uint32_t cpa_create(NCS_LIB_CREATE *create_info)
 {
 	CPA_CB *cb = NULL;
+	const char *value;
 	uint32_t rc;
 
 	/* validate create info */
@@ -155,6 +156,14 @@ static uint32_t cpa_create(NCS_LIB_CREATE *create_info)
 	/* get the process id */
 	cb->process_id = getpid();
 
+	/* Number of sections to prefetch during section iteration */
+	if ((value = getenv("OSAF_CKPT_SECT_ITER_BATCH")) != NULL)
+		cb->sect_iter_batch = atoi(value);
+	else
+		cb->sect_iter_batch = CPA_SECT_ITER_BATCH;
+	if (cb->sect_iter_batch > CPSV_SECT_ITER_BATCH_MAX)
+		cb->sect_iter_batch = CPSV_SECT_ITER_BATCH_MAX;
+
 	/* initialize the cpa cb lock */
 	if (m_NCS_LOCK_INIT(&cb->cb_lock) != NCSCC_RC_SUCCESS) {
 		TRACE_4("cpa create failed in LOCK_INIT ");
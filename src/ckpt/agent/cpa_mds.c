@@ -44,9 +44,11 @@ static uint32_t cpa_mds_dec(CPA_CB *cb, MDS_CALLBACK_DEC_FLAT_INFO *info);
 
 FUNC_DECLARATION(CPSV_EVT);
 
-/* Message Format Verion Tables at CPND */
+/* Message Format Verion Tables at CPND. CPND versions 5 and 6 did not change
+ * the CPA - CPND message format */
 MDS_CLIENT_MSG_FORMAT_VER
-    cpa_cpnd_msg_fmt_table[CPA_WRT_CPND_SUBPART_VER_RANGE] = {1, 2, 3, 4};
+    cpa_cpnd_msg_fmt_table[CPA_WRT_CPND_SUBPART_VER_RANGE] = {1, 2, 3, 4,
+							       4, 4, 5};
 
 MDS_CLIENT_MSG_FORMAT_VER cpa_cpd_msg_fmt_table[CPA_WRT_CPD_SUBPART_VER_RANGE] =
     {1, 2};
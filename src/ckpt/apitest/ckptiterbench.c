@@ -0,0 +1,237 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the time of a full
+ * saCkptSectionIterationNext scan of a checkpoint, for a growing number of
+ * sections.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <libgen.h>
+
+#include <saAis.h>
+#include <saCkpt.h>
+#include "base/osaf_time.h"
+#include "osaf/apitest/bench.h"
+
+#define BENCH_CKPT_NAME "safCkpt=ckptiterbench"
+
+static SaVersionT ckptVersion = {'B', 2, 2};
+static unsigned int sectionCounts[BENCH_MAX_COUNTS] = {1000, 10000, 100000};
+static unsigned int numCounts = 3;
+static unsigned int sectionSize = 64;
+static unsigned int numIterations = 1;
+static SaCkptCheckpointCreationFlagsT creationFlags = SA_CKPT_WR_ALL_REPLICAS;
+static const char *ckptName = BENCH_CKPT_NAME;
+
+static void usage(const char *progname)
+{
+	static const char *const options[] = {
+	    "-s, --sections <list>  comma separated section counts (default 1000,10000,100000)",
+	    "-z, --size <n>         section size in bytes (default 64)",
+	    "-r, --repeat <n>       iterations per section count (default 1)",
+	    "-c, --collocated       create a collocated checkpoint",
+	    "-n, --name <name>      checkpoint (default " BENCH_CKPT_NAME ")",
+	    NULL};
+
+	bench_usage(
+	    progname, "measure the CKPT section iteration time",
+	    "is a CKPT test client creating a checkpoint with a growing\n"
+	    "\tnumber of sections, iterating over all sections at each section\n"
+	    "\tcount and reporting the time of an iteration. The number of\n"
+	    "\tsections prefetched per request to the checkpoint node director\n"
+	    "\tis set with the environment variable OSAF_CKPT_SECT_ITER_BATCH,\n"
+	    "\twhere 1 fetches one section per request.\n",
+	    options, "-s 1000,200000");
+}
+
+static void create_sections(SaCkptCheckpointHandleT ckptHandle,
+			    unsigned int first, unsigned int last,
+			    const char *data)
+{
+	SaCkptSectionCreationAttributesT attr;
+	SaCkptSectionIdT id;
+	char idbuf[32];
+	unsigned int i;
+	SaAisErrorT rc;
+
+	attr.sectionId = &id;
+	attr.expirationTime = SA_TIME_END;
+	for (i = first; i < last; ++i) {
+		id.idLen = snprintf(idbuf, sizeof(idbuf), "s%u", i);
+		id.id = (SaUint8T *)idbuf;
+		rc = saCkptSectionCreate(ckptHandle, &attr, data, sectionSize);
+		if (rc != SA_AIS_OK)
+			bench_fail("saCkptSectionCreate", rc);
+	}
+}
+
+static unsigned int iterate_sections(SaCkptCheckpointHandleT ckptHandle)
+{
+	SaCkptSectionIterationHandleT iterHandle;
+	SaCkptSectionDescriptorT desc;
+	unsigned int count = 0;
+	SaAisErrorT rc;
+
+	rc = saCkptSectionIterationInitialize(ckptHandle, SA_CKPT_SECTIONS_ANY,
+					      0, &iterHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saCkptSectionIterationInitialize", rc);
+
+	while ((rc = saCkptSectionIterationNext(iterHandle, &desc)) ==
+	       SA_AIS_OK)
+		count++;
+	if (rc != SA_AIS_ERR_NO_SECTIONS)
+		bench_fail("saCkptSectionIterationNext", rc);
+
+	rc = saCkptSectionIterationFinalize(iterHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saCkptSectionIterationFinalize", rc);
+
+	return count;
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"sections", required_argument, 0, 's'},
+					{"size", required_argument, 0, 'z'},
+					{"repeat", required_argument, 0, 'r'},
+					{"collocated", no_argument, 0, 'c'},
+					{"name", required_argument, 0, 'n'},
+					{0, 0, 0, 0}};
+	SaCkptHandleT ckptSvcHandle;
+	SaCkptCheckpointHandleT ckptHandle;
+	SaCkptCheckpointCreationAttributesT attr;
+	struct timespec start, end, elapsed;
+	unsigned int i, j, count, maxSections = 0, numSections = 0;
+	SaNameT name;
+	char *data;
+	double secs;
+	SaAisErrorT rc;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "hs:z:r:cn:", long_options,
+				NULL)) != -1) {
+		switch (c) {
+		case 's':
+			numCounts = bench_parse_counts(
+			    optarg, sectionCounts, "section");
+			break;
+		case 'z':
+			sectionSize = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			numIterations = strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			creationFlags |= SA_CKPT_CHECKPOINT_COLLOCATED;
+			break;
+		case 'n':
+			ckptName = optarg;
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numCounts == 0 || sectionSize == 0 || numIterations == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < numCounts; ++i) {
+		if (i > 0 && sectionCounts[i] <= sectionCounts[i - 1]) {
+			fprintf(stderr, "Section counts must be increasing\n");
+			exit(EXIT_FAILURE);
+		}
+		maxSections = sectionCounts[i];
+	}
+
+	if (strlen(ckptName) >= SA_MAX_NAME_LENGTH) {
+		fprintf(stderr, "Checkpoint name too long\n");
+		exit(EXIT_FAILURE);
+	}
+
+	data = calloc(1, sectionSize);
+	if (data == NULL) {
+		perror("calloc");
+		exit(EXIT_FAILURE);
+	}
+
+	name.length = strlen(ckptName);
+	memcpy(name.value, ckptName, name.length);
+
+	attr.creationFlags = creationFlags;
+	attr.checkpointSize = (SaSizeT)maxSections * sectionSize;
+	attr.retentionDuration = 0;
+	attr.maxSections = maxSections;
+	attr.maxSectionSize = sectionSize;
+	attr.maxSectionIdSize = 32;
+
+	rc = saCkptInitialize(&ckptSvcHandle, NULL, &ckptVersion);
+	if (rc != SA_AIS_OK)
+		bench_fail("saCkptInitialize", rc);
+
+	/* Start from an empty checkpoint */
+	saCkptCheckpointUnlink(ckptSvcHandle, &name);
+
+	rc = saCkptCheckpointOpen(ckptSvcHandle, &name, &attr,
+				  SA_CKPT_CHECKPOINT_CREATE |
+				      SA_CKPT_CHECKPOINT_READ |
+				      SA_CKPT_CHECKPOINT_WRITE,
+				  SA_TIME_ONE_SECOND * 10, &ckptHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saCkptCheckpointOpen", rc);
+
+	for (i = 0; i < numCounts; ++i) {
+		create_sections(ckptHandle, numSections, sectionCounts[i],
+				data);
+		numSections = sectionCounts[i];
+
+		osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+		for (j = 0; j < numIterations; ++j) {
+			count = iterate_sections(ckptHandle);
+			if (count != numSections) {
+				fprintf(stderr,
+					"Iterated over %u of %u sections\n",
+					count, numSections);
+				exit(EXIT_FAILURE);
+			}
+		}
+		osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+		osaf_timespec_subtract(&end, &start, &elapsed);
+		secs = osaf_timespec_to_double(&elapsed) / numIterations;
+
+		printf("sections:%u time:%.3fs rate:%.1f sections/s\n",
+		       numSections, secs, numSections / secs);
+	}
+
+	saCkptCheckpointClose(ckptHandle);
+	saCkptCheckpointUnlink(ckptSvcHandle, &name);
+	saCkptFinalize(ckptSvcHandle);
+	free(data);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the time of section
+ * create, lookup (read of one section) and delete in a checkpoint with a
+ * large number of sections.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <libgen.h>
+
+#include <saAis.h>
+#include <saCkpt.h>
+#include "base/osaf_time.h"
+#include "osaf/apitest/bench.h"
+
+#define BENCH_CKPT_NAME "safCkpt=ckptsecbench"
+
+static SaVersionT ckptVersion = {'B', 2, 2};
+static unsigned int numSections = 100000;
+static unsigned int sectionSize = 64;
+static unsigned int seed = 1;
+static SaCkptCheckpointCreationFlagsT creationFlags = SA_CKPT_WR_ALL_REPLICAS;
+static const char *ckptName = BENCH_CKPT_NAME;
+
+static void usage(const char *progname)
+{
+	static const char *const options[] = {
+	    "-s, --sections <n>     number of sections (default 100000)",
+	    "-z, --size <n>         section size in bytes (default 64)",
+	    "-r, --seed <n>         seed of the random order (default 1)",
+	    "-c, --collocated       create a collocated checkpoint",
+	    "-n, --name <name>      checkpoint (default " BENCH_CKPT_NAME ")",
+	    NULL};
+
+	bench_usage(
+	    progname, "measure the CKPT section create, lookup and delete time",
+	    "is a CKPT test client creating a number of sections in a\n"
+	    "\tcheckpoint, reading every section once in random order and\n"
+	    "\tdeleting every section in random order. The time and rate of\n"
+	    "\teach phase are reported.\n",
+	    options, "-s 200000 -c");
+}
+
+static void section_id(SaCkptSectionIdT *id, char *idbuf, size_t len,
+		       unsigned int i)
+{
+	id->idLen = snprintf(idbuf, len, "s%u", i);
+	id->id = (SaUint8T *)idbuf;
+}
+
+static void report(const char *phase, const struct timespec *start)
+{
+	struct timespec end, elapsed;
+	double secs;
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+	osaf_timespec_subtract(&end, start, &elapsed);
+	secs = osaf_timespec_to_double(&elapsed);
+
+	printf("%s sections:%u time:%.3fs rate:%.1f sections/s\n", phase,
+	       numSections, secs, numSections / secs);
+}
+
+static void shuffle(unsigned int *order)
+{
+	unsigned int i, j, tmp;
+
+	for (i = 0; i < numSections; ++i)
+		order[i] = i;
+
+	srandom(seed);
+	for (i = numSections - 1; i > 0; --i) {
+		j = random() % (i + 1);
+		tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"sections", required_argument, 0, 's'},
+					{"size", required_argument, 0, 'z'},
+					{"seed", required_argument, 0, 'r'},
+					{"collocated", no_argument, 0, 'c'},
+					{"name", required_argument, 0, 'n'},
+					{0, 0, 0, 0}};
+	SaCkptHandleT ckptSvcHandle;
+	SaCkptCheckpointHandleT ckptHandle;
+	SaCkptCheckpointCreationAttributesT attr;
+	SaCkptSectionCreationAttributesT secAttr;
+	SaCkptIOVectorElementT iov;
+	SaCkptSectionIdT id;
+	SaUint32T erroneousVectorIndex;
+	struct timespec start;
+	unsigned int i, *order;
+	char idbuf[32];
+	SaNameT name;
+	char *data;
+	SaAisErrorT rc;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "hs:z:r:cn:", long_options,
+				NULL)) != -1) {
+		switch (c) {
+		case 's':
+			numSections = strtoul(optarg, NULL, 0);
+			break;
+		case 'z':
+			sectionSize = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			creationFlags |= SA_CKPT_CHECKPOINT_COLLOCATED;
+			break;
+		case 'n':
+			ckptName = optarg;
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numSections == 0 || sectionSize == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (strlen(ckptName) >= SA_MAX_NAME_LENGTH) {
+		fprintf(stderr, "Checkpoint name too long\n");
+		exit(EXIT_FAILURE);
+	}
+
+	data = calloc(1, sectionSize);
+	order = calloc(numSections, sizeof(*order));
+	if (data == NULL || order == NULL) {
+		perror("calloc");
+		exit(EXIT_FAILURE);
+	}
+
+	name.length = strlen(ckptName);
+	memcpy(name.value, ckptName, name.length);
+
+	attr.creationFlags = creationFlags;
+	attr.checkpointSize = (SaSizeT)numSections * sectionSize;
+	attr.retentionDuration = 0;
+	attr.maxSections = numSections;
+	attr.maxSectionSize = sectionSize;
+	attr.maxSectionIdSize = sizeof(idbuf);
+
+	rc = saCkptInitialize(&ckptSvcHandle, NULL, &ckptVersion);
+	if (rc != SA_AIS_OK)
+		bench_fail("saCkptInitialize", rc);
+
+	/* Start from an empty checkpoint */
+	saCkptCheckpointUnlink(ckptSvcHandle, &name);
+
+	rc = saCkptCheckpointOpen(ckptSvcHandle, &name, &attr,
+				  SA_CKPT_CHECKPOINT_CREATE |
+				      SA_CKPT_CHECKPOINT_READ |
+				      SA_CKPT_CHECKPOINT_WRITE,
+				  SA_TIME_ONE_SECOND * 10, &ckptHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saCkptCheckpointOpen", rc);
+
+	secAttr.sectionId = &id;
+	secAttr.expirationTime = SA_TIME_END;
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numSections; ++i) {
+		section_id(&id, idbuf, sizeof(idbuf), i);
+		rc = saCkptSectionCreate(ckptHandle, &secAttr, data,
+					 sectionSize);
+		if (rc != SA_AIS_OK)
+			bench_fail("saCkptSectionCreate", rc);
+	}
+	report("create", &start);
+
+	shuffle(order);
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numSections; ++i) {
+		section_id(&iov.sectionId, idbuf, sizeof(idbuf), order[i]);
+		iov.dataBuffer = data;
+		iov.dataSize = sectionSize;
+		iov.dataOffset = 0;
+		iov.readSize = 0;
+		rc = saCkptCheckpointRead(ckptHandle, &iov, 1,
+					  &erroneousVectorIndex);
+		if (rc != SA_AIS_OK)
+			bench_fail("saCkptCheckpointRead", rc);
+	}
+	report("lookup", &start);
+
+	seed++;
+	shuffle(order);
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numSections; ++i) {
+		section_id(&id, idbuf, sizeof(idbuf), order[i]);
+		rc = saCkptSectionDelete(ckptHandle, &id);
+		if (rc != SA_AIS_OK)
+			bench_fail("saCkptSectionDelete", rc);
+	}
+	report("delete", &start);
+
+	saCkptCheckpointClose(ckptHandle);
+	saCkptCheckpointUnlink(ckptSvcHandle, &name);
+	saCkptFinalize(ckptSvcHandle);
+	free(order);
+	free(data);
+
+	return EXIT_SUCCESS;
+}
@@ -86,12 +86,6 @@ extern uint32_t gl_cpnd_cb_hdl;
        ? true                                                    \
        : false)
 
-#define m_CPND_FREE_CKPT_SECTION(p)                                   \
-  do {                                                                \
-    if (p->sec_id.id != NULL) m_MMGR_FREE_CPND_DEFAULT(p->sec_id.id); \
-    m_MMGR_FREE_CPND_CPND_CKPT_SECTION_INFO(p);                       \
-  } while (0)
-
 /*** Macro used to get the AMF version used ****/
 #define m_CPSV_GET_AMF_VER(amf_ver) \
   amf_ver.releaseCode = 'B';        \
@@ -101,22 +95,50 @@ extern uint32_t gl_cpnd_cb_hdl;
 #define m_CPND_IS_ON_SCXB(m, n) ((m == n) ? 1 : 0)
 
 /*30B Versioning Changes */
-#define CPND_MDS_PVT_SUBPART_VERSION 4
+#define CPND_MDS_PVT_SUBPART_VERSION 8
 
 /*CPND - CPA communication */
 #define CPND_WRT_CPA_SUBPART_VER_MIN 1
-#define CPND_WRT_CPA_SUBPART_VER_MAX 4
+#define CPND_WRT_CPA_SUBPART_VER_MAX 5
 
 #define CPND_WRT_CPA_SUBPART_VER_RANGE \
   (CPND_WRT_CPA_SUBPART_VER_MAX - CPND_WRT_CPA_SUBPART_VER_MIN + 1)
 
 /*CPND - CPND communication */
 #define CPND_WRT_CPND_SUBPART_VER_MIN 1
-#define CPND_WRT_CPND_SUBPART_VER_MAX 4
+#define CPND_WRT_CPND_SUBPART_VER_MAX 6
 
 #define CPND_WRT_CPND_SUBPART_VER_RANGE \
   (CPND_WRT_CPND_SUBPART_VER_MAX - CPND_WRT_CPND_SUBPART_VER_MIN + 1)
 
+/* From CPND message format 5 all replica writes carry a sequence number,
+   are multicast to the replicas and the responses echo the sequence number.
+   From CPND version 8 the sync response carries the sequence number of the
+   active replica and a remote replica resyncs when it misses a write, so
+   the writes are numbered only while all CPNDs are version 8 or later */
+#define CPND_MCAST_WRITE_SUBPART_VER 8
+#define CPND_MCAST_WRITE_MSG_FMT_VER 5
+
+/* Time in 10 ms units a remote replica waits for a missing all replica
+   write before it resyncs from the active replica */
+#define CPND_WRITE_GAP_TIMEOUT 100
+
+/* Max number of all replica writes of a checkpoint waiting for the remote
+   replicas, and max number of writes a remote replica holds back while
+   waiting for a missing one */
+#define CPND_WRITE_WINDOW 32
+
+/* Upper bound of the node list of a multicast all replica write, above the
+   number of nodes of any cluster */
+#define CPND_MAX_DEST_NODES 4096
+
+/* From CPND version 6 a new replica may be synced in chunks of at most
+   CPND_SYNC_CHUNK_SIZE bytes of section data, acknowledged by the new
+   replica. At most CPND_SYNC_WINDOW chunks are waiting for an ack */
+#define CPND_STREAM_SYNC_MSG_FMT_VER 6
+#define CPND_SYNC_CHUNK_SIZE (1024 * 1024)
+#define CPND_SYNC_WINDOW 4
+
 /*CPND - CPD communication */
 #define CPND_WRT_CPD_SUBPART_VER_MIN 1
 #define CPND_WRT_CPD_SUBPART_VER_MAX 3
@@ -150,13 +172,49 @@ typedef struct cpnd_ckpt_replica_info_tag {
   SaUint32T mem_used;             /* Used for status */
   NCS_OS_POSIX_SHM_REQ_INFO open; /* for shm open */
   uint32_t *shm_sec_mapping;      /* for validity of sec */
+  uint32_t *shm_sec_free;         /* stack of free lcl_sec_ids */
+  uint32_t n_shm_sec_free;        /* number of ids on shm_sec_free */
   void *section_db;               /* used for C++ STL map */
-  void *local_section_db;         /* used for C++ STL map */
+  void *section_index;            /* used for C++ STL unordered_map */
+  void *local_section_db;         /* used for C++ STL vector */
+  void *section_slab;             /* storage of the section infos */
 } CPND_CKPT_REPLICA_INFO;
 
+/* Key of the ALL_REPL_WRITE EVT nodes. The sequence number is 0 for writes
+   sent to CPNDs older than CPND_MCAST_WRITE_SUBPART_VER, which allows only
+   one write at a time per local checkpoint handle */
+typedef struct cpnd_all_repl_write_evt_key {
+  SaCkptCheckpointHandleT lcl_ckpt_id;
+  SaUint64T seqno;
+} CPSV_CPND_ALL_REPL_EVT_KEY;
+
+/* Streamed sync of a new replica, kept by the active replica */
+typedef struct cpnd_sync_session {
+  struct cpnd_sync_session *next;
+  MDS_DEST dest;                 /* CPND of the new replica */
+  CPSV_A2ND_CKPT_SYNC sync_req;  /* The sync request */
+  SaCkptSectionIdT last_sec_id;  /* Last section sent */
+  SaUint32T seqno;               /* Last chunk sent */
+  SaUint32T acked_seqno;         /* Last chunk acked */
+  bool done;                     /* All sections sent */
+} CPND_SYNC_SESSION;
+
+/* Ack of an all replica write to the active replica, kept by a remote
+   replica until the resync that covers the write has ended */
+typedef struct cpnd_rmt_write_ack {
+  struct cpnd_rmt_write_ack *next;
+  CPSV_SEND_INFO sinfo;  /* The active replica */
+  SaUint32T type;        /* write/overwrite */
+  SaCkptCheckpointHandleT lcl_ckpt_id;
+  MDS_DEST agent_mdest;
+  SaUint32T num_of_elmts;
+  SaUint32T seqno;
+} CPND_RMT_WRITE_ACK;
+
 /*Structure to store info for ALL_REPL_WRITE EVT processing*/
 typedef struct cpnd_all_repl_write_evt_node {
   NCS_PATRICIA_NODE patnode;
+  CPSV_CPND_ALL_REPL_EVT_KEY key;
   SaCkptCheckpointHandleT ckpt_id;
   uint32_t write_rsp_cnt; /*Keeps track of the responses awaited during
                              ALL_REPL_WRITE */
@@ -214,6 +272,33 @@ typedef struct cpnd_ckpt_node {
       cpa_sinfo; /* Used in unlink flow while sending response to CPA */
   bool cpa_sinfo_flag;
   CPND_TMR open_active_sync_tmr;
+
+  /* Active replica: sequence number of the last all replica write and
+     number of writes waiting for the remote replicas */
+  SaUint32T write_seqno;
+  uint32_t write_pending_cnt;
+  /* Remote replica: sender and sequence number of the last applied write,
+     and the writes received ahead of a missing one, in sequence order */
+  MDS_DEST rmt_write_dest;
+  SaUint32T rmt_write_seqno;
+  uint32_t rmt_write_q_cnt;
+  CPSV_EVT *rmt_write_q;
+  /* Remote replica: a missing write is waited for until rmt_write_tmr
+     expires, and then the replica is resynced. While rmt_write_resync is
+     set the resync is pending and the writes are not applied.
+     rmt_write_resyncing is set while the resync identified by
+     rmt_write_resync_id is being streamed. The acks of the writes covered
+     by the resync are kept in rmt_write_ack_q until it has ended */
+  CPND_TMR rmt_write_tmr;
+  bool rmt_write_resync;
+  bool rmt_write_resyncing;
+  SaInvocationT rmt_write_resync_id;
+  CPND_RMT_WRITE_ACK *rmt_write_ack_q;
+
+  /* Active replica: streamed syncs of new replicas in progress */
+  CPND_SYNC_SESSION *sync_sessions;
+  /* New replica: writes are queued in evt_bckup_q while being synced */
+  bool journal_writes;
 } CPND_CKPT_NODE;
 
 #define CPND_CKPT_NODE_NULL ((CPND_CKPT_NODE *)0)
@@ -272,6 +357,19 @@ typedef struct cpnd_cpd_deferred_req_node {
   CPSV_EVT evt;
 } CPND_CPD_DEFERRED_REQ_NODE;
 
+/* Slots of the client or checkpoint infos in the restart shared memory.
+   Segment 0 is the info array in CPND_CHECKPOINT_INFO, further segments
+   are created when all slots are in use. The free slots are rebuilt from
+   the is_valid flags in the shared memory, so they need no saving */
+typedef struct cpnd_shm_slots {
+  char *seg_addr[MAX_SHM_SEGMENTS]; /* seg_addr[0] is not used */
+  uint32_t n_segs;
+  int32_t *free_slots; /* slots believed to be free, lowest on top */
+  uint8_t *on_free_list;
+  int32_t n_free;
+  int32_t n_slots; /* size of free_slots */
+} CPND_SHM_SLOTS;
+
 /*****************************************************************************
  * Data Structure used to hold CPND control block
  *****************************************************************************/
@@ -286,6 +384,8 @@ typedef struct cpnd_cb_tag {
 
   uint32_t cli_id_gen; /* for generating client_id */
   GBL_SHM_PTR shm_addr;
+  CPND_SHM_SLOTS shm_clients;
+  CPND_SHM_SLOTS shm_ckpts;
   /* Information about the CPD */
   MDS_DEST cpd_mdest_id;
   bool is_cpd_up;
@@ -338,6 +438,10 @@ typedef struct cpnd_cb_tag {
   bool scAbsenceAllowed;
   int shm_alloc_guaranteed;
 
+  bool mcast_write; /* Multicast all replica writes */
+  /* Number of CPNDs older than CPND_MCAST_WRITE_SUBPART_VER */
+  uint32_t prev_ver_cpnd_cnt;
+
   NCS_SEL_OBJ clm_updated_sel_obj; /* The CLM select object updated event */
 
 } CPND_CB;
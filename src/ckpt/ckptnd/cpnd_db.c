@@ -164,6 +164,14 @@ void cpnd_ckpt_node_destroy(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
 		cpnd_tmr_stop(&cp_node->open_active_sync_tmr);
 	if (cp_node->ret_tmr.is_active)
 		cpnd_tmr_stop(&cp_node->ret_tmr);
+	if (cp_node->rmt_write_tmr.is_active)
+		cpnd_tmr_stop(&cp_node->rmt_write_tmr);
+
+	cpnd_rmt_write_queue_cleanup(cp_node);
+	cpnd_rmt_write_ack_queue_cleanup(cp_node);
+	cpnd_evt_backup_queue_cleanup(cp_node);
+	while (cp_node->sync_sessions != NULL)
+		cpnd_sync_session_del(cp_node, cp_node->sync_sessions->dest);
 
 	cpnd_ckpt_sec_map_destroy(&cp_node->replica_info);
 
@@ -320,16 +328,23 @@ CPND_CKPT_NODE *cpnd_ckpt_node_find_by_name(CPND_CB *cpnd_cb,
  * Description   : Function to get the all repl evt node from Tree.
  *
  * Arguments     : CPND_CB *cb, - CPND Control Block
+ *                 SaCkptCheckpointHandleT lcl_ckpt_id - Local ckpt handle
+ *                 SaUint32T seqno - Sequence number of the write
  *
  * Return Values : CPSV_CPND_ALL_REPL_EVT_NODE ** evt_node - evt Node
  *
  * Notes         : None.
  *****************************************************************************/
 void cpnd_evt_node_get(CPND_CB *cb, SaCkptCheckpointHandleT lcl_ckpt_id,
-		       CPSV_CPND_ALL_REPL_EVT_NODE **evt_node)
+		       SaUint32T seqno, CPSV_CPND_ALL_REPL_EVT_NODE **evt_node)
 {
+	CPSV_CPND_ALL_REPL_EVT_KEY key;
+
+	memset(&key, 0, sizeof(key));
+	key.lcl_ckpt_id = lcl_ckpt_id;
+	key.seqno = seqno;
 	*evt_node = (CPSV_CPND_ALL_REPL_EVT_NODE *)ncs_patricia_tree_get(
-	    &cb->writeevt_db, (uint8_t *)&lcl_ckpt_id);
+	    &cb->writeevt_db, (uint8_t *)&key);
 	return;
 }
 
@@ -344,13 +359,13 @@ void cpnd_evt_node_get(CPND_CB *cb, SaCkptCheckpointHandleT lcl_ckpt_id,
  *
  * Notes         : None.
  *****************************************************************************/
-void cpnd_evt_node_getnext(CPND_CB *cb, SaCkptCheckpointHandleT lcl_ckpt_id,
+void cpnd_evt_node_getnext(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_KEY *key,
 			   CPSV_CPND_ALL_REPL_EVT_NODE **evt_node)
 {
-	if (lcl_ckpt_id)
+	if (key)
 		*evt_node =
 		    (CPSV_CPND_ALL_REPL_EVT_NODE *)ncs_patricia_tree_getnext(
-			&cb->writeevt_db, (uint8_t *)&lcl_ckpt_id);
+			&cb->writeevt_db, (uint8_t *)key);
 	else
 		*evt_node =
 		    (CPSV_CPND_ALL_REPL_EVT_NODE *)ncs_patricia_tree_getnext(
@@ -373,11 +388,17 @@ void cpnd_evt_node_getnext(CPND_CB *cb, SaCkptCheckpointHandleT lcl_ckpt_id,
 uint32_t cpnd_evt_node_add(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_NODE *evt_node)
 {
 	uint32_t rc = NCSCC_RC_FAILURE;
+	CPND_CKPT_NODE *cp_node = NULL;
 
-	evt_node->patnode.key_info = (uint8_t *)&evt_node->lcl_ckpt_id;
+	evt_node->patnode.key_info = (uint8_t *)&evt_node->key;
 
 	rc = ncs_patricia_tree_add(&cb->writeevt_db,
 				   (NCS_PATRICIA_NODE *)&evt_node->patnode);
+	if (rc == NCSCC_RC_SUCCESS) {
+		cpnd_ckpt_node_get(cb, evt_node->ckpt_id, &cp_node);
+		if (cp_node)
+			cp_node->write_pending_cnt++;
+	}
 	return rc;
 }
 
@@ -396,9 +417,15 @@ uint32_t cpnd_evt_node_add(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_NODE *evt_node)
 uint32_t cpnd_evt_node_del(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_NODE *evt_node)
 {
 	uint32_t rc = NCSCC_RC_FAILURE;
+	CPND_CKPT_NODE *cp_node = NULL;
 
 	rc = ncs_patricia_tree_del(&cb->writeevt_db,
 				   (NCS_PATRICIA_NODE *)&evt_node->patnode);
+	if (rc == NCSCC_RC_SUCCESS) {
+		cpnd_ckpt_node_get(cb, evt_node->ckpt_id, &cp_node);
+		if (cp_node && cp_node->write_pending_cnt > 0)
+			cp_node->write_pending_cnt--;
+	}
 	return rc;
 }
 
@@ -435,14 +462,13 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_add(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 	}
 
 	/* creat the cpnd_ckpt_section_info structure,memset */
-	pSecPtr = m_MMGR_ALLOC_CPND_CKPT_SECTION_INFO;
+	pSecPtr = cpnd_ckpt_sec_alloc(&cp_node->replica_info);
 	if (pSecPtr == NULL) {
 		LOG_ER("cpnd ckpt section info memory allocation failed");
+		cpnd_ckpt_put_lck_sec_id(cp_node, lcl_sec_id);
 		return NULL;
 	}
 
-	memset(pSecPtr, '\0', sizeof(CPND_CKPT_SECTION_INFO));
-
 	if (gen_flag) {
 
 		if (cp_node->create_attrib.maxSectionIdSize >
@@ -458,7 +484,7 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_add(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		    m_MMGR_ALLOC_CPND_DEFAULT(pSecPtr->sec_id.idLen);
 		if (pSecPtr->sec_id.id == NULL) {
 			LOG_ER("cpnd sect memory allocation failed");
-			goto sec_id_allocate_fails;
+			goto section_add_fails;
 		}
 		memset(pSecPtr->sec_id.id, '\0', pSecPtr->sec_id.idLen);
 
@@ -511,14 +537,11 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_add(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 section_hdr_update_fails:
 	hdr_update = false;
 ckpt_hdr_update_fails:
-	cpnd_ckpt_sec_del(cb, cp_node, id, hdr_update);
+	cpnd_ckpt_sec_del(cb, cp_node, &pSecPtr->sec_id, hdr_update);
 
 section_add_fails:
-	if (pSecPtr->sec_id.id != NULL)
-		m_MMGR_FREE_CPND_DEFAULT(pSecPtr->sec_id.id);
-
-sec_id_allocate_fails:
-	m_MMGR_FREE_CPND_CPND_CKPT_SECTION_INFO(pSecPtr);
+	cpnd_ckpt_sec_free(&cp_node->replica_info, pSecPtr);
+	cpnd_ckpt_put_lck_sec_id(cp_node, lcl_sec_id);
 	TRACE_LEAVE();
 	return NULL;
 }
@@ -565,6 +588,212 @@ void cpnd_evt_backup_queue_add(CPND_CKPT_NODE *cp_node, CPND_EVT *evt)
 	return;
 }
 
+/****************************************************************************
+ * Name          : cpnd_rmt_write_queue_add
+ *
+ * Description   : Function to hold back an all replica write received ahead
+ *                 of a missing one. The queue is kept in sequence order.
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 CPND_EVT *evt - CPND Event structure
+ *
+ * Return Values : None.
+ *
+ * Notes         : The event is owned by the queue until it is dequeued.
+ *****************************************************************************/
+void cpnd_rmt_write_queue_add(CPND_CKPT_NODE *cp_node, CPND_EVT *evt)
+{
+	CPSV_EVT *ptr = container_of(evt, CPSV_EVT, info.cpnd);
+	CPSV_EVT **pos = &cp_node->rmt_write_q;
+	SaUint32T seqno = evt->info.ckpt_nd2nd_data.seqno;
+
+	evt->dont_free_me = true;
+
+	while (*pos != NULL &&
+	       (int32_t)((*pos)->info.cpnd.info.ckpt_nd2nd_data.seqno -
+			 seqno) < 0)
+		pos = &(*pos)->next;
+
+	ptr->next = *pos;
+	*pos = ptr;
+	cp_node->rmt_write_q_cnt++;
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_queue_cleanup
+ *
+ * Description   : Function to drop the held back all replica writes
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node - Checkpoint node
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+void cpnd_rmt_write_queue_cleanup(CPND_CKPT_NODE *cp_node)
+{
+	CPSV_EVT *evt = NULL;
+
+	while (cp_node->rmt_write_q != NULL) {
+		evt = cp_node->rmt_write_q;
+		cp_node->rmt_write_q = evt->next;
+		evt->info.cpnd.dont_free_me = false;
+		cpnd_evt_destroy(evt);
+	}
+	cp_node->rmt_write_q_cnt = 0;
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_ack_queue_add
+ *
+ * Description   : Function to keep the ack of an all replica write until
+ *                 the resync that covers the write has ended. The queue is
+ *                 kept in the order the writes were received.
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 const CPND_RMT_WRITE_ACK *ack - The ack
+ *
+ * Return Values : None.
+ *
+ * Notes         : The ack is lost if no memory is available, the active
+ *                 replica then times out the write.
+ *****************************************************************************/
+void cpnd_rmt_write_ack_queue_add(CPND_CKPT_NODE *cp_node,
+				  const CPND_RMT_WRITE_ACK *ack)
+{
+	CPND_RMT_WRITE_ACK **pos = &cp_node->rmt_write_ack_q;
+	CPND_RMT_WRITE_ACK *ptr;
+
+	ptr = m_MMGR_ALLOC_CPND_DEFAULT(sizeof(CPND_RMT_WRITE_ACK));
+	if (ptr == NULL) {
+		LOG_ER("cpnd write ack alloc failed");
+		return;
+	}
+	*ptr = *ack;
+	ptr->next = NULL;
+
+	while (*pos != NULL)
+		pos = &(*pos)->next;
+	*pos = ptr;
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_ack_queue_cleanup
+ *
+ * Description   : Function to drop the kept acks of all replica writes
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node - Checkpoint node
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+void cpnd_rmt_write_ack_queue_cleanup(CPND_CKPT_NODE *cp_node)
+{
+	CPND_RMT_WRITE_ACK *ack = NULL;
+
+	while (cp_node->rmt_write_ack_q != NULL) {
+		ack = cp_node->rmt_write_ack_q;
+		cp_node->rmt_write_ack_q = ack->next;
+		m_MMGR_FREE_CPND_DEFAULT(ack);
+	}
+}
+
+/****************************************************************************
+ * Name          : cpnd_evt_backup_queue_proc
+ *
+ * Description   : Function to apply the write events of the back up queue
+ *                 in the order they were received, and stop journaling.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+void cpnd_evt_backup_queue_proc(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
+{
+	CPSV_EVT *bck_evt = NULL;
+	uint32_t err_flag = 0;
+	CPSV_SEND_INFO *sinfo = NULL;
+	uint32_t errflag = 0;
+
+	cp_node->journal_writes = false;
+
+	while (cp_node->evt_bckup_q != NULL) {
+		bck_evt = cp_node->evt_bckup_q;
+
+		cpnd_ckpt_update_replica(
+		    cb, cp_node, &bck_evt->info.cpnd.info.ckpt_nd2nd_data,
+		    bck_evt->info.cpnd.info.ckpt_nd2nd_data.type, &err_flag,
+		    &errflag);
+
+		cpnd_proc_ckpt_arrival_info_ntfy(
+		    cb, cp_node, &bck_evt->info.cpnd.info.ckpt_nd2nd_data,
+		    sinfo);
+
+		cp_node->evt_bckup_q = cp_node->evt_bckup_q->next;
+
+		bck_evt->info.cpnd.dont_free_me = false;
+
+		cpnd_evt_destroy(bck_evt);
+	}
+}
+
+/****************************************************************************
+ * Name          : cpnd_evt_backup_queue_cleanup
+ *
+ * Description   : Function to drop the write events of the back up queue
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node - Checkpoint node
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+void cpnd_evt_backup_queue_cleanup(CPND_CKPT_NODE *cp_node)
+{
+	CPSV_EVT *evt = NULL;
+
+	while (cp_node->evt_bckup_q != NULL) {
+		evt = cp_node->evt_bckup_q;
+		cp_node->evt_bckup_q = evt->next;
+		evt->info.cpnd.dont_free_me = false;
+		cpnd_evt_destroy(evt);
+	}
+	cp_node->journal_writes = false;
+}
+
+/****************************************************************************
+ * Name          : cpnd_sync_session_del
+ *
+ * Description   : Function to end the streamed sync of a new replica
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 MDS_DEST dest - CPND of the new replica
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+void cpnd_sync_session_del(CPND_CKPT_NODE *cp_node, MDS_DEST dest)
+{
+	CPND_SYNC_SESSION **pos = &cp_node->sync_sessions;
+	CPND_SYNC_SESSION *session = NULL;
+
+	while (*pos != NULL && (*pos)->dest != dest)
+		pos = &(*pos)->next;
+	if (*pos == NULL)
+		return;
+
+	session = *pos;
+	*pos = session->next;
+	if (session->last_sec_id.id != NULL)
+		m_MMGR_FREE_CPND_DEFAULT(session->last_sec_id.id);
+	m_MMGR_FREE_CPND_DEFAULT(session);
+}
+
 /****************************************************************************
  * Name          : cpnd_ckpt_node_tree_init
  *
@@ -747,7 +976,7 @@ uint32_t cpnd_allrepl_write_evt_node_tree_init(CPND_CB *cb)
 {
 	NCS_PATRICIA_PARAMS param;
 	memset(&param, 0, sizeof(NCS_PATRICIA_PARAMS));
-	param.key_size = sizeof(SaCkptCheckpointHandleT);
+	param.key_size = sizeof(CPSV_CPND_ALL_REPL_EVT_KEY);
 	if (ncs_patricia_tree_init(&cb->writeevt_db, &param) !=
 	    NCSCC_RC_SUCCESS)
 		return NCSCC_RC_FAILURE;
@@ -884,33 +1113,14 @@ void cpnd_agent_dest_del(CPND_CKPT_NODE *cp_node, MDS_DEST adest)
 void cpnd_proc_pending_writes(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 			      MDS_DEST adest)
 {
-	CPSV_EVT *bck_evt = NULL;
-	uint32_t err_flag = 0;
-	CPSV_SEND_INFO *sinfo = NULL;
-	uint32_t errflag = 0;
 	/* This check is for one write and 1 local read and then kill the reader
 	 */
 	TRACE_ENTER();
 	cpnd_agent_dest_del(cp_node, adest);
 
-	while (cp_node->evt_bckup_q != NULL) {
-		bck_evt = cp_node->evt_bckup_q;
-
-		cpnd_ckpt_update_replica(
-		    cb, cp_node, &bck_evt->info.cpnd.info.ckpt_nd2nd_data,
-		    bck_evt->info.cpnd.info.ckpt_nd2nd_data.type, &err_flag,
-		    &errflag);
-
-		cpnd_proc_ckpt_arrival_info_ntfy(
-		    cb, cp_node, &bck_evt->info.cpnd.info.ckpt_nd2nd_data,
-		    sinfo);
-
-		cp_node->evt_bckup_q = cp_node->evt_bckup_q->next;
-
-		bck_evt->info.cpnd.dont_free_me = false;
-
-		cpnd_evt_destroy(bck_evt);
-	}
+	/* Writes journaled during a replica sync are applied after it */
+	if (!cp_node->journal_writes)
+		cpnd_evt_backup_queue_proc(cb, cp_node);
 	TRACE_LEAVE();
 }
 
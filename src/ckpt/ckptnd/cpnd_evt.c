@@ -85,6 +85,15 @@ static uint32_t cpnd_evt_proc_ckpt_write(CPND_CB *cb, CPND_EVT *evt,
 static uint32_t
 cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
 						CPSV_SEND_INFO *sinfo);
+static uint32_t cpnd_nd2nd_ckpt_data_access_apply(CPND_CB *cb, CPND_EVT *evt,
+						  CPSV_SEND_INFO *sinfo);
+static uint32_t cpnd_nd2nd_ckpt_data_access_ack(CPND_CB *cb,
+						CPND_CKPT_NODE *cp_node,
+						CPND_EVT *evt,
+						CPSV_SEND_INFO *sinfo);
+static void cpnd_rmt_write_queue_proc(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
+				      bool all, CPND_EVT *cur_evt);
+static void cpnd_rmt_write_resync(CPND_CB *cb, CPND_CKPT_NODE *cp_node);
 static uint32_t
 cpnd_evt_proc_nd2nd_ckpt_active_data_access_rsp(CPND_CB *cb, CPND_EVT *evt,
 						CPSV_SEND_INFO *sinfo);
@@ -98,6 +107,8 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_sync_req(CPND_CB *cb, CPND_EVT *evt,
 						  CPSV_SEND_INFO *sinfo);
 static uint32_t cpnd_evt_proc_nd2nd_ckpt_active_sync(CPND_CB *cb, CPND_EVT *evt,
 						     CPSV_SEND_INFO *sinfo);
+static uint32_t cpnd_evt_proc_nd2nd_ckpt_sync_ack(CPND_CB *cb, CPND_EVT *evt,
+						  CPSV_SEND_INFO *sinfo);
 static uint32_t cpnd_evt_proc_ckpt_read(CPND_CB *cb, CPND_EVT *evt,
 					CPSV_SEND_INFO *sinfo);
 static uint32_t cpnd_evt_proc_timer_expiry(CPND_CB *cb, CPND_EVT *evt);
@@ -129,6 +140,8 @@ static uint32_t cpnd_transfer_replica(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 				      SaCkptCheckpointHandleT ckpt_id,
 				      CPSV_CPND_DEST_INFO *dest_list,
 				      CPSV_A2ND_CKPT_SYNC sync);
+static uint32_t cpnd_sync_session_send(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
+				       CPND_SYNC_SESSION *session);
 static uint32_t cpnd_evt_proc_ckpt_ckpt_list_update(CPND_CB *cb, CPND_EVT *evt,
 						    CPSV_SEND_INFO *sinfo);
 
@@ -415,6 +428,11 @@ void cpnd_process_evt(CPSV_EVT *evt)
 							   &evt->sinfo);
 		break;
 
+	case CPND_EVT_ND2ND_CKPT_SYNC_ACK:
+		(void)cpnd_evt_proc_nd2nd_ckpt_sync_ack(cb, &evt->info.cpnd,
+							&evt->sinfo);
+		break;
+
 	case CPSV_EVT_ND2ND_CKPT_SECT_CREATE_REQ:
 		(void)cpnd_evt_proc_nd2nd_ckpt_sect_create(cb, &evt->info.cpnd,
 							   &evt->sinfo);
@@ -1163,6 +1181,7 @@ static uint32_t cpnd_evt_proc_ckpt_open(CPND_CB *cb, CPND_EVT *evt,
 			    evt->info.openReq.lcl_ckpt_hdl;
 			send_evt.info.cpnd.info.sync_req.cpa_sinfo = *sinfo;
 			send_evt.info.cpnd.info.sync_req.is_ckpt_open = true;
+			send_evt.info.cpnd.info.sync_req.stream_sync = true;
 			if (sinfo->stype != MDS_SENDTYPE_SNDRSP)
 				send_evt.info.cpnd.info.sync_req.invocation =
 				    evt->info.openReq.invocation;
@@ -1202,15 +1221,25 @@ static uint32_t cpnd_evt_proc_ckpt_open(CPND_CB *cb, CPND_EVT *evt,
 					send_evt.info.cpa.info.openRsp.error =
 					    out_evt->info.cpnd.error;
 					goto ckpt_node_del_error;
-				} else if ((out_evt) &&
-					   (out_evt->info.cpnd.error ==
-					    SA_AIS_OK) &&
-					   (!out_evt->info.cpnd.info
-						 .ckpt_nd2nd_sync
-						 .num_of_elmts)) {
+				}
+				if (out_evt) {
+					/* The writes up to this sequence
+					 * number are in the sync */
+					cp_node->rmt_write_dest =
+					    cp_node->active_mds_dest;
+					cp_node->rmt_write_seqno =
+					    out_evt->info.cpnd.info
+						.ckpt_nd2nd_sync.seqno;
+				}
+				if ((out_evt) &&
+				    (!out_evt->info.cpnd.info.ckpt_nd2nd_sync
+					  .num_of_elmts)) {
 					goto agent_rsp2;
 				}
 			}
+			/* Writes received until the replica is synced are
+			 * applied after it */
+			cp_node->journal_writes = true;
 			cp_node->open_active_sync_tmr.type =
 			    CPND_TMR_OPEN_ACTIVE_SYNC;
 			cp_node->open_active_sync_tmr.uarg = cb->cpnd_cb_hdl_id;
@@ -2165,6 +2194,7 @@ static uint32_t cpnd_evt_proc_ckpt_active_set(CPND_CB *cb, CPND_EVT *evt,
 	MDS_DEST mds_dest;
 	uint32_t rc = NCSCC_RC_SUCCESS;
 	CPSV_EVT send_evt;
+	bool resync = false;
 
 	TRACE_ENTER();
 	memset(&mds_dest, '\0', sizeof(MDS_DEST));
@@ -2179,6 +2209,38 @@ static uint32_t cpnd_evt_proc_ckpt_active_set(CPND_CB *cb, CPND_EVT *evt,
 			evt->info.active_set.ckpt_id);
 		return NCSCC_RC_FAILURE;
 	}
+
+	if (evt->info.active_set.mds_dest != cp_node->active_mds_dest) {
+		if (evt->info.active_set.mds_dest == cb->cpnd_mdest_id) {
+			/* This replica takes over with the writes it has and
+			 * numbers its writes from one */
+			if (cp_node->rmt_write_q != NULL ||
+			    cp_node->rmt_write_resync ||
+			    cp_node->rmt_write_resyncing)
+				LOG_WA(
+				    "Active replica of ckpt_id:%llx may have lost writes after %u",
+				    cp_node->ckpt_id, cp_node->rmt_write_seqno);
+			if (cp_node->rmt_write_tmr.is_active)
+				cpnd_tmr_stop(&cp_node->rmt_write_tmr);
+			cpnd_rmt_write_queue_proc(cb, cp_node, true, NULL);
+			if (cp_node->rmt_write_resyncing)
+				cpnd_evt_backup_queue_proc(cb, cp_node);
+			cp_node->rmt_write_resync = false;
+			cp_node->rmt_write_resyncing = false;
+			cp_node->write_seqno = 0;
+		} else if (cp_node->rmt_write_q != NULL ||
+			   cp_node->rmt_write_resync ||
+			   cp_node->rmt_write_resyncing) {
+			/* The writes missing from the previous active
+			 * replica are covered by a resync from the new one */
+			resync = true;
+		}
+		/* The writes of the new active replica are numbered from one
+		 */
+		cp_node->rmt_write_dest = evt->info.active_set.mds_dest;
+		cp_node->rmt_write_seqno = 0;
+	}
+
 	if (m_CPND_IS_LOCAL_NODE(&evt->info.active_set.mds_dest, &mds_dest) ==
 	    0) {
 		cp_node->is_active_exist = false;
@@ -2197,6 +2259,8 @@ static uint32_t cpnd_evt_proc_ckpt_active_set(CPND_CB *cb, CPND_EVT *evt,
 		    cp_node->ckpt_id, cp_node->active_mds_dest);
 	}
 	cp_node->is_restart = false;
+	if (resync)
+		cpnd_rmt_write_resync(cb, cp_node);
 	TRACE_LEAVE();
 	return rc;
 }
@@ -2996,13 +3060,13 @@ static uint32_t cpnd_evt_proc_ckpt_sect_create(CPND_CB *cb, CPND_EVT *evt,
 
 								if (tmp_sec_info ==
 								    sec_info) {
-									cp_node
-									    ->replica_info
-									    .shm_sec_mapping
-										[sec_info
-										     ->lcl_sec_id] =
-									    1;
-									m_CPND_FREE_CKPT_SECTION(
+									cpnd_ckpt_put_lck_sec_id(
+									    cp_node,
+									    sec_info
+										->lcl_sec_id);
+									cpnd_ckpt_sec_free(
+									    &cp_node
+										 ->replica_info,
 									    sec_info);
 								} else {
 									TRACE_4(
@@ -3176,7 +3240,7 @@ static uint32_t cpnd_evt_proc_ckpt_sect_delete(CPND_CB *cb, CPND_EVT *evt,
 			    SA_AIS_ERR_INVALID_PARAM;
 			goto agent_rsp;
 		}
-		cp_node->replica_info.shm_sec_mapping[sec_info->lcl_sec_id] = 1;
+		cpnd_ckpt_put_lck_sec_id(cp_node, sec_info->lcl_sec_id);
 
 		/* Send the arrival callback */
 		memset(&ckpt_data, '\0', sizeof(CPSV_CKPT_DATA));
@@ -3262,7 +3326,7 @@ static uint32_t cpnd_evt_proc_ckpt_sect_delete(CPND_CB *cb, CPND_EVT *evt,
 		/* stop the timer and delete */
 		if (sec_info->ckpt_sec_exptmr.is_active)
 			cpnd_tmr_stop(&sec_info->ckpt_sec_exptmr);
-		m_CPND_FREE_CKPT_SECTION(sec_info);
+		cpnd_ckpt_sec_free(&cp_node->replica_info, sec_info);
 
 		sendStateChangeNotification(cb,
 			cp_node,
@@ -3512,7 +3576,7 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_sect_delete(CPND_CB *cb, CPND_EVT *evt,
 		}
 	} else {
 		/* resetting lcl_sec_id mapping */
-		cp_node->replica_info.shm_sec_mapping[sec_info->lcl_sec_id] = 1;
+		cpnd_ckpt_put_lck_sec_id(cp_node, sec_info->lcl_sec_id);
 	}
 
 	/* Send the arrival callback */
@@ -3551,7 +3615,7 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_sect_delete(CPND_CB *cb, CPND_EVT *evt,
 	}
 
 	if (sec_info)
-		m_CPND_FREE_CKPT_SECTION(sec_info);
+		cpnd_ckpt_sec_free(&cp_node->replica_info, sec_info);
 	send_evt.type = CPSV_EVT_TYPE_CPND;
 	send_evt.info.cpnd.type = CPSV_EVT_ND2ND_CKPT_SECT_DELETE_RSP;
 	send_evt.info.cpnd.info.sec_delete_rsp.error = SA_AIS_OK;
@@ -3725,6 +3789,7 @@ static uint32_t cpnd_evt_proc_ckpt_write(CPND_CB *cb, CPND_EVT *evt,
 	uint32_t err_flag = 0;
 	uint32_t errflag = 0;
 	CPSV_CPND_ALL_REPL_EVT_NODE *evt_node = NULL;
+	bool write_window_full = false;
 	TRACE_ENTER();
 
 	memset(&send_evt, '\0', sizeof(CPSV_EVT));
@@ -3761,18 +3826,29 @@ static uint32_t cpnd_evt_proc_ckpt_write(CPND_CB *cb, CPND_EVT *evt,
 		goto agent_rsp;
 	}
 
-	cpnd_evt_node_get(cb, evt->info.ckpt_write.lcl_ckpt_id, &evt_node);
-	if (evt_node) {
-		LOG_ER(
-		    "cpnd cpnd_evt_node pending with lcl_ckpt_id:%llx write failed for ckpt_id:%llx",
-		    evt->info.ckpt_write.lcl_ckpt_id,
-		    evt->info.ckpt_write.ckpt_id);
+	/* Unnumbered writes, used while older CPNDs are around, are limited to
+	 * one at a time per local handle. Numbered writes may be pipelined up
+	 * to CPND_WRITE_WINDOW per checkpoint */
+	if (cb->prev_ver_cpnd_cnt != 0) {
+		cpnd_evt_node_get(cb, evt->info.ckpt_write.lcl_ckpt_id, 0,
+				  &evt_node);
+		if (evt_node) {
+			LOG_ER(
+			    "cpnd cpnd_evt_node pending with lcl_ckpt_id:%llx write failed for ckpt_id:%llx",
+			    evt->info.ckpt_write.lcl_ckpt_id,
+			    evt->info.ckpt_write.ckpt_id);
+		}
+	} else if (cp_node->write_pending_cnt >= CPND_WRITE_WINDOW) {
+		TRACE_4("cpnd %u writes pending for ckpt_id:%llx",
+			cp_node->write_pending_cnt,
+			evt->info.ckpt_write.ckpt_id);
+		write_window_full = true;
 	}
 
 	if ((true == cp_node->is_restart) ||
 	    (m_CPND_IS_LOCAL_NODE(&cp_node->active_mds_dest,
 				  &cb->cpnd_mdest_id) != 0) ||
-	    (evt_node != NULL)) {
+	    (evt_node != NULL) || write_window_full) {
 		send_evt.type = CPSV_EVT_TYPE_CPA;
 		send_evt.info.cpa.type = CPA_EVT_ND2A_CKPT_DATA_RSP;
 		switch (evt->info.ckpt_write.type) {
@@ -3871,10 +3947,10 @@ agent_rsp:
 }
 
 /****************************************************************************
- * Name          : cpnd_evt_proc_nd2nd_ckpt_active_data_access_req
+ * Name          : cpnd_nd2nd_ckpt_data_access_apply
  *
- * Description   : Function to process write/read/overwrite
- *                 from other ND to Active ND.
+ * Description   : Function to apply a write/overwrite from the Active ND
+ *                 to the local replica and respond to the Active ND.
  *
  * Arguments     : CPND_CB *cb - CPND CB pointer
  *                 CPSV_EVT *evt - Received Event structure
@@ -3882,11 +3958,11 @@ agent_rsp:
  *
  * Return Values : NCSCC_RC_SUCCESS/Error.
  *
- * Notes         : None.
+ * Notes         : While the replica is being synced the write is journaled
+ *                 and applied when the sync has ended.
  *****************************************************************************/
-static uint32_t
-cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
-						CPSV_SEND_INFO *sinfo)
+static uint32_t cpnd_nd2nd_ckpt_data_access_apply(CPND_CB *cb, CPND_EVT *evt,
+						  CPSV_SEND_INFO *sinfo)
 {
 	uint32_t rc = NCSCC_RC_SUCCESS;
 	CPND_CKPT_NODE *cp_node = NULL;
@@ -3902,6 +3978,8 @@ cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
 	    CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_RSP;
 	send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.lcl_ckpt_id =
 	    evt->info.ckpt_nd2nd_data.lcl_ckpt_id;
+	send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.seqno =
+	    evt->info.ckpt_nd2nd_data.seqno;
 
 	cpnd_ckpt_node_get(cb, evt->info.ckpt_nd2nd_data.ckpt_id, &cp_node);
 	if (cp_node == NULL) {
@@ -3935,7 +4013,11 @@ cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
 		    evt->info.ckpt_nd2nd_data.agent_mdest;
 		goto nd_rsp;
 	}
-	if (cp_node->cpnd_rep_create) {
+	if (cp_node->journal_writes) {
+		/* The replica is being synced, apply the write after it */
+		TRACE_2("Write journaled for ckpt_id:%llx", cp_node->ckpt_id);
+		cpnd_evt_backup_queue_add(cp_node, evt);
+	} else if (cp_node->cpnd_rep_create) {
 		rc = cpnd_ckpt_update_replica(
 		    cb, cp_node, &evt->info.ckpt_nd2nd_data,
 		    evt->info.ckpt_nd2nd_data.type, &err_flag, &errflag);
@@ -3946,16 +4028,55 @@ cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
 			    cp_node->ckpt_id, err_flag);
 		}
 	}
-	if (rc == NCSCC_RC_SUCCESS) {
+	if (rc == NCSCC_RC_SUCCESS && !cp_node->journal_writes) {
 		cpnd_proc_ckpt_arrival_info_ntfy(
 		    cb, cp_node, &evt->info.ckpt_nd2nd_data, sinfo);
 	}
-	switch (evt->info.ckpt_nd2nd_data.type) {
+	rc = cpnd_nd2nd_ckpt_data_access_ack(cb, cp_node, evt, sinfo);
+	TRACE_LEAVE();
+	return rc;
+
+nd_rsp:
+	if (evt->info.ckpt_nd2nd_data.all_repl_evt_flag)
+		rc = cpnd_mds_msg_send(cb, sinfo->to_svc, sinfo->dest,
+				       &send_evt);
+	TRACE_LEAVE();
+	return rc;
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_ack_send
+ *
+ * Description   : Function to respond to the Active ND that a
+ *                 write/overwrite is done in the local replica.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 CPND_RMT_WRITE_ACK *ack - The ack
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static uint32_t cpnd_rmt_write_ack_send(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
+					CPND_RMT_WRITE_ACK *ack)
+{
+	CPSV_EVT send_evt;
+
+	memset(&send_evt, '\0', sizeof(CPSV_EVT));
+	send_evt.type = CPSV_EVT_TYPE_CPND;
+	send_evt.info.cpnd.type =
+	    CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_RSP;
+	send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.lcl_ckpt_id =
+	    ack->lcl_ckpt_id;
+	send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.seqno = ack->seqno;
+
+	switch (ack->type) {
 	case CPSV_CKPT_ACCESS_WRITE:
 		send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.type =
 		    CPSV_DATA_ACCESS_WRITE_RSP;
 		send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.num_of_elmts =
-		    evt->info.ckpt_nd2nd_data.num_of_elmts;
+		    ack->num_of_elmts;
 		send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.size = 0;
 		send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.info
 		    .write_err_index = NULL;
@@ -3971,15 +4092,364 @@ cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
 
 	send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.ckpt_id = cp_node->ckpt_id;
 	send_evt.info.cpnd.info.ckpt_nd2nd_data_rsp.from_svc =
-	    evt->info.ckpt_nd2nd_data.agent_mdest;
-nd_rsp:
-	if (evt->info.ckpt_nd2nd_data.all_repl_evt_flag)
-		rc = cpnd_mds_msg_send(cb, sinfo->to_svc, sinfo->dest,
-				       &send_evt);
+	    ack->agent_mdest;
+	return cpnd_mds_msg_send(cb, ack->sinfo.to_svc, ack->sinfo.dest,
+				 &send_evt);
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_ack_queue_proc
+ *
+ * Description   : Function to send the acks of the writes covered by a
+ *                 resync that has ended.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static void cpnd_rmt_write_ack_queue_proc(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
+{
+	CPND_RMT_WRITE_ACK *ack = NULL;
+
+	while (cp_node->rmt_write_ack_q != NULL) {
+		ack = cp_node->rmt_write_ack_q;
+		cp_node->rmt_write_ack_q = ack->next;
+		cpnd_rmt_write_ack_send(cb, cp_node, ack);
+		m_MMGR_FREE_CPND_DEFAULT(ack);
+	}
+}
+
+/****************************************************************************
+ * Name          : cpnd_nd2nd_ckpt_data_access_ack
+ *
+ * Description   : Function to respond to the Active ND that a
+ *                 write/overwrite is done in the local replica.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 CPSV_EVT *evt - Received Event structure
+ *                 CPSV_SEND_INFO *sinfo - Sender MDS information.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : While the replica is resynced the ack is kept until the
+ *                 resync has ended, the replica has the write only then.
+ *****************************************************************************/
+static uint32_t cpnd_nd2nd_ckpt_data_access_ack(CPND_CB *cb,
+						CPND_CKPT_NODE *cp_node,
+						CPND_EVT *evt,
+						CPSV_SEND_INFO *sinfo)
+{
+	CPND_RMT_WRITE_ACK ack;
+
+	if (!evt->info.ckpt_nd2nd_data.all_repl_evt_flag)
+		return NCSCC_RC_SUCCESS;
+
+	memset(&ack, 0, sizeof(CPND_RMT_WRITE_ACK));
+	ack.sinfo = *sinfo;
+	ack.type = evt->info.ckpt_nd2nd_data.type;
+	ack.lcl_ckpt_id = evt->info.ckpt_nd2nd_data.lcl_ckpt_id;
+	ack.agent_mdest = evt->info.ckpt_nd2nd_data.agent_mdest;
+	ack.num_of_elmts = evt->info.ckpt_nd2nd_data.num_of_elmts;
+	ack.seqno = evt->info.ckpt_nd2nd_data.seqno;
+
+	if (cp_node->rmt_write_resync || cp_node->rmt_write_resyncing) {
+		TRACE_2("Write %u acked after the resync", ack.seqno);
+		cpnd_rmt_write_ack_queue_add(cp_node, &ack);
+		return NCSCC_RC_SUCCESS;
+	}
+
+	return cpnd_rmt_write_ack_send(cb, cp_node, &ack);
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_tmr_start
+ *
+ * Description   : Function to start the timer of a remote replica waiting
+ *                 for a missing all replica write or for a resync.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 SaTimeT timeout - Timeout in 10 ms units
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static void cpnd_rmt_write_tmr_start(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
+				     SaTimeT timeout)
+{
+	cp_node->rmt_write_tmr.type = CPND_TMR_TYPE_RMT_WRITE;
+	cp_node->rmt_write_tmr.uarg = cb->cpnd_cb_hdl_id;
+	cp_node->rmt_write_tmr.ckpt_id = cp_node->ckpt_id;
+	cpnd_tmr_start(&cp_node->rmt_write_tmr, timeout);
+}
+
+/****************************************************************************
+ * Name          : cpnd_rmt_write_queue_proc
+ *
+ * Description   : Function to apply the held back all replica writes that
+ *                 are next in sequence, or all of them.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *                 bool all - Apply all held back writes
+ *                 CPND_EVT *cur_evt - Event being processed, if any
+ *
+ * Return Values : None.
+ *
+ * Notes         : The event being processed is freed by the caller.
+ *****************************************************************************/
+static void cpnd_rmt_write_queue_proc(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
+				      bool all, CPND_EVT *cur_evt)
+{
+	CPSV_EVT *evt = NULL;
+	SaUint32T seqno;
+
+	while (cp_node->rmt_write_q != NULL) {
+		evt = cp_node->rmt_write_q;
+		seqno = evt->info.cpnd.info.ckpt_nd2nd_data.seqno;
+		if (!all && seqno != cp_node->rmt_write_seqno + 1)
+			break;
+
+		cp_node->rmt_write_q = evt->next;
+		cp_node->rmt_write_q_cnt--;
+		cp_node->rmt_write_seqno = seqno;
+		evt->next = NULL;
+
+		/* Journaling the write keeps it */
+		evt->info.cpnd.dont_free_me = false;
+		cpnd_nd2nd_ckpt_data_access_apply(cb, &evt->info.cpnd,
+						  &evt->sinfo);
+		if (&evt->info.cpnd != cur_evt)
+			cpnd_evt_destroy(evt);
+	}
+}
+
+/****************************************************************************
+ * Name          : cpnd_evt_proc_nd2nd_ckpt_active_data_access_req
+ *
+ * Description   : Function to process write/read/overwrite
+ *                 from other ND to Active ND.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPSV_EVT *evt - Received Event structure
+ *                 CPSV_SEND_INFO *sinfo - Sender MDS information.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : Numbered all replica writes are applied in sequence.
+ *                 Writes received ahead of a missing one are held back for
+ *                 at most CPND_WRITE_GAP_TIMEOUT without progress and at
+ *                 most CPND_WRITE_WINDOW of them. Then the replica is
+ *                 resynced from the active replica, and the writes covered
+ *                 by the resync are acked when it has ended.
+ *****************************************************************************/
+static uint32_t
+cpnd_evt_proc_nd2nd_ckpt_active_data_access_req(CPND_CB *cb, CPND_EVT *evt,
+						CPSV_SEND_INFO *sinfo)
+{
+	uint32_t rc = NCSCC_RC_SUCCESS;
+	CPND_CKPT_NODE *cp_node = NULL;
+	CPSV_CKPT_ACCESS *req = &evt->info.ckpt_nd2nd_data;
+	NODE_ID node_id = m_NCS_NODE_ID_FROM_MDS_DEST(cb->cpnd_mdest_id);
+	uint32_t i;
+	int32_t diff;
+
+	TRACE_ENTER();
+
+	/* A multicast write is only for the listed replica nodes */
+	if (req->num_dest_nodes != 0) {
+		for (i = 0; i < req->num_dest_nodes; i++) {
+			if (req->dest_nodes[i] == node_id)
+				break;
+		}
+		if (i == req->num_dest_nodes) {
+			TRACE_LEAVE2("Not a replica node of ckpt_id:%llx",
+				     req->ckpt_id);
+			return rc;
+		}
+	}
+
+	cpnd_ckpt_node_get(cb, req->ckpt_id, &cp_node);
+	if (cp_node == NULL || req->seqno == 0) {
+		rc = cpnd_nd2nd_ckpt_data_access_apply(cb, evt, sinfo);
+		TRACE_LEAVE();
+		return rc;
+	}
+
+	if (!cp_node->rmt_write_resync &&
+	    sinfo->dest != cp_node->rmt_write_dest) {
+		if (cp_node->rmt_write_q == NULL && req->seqno == 1) {
+			/* First write of a new active replica */
+			TRACE_2("New write sequence for ckpt_id:%llx",
+				req->ckpt_id);
+			cp_node->rmt_write_dest = sinfo->dest;
+			cp_node->rmt_write_seqno = 0;
+		} else {
+			/* Earlier writes of this active replica are unknown */
+			cpnd_rmt_write_resync(cb, cp_node);
+		}
+	}
+
+	diff = (int32_t)(req->seqno - cp_node->rmt_write_seqno - 1);
+	if (cp_node->rmt_write_resync ||
+	    sinfo->dest != cp_node->rmt_write_dest || diff < 0) {
+		/* The write is applied already, or covered by the resync of
+		 * the replica */
+		rc = cpnd_nd2nd_ckpt_data_access_ack(cb, cp_node, evt, sinfo);
+		TRACE_LEAVE();
+		return rc;
+	}
+
+	if (diff == 0) {
+		cp_node->rmt_write_seqno = req->seqno;
+		rc = cpnd_nd2nd_ckpt_data_access_apply(cb, evt, sinfo);
+
+		/* Apply the held back writes now in sequence */
+		cpnd_rmt_write_queue_proc(cb, cp_node, false, evt);
+	} else if (diff >= CPND_WRITE_WINDOW ||
+		   cp_node->rmt_write_q_cnt + 1 >= CPND_WRITE_WINDOW) {
+		cpnd_rmt_write_resync(cb, cp_node);
+		rc = cpnd_nd2nd_ckpt_data_access_ack(cb, cp_node, evt, sinfo);
+		TRACE_LEAVE();
+		return rc;
+	} else {
+		TRACE_2("Write %u held back", req->seqno);
+		cpnd_rmt_write_queue_add(cp_node, evt);
+	}
+
+	/* Wait for a missing write until the gap timer expires without
+	 * progress. A resync in progress is supervised by the same timer. */
+	if (!cp_node->rmt_write_resyncing) {
+		if (cp_node->rmt_write_q == NULL) {
+			if (cp_node->rmt_write_tmr.is_active)
+				cpnd_tmr_stop(&cp_node->rmt_write_tmr);
+		} else if (diff == 0 || !cp_node->rmt_write_tmr.is_active) {
+			cpnd_rmt_write_tmr_start(cb, cp_node,
+						 CPND_WRITE_GAP_TIMEOUT);
+		}
+	}
+
 	TRACE_LEAVE();
 	return rc;
 }
 
+/****************************************************************************
+ * Name          : cpnd_rmt_write_resync
+ *
+ * Description   : Function to resync a remote replica that has missed an
+ *                 all replica write from the active replica.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPND_CKPT_NODE *cp_node - Checkpoint node
+ *
+ * Return Values : None.
+ *
+ * Notes         : The replica asks the active replica for a streamed sync.
+ *                 The sync response carries the sequence number of the
+ *                 last write of the active replica, the writes up to it are
+ *                 in the sync and the later ones are journaled until the
+ *                 sync has ended. A failed request is retried when the
+ *                 timer expires, and so is a resync that has not ended in
+ *                 time. A resync is started only after a sync of the new
+ *                 replica in progress has ended.
+ *****************************************************************************/
+static void cpnd_rmt_write_resync(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
+{
+	CPSV_EVT send_evt, *out_evt = NULL;
+	CPSV_EVT *q_evt = NULL;
+	uint32_t rc;
+
+	TRACE_ENTER2("ckpt_id:%llx", cp_node->ckpt_id);
+
+	if (cp_node->rmt_write_tmr.is_active)
+		cpnd_tmr_stop(&cp_node->rmt_write_tmr);
+
+	if (!cp_node->rmt_write_resync) {
+		LOG_NO("Missing write %u for ckpt_id:%llx, resyncing replica",
+		       cp_node->rmt_write_seqno + 1, cp_node->ckpt_id);
+		cp_node->rmt_write_resync = true;
+
+		/* The resync covers the held back writes */
+		while (cp_node->rmt_write_q != NULL) {
+			q_evt = cp_node->rmt_write_q;
+			cp_node->rmt_write_q = q_evt->next;
+			q_evt->next = NULL;
+			cpnd_nd2nd_ckpt_data_access_ack(cb, cp_node,
+							&q_evt->info.cpnd,
+							&q_evt->sinfo);
+			q_evt->info.cpnd.dont_free_me = false;
+			cpnd_evt_destroy(q_evt);
+		}
+		cp_node->rmt_write_q_cnt = 0;
+	}
+
+	if (cp_node->journal_writes && !cp_node->rmt_write_resyncing) {
+		/* Resync when the sync of the new replica has ended */
+		cpnd_rmt_write_tmr_start(cb, cp_node, CPND_WRITE_GAP_TIMEOUT);
+		TRACE_LEAVE();
+		return;
+	}
+
+	/* Drop the writes journaled during an earlier resync */
+	cpnd_evt_backup_queue_cleanup(cp_node);
+	cp_node->rmt_write_resyncing = false;
+
+	if (!cp_node->is_active_exist) {
+		TRACE_4("No active replica to resync ckpt_id:%llx from",
+			cp_node->ckpt_id);
+		cpnd_rmt_write_tmr_start(cb, cp_node, CPND_WRITE_GAP_TIMEOUT);
+		TRACE_LEAVE();
+		return;
+	}
+
+	memset(&send_evt, '\0', sizeof(CPSV_EVT));
+	send_evt.type = CPSV_EVT_TYPE_CPND;
+	send_evt.info.cpnd.type = CPND_EVT_ND2ND_CKPT_SYNC_REQ;
+	send_evt.info.cpnd.info.sync_req.ckpt_id = cp_node->ckpt_id;
+	send_evt.info.cpnd.info.sync_req.invocation =
+	    ++cp_node->rmt_write_resync_id;
+	send_evt.info.cpnd.info.sync_req.is_ckpt_open = true;
+	send_evt.info.cpnd.info.sync_req.stream_sync = true;
+
+	rc = cpnd_mds_msg_sync_send(cb, NCSMDS_SVC_ID_CPND,
+				    cp_node->active_mds_dest, &send_evt,
+				    &out_evt, CPSV_WAIT_TIME);
+	if (rc != NCSCC_RC_SUCCESS || out_evt == NULL ||
+	    out_evt->info.cpnd.error != SA_AIS_OK) {
+		LOG_NO("Resync request for ckpt_id:%llx failed, rc:%u",
+		       cp_node->ckpt_id, rc);
+		if (out_evt)
+			cpnd_evt_destroy(out_evt);
+		cpnd_rmt_write_tmr_start(cb, cp_node, CPND_WRITE_GAP_TIMEOUT);
+		TRACE_LEAVE();
+		return;
+	}
+
+	cp_node->rmt_write_resync = false;
+	cp_node->rmt_write_dest = cp_node->active_mds_dest;
+	cp_node->rmt_write_seqno =
+	    out_evt->info.cpnd.info.ckpt_nd2nd_sync.seqno;
+	if (out_evt->info.cpnd.info.ckpt_nd2nd_sync.num_of_elmts != 0) {
+		cp_node->journal_writes = true;
+		cp_node->rmt_write_resyncing = true;
+		cpnd_rmt_write_tmr_start(
+		    cb, cp_node,
+		    CPND_WAIT_TIME(cp_node->create_attrib.checkpointSize));
+	} else {
+		/* Nothing to stream, the resync has ended */
+		cpnd_rmt_write_ack_queue_proc(cb, cp_node);
+	}
+	TRACE_2("Resync of ckpt_id:%llx from write %u",
+		cp_node->ckpt_id, cp_node->rmt_write_seqno);
+	cpnd_evt_destroy(out_evt);
+	TRACE_LEAVE();
+}
+
 /****************************************************************************
  * Name          : cpnd_evt_proc_nd2nd_ckpt_active_data_access_rsp
  *
@@ -4007,7 +4477,7 @@ cpnd_evt_proc_nd2nd_ckpt_active_data_access_rsp(CPND_CB *cb, CPND_EVT *evt,
 	TRACE_ENTER();
 	cpnd_ckpt_node_get(cb, evt->info.ckpt_nd2nd_data_rsp.ckpt_id, &cp_node);
 	cpnd_evt_node_get(cb, evt->info.ckpt_nd2nd_data_rsp.lcl_ckpt_id,
-			  &evt_node);
+			  evt->info.ckpt_nd2nd_data_rsp.seqno, &evt_node);
 
 	memset(&rsp_evt, '\0', sizeof(CPSV_EVT));
 
@@ -4306,7 +4776,8 @@ static uint32_t cpnd_evt_proc_arrival_cbunreg(CPND_CB *cb, CPND_EVT *evt,
  *
  * Return Values : NCSCC_RC_SUCCESS/Error.
  *
- * Notes         : None.
+ * Notes         : A new replica asking for a streamed sync is sent the
+ *                 sections in chunks as it acknowledges them.
  *****************************************************************************/
 static uint32_t cpnd_evt_proc_nd2nd_ckpt_sync_req(CPND_CB *cb, CPND_EVT *evt,
 						  CPSV_SEND_INFO *sinfo)
@@ -4315,6 +4786,7 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_sync_req(CPND_CB *cb, CPND_EVT *evt,
 	CPND_CKPT_NODE *cp_node = NULL;
 	CPSV_EVT send_evt;
 	CPSV_CPND_DEST_INFO dest_list;
+	CPND_SYNC_SESSION *session = NULL;
 
 	TRACE_ENTER();
 	memset(&send_evt, '\0', sizeof(CPSV_EVT));
@@ -4334,17 +4806,43 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_sync_req(CPND_CB *cb, CPND_EVT *evt,
 		return rc;
 	}
 
-	if (cp_node->create_attrib.creationFlags &
-	    SA_CKPT_CHECKPOINT_COLLOCATED) {
+	if ((cp_node->create_attrib.creationFlags &
+	     SA_CKPT_CHECKPOINT_COLLOCATED) ||
+	    evt->info.sync_req.stream_sync) {
+		/* The writes up to this sequence number are in the sync */
 		send_evt.info.cpnd.info.ckpt_nd2nd_sync.num_of_elmts =
 		    cp_node->replica_info.n_secs;
+		send_evt.info.cpnd.info.ckpt_nd2nd_sync.seqno =
+		    cp_node->write_seqno;
 		rc = cpnd_mds_send_rsp(cb, sinfo, &send_evt);
 	}
+	if (evt->info.sync_req.stream_sync &&
+	    evt->info.sync_req.cpa_sinfo.dest == 0)
+		LOG_NO("Replica on node 0x%X missed writes of ckpt_id:%llx, "
+		       "resyncing from write %u",
+		       m_NCS_NODE_ID_FROM_MDS_DEST(sinfo->dest),
+		       cp_node->ckpt_id, cp_node->write_seqno);
 
 	if ((cp_node->replica_info.n_secs > 0) &&
 	    !cpnd_ckpt_sec_empty(&cp_node->replica_info)) {
 
-		if (evt->info.sync_req.is_ckpt_open) {
+		if (evt->info.sync_req.is_ckpt_open &&
+		    evt->info.sync_req.stream_sync) {
+			/* Restart a sync already in progress */
+			cpnd_sync_session_del(cp_node, sinfo->dest);
+			session = m_MMGR_ALLOC_CPND_DEFAULT(
+			    sizeof(CPND_SYNC_SESSION));
+			memset(session, 0, sizeof(CPND_SYNC_SESSION));
+			session->dest = sinfo->dest;
+			session->sync_req = evt->info.sync_req;
+			session->next = cp_node->sync_sessions;
+			cp_node->sync_sessions = session;
+			TRACE_2("Streamed sync of ckpt_id:%llx to %" PRIu64,
+				cp_node->ckpt_id, sinfo->dest);
+			if (cpnd_sync_session_send(cb, cp_node, session) !=
+			    NCSCC_RC_SUCCESS)
+				cpnd_sync_session_del(cp_node, sinfo->dest);
+		} else if (evt->info.sync_req.is_ckpt_open) {
 			dest_list.dest = sinfo->dest;
 			dest_list.next = NULL;
 			cpnd_transfer_replica(cb, cp_node,
@@ -4389,6 +4887,7 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_active_sync(CPND_CB *cb, CPND_EVT *evt,
 	uint32_t err_flag = 0;
 	CPSV_EVT des_evt, *out_evt = NULL;
 	uint32_t errflag = 0;
+	bool resync;
 
 	TRACE_ENTER();
 	memset(&send_evt, '\0', sizeof(CPSV_EVT));
@@ -4399,6 +4898,15 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_active_sync(CPND_CB *cb, CPND_EVT *evt,
 			evt->info.ckpt_nd2nd_sync.ckpt_id);
 		return NCSCC_RC_FAILURE;
 	}
+	resync = evt->info.ckpt_nd2nd_sync.ckpt_sync.stream_sync &&
+		 evt->info.ckpt_nd2nd_sync.ckpt_sync.cpa_sinfo.dest == 0;
+	if (resync && (!cp_node->rmt_write_resyncing ||
+		       evt->info.ckpt_nd2nd_sync.ckpt_sync.invocation !=
+			   cp_node->rmt_write_resync_id)) {
+		TRACE_4("Stale resync chunk for ckpt_id:%llx",
+			cp_node->ckpt_id);
+		return NCSCC_RC_SUCCESS;
+	}
 	if (cp_node->cpnd_rep_create) {
 		if (cpnd_ckpt_update_replica(
 			cb, cp_node, &evt->info.ckpt_nd2nd_sync,
@@ -4406,7 +4914,38 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_active_sync(CPND_CB *cb, CPND_EVT *evt,
 			&errflag) != NCSCC_RC_SUCCESS)
 			cp_node->open_active_sync_tmr.is_active_sync_err = true;
 
+		if (evt->info.ckpt_nd2nd_sync.ckpt_sync.stream_sync) {
+			/* Ask the active replica for the next chunk */
+			send_evt.type = CPSV_EVT_TYPE_CPND;
+			send_evt.info.cpnd.type = CPND_EVT_ND2ND_CKPT_SYNC_ACK;
+			send_evt.info.cpnd.info.sync_ack.ckpt_id =
+			    cp_node->ckpt_id;
+			send_evt.info.cpnd.info.sync_ack.seqno =
+			    evt->info.ckpt_nd2nd_sync.seqno;
+			if (cpnd_mds_msg_send(cb, NCSMDS_SVC_ID_CPND,
+					      sinfo->dest,
+					      &send_evt) != NCSCC_RC_SUCCESS)
+				TRACE_4(
+				    "cpnd sync ack send failed for ckpt_id:%llx",
+				    cp_node->ckpt_id);
+			memset(&send_evt, '\0', sizeof(CPSV_EVT));
+		}
+
 		if (evt->info.ckpt_nd2nd_sync.last_seq == true) {
+			/* Apply the writes received during the sync */
+			cpnd_evt_backup_queue_proc(cb, cp_node);
+			if (resync) {
+				TRACE_2("Resync of ckpt_id:%llx ended",
+					cp_node->ckpt_id);
+				cp_node->rmt_write_resyncing = false;
+				cpnd_rmt_write_ack_queue_proc(cb, cp_node);
+				if (cp_node->rmt_write_tmr.is_active)
+					cpnd_tmr_stop(&cp_node->rmt_write_tmr);
+				if (cp_node->rmt_write_q != NULL)
+					cpnd_rmt_write_tmr_start(
+					    cb, cp_node,
+					    CPND_WRITE_GAP_TIMEOUT);
+			}
 
 			if (evt->info.ckpt_nd2nd_sync.ckpt_sync.is_ckpt_open ==
 			    false) {
@@ -4567,6 +5106,10 @@ static uint32_t cpnd_evt_proc_nd2nd_ckpt_active_sync(CPND_CB *cb, CPND_EVT *evt,
 					}
 				}
 			}
+
+			/* Start a resync held back by the sync */
+			if (!resync && cp_node->rmt_write_resync)
+				cpnd_rmt_write_resync(cb, cp_node);
 		}
 	}
 
@@ -4689,11 +5232,13 @@ static uint32_t cpnd_evt_proc_timer_expiry(CPND_CB *cb, CPND_EVT *evt)
 	}
 
 	cpnd_ckpt_node_get(cb, evt->info.tmr_info.ckpt_id, &cp_node);
-	cpnd_evt_node_get(cb, evt->info.tmr_info.lcl_ckpt_hdl, &evt_node);
+	cpnd_evt_node_get(cb, evt->info.tmr_info.lcl_ckpt_hdl,
+			  evt->info.tmr_info.write_seqno, &evt_node);
 
 	if ((evt->info.tmr_info.type == CPND_TMR_TYPE_RETENTION) ||
 	    (evt->info.tmr_info.type == CPND_TMR_TYPE_NON_COLLOC_RETENTION) ||
-	    (evt->info.tmr_info.type == CPND_TMR_OPEN_ACTIVE_SYNC)) {
+	    (evt->info.tmr_info.type == CPND_TMR_OPEN_ACTIVE_SYNC) ||
+	    (evt->info.tmr_info.type == CPND_TMR_TYPE_RMT_WRITE)) {
 
 		if (cp_node == NULL) {
 			TRACE_4("cpnd ckpt replica destroy failed ckpt_id:%llx",
@@ -4781,6 +5326,12 @@ static uint32_t cpnd_evt_proc_timer_expiry(CPND_CB *cb, CPND_EVT *evt)
 			TRACE_4("cpnd open active sync expiry failed %d", rc);
 		}
 		break;
+	case CPND_TMR_TYPE_RMT_WRITE:
+		/* A write is still missing, or a resync has not ended */
+		if (cp_node->rmt_write_q != NULL || cp_node->rmt_write_resync ||
+		    cp_node->rmt_write_resyncing)
+			cpnd_rmt_write_resync(cb, cp_node);
+		break;
 	}
 done:
 	TRACE_LEAVE();
@@ -4802,6 +5353,7 @@ done:
 static uint32_t cpnd_evt_proc_mds_evt(CPND_CB *cb, CPND_EVT *evt)
 {
 	uint32_t rc = NCSCC_RC_SUCCESS;
+	CPND_CKPT_NODE *cp_node = NULL;
 
 	if ((evt->info.mds_info.change == NCSMDS_DOWN) &&
 	    evt->info.mds_info.svc_id == NCSMDS_SVC_ID_CPA) {
@@ -4830,8 +5382,29 @@ static uint32_t cpnd_evt_proc_mds_evt(CPND_CB *cb, CPND_EVT *evt)
 			cpnd_proc_ckpt_info_update(cb);
 			cb->is_cpd_need_update = false;
 		}
+	} else if ((evt->info.mds_info.change == NCSMDS_UP) &&
+		   evt->info.mds_info.svc_id == NCSMDS_SVC_ID_CPND) {
+		if (evt->info.mds_info.rem_svc_pvt_ver <
+		    CPND_MCAST_WRITE_SUBPART_VER) {
+			cb->prev_ver_cpnd_cnt++;
+			TRACE_2("Previous version CPND up, count: %u",
+				cb->prev_ver_cpnd_cnt);
+		}
 	} else if ((evt->info.mds_info.change == NCSMDS_DOWN) &&
 		   evt->info.mds_info.svc_id == NCSMDS_SVC_ID_CPND) {
+		if (evt->info.mds_info.rem_svc_pvt_ver <
+			CPND_MCAST_WRITE_SUBPART_VER &&
+		    cb->prev_ver_cpnd_cnt > 0)
+			cb->prev_ver_cpnd_cnt--;
+
+		/* A restarted active replica numbers its writes from one */
+		cpnd_ckpt_node_getnext(cb, 0, &cp_node);
+		while (cp_node != NULL) {
+			if (cp_node->rmt_write_dest == evt->info.mds_info.dest)
+				cp_node->rmt_write_dest = 0;
+			cpnd_ckpt_node_getnext(cb, cp_node->ckpt_id, &cp_node);
+		}
+
 		/* In headless state, when the cpnd is down the node also
 		 * restart. Thus the non-collocated checkpoint which has active
 		 * replica located on this node should be deleted */
@@ -5026,8 +5599,7 @@ static uint32_t cpnd_evt_proc_ckpt_destroy(CPND_CB *cb, CPND_EVT *evt,
 			m_MMGR_FREE_CPND_DEFAULT(
 			    cp_node->replica_info.open.info.open.i_name);
 			/* freeing the sec_mapping memory */
-			m_MMGR_FREE_CPND_DEFAULT(
-			    cp_node->replica_info.shm_sec_mapping);
+			cpnd_ckpt_lck_sec_ids_free(cp_node);
 		}
 
 		TRACE_4("cpnd ckpt replica destroy success for ckpt_id:%llx",
@@ -5283,7 +5855,10 @@ static uint32_t cpnd_evt_proc_ckpt_iter_getnext(CPND_CB *cb, CPND_EVT *evt,
 	CPND_CKPT_NODE *cp_node = NULL;
 	CPSV_EVT send_evt;
 	SaCkptSectionDescriptorT sect_desc;
+	SaCkptSectionDescriptorT *descs = NULL;
+	uint32_t num_descs = 0;
 	uint32_t num_secs_trav = 0;
+	uint32_t batch_size;
 
 	TRACE_ENTER();
 	/*  evt contain filter iter_id section_id ckpt_id */
@@ -5323,6 +5898,30 @@ static uint32_t cpnd_evt_proc_ckpt_iter_getnext(CPND_CB *cb, CPND_EVT *evt,
 
 		memcpy(&send_evt.info.cpa.info.iter_next_rsp.sect_desc,
 		       &sect_desc, sizeof(SaCkptSectionDescriptorT));
+
+		/* Return the following sections as well if the agent asked
+		 * for a batch */
+		batch_size = evt->info.iter_getnext.batch_size;
+		if (batch_size > CPSV_SECT_ITER_BATCH_MAX)
+			batch_size = CPSV_SECT_ITER_BATCH_MAX;
+		if (batch_size > 1)
+			descs = malloc((batch_size - 1) *
+				       sizeof(SaCkptSectionDescriptorT));
+		if (descs != NULL) {
+			CPSV_A2ND_SECT_ITER_GETNEXT get_next =
+			    evt->info.iter_getnext;
+			SaCkptSectionDescriptorT *prev = &sect_desc;
+
+			while (num_descs < batch_size - 1) {
+				get_next.section_id = prev->sectionId;
+				get_next.n_secs_trav = num_secs_trav;
+				if (cpnd_proc_getnext_section(
+					cp_node, &get_next, &descs[num_descs],
+					&num_secs_trav) != NCSCC_RC_SUCCESS)
+					break;
+				prev = &descs[num_descs++];
+			}
+		}
 		/* need to cpy sec_id */
 		rc = SA_AIS_OK;
 	} else {
@@ -5339,8 +5938,12 @@ agent_rsp:
 	send_evt.info.cpa.info.iter_next_rsp.iter_id =
 	    evt->info.iter_getnext.iter_id;
 	send_evt.info.cpa.info.iter_next_rsp.n_secs_trav = num_secs_trav;
+	send_evt.info.cpa.info.iter_next_rsp.num_descs = num_descs;
+	send_evt.info.cpa.info.iter_next_rsp.descs = descs;
 
 	rc = cpnd_mds_send_rsp(cb, sinfo, &send_evt);
+	/* The section ids of descs belong to the replica */
+	free(descs);
 	TRACE_LEAVE();
 	return rc;
 }
@@ -5666,6 +6269,9 @@ uint32_t cpnd_evt_destroy(CPSV_EVT *evt)
 				tmp_data = next_data;
 			} while (tmp_data != NULL);
 		}
+		if (evt->info.cpnd.info.ckpt_nd2nd_data.dest_nodes != NULL)
+			m_MMGR_FREE_CPSV_SYS_MEMORY(
+			    evt->info.cpnd.info.ckpt_nd2nd_data.dest_nodes);
 	} else if (evt->info.cpnd.type ==
 		   CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_RSP) {
 		switch (evt->info.cpnd.info.ckpt_nd2nd_data_rsp.type) {
@@ -5870,3 +6476,185 @@ static uint32_t cpnd_transfer_replica(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 	TRACE_LEAVE();
 	return NCSCC_RC_FAILURE;
 }
+
+/****************************************************************************
+ * Name          : cpnd_sync_session_send
+ *
+ * Description   : This routine sends the next chunks of a streamed replica
+ *                 sync, as long as less than CPND_SYNC_WINDOW chunks are
+ *                 waiting to be acknowledged.
+ *
+ * Arguments     : cb - CPND Control Block pointer
+ *                 cp_node - Checkpoint node of the active replica
+ *                 session - Sync session of the new replica
+ *
+ * Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ *
+ * Notes         : The section data is encoded straight from the replica
+ *                 shared memory. A chunk holds at least one section, and
+ *                 otherwise at most CPND_SYNC_CHUNK_SIZE bytes of data.
+ *                 The sync resumes after the last section sent, so the
+ *                 sections created or deleted meanwhile are taken into
+ *                 account.
+ *****************************************************************************/
+static uint32_t cpnd_sync_session_send(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
+				       CPND_SYNC_SESSION *session)
+{
+	CPSV_EVT send_evt;
+	CPSV_CKPT_ACCESS *sync = &send_evt.info.cpnd.info.ckpt_nd2nd_sync;
+	CPSV_CKPT_DATA *sec_data = NULL, *tmp_sec_data = NULL;
+	CPND_CKPT_SECTION_INFO *sec_info = NULL, *last_sec_info = NULL;
+	uint32_t rc = NCSCC_RC_SUCCESS;
+	SaSizeT size;
+
+	TRACE_ENTER();
+	memset(&send_evt, '\0', sizeof(CPSV_EVT));
+
+	send_evt.type = CPSV_EVT_TYPE_CPND;
+	send_evt.info.cpnd.type = CPND_EVT_ND2ND_CKPT_ACTIVE_SYNC;
+	sync->type = CPSV_CKPT_ACCESS_SYNC;
+	sync->ckpt_id = cp_node->ckpt_id;
+	sync->ckpt_sync = session->sync_req;
+
+	while (!session->done &&
+	       session->seqno - session->acked_seqno < CPND_SYNC_WINDOW) {
+		if (session->seqno == 0)
+			sec_info =
+			    cpnd_ckpt_sec_get_first(&cp_node->replica_info);
+		else
+			sec_info = cpnd_ckpt_sec_get_after(
+			    &cp_node->replica_info, &session->last_sec_id);
+
+		sec_data = NULL;
+		last_sec_info = NULL;
+		sync->num_of_elmts = 0;
+		size = 0;
+		while (sec_info != NULL &&
+		       (sync->num_of_elmts == 0 ||
+			size + sec_info->sec_size <= CPND_SYNC_CHUNK_SIZE)) {
+			tmp_sec_data = m_MMGR_ALLOC_CPSV_CKPT_DATA;
+			memset(tmp_sec_data, '\0', sizeof(CPSV_CKPT_DATA));
+
+			tmp_sec_data->sec_id = sec_info->sec_id;
+			tmp_sec_data->expirationTime = sec_info->exp_tmr;
+			tmp_sec_data->dataSize = sec_info->sec_size;
+			tmp_sec_data->data =
+			    (char *)
+				cp_node->replica_info.open.info.open.o_addr +
+			    sizeof(CPSV_CKPT_HDR) +
+			    ((sec_info->lcl_sec_id + 1) *
+			     sizeof(CPSV_SECT_HDR)) +
+			    (sec_info->lcl_sec_id *
+			     cp_node->create_attrib.maxSectionSize);
+
+			tmp_sec_data->next = sec_data;
+			sec_data = tmp_sec_data;
+
+			size += sec_info->sec_size;
+			sync->num_of_elmts++;
+			last_sec_info = sec_info;
+			sec_info = cpnd_ckpt_sec_get_next(
+			    &cp_node->replica_info, sec_info);
+		}
+
+		if (last_sec_info != NULL) {
+			/* The section may be deleted before the next chunk */
+			if (session->last_sec_id.id != NULL)
+				m_MMGR_FREE_CPND_DEFAULT(
+				    session->last_sec_id.id);
+			session->last_sec_id.idLen =
+			    last_sec_info->sec_id.idLen;
+			session->last_sec_id.id = m_MMGR_ALLOC_CPND_DEFAULT(
+			    last_sec_info->sec_id.idLen + 1);
+			memcpy(session->last_sec_id.id,
+			       last_sec_info->sec_id.id,
+			       last_sec_info->sec_id.idLen);
+		}
+
+		session->done = (sec_info == NULL);
+		session->seqno++;
+		sync->data = sec_data;
+		sync->seqno = session->seqno;
+		sync->last_seq = session->done;
+
+		rc = cpnd_mds_msg_send(cb, NCSMDS_SVC_ID_CPND, session->dest,
+				       &send_evt);
+
+		/* The data itself belongs to the replica */
+		while (sec_data != NULL) {
+			tmp_sec_data = sec_data;
+			sec_data = sec_data->next;
+			m_MMGR_FREE_CPSV_CKPT_DATA(tmp_sec_data);
+		}
+
+		if (rc != NCSCC_RC_SUCCESS) {
+			LOG_NO("Sync of ckpt_id:%llx to %" PRIu64 " failed",
+			       cp_node->ckpt_id, session->dest);
+			break;
+		}
+		TRACE_2("Sync chunk %u with %u sections sent", sync->seqno,
+			sync->num_of_elmts);
+	}
+
+	TRACE_LEAVE();
+	return rc;
+}
+
+/****************************************************************************
+ * Name          : cpnd_evt_proc_nd2nd_ckpt_sync_ack
+ *
+ * Description   : Function to process the ack of a streamed sync chunk
+ *                 from the CPND of a new replica.
+ *
+ * Arguments     : CPND_CB *cb - CPND CB pointer
+ *                 CPSV_EVT *evt - Received Event structure
+ *                 CPSV_SEND_INFO *sinfo - Sender MDS information.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : The sync session ends when its last chunk is acked.
+ *****************************************************************************/
+static uint32_t cpnd_evt_proc_nd2nd_ckpt_sync_ack(CPND_CB *cb, CPND_EVT *evt,
+						  CPSV_SEND_INFO *sinfo)
+{
+	uint32_t rc = NCSCC_RC_SUCCESS;
+	CPND_CKPT_NODE *cp_node = NULL;
+	CPND_SYNC_SESSION *session = NULL;
+
+	TRACE_ENTER();
+	cpnd_ckpt_node_get(cb, evt->info.sync_ack.ckpt_id, &cp_node);
+	if (cp_node == NULL) {
+		TRACE_4("cpnd ckpt node get failed for ckpt_id:%llx",
+			evt->info.sync_ack.ckpt_id);
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	for (session = cp_node->sync_sessions; session != NULL;
+	     session = session->next) {
+		if (session->dest == sinfo->dest)
+			break;
+	}
+	if (session == NULL || evt->info.sync_ack.seqno > session->seqno ||
+	    evt->info.sync_ack.seqno <= session->acked_seqno) {
+		TRACE_LEAVE2("Unexpected sync ack %u",
+			     evt->info.sync_ack.seqno);
+		return NCSCC_RC_FAILURE;
+	}
+
+	session->acked_seqno = evt->info.sync_ack.seqno;
+	if (session->done) {
+		if (session->acked_seqno == session->seqno) {
+			TRACE_2("Sync of ckpt_id:%llx to %" PRIu64 " done",
+				cp_node->ckpt_id, sinfo->dest);
+			cpnd_sync_session_del(cp_node, sinfo->dest);
+		}
+	} else if (cpnd_sync_session_send(cb, cp_node, session) !=
+		   NCSCC_RC_SUCCESS) {
+		cpnd_sync_session_del(cp_node, sinfo->dest);
+		rc = NCSCC_RC_FAILURE;
+	}
+
+	TRACE_LEAVE();
+	return rc;
+}
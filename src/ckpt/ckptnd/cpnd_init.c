@@ -228,6 +228,13 @@ static uint32_t cpnd_lib_init(CPND_CREATE_INFO *info)
 		cb->shm_alloc_guaranteed = 2;
 	}
 
+	/* Multicast all replica writes, unless disabled */
+	if ((ptr = getenv("OSAF_CKPT_MCAST_WRITE")) != NULL) {
+		cb->mcast_write = (atoi(ptr) != 0);
+	} else {
+		cb->mcast_write = true;
+	}
+
 	/* create a mail box */
 	if ((rc = m_NCS_IPC_CREATE(&cb->cpnd_mbx)) != NCSCC_RC_SUCCESS) {
 		LOG_ER("cpnd ipc create fail");
@@ -95,7 +95,10 @@ void cpnd_ckpt_replica_delete(CPND_CB *cb, CPND_CKPT_NODE *ckpt_node);
 uint32_t cpnd_ckpt_replica_create(CPND_CB *cb, CPND_CKPT_NODE *cp_node);
 uint32_t cpnd_ckpt_remote_cpnd_add(CPND_CKPT_NODE *cp_node, MDS_DEST mds_info);
 uint32_t cpnd_ckpt_remote_cpnd_del(CPND_CKPT_NODE *cp_node, MDS_DEST mds_info);
+uint32_t cpnd_ckpt_lck_sec_ids_init(CPND_CKPT_NODE *cp_node);
+void cpnd_ckpt_lck_sec_ids_free(CPND_CKPT_NODE *cp_node);
 int32_t cpnd_ckpt_get_lck_sec_id(CPND_CKPT_NODE *cp_node);
+void cpnd_ckpt_put_lck_sec_id(CPND_CKPT_NODE *cp_node, uint32_t lcl_sec_id);
 uint32_t cpnd_ckpt_sec_write(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
                              CPND_CKPT_SECTION_INFO *sec_info, const void *data,
                              uint64_t size, uint64_t offset, uint32_t type);
@@ -191,8 +194,8 @@ uint32_t cpnd_client_node_add(CPND_CB *cb, CPND_CKPT_CLIENT_NODE *ckpt_node);
 uint32_t cpnd_client_node_del(CPND_CB *cb,
                               CPND_CKPT_CLIENT_NODE *ckpt_client_node);
 void cpnd_evt_node_get(CPND_CB *cb, SaCkptCheckpointHandleT lcl_ckpt_id,
-                       CPSV_CPND_ALL_REPL_EVT_NODE **evt_node);
-void cpnd_evt_node_getnext(CPND_CB *cb, SaCkptCheckpointHandleT lcl_ckpt_id,
+                       SaUint32T seqno, CPSV_CPND_ALL_REPL_EVT_NODE **evt_node);
+void cpnd_evt_node_getnext(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_KEY *key,
                            CPSV_CPND_ALL_REPL_EVT_NODE **evt_node);
 uint32_t cpnd_evt_node_add(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_NODE *evt_node);
 uint32_t cpnd_evt_node_del(CPND_CB *cb, CPSV_CPND_ALL_REPL_EVT_NODE *evt_node);
@@ -202,6 +205,14 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_add(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
                                           SaCkptSectionIdT *id,
                                           SaTimeT exp_time, uint32_t gen_flag);
 void cpnd_evt_backup_queue_add(CPND_CKPT_NODE *cp_node, CPND_EVT *evt);
+void cpnd_rmt_write_queue_add(CPND_CKPT_NODE *cp_node, CPND_EVT *evt);
+void cpnd_rmt_write_queue_cleanup(CPND_CKPT_NODE *cp_node);
+void cpnd_rmt_write_ack_queue_add(CPND_CKPT_NODE *cp_node,
+                                  const CPND_RMT_WRITE_ACK *ack);
+void cpnd_rmt_write_ack_queue_cleanup(CPND_CKPT_NODE *cp_node);
+void cpnd_evt_backup_queue_proc(CPND_CB *cb, CPND_CKPT_NODE *cp_node);
+void cpnd_evt_backup_queue_cleanup(CPND_CKPT_NODE *cp_node);
+void cpnd_sync_session_del(CPND_CKPT_NODE *cp_node, MDS_DEST dest);
 uint32_t cpnd_ckpt_node_tree_init(CPND_CB *cb);
 uint32_t cpnd_allrepl_write_evt_node_tree_init(CPND_CB *cb);
 uint32_t cpnd_client_node_tree_init(CPND_CB *cb);
@@ -242,6 +253,7 @@ uint32_t cpnd_mds_register(CPND_CB *cb);
 void cpnd_mds_unregister(CPND_CB *cb);
 uint32_t cpnd_mds_get_handle(CPND_CB *cb);
 uint32_t cpnd_mds_bcast_send(CPND_CB *cb, CPSV_EVT *evt, NCSMDS_SVC_ID to_svc);
+uint32_t cpnd_mds_mcast_send(CPND_CB *cb, CPSV_EVT *evt);
 /* End : --- cpnd_mds.c */
 
 /* File : ----  cpnd_evt.c */
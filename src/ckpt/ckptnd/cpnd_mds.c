@@ -42,15 +42,21 @@ static uint32_t cpnd_mds_dec_flat(CPND_CB *cb,
 static uint32_t cpnd_mds_send_try_again_rsp(CPND_CB *cb, CPSV_EVT *pEvt);
 static uint32_t cpsv_ckpt_access_decode(CPSV_CKPT_ACCESS *ckpt_data,
 					NCS_UBAID *io_uba);
+static uint32_t cpnd_dest_nodes_encode(CPSV_CKPT_ACCESS *ckpt_data,
+				       NCS_UBAID *io_uba);
+static uint32_t cpnd_dest_nodes_decode(CPSV_CKPT_ACCESS *ckpt_data,
+				       NCS_UBAID *io_uba);
 
 FUNC_DECLARATION(CPSV_EVT);
 
 /* Message Format Verion Tables at CPND */
 MDS_CLIENT_MSG_FORMAT_VER
-    cpnd_cpa_msg_fmt_table[CPND_WRT_CPA_SUBPART_VER_RANGE] = {1, 2, 3, 4};
+    cpnd_cpa_msg_fmt_table[CPND_WRT_CPA_SUBPART_VER_RANGE] = {1, 2, 3, 4,
+								5};
 
 MDS_CLIENT_MSG_FORMAT_VER
-    cpnd_cpnd_msg_fmt_table[CPND_WRT_CPND_SUBPART_VER_RANGE] = {1, 2, 3, 4};
+    cpnd_cpnd_msg_fmt_table[CPND_WRT_CPND_SUBPART_VER_RANGE] = {1, 2, 3, 4,
+								5, 6};
 
 MDS_CLIENT_MSG_FORMAT_VER
     cpnd_cpd_msg_fmt_table[CPND_WRT_CPD_SUBPART_VER_RANGE] = {1, 2, 3};
@@ -381,9 +387,62 @@ static uint32_t cpnd_mds_enc(CPND_CB *cb, MDS_CALLBACK_ENC_INFO *enc_info)
 				rc = cpsv_ckpt_access_encode(
 				    &pevt->info.cpnd.info.ckpt_nd2nd_sync,
 				    io_uba);
+				if (rc == NCSCC_RC_SUCCESS &&
+				    enc_info->o_msg_fmt_ver >=
+					CPND_STREAM_SYNC_MSG_FMT_VER) {
+					pstream =
+					    ncs_enc_reserve_space(io_uba, 1);
+					if (!pstream)
+						return m_CPSV_DBG_SINK(
+						    NCSCC_RC_FAILURE,
+						    "Memory alloc failed in cpnd_mds_enc \n");
+					ncs_encode_8bit(
+					    &pstream,
+					    pevt->info.cpnd.info.ckpt_nd2nd_sync
+						.ckpt_sync.stream_sync);
+					ncs_enc_claim_space(io_uba, 1);
+				}
 				TRACE_LEAVE();
 				return rc;
 
+			case CPND_EVT_ND2ND_CKPT_SYNC_ACK:
+
+				pstream = ncs_enc_reserve_space(io_uba, 12);
+				if (!pstream)
+					return m_CPSV_DBG_SINK(
+					    NCSCC_RC_FAILURE,
+					    "Memory alloc failed in cpnd_mds_enc \n");
+				ncs_encode_32bit(
+				    &pstream, pevt->type); /* CPSV_EVT Type */
+				ncs_encode_32bit(
+				    &pstream,
+				    pevt->info.cpnd.error); /* cpnd_evt error
+							       This is for
+							       backword
+							       compatible
+							       purpose with EDU
+							       enc/dec with
+							       3.0.2 */
+				ncs_encode_32bit(
+				    &pstream, pevt->info.cpnd
+						  .type); /* cpnd_evt SubType */
+				ncs_enc_claim_space(io_uba, 12);
+
+				pstream = ncs_enc_reserve_space(io_uba, 12);
+				if (!pstream)
+					return m_CPSV_DBG_SINK(
+					    NCSCC_RC_FAILURE,
+					    "Memory alloc failed in cpnd_mds_enc \n");
+				ncs_encode_64bit(
+				    &pstream,
+				    pevt->info.cpnd.info.sync_ack.ckpt_id);
+				ncs_encode_32bit(
+				    &pstream,
+				    pevt->info.cpnd.info.sync_ack.seqno);
+				ncs_enc_claim_space(io_uba, 12);
+				TRACE_LEAVE();
+				return NCSCC_RC_SUCCESS;
+
 			case CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_REQ:
 
 				pstream = ncs_enc_reserve_space(io_uba, 12);
@@ -410,6 +469,13 @@ static uint32_t cpnd_mds_enc(CPND_CB *cb, MDS_CALLBACK_ENC_INFO *enc_info)
 				rc = cpsv_ckpt_access_encode(
 				    &pevt->info.cpnd.info.ckpt_nd2nd_data,
 				    io_uba);
+				if (rc == NCSCC_RC_SUCCESS &&
+				    enc_info->o_msg_fmt_ver >=
+					CPND_MCAST_WRITE_MSG_FMT_VER)
+					rc = cpnd_dest_nodes_encode(
+					    &pevt->info.cpnd.info
+						 .ckpt_nd2nd_data,
+					    io_uba);
 				TRACE_LEAVE();
 				return rc;
 
@@ -439,6 +505,21 @@ static uint32_t cpnd_mds_enc(CPND_CB *cb, MDS_CALLBACK_ENC_INFO *enc_info)
 				rc = cpsv_data_access_rsp_encode(
 				    &pevt->info.cpnd.info.ckpt_nd2nd_data_rsp,
 				    io_uba, enc_info->o_msg_fmt_ver);
+				if (rc == NCSCC_RC_SUCCESS &&
+				    enc_info->o_msg_fmt_ver >=
+					CPND_MCAST_WRITE_MSG_FMT_VER) {
+					pstream =
+					    ncs_enc_reserve_space(io_uba, 4);
+					if (!pstream)
+						return m_CPSV_DBG_SINK(
+						    NCSCC_RC_FAILURE,
+						    "Memory alloc failed in cpnd_mds_enc \n");
+					ncs_encode_32bit(
+					    &pstream,
+					    pevt->info.cpnd.info
+						.ckpt_nd2nd_data_rsp.seqno);
+					ncs_enc_claim_space(io_uba, 4);
+				}
 				TRACE_LEAVE();
 				return rc;
 
@@ -446,10 +527,18 @@ static uint32_t cpnd_mds_enc(CPND_CB *cb, MDS_CALLBACK_ENC_INFO *enc_info)
 				break;
 			}
 		}
-		/* For all other Cases Invoke EDU encode */
-		rc = m_NCS_EDU_EXEC(&cb->cpnd_edu_hdl, FUNC_NAME(CPSV_EVT),
-				    enc_info->io_uba, EDP_OP_TYPE_ENC, pevt,
-				    &ederror);
+		/* For all other Cases Invoke EDU encode. CPD decodes all
+		 * messages as version 1 */
+		if (enc_info->i_to_svc_id == NCSMDS_SVC_ID_CPD)
+			rc = m_NCS_EDU_EXEC(&cb->cpnd_edu_hdl,
+					    FUNC_NAME(CPSV_EVT),
+					    enc_info->io_uba, EDP_OP_TYPE_ENC,
+					    pevt, &ederror);
+		else
+			rc = m_NCS_EDU_VER_EXEC(
+			    &cb->cpnd_edu_hdl, FUNC_NAME(CPSV_EVT),
+			    enc_info->io_uba, EDP_OP_TYPE_ENC, pevt, &ederror,
+			    enc_info->o_msg_fmt_ver);
 		TRACE_LEAVE();
 		return rc;
 	} else {
@@ -521,6 +610,99 @@ uint32_t cpsv_ckpt_access_decode(CPSV_CKPT_ACCESS *ckpt_data, NCS_UBAID *io_uba)
 	return rc;
 }
 
+/****************************************************************************
+  Name          : cpnd_dest_nodes_encode
+
+  Description   : This routine encodes the nodes a multicast all replica
+		  write is meant for. Only sent to CPNDs supporting message
+		  format CPND_MCAST_WRITE_MSG_FMT_VER.
+
+  Arguments     : ckpt_data - the write request
+		  io_uba    - User Buff.
+
+  Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+
+  Notes         : None.
+******************************************************************************/
+static uint32_t cpnd_dest_nodes_encode(CPSV_CKPT_ACCESS *ckpt_data,
+				       NCS_UBAID *io_uba)
+{
+	uint8_t *pstream = NULL;
+	uint32_t i;
+
+	pstream = ncs_enc_reserve_space(io_uba, 4);
+	if (!pstream)
+		return m_CPSV_DBG_SINK(
+		    NCSCC_RC_FAILURE,
+		    "Memory alloc failed in cpnd_dest_nodes_encode\n");
+	ncs_encode_32bit(&pstream, ckpt_data->num_dest_nodes);
+	ncs_enc_claim_space(io_uba, 4);
+
+	for (i = 0; i < ckpt_data->num_dest_nodes; i++) {
+		pstream = ncs_enc_reserve_space(io_uba, 4);
+		if (!pstream)
+			return m_CPSV_DBG_SINK(
+			    NCSCC_RC_FAILURE,
+			    "Memory alloc failed in cpnd_dest_nodes_encode\n");
+		ncs_encode_32bit(&pstream, ckpt_data->dest_nodes[i]);
+		ncs_enc_claim_space(io_uba, 4);
+	}
+	return NCSCC_RC_SUCCESS;
+}
+
+/****************************************************************************
+  Name          : cpnd_dest_nodes_decode
+
+  Description   : This routine decodes the nodes a multicast all replica
+		  write is meant for.
+
+  Arguments     : ckpt_data - the write request
+		  io_uba    - User Buff.
+
+  Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+
+  Notes         : The node list is freed in cpnd_evt_destroy().
+******************************************************************************/
+static uint32_t cpnd_dest_nodes_decode(CPSV_CKPT_ACCESS *ckpt_data,
+				       NCS_UBAID *io_uba)
+{
+	uint8_t *pstream = NULL;
+	uint8_t local_data[4];
+	uint32_t i, num;
+
+	ckpt_data->num_dest_nodes = 0;
+	ckpt_data->dest_nodes = NULL;
+
+	pstream = ncs_dec_flatten_space(io_uba, local_data, 4);
+	if (pstream == NULL)
+		return NCSCC_RC_FAILURE;
+	num = ncs_decode_32bit(&pstream);
+	ncs_dec_skip_space(io_uba, 4);
+
+	if (num == 0)
+		return NCSCC_RC_SUCCESS;
+	if (num > CPND_MAX_DEST_NODES) {
+		LOG_ER("cpnd dest nodes count %u invalid", num);
+		return NCSCC_RC_FAILURE;
+	}
+
+	ckpt_data->dest_nodes = m_MMGR_ALLOC_CPSV_SYS_MEMORY(
+	    num * sizeof(NODE_ID));
+	if (ckpt_data->dest_nodes == NULL) {
+		LOG_ER("cpnd dest nodes alloc failed");
+		return NCSCC_RC_FAILURE;
+	}
+	for (i = 0; i < num; i++) {
+		pstream = ncs_dec_flatten_space(io_uba, local_data, 4);
+		if (pstream == NULL)
+			return NCSCC_RC_FAILURE;
+		ckpt_data->dest_nodes[i] = ncs_decode_32bit(&pstream);
+		ncs_dec_skip_space(io_uba, 4);
+	}
+	ckpt_data->num_dest_nodes = num;
+	return NCSCC_RC_SUCCESS;
+}
+
 /****************************************************************************
   Name          : cpnd_mds_dec
 
@@ -594,6 +776,28 @@ static uint32_t cpnd_mds_dec(CPND_CB *cb, MDS_CALLBACK_DEC_INFO *dec_info)
 				rc = cpsv_ckpt_access_decode(
 				    &msg_ptr->info.cpnd.info.ckpt_nd2nd_sync,
 				    dec_info->io_uba);
+				if (rc == NCSCC_RC_SUCCESS &&
+				    dec_info->i_msg_fmt_ver >=
+					CPND_STREAM_SYNC_MSG_FMT_VER) {
+					pstream = ncs_dec_flatten_space(
+					    dec_info->io_uba, local_data, 1);
+					msg_ptr->info.cpnd.info.ckpt_nd2nd_sync
+					    .ckpt_sync.stream_sync =
+					    ncs_decode_8bit(&pstream);
+					ncs_dec_skip_space(dec_info->io_uba, 1);
+				}
+				goto free;
+
+			case CPND_EVT_ND2ND_CKPT_SYNC_ACK:
+				ncs_dec_skip_space(dec_info->io_uba, 12);
+				pstream = ncs_dec_flatten_space(
+				    dec_info->io_uba, local_data, 12);
+				msg_ptr->info.cpnd.info.sync_ack.ckpt_id =
+				    ncs_decode_64bit(&pstream);
+				msg_ptr->info.cpnd.info.sync_ack.seqno =
+				    ncs_decode_32bit(&pstream);
+				ncs_dec_skip_space(dec_info->io_uba, 12);
+				rc = NCSCC_RC_SUCCESS;
 				goto free;
 
 			case CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_REQ: /* Write Event ND2ND */
@@ -601,6 +805,13 @@ static uint32_t cpnd_mds_dec(CPND_CB *cb, MDS_CALLBACK_DEC_INFO *dec_info)
 				rc = cpsv_ckpt_access_decode(
 				    &msg_ptr->info.cpnd.info.ckpt_nd2nd_data,
 				    dec_info->io_uba);
+				if (rc == NCSCC_RC_SUCCESS &&
+				    dec_info->i_msg_fmt_ver >=
+					CPND_MCAST_WRITE_MSG_FMT_VER)
+					rc = cpnd_dest_nodes_decode(
+					    &msg_ptr->info.cpnd.info
+						 .ckpt_nd2nd_data,
+					    dec_info->io_uba);
 				goto free;
 
 			case CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_RSP:
@@ -609,6 +820,16 @@ static uint32_t cpnd_mds_dec(CPND_CB *cb, MDS_CALLBACK_DEC_INFO *dec_info)
 				    &msg_ptr->info.cpnd.info
 					 .ckpt_nd2nd_data_rsp,
 				    dec_info->io_uba, dec_info->i_msg_fmt_ver);
+				if (rc == NCSCC_RC_SUCCESS &&
+				    dec_info->i_msg_fmt_ver >=
+					CPND_MCAST_WRITE_MSG_FMT_VER) {
+					pstream = ncs_dec_flatten_space(
+					    dec_info->io_uba, local_data, 4);
+					msg_ptr->info.cpnd.info
+					    .ckpt_nd2nd_data_rsp.seqno =
+					    ncs_decode_32bit(&pstream);
+					ncs_dec_skip_space(dec_info->io_uba, 4);
+				}
 				goto free;
 
 			case CPND_EVT_A2ND_CKPT_REFCNTSET:
@@ -1007,6 +1228,44 @@ uint32_t cpnd_mds_bcast_send(CPND_CB *cb, CPSV_EVT *evt, NCSMDS_SVC_ID to_svc)
 	return (res);
 }
 
+/****************************************************************************
+ * Name          : cpnd_mds_mcast_send
+ *
+ * Description   : Send an all replica write to the remote CPNDs with one
+ *                 MDS broadcast. The message is encoded once and sent using
+ *                 TIPC multicast if enabled. CPNDs not in the node list of
+ *                 the write drop it.
+ *
+ * Arguments     : cb  - CPND control block
+ *                 evt - Event to be sent.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ *
+ * Notes         : None.
+ *****************************************************************************/
+uint32_t cpnd_mds_mcast_send(CPND_CB *cb, CPSV_EVT *evt)
+{
+	NCSMDS_INFO info;
+	uint32_t res;
+
+	memset(&info, 0, sizeof(info));
+
+	info.i_mds_hdl = cb->cpnd_mds_hdl;
+	info.i_op = MDS_SEND;
+	info.i_svc_id = NCSMDS_SVC_ID_CPND;
+
+	info.info.svc_send.i_msg = (NCSCONTEXT)evt;
+	info.info.svc_send.i_priority = MDS_SEND_PRIORITY_MEDIUM;
+	info.info.svc_send.i_sendtype = MDS_SENDTYPE_BCAST;
+	info.info.svc_send.i_to_svc = NCSMDS_SVC_ID_CPND;
+	info.info.svc_send.info.bcast.i_bcast_scope = NCSMDS_SCOPE_NONE;
+
+	cpsv_evt_trace("cpnd", CPSV_EVT_BROADCAST, evt, 0);
+
+	res = ncsmds_api(&info);
+	return (res);
+}
+
 /****************************************************************************
  * Name          : cpnd_mds_svc_evt
  *
@@ -1122,6 +1381,8 @@ static uint32_t cpnd_mds_svc_evt(CPND_CB *cb,
 	evt->info.cpnd.info.mds_info.dest = svc_evt->i_dest;
 	evt->info.cpnd.info.mds_info.svc_id = svc_evt->i_svc_id;
 	evt->info.cpnd.info.mds_info.role = svc_evt->i_role;
+	evt->info.cpnd.info.mds_info.rem_svc_pvt_ver =
+	    svc_evt->i_rem_svc_pvt_ver;
 
 	/* Put it in CPND's Event Queue */
 	rc = m_NCS_IPC_SEND(&cb->cpnd_mbx, (NCSCONTEXT)evt, priority);
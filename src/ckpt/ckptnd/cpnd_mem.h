@@ -136,15 +136,6 @@ typedef enum {
   m_NCS_MEM_FREE(p, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_CPND, \
                  CPND_SVC_SUB_ID_CPND_UPDATE_DEST_LIST_NODE)
 
-#define m_MMGR_ALLOC_CPND_CKPT_SECTION_INFO                      \
-  (CPND_CKPT_SECTION_INFO *)m_NCS_MEM_ALLOC(                     \
-      sizeof(CPND_CKPT_SECTION_INFO), NCS_MEM_REGION_PERSISTENT, \
-      NCS_SERVICE_ID_CPND, CPND_SVC_SUB_ID_CPND_CKPT_SECTION_INFO)
-
-#define m_MMGR_FREE_CPND_CPND_CKPT_SECTION_INFO(p)                  \
-  m_NCS_MEM_FREE(p, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_CPND, \
-                 CPND_SVC_SUB_ID_CPND_CKPT_SECTION_INFO)
-
 #define m_MMGR_ALLOC_CPND_SYNC_SEND_NODE                      \
   (CPND_SYNC_SEND_NODE *)m_NCS_MEM_ALLOC(                     \
       sizeof(CPND_SYNC_SEND_NODE), NCS_MEM_REGION_PERSISTENT, \
@@ -404,9 +404,7 @@ uint32_t cpnd_ckpt_replica_destroy(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		    cp_node->replica_info.open.info.open.i_name);
 
 		/* freeing the sec_mapping memory */
-		if (cp_node->replica_info.shm_sec_mapping)
-			m_MMGR_FREE_CPND_DEFAULT(
-			    cp_node->replica_info.shm_sec_mapping);
+		cpnd_ckpt_lck_sec_ids_free(cp_node);
 	}
 
 	if (!m_CPND_IS_COLLOCATED_ATTR_SET(
@@ -554,6 +552,8 @@ again:
 	for (; sec_cnt < cp_node->create_attrib.maxSections; sec_cnt++)
 		cp_node->replica_info.shm_sec_mapping[sec_cnt] = 1;
 
+	rc = cpnd_ckpt_lck_sec_ids_init(cp_node);
+
 	TRACE_LEAVE();
 	return rc;
 }
@@ -617,6 +617,8 @@ uint32_t cpnd_ckpt_remote_cpnd_del(CPND_CKPT_NODE *cp_node, MDS_DEST mds_info)
 	CPSV_CPND_DEST_INFO *prev_ptr_cpnd_mdest = NULL;
 
 	TRACE_ENTER();
+	cpnd_sync_session_del(cp_node, mds_info);
+
 	while (ptr_cpnd_mdest != NULL) {
 
 		if (m_CPND_IS_LOCAL_NODE(&ptr_cpnd_mdest->dest, &mds_info) == 0)
@@ -643,33 +645,113 @@ uint32_t cpnd_ckpt_remote_cpnd_del(CPND_CKPT_NODE *cp_node, MDS_DEST mds_info)
 }
 
 /****************************************************************************
- * Name          :  cpnd_ckpt_get_lck_sec_id
+ * Name          :  cpnd_ckpt_lck_sec_ids_init
  *
- * Description   : Function to process the
- *                 from Applications.
+ * Description   : Function to build the stack of free lcl_sec_ids of a
+ *                 replica from its shm_sec_mapping.
  *
  * Arguments     : CPND_CKPT_NODE *cp_node  - CPND CKPT pointer
  *
  * Return Values : NCSCC_RC_SUCCESS/Error.
  *
+ * Notes         : The lowest free lcl_sec_id is on top of the stack.
+ *****************************************************************************/
+uint32_t cpnd_ckpt_lck_sec_ids_init(CPND_CKPT_NODE *cp_node)
+{
+	CPND_CKPT_REPLICA_INFO *rep = &cp_node->replica_info;
+	uint32_t i = cp_node->create_attrib.maxSections;
+
+	rep->n_shm_sec_free = 0;
+	rep->shm_sec_free =
+	    (uint32_t *)m_MMGR_ALLOC_CPND_DEFAULT(sizeof(uint32_t) * i);
+	if (rep->shm_sec_free == NULL) {
+		LOG_ER("cpnd default memory alloc failed");
+		return NCSCC_RC_FAILURE;
+	}
+
+	while (i > 0) {
+		i--;
+		if (rep->shm_sec_mapping[i] == 1)
+			rep->shm_sec_free[rep->n_shm_sec_free++] = i;
+	}
+
+	return NCSCC_RC_SUCCESS;
+}
+
+/****************************************************************************
+ * Name          :  cpnd_ckpt_lck_sec_ids_free
+ *
+ * Description   : Function to free the shm_sec_mapping and the stack of
+ *                 free lcl_sec_ids of a replica.
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node  - CPND CKPT pointer
+ *
+ * Return Values : None.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+void cpnd_ckpt_lck_sec_ids_free(CPND_CKPT_NODE *cp_node)
+{
+	if (cp_node->replica_info.shm_sec_mapping)
+		m_MMGR_FREE_CPND_DEFAULT(cp_node->replica_info.shm_sec_mapping);
+	if (cp_node->replica_info.shm_sec_free)
+		m_MMGR_FREE_CPND_DEFAULT(cp_node->replica_info.shm_sec_free);
+
+	cp_node->replica_info.shm_sec_mapping = NULL;
+	cp_node->replica_info.shm_sec_free = NULL;
+	cp_node->replica_info.n_shm_sec_free = 0;
+}
+
+/****************************************************************************
+ * Name          :  cpnd_ckpt_get_lck_sec_id
+ *
+ * Description   : Function to allocate a free lcl_sec_id (shm section slot)
+ *                 of a replica.
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node  - CPND CKPT pointer
+ *
+ * Return Values : lcl_sec_id/-1 if all sections are in use.
+ *
  * Notes         : None.
  *****************************************************************************/
 int32_t cpnd_ckpt_get_lck_sec_id(CPND_CKPT_NODE *cp_node)
 {
-	uint32_t i = 0;
+	uint32_t i;
 
-	for (; i < cp_node->create_attrib.maxSections; i++)
-		if (cp_node->replica_info.shm_sec_mapping[i] == 1) {
-			cp_node->replica_info.shm_sec_mapping[i] = 0;
-			break;
-		}
-	if (i == cp_node->create_attrib.maxSections) {
+	if (cp_node->replica_info.n_shm_sec_free == 0)
 		return -1;
-	}
+
+	i = cp_node->replica_info
+		.shm_sec_free[--cp_node->replica_info.n_shm_sec_free];
+	cp_node->replica_info.shm_sec_mapping[i] = 0;
 
 	return i;
 }
 
+/****************************************************************************
+ * Name          :  cpnd_ckpt_put_lck_sec_id
+ *
+ * Description   : Function to release a lcl_sec_id (shm section slot) of a
+ *                 replica.
+ *
+ * Arguments     : CPND_CKPT_NODE *cp_node  - CPND CKPT pointer
+ *                 uint32_t lcl_sec_id - lcl Section Identifier
+ *
+ * Return Values : None.
+ *
+ * Notes         : Releasing a free lcl_sec_id is a no-op.
+ *****************************************************************************/
+void cpnd_ckpt_put_lck_sec_id(CPND_CKPT_NODE *cp_node, uint32_t lcl_sec_id)
+{
+	if (lcl_sec_id >= cp_node->create_attrib.maxSections ||
+	    cp_node->replica_info.shm_sec_mapping[lcl_sec_id] == 1)
+		return;
+
+	cp_node->replica_info.shm_sec_mapping[lcl_sec_id] = 1;
+	cp_node->replica_info
+	    .shm_sec_free[cp_node->replica_info.n_shm_sec_free++] = lcl_sec_id;
+}
+
 /****************************************************************************
  * Name          : cpnd_ckpt_sec_write
  *
@@ -1411,15 +1493,18 @@ uint32_t cpnd_proc_update_remote(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		cp_node->create_attrib.creationFlags) == true) {
 		if (cp_node->cpnd_dest_list != NULL) {
 			CPSV_CPND_DEST_INFO *tmp = NULL;
+			CPSV_CKPT_ACCESS *write_req = NULL;
+			NODE_ID *dest_nodes = NULL;
+			uint32_t num_dests = 0;
 
 			tmp = cp_node->cpnd_dest_list;
 			send_evt.type = CPSV_EVT_TYPE_CPND;
 			send_evt.info.cpnd.type =
 			    CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_REQ;
+			write_req = &send_evt.info.cpnd.info.ckpt_nd2nd_data;
 
 			{
-				send_evt.info.cpnd.info.ckpt_nd2nd_data =
-				    in_evt->info.ckpt_write;
+				*write_req = in_evt->info.ckpt_write;
 				datasize =
 				    in_evt->info.ckpt_write.num_of_elmts *
 				    cp_node->create_attrib.maxSectionSize;
@@ -1427,10 +1512,22 @@ uint32_t cpnd_proc_update_remote(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 			}
 			/*Flag set to distinguish ALL_REPL case on response side
 			 */
-			send_evt.info.cpnd.info.ckpt_nd2nd_data
-			    .all_repl_evt_flag = true;
-			send_evt.info.cpnd.info.ckpt_nd2nd_data.agent_mdest =
-			    sinfo->dest;
+			write_req->all_repl_evt_flag = true;
+			write_req->agent_mdest = sinfo->dest;
+			write_req->num_dest_nodes = 0;
+			write_req->dest_nodes = NULL;
+
+			/* Number the write so that the remote replicas apply
+			 * the writes in order and the responses can be matched
+			 * with it. Older CPNDs don't echo the number, so while
+			 * they are around the writes are not numbered. */
+			write_req->seqno = 0;
+			if (cb->prev_ver_cpnd_cnt == 0) {
+				if (++cp_node->write_seqno == 0)
+					cp_node->write_seqno = 1;
+				write_req->seqno = cp_node->write_seqno;
+			}
+
 			/*Allocate memory to store the ALL REPL event node */
 			all_repl_evt = m_MMGR_ALLOC_CPND_ALL_REPL_EVT_NODE;
 			if (all_repl_evt) {
@@ -1442,6 +1539,9 @@ uint32_t cpnd_proc_update_remote(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 				all_repl_evt->ckpt_id = cp_node->ckpt_id;
 				all_repl_evt->lcl_ckpt_id =
 				    in_evt->info.ckpt_write.lcl_ckpt_id;
+				all_repl_evt->key.lcl_ckpt_id =
+				    all_repl_evt->lcl_ckpt_id;
+				all_repl_evt->key.seqno = write_req->seqno;
 				all_repl_evt->sinfo = *sinfo;
 
 				/*Copy the entire dest_list info of ckpt node to
@@ -1462,6 +1562,7 @@ uint32_t cpnd_proc_update_remote(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 						new->next = head;
 						head = new;
 					}
+					num_dests++;
 					tmp = tmp->next;
 				}
 				all_repl_evt->cpnd_update_dest_list = head;
@@ -1485,6 +1586,8 @@ uint32_t cpnd_proc_update_remote(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 				    cp_node->ckpt_id;
 				all_repl_evt->write_rsp_tmr.lcl_ckpt_hdl =
 				    in_evt->info.ckpt_write.lcl_ckpt_id;
+				all_repl_evt->write_rsp_tmr.write_seqno =
+				    write_req->seqno;
 				all_repl_evt->write_rsp_tmr.agent_dest =
 				    sinfo->dest;
 				all_repl_evt->write_rsp_tmr.write_type =
@@ -1492,6 +1595,44 @@ uint32_t cpnd_proc_update_remote(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 				rc = cpnd_tmr_start(
 				    &all_repl_evt->write_rsp_tmr, timeout);
 
+				/* Send a numbered write to several replicas
+				 * with one multicast, which is encoded once.
+				 * The write lists the nodes it is meant for */
+				if (cb->mcast_write && write_req->seqno != 0 &&
+				    num_dests > 1)
+					dest_nodes =
+					    m_MMGR_ALLOC_CPSV_SYS_MEMORY(
+						num_dests * sizeof(NODE_ID));
+
+				if (dest_nodes != NULL) {
+					uint32_t i = 0;
+
+					for (new = head; new != NULL;
+					     new = new->next)
+						dest_nodes[i++] =
+						    m_NCS_NODE_ID_FROM_MDS_DEST(
+							new->dest);
+					write_req->num_dest_nodes = i;
+					write_req->dest_nodes = dest_nodes;
+
+					rc = cpnd_mds_mcast_send(cb, &send_evt);
+					if (rc != NCSCC_RC_SUCCESS) {
+						TRACE_4(
+						    "CPND - MDS mcast failed from Active Dest cpnd_mdest_id:%" PRIu64
+						    ",ckpt_id:%llx:rc:%d",
+						    cb->cpnd_mdest_id,
+						    cp_node->ckpt_id, rc);
+					} else {
+						all_repl_evt->write_rsp_cnt =
+						    num_dests;
+					}
+
+					write_req->num_dest_nodes = 0;
+					write_req->dest_nodes = NULL;
+					m_MMGR_FREE_CPSV_SYS_MEMORY(dest_nodes);
+					head = NULL;
+				}
+
 				while (head != NULL) {
 					rc = cpnd_mds_msg_send(
 					    cb, NCSMDS_SVC_ID_CPND, head->dest,
@@ -1702,7 +1843,7 @@ uint32_t cpnd_proc_sec_expiry(CPND_CB *cb, CPND_TMR_INFO *tmr_info)
 	}
 
 	cpnd_ckpt_sec_del(cb, cp_node, &pSec_info->sec_id, true);
-	cp_node->replica_info.shm_sec_mapping[pSec_info->lcl_sec_id] = 1;
+	cpnd_ckpt_put_lck_sec_id(cp_node, pSec_info->lcl_sec_id);
 
 	/* send out destory to all cpnd's maintaining this ckpt */
 	if (cp_node->cpnd_dest_list != NULL) {
@@ -1738,7 +1879,7 @@ uint32_t cpnd_proc_sec_expiry(CPND_CB *cb, CPND_TMR_INFO *tmr_info)
 			out_evt = NULL;
 		}
 	}
-	m_CPND_FREE_CKPT_SECTION(pSec_info);
+	cpnd_ckpt_sec_free(&cp_node->replica_info, pSec_info);
 	return NCSCC_RC_SUCCESS;
 }
 
@@ -1758,6 +1899,13 @@ uint32_t cpnd_open_active_sync_expiry(CPND_CB *cb, CPND_TMR_INFO *tmr_info)
 {
 	CPSV_EVT des_evt, *out_evt = NULL;
 	CPSV_EVT send_evt;
+	CPND_CKPT_NODE *cp_node = NULL;
+
+	/* Apply the writes received during the sync */
+	cpnd_ckpt_node_get(cb, tmr_info->ckpt_id, &cp_node);
+	if (cp_node != NULL)
+		cpnd_evt_backup_queue_proc(cb, cp_node);
+
 	memset(&des_evt, '\0', sizeof(CPSV_EVT));
 	memset(&send_evt, '\0', sizeof(CPSV_EVT));
 	des_evt.type = CPSV_EVT_TYPE_CPD;
@@ -1795,7 +1943,8 @@ uint32_t cpnd_all_repl_rsp_expiry(CPND_CB *cb, CPND_TMR_INFO *tmr_info)
 
 	TRACE_ENTER();
 	cpnd_ckpt_node_get(cb, tmr_info->ckpt_id, &cp_node);
-	cpnd_evt_node_get(cb, tmr_info->lcl_ckpt_hdl, &evt_node);
+	cpnd_evt_node_get(cb, tmr_info->lcl_ckpt_hdl, tmr_info->write_seqno,
+			  &evt_node);
 
 	memset(&rsp_evt, 0, sizeof(CPSV_EVT));
 
@@ -1884,24 +2033,21 @@ uint32_t cpnd_proc_getnext_section(CPND_CKPT_NODE *cp_node,
 			return NCSCC_RC_FAILURE;
 		}
 
-		/* search the existing section id */
+		/* if first is NULL then return no more sections */
 		*n_secs_trav = get_next->n_secs_trav;
-		if (pSecPtr != NULL && *n_secs_trav != 0) {
-			pSecPtr =
-			    cpnd_ckpt_sec_get(cp_node, &get_next->section_id);
-		}
-		/* if next is NULL then return no more sections */
 		if (pSecPtr == NULL) {
 			TRACE_4("cpnd replica has no sections");
 			return NCSCC_RC_FAILURE;
 		}
 
-		/* get section descriptor with given filter */
+		/* get section descriptor with given filter, continuing after
+		 * the last returned section. That section may have been
+		 * deleted since */
 		if (*n_secs_trav == 0)
 			pTmpSecPtr = pSecPtr;
 		else
-			pTmpSecPtr = cpnd_ckpt_sec_get_next(
-			    &cp_node->replica_info, pSecPtr);
+			pTmpSecPtr = cpnd_ckpt_sec_get_after(
+			    &cp_node->replica_info, &get_next->section_id);
 
 		switch (get_next->filter) {
 		case SA_CKPT_SECTIONS_ANY:
@@ -2937,9 +3083,7 @@ void cpnd_ckpt_replica_delete(CPND_CB *cb, CPND_CKPT_NODE *ckpt_node)
 		    ckpt_node->replica_info.open.info.open.i_name);
 
 		/* freeing the sec_mapping memory */
-		if (ckpt_node->replica_info.shm_sec_mapping)
-			m_MMGR_FREE_CPND_DEFAULT(
-			    ckpt_node->replica_info.shm_sec_mapping);
+		cpnd_ckpt_lck_sec_ids_free(ckpt_node);
 	}
 	TRACE_LEAVE();
 }
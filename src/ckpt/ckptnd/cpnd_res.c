@@ -43,17 +43,23 @@
 #define m_CPND_CKPTHDR_READ(ckpt_hdr, addr, offset)                            \
 	memcpy(&ckpt_hdr, addr + offset, sizeof(CKPT_HDR))
 
-#define m_CPND_CLINFO_READ(cli_info, addr, offset)                             \
-	memcpy(&cli_info, addr + offset, sizeof(CLIENT_INFO))
+/* The offset is the byte offset of the info in the client or checkpoint
+   info array, that continues in the overflow segments */
+#define m_CPND_CLINFO_READ(cli_info, cb, offset)                               \
+	memcpy(&cli_info, cpnd_shm_info_addr(cb, CPND_CLIENT_INFO, offset),    \
+	       sizeof(CLIENT_INFO))
 
-#define m_CPND_CLINFO_UPDATE(addr, cli_info, offset)                           \
-	memcpy(addr + offset, &cli_info, sizeof(CLIENT_INFO))
+#define m_CPND_CLINFO_UPDATE(cb, cli_info, offset)                             \
+	memcpy(cpnd_shm_info_addr(cb, CPND_CLIENT_INFO, offset), &cli_info,    \
+	       sizeof(CLIENT_INFO))
 
-#define m_CPND_CKPTINFO_READ(ckpt_info, addr, offset)                          \
-	memcpy(&ckpt_info, addr + offset, sizeof(CKPT_INFO))
+#define m_CPND_CKPTINFO_READ(ckpt_info, cb, offset)                            \
+	memcpy(&ckpt_info, cpnd_shm_info_addr(cb, CPND_CKPT_INFO, offset),     \
+	       sizeof(CKPT_INFO))
 
-#define m_CPND_CKPTINFO_UPDATE(addr, ckpt_info, offset)                        \
-	memcpy(addr + offset, &ckpt_info, sizeof(CKPT_INFO))
+#define m_CPND_CKPTINFO_UPDATE(cb, ckpt_info, offset)                          \
+	memcpy(cpnd_shm_info_addr(cb, CPND_CKPT_INFO, offset), &ckpt_info,     \
+	       sizeof(CKPT_INFO))
 
 #define m_CPND_CKPTHDR_UPDATE(ckpt_hdr, offset)                                \
 	memcpy(offset, &ckpt_hdr, sizeof(CKPT_HDR))
@@ -70,6 +76,11 @@ static uint32_t cpnd_shm_extended_open(CPND_CB *cb, uint32_t flag);
 static uint32_t cpnd_extended_name_lend(SaConstStringT value, SaNameT *name);
 static SaConstStringT cpnd_extended_name_borrow(const SaNameT *name);
 static void cpnd_extended_name_free(const SaNameT *name);
+static char *cpnd_shm_info_addr(CPND_CB *cb, CPND_TYPE_INFO type,
+				uint64_t i_offset);
+static void cpnd_shm_segs_open(CPND_CB *cb);
+static void cpnd_shm_segs_unlink(CPND_CB *cb);
+static void cpnd_shm_slot_put(CPND_CB *cb, CPND_TYPE_INFO type, int32_t slot);
 
 /*******************************************************************************
  ** Name           : cpnd_client_extract_bits
@@ -132,20 +143,9 @@ uint32_t cpnd_res_ckpt_sec_add(CPND_CKPT_SECTION_INFO *pSecPtr,
  *********************************************************************************************/
 uint32_t cpnd_res_ckpt_sec_del(CPND_CKPT_NODE *cp_node)
 {
-	CPND_CKPT_SECTION_INFO *pSecPtr = NULL, *nextPtr = NULL;
-
-	pSecPtr = cpnd_ckpt_sec_get_first(&cp_node->replica_info);
-	while (pSecPtr != NULL) {
-		nextPtr = pSecPtr;
-		pSecPtr =
-		    cpnd_ckpt_sec_get_next(&cp_node->replica_info, pSecPtr);
-		if ((nextPtr->sec_id.id != NULL) &&
-		    (nextPtr->sec_id.idLen != 0)) {
-			m_MMGR_FREE_CPSV_DEFAULT_VAL(nextPtr->sec_id.id,
-						     NCS_SERVICE_ID_CPND);
-		}
-		m_CPND_FREE_CKPT_SECTION(nextPtr);
-	}
+	cpnd_ckpt_delete_all_sect(cp_node);
+	cp_node->replica_info.n_secs = 0;
+	cp_node->replica_info.mem_used = 0;
 	return NCSCC_RC_SUCCESS;
 }
 
@@ -269,15 +269,13 @@ uint32_t cpnd_ckpt_replica_create_res(CPND_CB *cb,
 		(*cp_node)->replica_info.shm_sec_mapping[sec_cnt] = 0;
 		sec_cnt++;
 		counter++;
-		pSecPtr = m_MMGR_ALLOC_CPND_CKPT_SECTION_INFO;
+		pSecPtr = cpnd_ckpt_sec_alloc(&(*cp_node)->replica_info);
 		if (pSecPtr == NULL) {
 			TRACE_4(
 			    "cpnd ckpt section info memory allocation failed");
 			rc = NCSCC_RC_FAILURE;
 			goto end;
 		}
-
-		memset(pSecPtr, '\0', sizeof(CPND_CKPT_SECTION_INFO));
 		pSecPtr->lcl_sec_id = sect_hdr.lcl_sec_id;
 		pSecPtr->sec_id.idLen = sect_hdr.idLen;
 		if (pSecPtr->sec_id.idLen != 0) {
@@ -286,8 +284,8 @@ uint32_t cpnd_ckpt_replica_create_res(CPND_CB *cb,
 			if (pSecPtr->sec_id.id == NULL) {
 				TRACE_4(
 				    "cpnd default allocation failed for sec_id length");
-				m_MMGR_FREE_CPND_CPND_CKPT_SECTION_INFO(
-				    pSecPtr);
+				cpnd_ckpt_sec_free(&(*cp_node)->replica_info,
+						   pSecPtr);
 				rc = NCSCC_RC_FAILURE;
 				goto end;
 			}
@@ -303,9 +301,8 @@ uint32_t cpnd_ckpt_replica_create_res(CPND_CB *cb,
 		if (rc != NCSCC_RC_SUCCESS) {
 			LOG_NO(
 			    "cpnd restart create replica - add section fails");
-			if (pSecPtr->sec_id.id != NULL)
-				m_MMGR_FREE_CPND_DEFAULT(pSecPtr->sec_id.id);
-			m_MMGR_FREE_CPND_CPND_CKPT_SECTION_INFO(pSecPtr);
+			cpnd_ckpt_sec_free(&(*cp_node)->replica_info,
+					   pSecPtr);
 			goto end;
 		}
 
@@ -313,13 +310,16 @@ uint32_t cpnd_ckpt_replica_create_res(CPND_CB *cb,
 
 		(*cp_node)->replica_info.mem_used += pSecPtr->sec_size;
 	}
+
+	rc = cpnd_ckpt_lck_sec_ids_init(*cp_node);
+	if (rc != NCSCC_RC_SUCCESS)
+		goto end;
+
 	TRACE_LEAVE2("Ret val %d", rc);
 	return rc;
 
 end:
-	if ((*cp_node)->replica_info.shm_sec_mapping != NULL)
-		m_MMGR_FREE_CPND_DEFAULT(
-		    (*cp_node)->replica_info.shm_sec_mapping);
+	cpnd_ckpt_lck_sec_ids_free(*cp_node);
 	cpnd_res_ckpt_sec_del(*cp_node);
 	TRACE_LEAVE2("Ret val %d", rc);
 	return rc;
@@ -332,14 +332,11 @@ void cpnd_restart_update_timer(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 
 	memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
 	if (cp_node->offset >= 0) {
-		m_CPND_CKPTINFO_READ(ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
+		m_CPND_CKPTINFO_READ(ckpt_info, cb,
 				     cp_node->offset * sizeof(CKPT_INFO));
 		ckpt_info.close_time = closetime;
-		m_CPND_CKPTINFO_UPDATE(
-		    (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-		    ckpt_info, cp_node->offset * sizeof(CKPT_INFO));
+		m_CPND_CKPTINFO_UPDATE(cb, ckpt_info,
+				       cp_node->offset * sizeof(CKPT_INFO));
 	}
 	return;
 }
@@ -434,6 +431,7 @@ void *cpnd_restart_shm_create(NCS_OS_POSIX_SHM_REQ_INFO *cpnd_open_req,
 			   sizeof(CKPT_HDR) + (MAX_CKPTS * sizeof(CKPT_INFO)));
 		memcpy(cpnd_open_req->info.open.o_addr, &cpnd_shm_version,
 		       sizeof(cpnd_shm_version));
+		cpnd_shm_segs_unlink(cb);
 		TRACE_1("cpnd new shm create request success");
 		return cpnd_open_req->info.open.o_addr;
 	}
@@ -489,6 +487,8 @@ void *cpnd_restart_shm_create(NCS_OS_POSIX_SHM_REQ_INFO *cpnd_open_req,
 			return NULL;
 		}
 
+		cpnd_shm_segs_open(cb);
+
 		/* READ FROM THE SHARED MEMORY */
 
 		TRACE("CPND IS RESTARTING ");
@@ -502,7 +502,8 @@ void *cpnd_restart_shm_create(NCS_OS_POSIX_SHM_REQ_INFO *cpnd_open_req,
 		/* ( DO - WHILE )-  READ THE CLIENT INFO AND FILL THE DATABASE
 		 * OF CLIENT INFO */
 		if (n_clients != 0) {
-			while (counter < MAX_CLIENTS) {
+			while (counter <
+			       cb->shm_clients.n_segs * MAX_CLIENTS) {
 				memset(&cl_info, '\0', sizeof(CLIENT_INFO));
 				if ((counter * sizeof(CLIENT_INFO)) >
 				    INTMAX_MAX) {
@@ -510,11 +511,7 @@ void *cpnd_restart_shm_create(NCS_OS_POSIX_SHM_REQ_INFO *cpnd_open_req,
 					    "cpnd ckpt shm create failed,exceeded the write limits(UINT64_MAX) ");
 				}
 				i_offset = counter * sizeof(CLIENT_INFO);
-				m_CPND_CLINFO_READ(
-				    cl_info,
-				    (char *)gbl_shm_addr.cli_addr +
-					sizeof(CLIENT_HDR),
-				    i_offset);
+				m_CPND_CLINFO_READ(cl_info, cb, i_offset);
 
 				if (cl_info.ckpt_app_hdl == 0) {
 					counter++;
@@ -564,17 +561,14 @@ void *cpnd_restart_shm_create(NCS_OS_POSIX_SHM_REQ_INFO *cpnd_open_req,
 		counter = 0;
 
 		/* TO READ THE NUMBER OF CHECKPOINTS FROM THE HEADER */
-		while (counter < MAX_CKPTS) {
+		while (counter < cb->shm_ckpts.n_segs * MAX_CKPTS) {
 			memset(&cp_info, '\0', sizeof(CKPT_INFO));
 			if ((counter * sizeof(CKPT_INFO)) > UINTMAX_MAX) {
 				LOG_ER(
 				    "cpnd ckpt shm create failed,exceeded the write limits(UINT64_MAX) ");
 			}
 			i_offset = counter * sizeof(CKPT_INFO);
-			m_CPND_CKPTINFO_READ(cp_info,
-					     (char *)gbl_shm_addr.ckpt_addr +
-						 sizeof(CKPT_HDR),
-					     i_offset);
+			m_CPND_CKPTINFO_READ(cp_info, cb, i_offset);
 
 			if (cp_info.is_valid == 0) {
 				counter++;
@@ -704,11 +698,7 @@ void *cpnd_restart_shm_create(NCS_OS_POSIX_SHM_REQ_INFO *cpnd_open_req,
 						i_offset = next_offset *
 							   sizeof(CKPT_INFO);
 						m_CPND_CKPTINFO_READ(
-						    tmp_cp_info,
-						    (char *)gbl_shm_addr
-							    .ckpt_addr +
-							sizeof(CKPT_HDR),
-						    i_offset);
+						    tmp_cp_info, cb, i_offset);
 					}
 
 				} /* End of clients processing for this cp_node
@@ -792,116 +782,322 @@ node_add_fail:
 	return cpnd_open_req->info.open.o_addr;
 }
 
-/* TO FIND THE FREE BLOCK */
+/*********************************************************************************************
+ * Name           :  cpnd_shm_info_addr
+ *
+ * Description    : To get the address of a client or checkpoint info, segment
+ *                  0 is the info array of CPND_CHECKPOINT_INFO and the others
+ *                  are the overflow segments
+ *
+ * Arguments      : type - client or checkpoint info, i_offset - byte offset
+ *
+ * Return Values  : address of the info
+ *
+ **********************************************************************************************/
+static char *cpnd_shm_info_addr(CPND_CB *cb, CPND_TYPE_INFO type,
+				uint64_t i_offset)
+{
+	CPND_SHM_SLOTS *slots;
+	uint64_t seg_size;
+	uint64_t seg;
+
+	if (type == CPND_CLIENT_INFO) {
+		slots = &cb->shm_clients;
+		seg_size = MAX_CLIENTS * sizeof(CLIENT_INFO);
+		if (i_offset < seg_size)
+			return (char *)cb->shm_addr.cli_addr +
+			       sizeof(CLIENT_HDR) + i_offset;
+	} else {
+		slots = &cb->shm_ckpts;
+		seg_size = MAX_CKPTS * sizeof(CKPT_INFO);
+		if (i_offset < seg_size)
+			return (char *)cb->shm_addr.ckpt_addr +
+			       sizeof(CKPT_HDR) + i_offset;
+	}
+
+	seg = i_offset / seg_size;
+	osafassert(seg < slots->n_segs);
+	return slots->seg_addr[seg] + i_offset % seg_size;
+}
+
+/*********************************************************************************************
+ * Name           :  cpnd_shm_seg_open
+ *
+ * Description    : To open an overflow segment of the client or checkpoint
+ *                  infos
+ *
+ * Arguments      : type - client or checkpoint info, seg - segment number,
+ *                  flags - open flags
+ *
+ * Return Values  : Success / Error
+ *
+ **********************************************************************************************/
+static uint32_t cpnd_shm_seg_open(CPND_CB *cb, CPND_TYPE_INFO type,
+				  uint32_t seg, uint32_t flags)
+{
+	NCS_OS_POSIX_SHM_REQ_INFO open_req;
+	CPND_SHM_SLOTS *slots;
+	char name[64];
+	uint32_t rc;
+
+	memset(&open_req, '\0', sizeof(open_req));
+	if (type == CPND_CLIENT_INFO) {
+		slots = &cb->shm_clients;
+		snprintf(name, sizeof(name), "CPND_CLIENT_INFO_%" PRIu32 "_%u",
+			 cb->nodeid, seg);
+		open_req.info.open.i_size = MAX_CLIENTS * sizeof(CLIENT_INFO);
+	} else {
+		slots = &cb->shm_ckpts;
+		snprintf(name, sizeof(name), "CPND_CKPT_INFO_%" PRIu32 "_%u",
+			 cb->nodeid, seg);
+		open_req.info.open.i_size = MAX_CKPTS * sizeof(CKPT_INFO);
+	}
+
+	open_req.type = NCS_OS_POSIX_SHM_REQ_OPEN;
+	open_req.ensures_space = cb->shm_alloc_guaranteed == 1;
+	open_req.info.open.i_offset = 0;
+	open_req.info.open.i_name = name;
+	open_req.info.open.i_map_flags = MAP_SHARED;
+	open_req.info.open.o_addr = NULL;
+	open_req.info.open.i_flags = flags;
+
+	rc = ncs_os_posix_shm(&open_req);
+	if (rc == NCSCC_RC_SUCCESS)
+		slots->seg_addr[seg] = open_req.info.open.o_addr;
+	return rc;
+}
+
+/*********************************************************************************************
+ * Name           :  cpnd_shm_segs_open
+ *
+ * Description    : To open the overflow segments left by the previous CPND
+ *
+ * Arguments      : -
+ *
+ * Return Values  : -
+ *
+ **********************************************************************************************/
+static void cpnd_shm_segs_open(CPND_CB *cb)
+{
+	cb->shm_clients.n_segs = 1;
+	while (cb->shm_clients.n_segs < MAX_SHM_SEGMENTS &&
+	       cpnd_shm_seg_open(cb, CPND_CLIENT_INFO, cb->shm_clients.n_segs,
+				 O_RDWR) == NCSCC_RC_SUCCESS)
+		cb->shm_clients.n_segs++;
+
+	cb->shm_ckpts.n_segs = 1;
+	while (cb->shm_ckpts.n_segs < MAX_SHM_SEGMENTS &&
+	       cpnd_shm_seg_open(cb, CPND_CKPT_INFO, cb->shm_ckpts.n_segs,
+				 O_RDWR) == NCSCC_RC_SUCCESS)
+		cb->shm_ckpts.n_segs++;
+
+	TRACE_1("cpnd client segments:%u ckpt segments:%u",
+		cb->shm_clients.n_segs, cb->shm_ckpts.n_segs);
+}
+
+/*********************************************************************************************
+ * Name           :  cpnd_shm_segs_unlink
+ *
+ * Description    : To remove the overflow segments of an earlier CPND
+ *                  instance when the shared memory is created
+ *
+ * Arguments      : -
+ *
+ * Return Values  : -
+ *
+ **********************************************************************************************/
+static void cpnd_shm_segs_unlink(CPND_CB *cb)
+{
+	char name[64];
+	uint32_t seg;
+
+	cb->shm_clients.n_segs = 1;
+	cb->shm_ckpts.n_segs = 1;
+
+	for (seg = 1; seg < MAX_SHM_SEGMENTS; seg++) {
+		snprintf(name, sizeof(name), "CPND_CLIENT_INFO_%" PRIu32 "_%u",
+			 cb->nodeid, seg);
+		if (shm_unlink(name) < 0)
+			break;
+	}
+	for (seg = 1; seg < MAX_SHM_SEGMENTS; seg++) {
+		snprintf(name, sizeof(name), "CPND_CKPT_INFO_%" PRIu32 "_%u",
+			 cb->nodeid, seg);
+		if (shm_unlink(name) < 0)
+			break;
+	}
+}
+
+/*********************************************************************************************
+ * Name           :  cpnd_shm_slot_valid
+ *
+ * Description    : To check the is_valid flag of a slot in the shared memory
+ *
+ * Arguments      : type - client or checkpoint info, slot - slot number
+ *
+ * Return Values  : true if the slot is in use
+ *
+ **********************************************************************************************/
+static bool cpnd_shm_slot_valid(CPND_CB *cb, CPND_TYPE_INFO type,
+				int32_t slot)
+{
+	CLIENT_INFO cl_info;
+	CKPT_INFO ckpt_info;
+
+	if (type == CPND_CLIENT_INFO) {
+		m_CPND_CLINFO_READ(cl_info, cb, slot * sizeof(CLIENT_INFO));
+		return cl_info.is_valid == 1;
+	}
+	m_CPND_CKPTINFO_READ(ckpt_info, cb, slot * sizeof(CKPT_INFO));
+	return ckpt_info.is_valid == 1;
+}
+
+/*********************************************************************************************
+ * Name           :  cpnd_shm_slots_rebuild
+ *
+ * Description    : To rebuild the free slots from the is_valid flags in the
+ *                  shared memory, the lowest slot is put on top
+ *
+ * Arguments      : type - client or checkpoint info
+ *
+ * Return Values  : Success / Error
+ *
+ **********************************************************************************************/
+static uint32_t cpnd_shm_slots_rebuild(CPND_CB *cb, CPND_TYPE_INFO type)
+{
+	CPND_SHM_SLOTS *slots;
+	int32_t n_slots, slot;
+
+	if (type == CPND_CLIENT_INFO) {
+		slots = &cb->shm_clients;
+		n_slots = slots->n_segs * MAX_CLIENTS;
+	} else {
+		slots = &cb->shm_ckpts;
+		n_slots = slots->n_segs * MAX_CKPTS;
+	}
+
+	if (slots->n_slots != n_slots) {
+		if (slots->free_slots)
+			m_MMGR_FREE_CPND_DEFAULT(slots->free_slots);
+		if (slots->on_free_list)
+			m_MMGR_FREE_CPND_DEFAULT(slots->on_free_list);
+		slots->n_slots = 0;
+		slots->free_slots =
+		    m_MMGR_ALLOC_CPND_DEFAULT(n_slots * sizeof(int32_t));
+		slots->on_free_list = m_MMGR_ALLOC_CPND_DEFAULT(n_slots);
+		if (slots->free_slots == NULL || slots->on_free_list == NULL) {
+			LOG_ER("cpnd free slot memory allocation failed");
+			return NCSCC_RC_FAILURE;
+		}
+		slots->n_slots = n_slots;
+	}
+
+	memset(slots->on_free_list, 0, n_slots);
+	slots->n_free = 0;
+	for (slot = n_slots - 1; slot >= 0; slot--) {
+		if (!cpnd_shm_slot_valid(cb, type, slot)) {
+			slots->free_slots[slots->n_free++] = slot;
+			slots->on_free_list[slot] = 1;
+		}
+	}
+	return NCSCC_RC_SUCCESS;
+}
+
+/*********************************************************************************************
+ * Name           :  cpnd_shm_slot_put
+ *
+ * Description    : To put a slot cleared in the shared memory back on the
+ *                  free slots
+ *
+ * Arguments      : type - client or checkpoint info, slot - slot number
+ *
+ * Return Values  : -
+ *
+ **********************************************************************************************/
+static void cpnd_shm_slot_put(CPND_CB *cb, CPND_TYPE_INFO type, int32_t slot)
+{
+	CPND_SHM_SLOTS *slots =
+	    (type == CPND_CLIENT_INFO) ? &cb->shm_clients : &cb->shm_ckpts;
+
+	if (slot < 0 || slot >= slots->n_slots || slots->on_free_list[slot])
+		return;
+	slots->free_slots[slots->n_free++] = slot;
+	slots->on_free_list[slot] = 1;
+}
+
 /************************************************************************************
  * Name        :  cpnd_find_free_loc
  *
- * Description : To find the free block in the client info if case 1 & ckpt_info
- *if case 2 it will detect if there is any hole in between and allocate that
- *memory, this is done by checking the is_valid flag
+ * Description : To find a free block in the client info if case 1 & ckpt_info
+ *if case 2. The free blocks are taken from a stack of free slots, that is
+ *rebuilt from the is_valid flags when it is empty. When all blocks are in use
+ *a new overflow segment is added
  *
  * Arguments   : type - which will decide for which case it has to find free
  *block
  *
- * Return Values : Return the free block number
+ * Return Values : Return the free block number, -1 when all blocks are in use
  ***********************************************************************************/
 int32_t cpnd_find_free_loc(CPND_CB *cb, CPND_TYPE_INFO type)
 {
-	int32_t counter = 0;
-	uint32_t rc = NCSCC_RC_SUCCESS;
-	CLIENT_INFO cl_info;
-	CKPT_INFO ckpt_info;
-	NCS_OS_POSIX_SHM_REQ_INFO read_req;
+	CPND_SHM_SLOTS *slots;
+	int32_t slot;
 
 	TRACE_ENTER();
-	memset(&read_req, '\0', sizeof(NCS_OS_POSIX_SHM_REQ_INFO));
-	memset(&cl_info, '\0', sizeof(CLIENT_INFO));
-	memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
-
 	switch (type) {
 	case CPND_CLIENT_INFO:
-		do {
-
-			if ((counter * sizeof(CLIENT_INFO)) > UINTMAX_MAX) {
-				LOG_ER(
-				    "cpnd client info read failed,exceeded the read limits(UINT64_MAX) ");
-				return -2;
-			}
-			read_req.type = NCS_OS_POSIX_SHM_REQ_READ;
-			read_req.info.read.i_addr =
-			    (void *)((char *)cb->shm_addr.cli_addr +
-				     sizeof(CLIENT_HDR));
-			read_req.info.read.i_read_size = sizeof(CLIENT_INFO);
-			read_req.info.read.i_offset =
-			    counter * sizeof(CLIENT_INFO);
-			read_req.info.read.i_to_buff = (CLIENT_INFO *)&cl_info;
-			rc = ncs_os_posix_shm(&read_req);
-			if (rc != NCSCC_RC_SUCCESS) {
-				LOG_ER("cpnd client info read shm failed");
-				return -2;
-			}
-			if (1 == ((CLIENT_INFO *)read_req.info.read.i_to_buff)
-				     ->is_valid) {
-				counter++;
-				memset(&cl_info, '\0', sizeof(CLIENT_INFO));
-				if (counter == MAX_CLIENTS) {
-					TRACE_1(
-					    "cpnd max number of clients reached");
-					counter = -1;
-					break;
-				}
-			} else {
-				TRACE_1("cpnd found free block for client");
-				break;
-			}
-		} while (1);
+		slots = &cb->shm_clients;
 		break;
-
 	case CPND_CKPT_INFO:
-		do {
-			if ((counter * sizeof(CKPT_INFO)) > UINTMAX_MAX) {
-				LOG_ER(
-				    "cpnd ckpt info read failed,exceeded the read limits(UINT64_MAX) ");
-				return -2;
-			}
-			read_req.type = NCS_OS_POSIX_SHM_REQ_READ;
-			read_req.info.read.i_addr =
-			    (void *)((char *)cb->shm_addr.ckpt_addr +
-				     sizeof(CKPT_HDR));
-			read_req.info.read.i_read_size = sizeof(CKPT_INFO);
-			read_req.info.read.i_offset =
-			    counter * sizeof(CKPT_INFO);
-			read_req.info.read.i_to_buff = (CKPT_INFO *)&ckpt_info;
-			rc = ncs_os_posix_shm(&read_req);
-			if (rc != NCSCC_RC_SUCCESS) {
-				TRACE_4("cpnd ckpt info read failed counter:%d",
-					counter);
-				TRACE_LEAVE();
-				return -2;
-			}
-
-			if (1 == ((CKPT_INFO *)read_req.info.read.i_to_buff)
-				     ->is_valid) {
-				counter++;
-				memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
-				if (counter == MAX_CKPTS) {
-					TRACE_4(
-					    "cpnd max ckpts reached in read request");
-					counter = -1;
-					break;
-				}
-			} else {
-				TRACE_1("cpnd ckpt free block success");
-				break;
-			}
-		} while (1);
+		slots = &cb->shm_ckpts;
 		break;
 	default:
 		TRACE_LEAVE();
 		return NCSCC_RC_FAILURE;
 	}
+
+	do {
+		/* A slot of the stack may have been taken without being
+		 * popped, e.g. by the restart of the CPND, so check it */
+		while (slots->n_free > 0) {
+			slot = slots->free_slots[--slots->n_free];
+			slots->on_free_list[slot] = 0;
+			if (!cpnd_shm_slot_valid(cb, type, slot)) {
+				TRACE_1("cpnd found free block:%d type:%d",
+					slot, type);
+				TRACE_LEAVE();
+				return slot;
+			}
+		}
+
+		if (cpnd_shm_slots_rebuild(cb, type) != NCSCC_RC_SUCCESS) {
+			TRACE_LEAVE();
+			return -2;
+		}
+		if (slots->n_free > 0)
+			continue;
+
+		if (slots->n_segs == MAX_SHM_SEGMENTS ||
+		    cpnd_shm_seg_open(cb, type, slots->n_segs,
+				      O_CREAT | O_EXCL | O_RDWR) !=
+			NCSCC_RC_SUCCESS) {
+			TRACE_4("cpnd max number of blocks reached type:%d",
+				type);
+			TRACE_LEAVE();
+			return -1;
+		}
+		slots->n_segs++;
+		TRACE_1("cpnd added segment:%u type:%d", slots->n_segs - 1,
+			type);
+
+		if (cpnd_shm_slots_rebuild(cb, type) != NCSCC_RC_SUCCESS) {
+			TRACE_LEAVE();
+			return -2;
+		}
+	} while (slots->n_free > 0);
+
 	TRACE_LEAVE();
-	return counter;
+	return -1;
 }
 
 /*********************************************************************************
@@ -988,8 +1184,7 @@ uint32_t cpnd_write_client_info(CPND_CB *cb, CPND_CKPT_CLIENT_NODE *cl_node,
 		    "cpnd write client info  failed,exceeded the write limits(UINT64_MAX) ");
 	}
 	i_offset = offset * sizeof(CLIENT_INFO);
-	m_CPND_CLINFO_UPDATE((char *)cb->shm_addr.cli_addr + sizeof(CLIENT_HDR),
-			     cl_info, i_offset);
+	m_CPND_CLINFO_UPDATE(cb, cl_info, i_offset);
 	TRACE_1("cpnd client info update success for ckpt_app_hdl :%llx",
 		cl_node->ckpt_app_hdl);
 	return rc;
@@ -1009,12 +1204,10 @@ void cpnd_restart_set_arrcb(CPND_CB *cb, CPND_CKPT_CLIENT_NODE *cl_node)
 	CLIENT_INFO cl_info;
 	memset(&cl_info, '\0', sizeof(CLIENT_INFO));
 
-	m_CPND_CLINFO_READ(cl_info,
-			   ((char *)cb->shm_addr.cli_addr) + sizeof(CLIENT_HDR),
-			   cl_node->offset * sizeof(CLIENT_INFO));
+	m_CPND_CLINFO_READ(cl_info, cb, cl_node->offset * sizeof(CLIENT_INFO));
 	cl_info.arr_flag = cl_node->arrival_cb_flag;
-	m_CPND_CLINFO_UPDATE((char *)cb->shm_addr.cli_addr + sizeof(CLIENT_HDR),
-			     cl_info, cl_node->offset * sizeof(CLIENT_INFO));
+	m_CPND_CLINFO_UPDATE(cb, cl_info,
+			     cl_node->offset * sizeof(CLIENT_INFO));
 }
 
 /******************************************************************************************
@@ -1032,15 +1225,13 @@ void cpnd_restart_set_reader_writer_flags_cnt(CPND_CB *cb,
 	CLIENT_INFO cl_info;
 	memset(&cl_info, '\0', sizeof(CLIENT_INFO));
 
-	m_CPND_CLINFO_READ(cl_info,
-			   ((char *)cb->shm_addr.cli_addr) + sizeof(CLIENT_HDR),
-			   cl_node->offset * sizeof(CLIENT_INFO));
+	m_CPND_CLINFO_READ(cl_info, cb, cl_node->offset * sizeof(CLIENT_INFO));
 	cl_info.ckpt_open_ref_cnt = cl_node->ckpt_open_ref_cnt;
 	cl_info.open_reader_flags_cnt = cl_node->open_reader_flags_cnt;
 	cl_info.open_writer_flags_cnt = cl_node->open_writer_flags_cnt;
 
-	m_CPND_CLINFO_UPDATE((char *)cb->shm_addr.cli_addr + sizeof(CLIENT_HDR),
-			     cl_info, cl_node->offset * sizeof(CLIENT_INFO));
+	m_CPND_CLINFO_UPDATE(cb, cl_info,
+			     cl_node->offset * sizeof(CLIENT_INFO));
 }
 
 /***************************************************************************************
@@ -1099,10 +1290,7 @@ bool cpnd_find_exact_ckptinfo(CPND_CB *cb, CKPT_INFO *ckpt_info,
 			    "cpnd exact_ckptinf failed,exceeded the write limits(UINT64_MAX) ");
 		}
 		i_offset = next * sizeof(CKPT_INFO);
-		m_CPND_CKPTINFO_READ(prev_ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
-				     i_offset);
+		m_CPND_CKPTINFO_READ(prev_ckpt_info, cb, i_offset);
 		if (prev_ckpt_info.bm_offset == bitmap_offset) {
 			found = true;
 			*offset = prev_ckpt_info.offset;
@@ -1146,9 +1334,7 @@ uint32_t cpnd_update_ckpt_with_clienthdl(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 	/* Read the starting shared memory entry for this cp_node */
 	prev_offset = cp_node->offset;
 	i_offset = prev_offset * sizeof(CKPT_INFO);
-	m_CPND_CKPTINFO_READ(ckpt_info,
-			     (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-			     i_offset);
+	m_CPND_CKPTINFO_READ(ckpt_info, cb, i_offset);
 
 	/* Findout the bitmap offset and bitmap value for the input client
 	 * handle */
@@ -1171,10 +1357,7 @@ uint32_t cpnd_update_ckpt_with_clienthdl(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 			    "cpnd update clienthdl failed,exceeded the write limits(UINT64_MAX) ");
 		}
 		i_offset = prev_offset * sizeof(CKPT_INFO);
-		m_CPND_CKPTINFO_READ(prev_ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
-				     i_offset);
+		m_CPND_CKPTINFO_READ(prev_ckpt_info, cb, i_offset);
 
 		prev_ckpt_info.next = cpnd_find_free_loc(cb, CPND_CKPT_INFO);
 		if (prev_ckpt_info.next == -1) {
@@ -1194,7 +1377,7 @@ uint32_t cpnd_update_ckpt_with_clienthdl(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 				    0);
 		no_ckpts = ++(ckpt_hdr.num_ckpts);
 
-		if (no_ckpts >= MAX_CKPTS) {
+		if (no_ckpts >= MAX_SHM_SEGMENTS * MAX_CKPTS) {
 			TRACE_LEAVE();
 			return NCSCC_RC_FAILURE;
 		}
@@ -1202,9 +1385,7 @@ uint32_t cpnd_update_ckpt_with_clienthdl(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		/* write the checkpoint info (number of ckpts)in the  header  */
 		cpnd_ckpt_write_header(cb, no_ckpts);
 
-		m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-					   sizeof(CKPT_HDR),
-				       prev_ckpt_info, i_offset);
+		m_CPND_CKPTINFO_UPDATE(cb, prev_ckpt_info, i_offset);
 
 		/* Allocate New ckpt_info information */
 		offset = prev_ckpt_info.next;
@@ -1218,21 +1399,14 @@ uint32_t cpnd_update_ckpt_with_clienthdl(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		new_ckpt_info.next = SHM_NEXT;
 
 		i_offset = offset * sizeof(CKPT_INFO);
-		m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-					   sizeof(CKPT_HDR),
-				       new_ckpt_info, i_offset);
+		m_CPND_CKPTINFO_UPDATE(cb, new_ckpt_info, i_offset);
 
 	} else {
 		i_offset = offset * sizeof(CKPT_INFO);
-		m_CPND_CKPTINFO_READ(prev_ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
-				     i_offset);
+		m_CPND_CKPTINFO_READ(prev_ckpt_info, cb, i_offset);
 		prev_ckpt_info.client_bitmap =
 		    prev_ckpt_info.client_bitmap | bitmap_value;
-		m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-					   sizeof(CKPT_HDR),
-				       prev_ckpt_info, i_offset);
+		m_CPND_CKPTINFO_UPDATE(cb, prev_ckpt_info, i_offset);
 	}
 	TRACE_LEAVE();
 	return rc;
@@ -1287,9 +1461,7 @@ uint32_t cpnd_write_ckpt_info(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		    "cpnd write ckpt info  failed,exceeded the write limits(UINT64_MAX) ");
 	}
 	i_offset = offset * sizeof(CKPT_INFO);
-	m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-				   sizeof(CKPT_HDR),
-			       ckpt_info, i_offset);
+	m_CPND_CKPTINFO_UPDATE(cb, ckpt_info, i_offset);
 
 	TRACE_LEAVE2("cpnd ckpt info write success ckpt_id:%llx",
 		     cp_node->ckpt_id);
@@ -1381,16 +1553,15 @@ uint32_t cpnd_restart_client_node_del(CPND_CB *cb,
 	cpnd_cli_info_write_header(cb, no_clients);
 
 	clinfo_write.type = NCS_OS_POSIX_SHM_REQ_WRITE;
-	clinfo_write.info.write.i_addr =
-	    (void *)((char *)cb->shm_addr.cli_addr + sizeof(CLIENT_HDR));
 	clinfo_write.info.write.i_from_buff = (CLIENT_INFO *)&cl_info;
 	if ((cl_node->offset * sizeof(CLIENT_INFO)) > UINTMAX_MAX) {
 		LOG_ER(
 		    "cpnd client info read failed,exceeded the read limits(UINT64_MAX) ");
 		return NCSCC_RC_FAILURE;
 	}
-	clinfo_write.info.write.i_offset =
-	    cl_node->offset * sizeof(CLIENT_INFO);
+	clinfo_write.info.write.i_addr = cpnd_shm_info_addr(
+	    cb, CPND_CLIENT_INFO, cl_node->offset * sizeof(CLIENT_INFO));
+	clinfo_write.info.write.i_offset = 0;
 	clinfo_write.info.write.i_write_size = sizeof(CLIENT_INFO);
 	clinfo_write.ensures_space = cb->shm_alloc_guaranteed != 0;
 	rc = ncs_os_posix_shm(&clinfo_write);
@@ -1400,6 +1571,7 @@ uint32_t cpnd_restart_client_node_del(CPND_CB *cb,
 	} else {
 		TRACE_1("cpnd ckpt info write success");
 	}
+	cpnd_shm_slot_put(cb, CPND_CLIENT_INFO, cl_node->offset);
 
 	TRACE_LEAVE();
 	return rc;
@@ -1488,9 +1660,8 @@ uint32_t cpnd_restart_shm_ckpt_free(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
 	cp_node->offset = SHM_INIT;
 
 	/*Update the prev & curr shared memory segments with the new data */
-	m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-				   sizeof(CKPT_HDR),
-			       ckpt_info, i_offset);
+	m_CPND_CKPTINFO_UPDATE(cb, ckpt_info, i_offset);
+	cpnd_shm_slot_put(cb, CPND_CKPT_INFO, i_offset / sizeof(CKPT_INFO));
 
 	TRACE_LEAVE();
 
@@ -1514,14 +1685,11 @@ void cpnd_restart_ckpt_name_length_reset(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
 
 	memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
 	if (cp_node->offset >= 0) {
-		m_CPND_CKPTINFO_READ(ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
+		m_CPND_CKPTINFO_READ(ckpt_info, cb,
 				     cp_node->offset * sizeof(CKPT_INFO));
 		ckpt_info.is_unlink = true;
-		m_CPND_CKPTINFO_UPDATE(
-		    (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-		    ckpt_info, cp_node->offset * sizeof(CKPT_INFO));
+		m_CPND_CKPTINFO_UPDATE(cb, ckpt_info,
+				       cp_node->offset * sizeof(CKPT_INFO));
 	}
 	return;
 }
@@ -1541,14 +1709,11 @@ void cpnd_restart_set_close_flag(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
 
 	memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
 	if (cp_node->offset >= 0) {
-		m_CPND_CKPTINFO_READ(ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
+		m_CPND_CKPTINFO_READ(ckpt_info, cb,
 				     cp_node->offset * sizeof(CKPT_INFO));
 		ckpt_info.is_close = true;
-		m_CPND_CKPTINFO_UPDATE(
-		    (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-		    ckpt_info, cp_node->offset * sizeof(CKPT_INFO));
+		m_CPND_CKPTINFO_UPDATE(cb, ckpt_info,
+				       cp_node->offset * sizeof(CKPT_INFO));
 	}
 	return;
 }
@@ -1568,14 +1733,11 @@ void cpnd_restart_reset_close_flag(CPND_CB *cb, CPND_CKPT_NODE *cp_node)
 
 	memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
 	if (cp_node->offset >= 0) {
-		m_CPND_CKPTINFO_READ(ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
+		m_CPND_CKPTINFO_READ(ckpt_info, cb,
 				     cp_node->offset * sizeof(CKPT_INFO));
 		ckpt_info.is_close = false;
-		m_CPND_CKPTINFO_UPDATE(
-		    (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-		    ckpt_info, cp_node->offset * sizeof(CKPT_INFO));
+		m_CPND_CKPTINFO_UPDATE(cb, ckpt_info,
+				       cp_node->offset * sizeof(CKPT_INFO));
 	}
 	return;
 }
@@ -1607,14 +1769,10 @@ void cpnd_clear_ckpt_info(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		    "cpnd clear ckpt info failed,exceeded the write limits(UINT64_MAX) ");
 	}
 	i_offset = prev_offset * sizeof(CKPT_INFO);
-	m_CPND_CKPTINFO_READ(prev_ckpt_info,
-			     (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-			     i_offset);
+	m_CPND_CKPTINFO_READ(prev_ckpt_info, cb, i_offset);
 
 	i_offset = curr_offset * sizeof(CKPT_INFO);
-	m_CPND_CKPTINFO_READ(curr_ckpt_info,
-			     (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-			     i_offset);
+	m_CPND_CKPTINFO_READ(curr_ckpt_info, cb, i_offset);
 
 	/* Update the Next Location in the previous prev_ckpt_info.next as we
 	 * have to clear the curr ckpt_info */
@@ -1630,16 +1788,13 @@ void cpnd_clear_ckpt_info(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 		/*Update the prev & curr shared memory segments with the new
 		 * data */
 		i_offset = prev_offset * sizeof(CKPT_INFO);
-		m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-					   sizeof(CKPT_HDR),
-				       prev_ckpt_info, i_offset);
+		m_CPND_CKPTINFO_UPDATE(cb, prev_ckpt_info, i_offset);
 
 		cpnd_extended_name_free(&curr_ckpt_info.ckpt_name);
 		memset(&curr_ckpt_info, '\0', sizeof(CKPT_INFO));
 		i_offset = curr_offset * sizeof(CKPT_INFO);
-		m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-					   sizeof(CKPT_HDR),
-				       curr_ckpt_info, i_offset);
+		m_CPND_CKPTINFO_UPDATE(cb, curr_ckpt_info, i_offset);
+		cpnd_shm_slot_put(cb, CPND_CKPT_INFO, curr_offset);
 	} else { /* This is the starting entry for this cp_node so update
 		    accordingly */
 
@@ -1661,18 +1816,13 @@ void cpnd_clear_ckpt_info(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 				    "cpnd clear ckpt info failed,exceeded the write limits(UINT64_MAX) ");
 			}
 			i_offset = (curr_ckpt_info.next) * sizeof(CKPT_INFO);
-			m_CPND_CKPTINFO_READ(next_ckpt_info,
-					     (char *)cb->shm_addr.ckpt_addr +
-						 sizeof(CKPT_HDR),
-					     i_offset);
+			m_CPND_CKPTINFO_READ(next_ckpt_info, cb, i_offset);
 
 			next_ckpt_info.is_close = curr_ckpt_info.is_close;
 			next_ckpt_info.is_unlink = curr_ckpt_info.is_unlink;
 			next_ckpt_info.close_time = curr_ckpt_info.close_time;
 			next_ckpt_info.is_first = true;
-			m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-						   sizeof(CKPT_HDR),
-					       next_ckpt_info, i_offset);
+			m_CPND_CKPTINFO_UPDATE(cb, next_ckpt_info, i_offset);
 
 			if (((curr_ckpt_info.offset) * sizeof(CKPT_INFO)) >
 			    UINTMAX_MAX) {
@@ -1683,9 +1833,9 @@ void cpnd_clear_ckpt_info(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 			cpnd_extended_name_free(&curr_ckpt_info.ckpt_name);
 			memset(&curr_ckpt_info, '\0', sizeof(CKPT_INFO));
 
-			m_CPND_CKPTINFO_UPDATE((char *)cb->shm_addr.ckpt_addr +
-						   sizeof(CKPT_HDR),
-					       curr_ckpt_info, i_offset);
+			m_CPND_CKPTINFO_UPDATE(cb, curr_ckpt_info, i_offset);
+			cpnd_shm_slot_put(cb, CPND_CKPT_INFO,
+					  i_offset / sizeof(CKPT_INFO));
 
 		} else {
 			/* There is only one ckpt_info is there for this cp_node
@@ -1722,24 +1872,19 @@ void cpnd_restart_client_reset(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 	memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
 
 	if (cp_node->offset >= 0) {
-		m_CPND_CKPTINFO_READ(ckpt_info,
-				     (char *)cb->shm_addr.ckpt_addr +
-					 sizeof(CKPT_HDR),
+		m_CPND_CKPTINFO_READ(ckpt_info, cb,
 				     cp_node->offset * sizeof(CKPT_INFO));
 		/* findour the exact ckpt_info matching the client_hdl */
 		found = cpnd_find_exact_ckptinfo(cb, &ckpt_info, bitmap_offset,
 						 &offset, &prev_offset);
 		if (found) {
 			memset(&ckpt_info, '\0', sizeof(CKPT_INFO));
-			m_CPND_CKPTINFO_READ(ckpt_info,
-					     (char *)cb->shm_addr.ckpt_addr +
-						 sizeof(CKPT_HDR),
+			m_CPND_CKPTINFO_READ(ckpt_info, cb,
 					     offset * sizeof(CKPT_INFO));
 			client_bitmap_reset(&ckpt_info.client_bitmap,
 					    (client_hdl % 32));
-			m_CPND_CKPTINFO_UPDATE(
-			    (char *)cb->shm_addr.ckpt_addr + sizeof(CKPT_HDR),
-			    ckpt_info, offset * sizeof(CKPT_INFO));
+			m_CPND_CKPTINFO_UPDATE(cb, ckpt_info,
+					       offset * sizeof(CKPT_INFO));
 
 			/* Delete the ckpt_info from shared memory if this
 			 * ckpt_info's all 31 refs are closed */
@@ -1809,7 +1954,7 @@ uint32_t cpnd_restart_shm_ckpt_update(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 					    (char *)cb->shm_addr.ckpt_addr, 0);
 			no_ckpts = ++(ckpt_hdr.num_ckpts);
 
-			if (no_ckpts >= MAX_CKPTS)
+			if (no_ckpts >= MAX_SHM_SEGMENTS * MAX_CKPTS)
 				return NCSCC_RC_FAILURE;
 
 			/* write the checkpoint info (number of ckpts)in the
@@ -24,6 +24,9 @@
 
 #include <cstring>
 #include <map>
+#include <new>
+#include <unordered_map>
+#include <vector>
 #include "base/logtrace.h"
 #include "base/ncsgl_defs.h"
 #include "ckpt/ckptnd/cpnd.h"
@@ -44,11 +47,96 @@ struct ltSectionIdT {
   }
 };
 
+// FNV-1a over the section id bytes
+struct hashSectionIdT {
+  size_t operator()(const SaCkptSectionIdT *s) const {
+    uint64_t hash(14695981039346656037ULL);
+
+    for (SaUint16T i(0); i < s->idLen; i++) {
+      hash ^= s->id[i];
+      hash *= 1099511628211ULL;
+    }
+
+    return static_cast<size_t>(hash);
+  }
+};
+
+struct eqSectionIdT {
+  bool operator()(const SaCkptSectionIdT *s1,
+                  const SaCkptSectionIdT *s2) const {
+    return s1->idLen == s2->idLen &&
+           memcmp(s1->id, s2->id, s1->idLen) == 0;
+  }
+};
+
+// ordered by section id, used for section iteration
 typedef std::map<const SaCkptSectionIdT *, CPND_CKPT_SECTION_INFO *,
                  ltSectionIdT>
     SectionMap;
 
-typedef std::map<uint32_t, CPND_CKPT_SECTION_INFO *> LocalSectionIdMap;
+// used for lookup of a section id
+typedef std::unordered_map<const SaCkptSectionIdT *, CPND_CKPT_SECTION_INFO *,
+                           hashSectionIdT, eqSectionIdT>
+    SectionIndex;
+
+// indexed by lcl_sec_id
+typedef std::vector<CPND_CKPT_SECTION_INFO *> LocalSectionIdMap;
+
+// Section infos of a replica are carved out of chunks of growing size, and
+// freed section infos are reused for new sections. The memory is returned
+// when the replica is destroyed.
+class SectionSlab {
+ public:
+  SectionSlab() : chunkSize_(kMinChunkSize), size_(0) {}
+
+  ~SectionSlab() {
+    for (size_t i(0); i < chunks_.size(); i++) delete[] chunks_[i];
+  }
+
+  CPND_CKPT_SECTION_INFO *alloc() {
+    CPND_CKPT_SECTION_INFO *sectionInfo(0);
+
+    if (freeList_.empty() && !grow()) return sectionInfo;
+
+    sectionInfo = freeList_.back();
+    freeList_.pop_back();
+    memset(sectionInfo, '\0', sizeof(CPND_CKPT_SECTION_INFO));
+
+    return sectionInfo;
+  }
+
+  // never reallocates, capacity covers all section infos of the slab
+  void free(CPND_CKPT_SECTION_INFO *sectionInfo) {
+    freeList_.push_back(sectionInfo);
+  }
+
+ private:
+  static const size_t kMinChunkSize = 16;
+  static const size_t kMaxChunkSize = 4096;
+
+  bool grow() {
+    CPND_CKPT_SECTION_INFO *chunk(
+        new (std::nothrow) CPND_CKPT_SECTION_INFO[chunkSize_]);
+
+    if (!chunk) return false;
+
+    chunks_.push_back(chunk);
+    size_ += chunkSize_;
+    freeList_.reserve(size_);
+
+    // hand out the lowest addresses first
+    for (size_t i(chunkSize_); i > 0; i--) freeList_.push_back(&chunk[i - 1]);
+
+    if (chunkSize_ < kMaxChunkSize) chunkSize_ *= 2;
+
+    return true;
+  }
+
+  std::vector<CPND_CKPT_SECTION_INFO *> chunks_;
+  std::vector<CPND_CKPT_SECTION_INFO *> freeList_;
+  size_t chunkSize_;
+  size_t size_;
+};
 
 void cpnd_ckpt_sec_map_init(CPND_CKPT_REPLICA_INFO *replicaInfo) {
   if (replicaInfo->section_db) {
@@ -56,21 +144,103 @@ void cpnd_ckpt_sec_map_init(CPND_CKPT_REPLICA_INFO *replicaInfo) {
     osafassert(false);
   }
 
+  if (replicaInfo->section_index) {
+    LOG_ER("section index already exists");
+    osafassert(false);
+  }
+
   if (replicaInfo->local_section_db) {
     LOG_ER("section map for local section id already exists");
     osafassert(false);
   }
 
+  if (replicaInfo->section_slab) {
+    LOG_ER("section slab already exists");
+    osafassert(false);
+  }
+
   replicaInfo->section_db = new SectionMap;
+  replicaInfo->section_index = new SectionIndex;
   replicaInfo->local_section_db = new LocalSectionIdMap;
+  replicaInfo->section_slab = new SectionSlab;
 }
 
 void cpnd_ckpt_sec_map_destroy(CPND_CKPT_REPLICA_INFO *replicaInfo) {
-  delete static_cast<SectionMap *>(replicaInfo->section_db);
+  SectionMap *map(static_cast<SectionMap *>(replicaInfo->section_db));
+
+  if (map) {
+    // the section infos go away with the slab
+    for (SectionMap::iterator it(map->begin()); it != map->end(); ++it) {
+      CPND_CKPT_SECTION_INFO *section(it->second);
+
+      if (section->ckpt_sec_exptmr.is_active)
+        cpnd_tmr_stop(&section->ckpt_sec_exptmr);
+
+      if (section->sec_id.id) m_MMGR_FREE_CPND_DEFAULT(section->sec_id.id);
+    }
+  }
+
+  delete map;
+  delete static_cast<SectionIndex *>(replicaInfo->section_index);
   delete static_cast<LocalSectionIdMap *>(replicaInfo->local_section_db);
+  delete static_cast<SectionSlab *>(replicaInfo->section_slab);
 
   replicaInfo->section_db = 0;
+  replicaInfo->section_index = 0;
   replicaInfo->local_section_db = 0;
+  replicaInfo->section_slab = 0;
+}
+
+/****************************************************************************
+ * Name          : cpnd_ckpt_sec_alloc
+ *
+ * Description   : Function to allocate a zeroed section info from the slab
+ *                 of a checkpoint replica.
+ *
+ * Arguments     : CPND_CKPT_REPLICA_INFO *replicaInfo - Check point replica.
+ *
+ * Return Values :  NULL/CPND_CKPT_SECTION_INFO
+ *
+ * Notes         : None.
+ *****************************************************************************/
+CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_alloc(
+    CPND_CKPT_REPLICA_INFO *replicaInfo) {
+  SectionSlab *slab(static_cast<SectionSlab *>(replicaInfo->section_slab));
+
+  if (!slab) {
+    LOG_ER("can't find slab in cpnd_ckpt_sec_alloc");
+    osafassert(false);
+  }
+
+  return slab->alloc();
+}
+
+/****************************************************************************
+ * Name          : cpnd_ckpt_sec_free
+ *
+ * Description   : Function to return a section info and its section id to
+ *                 the slab of a checkpoint replica.
+ *
+ * Arguments     : CPND_CKPT_REPLICA_INFO *replicaInfo - Check point replica.
+ *               : CPND_CKPT_SECTION_INFO sectionInfo - Section Info
+ *
+ * Return Values : None.
+ *
+ * Notes         : The section must not be in the section maps.
+ *****************************************************************************/
+void cpnd_ckpt_sec_free(CPND_CKPT_REPLICA_INFO *replicaInfo,
+                        CPND_CKPT_SECTION_INFO *sectionInfo) {
+  SectionSlab *slab(static_cast<SectionSlab *>(replicaInfo->section_slab));
+
+  if (!slab) {
+    LOG_ER("can't find slab in cpnd_ckpt_sec_free");
+    osafassert(false);
+  }
+
+  if (sectionInfo->sec_id.id) m_MMGR_FREE_CPND_DEFAULT(sectionInfo->sec_id.id);
+  sectionInfo->sec_id.id = 0;
+
+  slab->free(sectionInfo);
 }
 
 /****************************************************************************
@@ -92,15 +262,15 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get(const CPND_CKPT_NODE *cp_node,
   TRACE_ENTER();
 
   if (cp_node->replica_info.n_secs) {
-    SectionMap *map(
-        static_cast<SectionMap *>(cp_node->replica_info.section_db));
+    SectionIndex *index(
+        static_cast<SectionIndex *>(cp_node->replica_info.section_index));
 
-    if (map) {
-      SectionMap::iterator it(map->find(id));
+    if (index) {
+      SectionIndex::iterator it(index->find(id));
 
-      if (it != map->end()) sectionInfo = it->second;
+      if (it != index->end()) sectionInfo = it->second;
     } else {
-      LOG_ER("can't find map in cpnd_ckpt_sec_get");
+      LOG_ER("can't find index in cpnd_ckpt_sec_get");
       osafassert(false);
     }
   } else {
@@ -165,15 +335,25 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_del(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
 
   TRACE_ENTER();
 
-  SectionMap *map(static_cast<SectionMap *>(cp_node->replica_info.section_db));
+  SectionIndex *index(
+      static_cast<SectionIndex *>(cp_node->replica_info.section_index));
 
-  if (map) {
-    SectionMap::iterator it(map->find(id));
+  if (index) {
+    SectionIndex::iterator it(index->find(id));
 
-    if (it != map->end()) {
+    if (it != index->end()) {
       sectionInfo = it->second;
-      map->erase(it);
+      index->erase(it);
     }
+  } else {
+    LOG_ER("can't find index in cpnd_ckpt_sec_del");
+    osafassert(false);
+  }
+
+  SectionMap *map(static_cast<SectionMap *>(cp_node->replica_info.section_db));
+
+  if (map) {
+    if (sectionInfo) map->erase(&sectionInfo->sec_id);
   } else {
     LOG_ER("can't find map in cpnd_ckpt_sec_del");
     osafassert(false);
@@ -183,12 +363,8 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_del(CPND_CB *cb, CPND_CKPT_NODE *cp_node,
       static_cast<LocalSectionIdMap *>(cp_node->replica_info.local_section_db));
 
   if (localSecMap) {
-    if (sectionInfo) {
-      LocalSectionIdMap::iterator it(
-          localSecMap->find(sectionInfo->lcl_sec_id));
-
-      if (it != localSecMap->end()) localSecMap->erase(it);
-    }
+    if (sectionInfo && sectionInfo->lcl_sec_id < localSecMap->size())
+      (*localSecMap)[sectionInfo->lcl_sec_id] = 0;
   } else {
     LOG_ER("can't find local sec map in cpnd_ckpt_sec_del");
     osafassert(false);
@@ -234,43 +410,40 @@ uint32_t cpnd_ckpt_sec_add_db(CPND_CKPT_REPLICA_INFO *replicaInfo,
                               CPND_CKPT_SECTION_INFO *sectionInfo) {
   uint32_t rc(NCSCC_RC_SUCCESS);
 
+  SectionIndex *index(static_cast<SectionIndex *>(replicaInfo->section_index));
   SectionMap *map(static_cast<SectionMap *>(replicaInfo->section_db));
+  LocalSectionIdMap *localSecMap(
+      static_cast<LocalSectionIdMap *>(replicaInfo->local_section_db));
 
-  if (map) {
-    std::pair<SectionMap::iterator, bool> p(
-        map->insert(std::make_pair(&sectionInfo->sec_id, sectionInfo)));
-
-    if (!p.second) {
-      LOG_ER("unable to add section info to map");
-      rc = NCSCC_RC_FAILURE;
-      return rc;
-    }
-  } else {
-    LOG_ER("can't find map in cpnd_ckpt_sec_add_db");
+  if (!index || !map || !localSecMap) {
+    LOG_ER("can't find maps in cpnd_ckpt_sec_add_db");
     osafassert(false);
   }
 
-  LocalSectionIdMap *localSecMap(
-      static_cast<LocalSectionIdMap *>(replicaInfo->local_section_db));
-
-  if (localSecMap) {
-    std::pair<LocalSectionIdMap::iterator, bool> p(localSecMap->insert(
-        std::make_pair(sectionInfo->lcl_sec_id, sectionInfo)));
+  if (sectionInfo->lcl_sec_id < localSecMap->size() &&
+      (*localSecMap)[sectionInfo->lcl_sec_id]) {
+    LOG_ER(
+        "unable to add section info to local section id map - the id %d already existed",
+        sectionInfo->lcl_sec_id);
+    rc = NCSCC_RC_FAILURE;
+    return rc;
+  }
 
-    if (!p.second) {
-      LOG_ER(
-          "unable to add section info to local section id map - the id %d already existed",
-          sectionInfo->lcl_sec_id);
-      rc = NCSCC_RC_FAILURE;
+  std::pair<SectionIndex::iterator, bool> p(
+      index->insert(std::make_pair(&sectionInfo->sec_id, sectionInfo)));
 
-      /* Erase the element was inserted into section_db */
-      map->erase(&sectionInfo->sec_id);
-    }
-  } else {
-    LOG_ER("can't find local sec map in cpnd_ckpt_sec_add_db");
-    osafassert(false);
+  if (!p.second) {
+    LOG_ER("unable to add section info to map");
+    rc = NCSCC_RC_FAILURE;
+    return rc;
   }
 
+  map->insert(std::make_pair(&sectionInfo->sec_id, sectionInfo));
+
+  if (sectionInfo->lcl_sec_id >= localSecMap->size())
+    localSecMap->resize(sectionInfo->lcl_sec_id + 1);
+  (*localSecMap)[sectionInfo->lcl_sec_id] = sectionInfo;
+
   return rc;
 }
 
@@ -286,11 +459,21 @@ uint32_t cpnd_ckpt_sec_add_db(CPND_CKPT_REPLICA_INFO *replicaInfo,
  * Notes         : None.
  *****************************************************************************/
 void cpnd_ckpt_delete_all_sect(CPND_CKPT_NODE *cp_node) {
+  SectionIndex *index(
+      static_cast<SectionIndex *>(cp_node->replica_info.section_index));
+
+  if (index) {
+    index->clear();
+  } else {
+    LOG_ER("can't find index in cpnd_ckpt_delete_all_sect");
+    osafassert(false);
+  }
+
   LocalSectionIdMap *localSecMap(
       static_cast<LocalSectionIdMap *>(cp_node->replica_info.local_section_db));
 
   if (localSecMap) {
-    localSecMap->erase(localSecMap->begin(), localSecMap->end());
+    localSecMap->clear();
   } else {
     LOG_ER("can't find local sec map in cpnd_ckpt_delete_all_sect");
     osafassert(false);
@@ -309,7 +492,7 @@ void cpnd_ckpt_delete_all_sect(CPND_CKPT_NODE *cp_node) {
       if (section->ckpt_sec_exptmr.is_active)
         cpnd_tmr_stop(&section->ckpt_sec_exptmr);
 
-      m_CPND_FREE_CKPT_SECTION(section);
+      cpnd_ckpt_sec_free(&cp_node->replica_info, section);
 
       SectionMap::iterator tmpIt(it);
       ++it;
@@ -343,9 +526,7 @@ CPND_CKPT_SECTION_INFO *cpnd_get_sect_with_id(const CPND_CKPT_NODE *cp_node,
         cp_node->replica_info.local_section_db));
 
     if (map) {
-      LocalSectionIdMap::iterator it(map->find(lcl_sec_id));
-
-      if (it != map->end()) sectionInfo = it->second;
+      if (lcl_sec_id < map->size()) sectionInfo = (*map)[lcl_sec_id];
     } else {
       LOG_ER("can't find sec map in cpnd_get_sect_with_id");
       osafassert(false);
@@ -399,3 +580,22 @@ CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get_next(
 
   return sectionInfo;
 }
+
+CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get_after(
+    const CPND_CKPT_REPLICA_INFO *replicaInfo,
+    const SaCkptSectionIdT *sectionId) {
+  CPND_CKPT_SECTION_INFO *sectionInfo(0);
+
+  SectionMap *map(static_cast<SectionMap *>(replicaInfo->section_db));
+
+  if (map) {
+    // the section itself need not exist anymore
+    SectionMap::iterator it(map->upper_bound(sectionId));
+
+    if (it != map->end()) sectionInfo = it->second;
+  } else {
+    LOG_ER("can't find sec map in cpnd_ckpt_sec_get_after");
+  }
+
+  return sectionInfo;
+}
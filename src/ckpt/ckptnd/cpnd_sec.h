@@ -25,11 +25,18 @@ void cpnd_ckpt_sec_map_init(CPND_CKPT_REPLICA_INFO *);
 
 void cpnd_ckpt_sec_map_destroy(CPND_CKPT_REPLICA_INFO *);
 
+CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_alloc(CPND_CKPT_REPLICA_INFO *);
+
+void cpnd_ckpt_sec_free(CPND_CKPT_REPLICA_INFO *, CPND_CKPT_SECTION_INFO *);
+
 CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get_first(const CPND_CKPT_REPLICA_INFO *);
 
 CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get_next(const CPND_CKPT_REPLICA_INFO *,
                                                const CPND_CKPT_SECTION_INFO *);
 
+CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get_after(const CPND_CKPT_REPLICA_INFO *,
+                                                const SaCkptSectionIdT *);
+
 CPND_CKPT_SECTION_INFO *cpnd_ckpt_sec_get(const CPND_CKPT_NODE *,
                                           const SaCkptSectionIdT *);
 
@@ -88,6 +88,7 @@ void cpnd_timer_expiry(NCSCONTEXT uarg)
 		evt->info.cpnd.info.tmr_info.type = CPND_ALL_REPL_RSP_EXPI;
 		evt->info.cpnd.info.tmr_info.ckpt_id = tmr->ckpt_id;
 		evt->info.cpnd.info.tmr_info.lcl_ckpt_hdl = tmr->lcl_ckpt_hdl;
+		evt->info.cpnd.info.tmr_info.write_seqno = tmr->write_seqno;
 		evt->info.cpnd.info.tmr_info.agent_dest = tmr->agent_dest;
 		evt->info.cpnd.info.tmr_info.write_type = tmr->write_type;
 		break;
@@ -98,6 +99,10 @@ void cpnd_timer_expiry(NCSCONTEXT uarg)
 		evt->info.cpnd.info.tmr_info.sinfo = tmr->sinfo;
 		evt->info.cpnd.info.tmr_info.lcl_ckpt_hdl = tmr->lcl_ckpt_hdl;
 		break;
+	case CPND_TMR_TYPE_RMT_WRITE:
+		evt->info.cpnd.info.tmr_info.type = CPND_TMR_TYPE_RMT_WRITE;
+		evt->info.cpnd.info.tmr_info.ckpt_id = tmr->ckpt_id;
+		break;
 	default:
 		TRACE_4(" Invalid    tmr->type %d", tmr->type);
 		m_MMGR_FREE_CPSV_EVT(evt, NCS_SERVICE_ID_CPND);
@@ -684,6 +684,8 @@ FUNC_DECLARATION(DS)
 
 FUNC_DECLARATION(DS)
 {
+	uint16_t ver_compare = 0;
+	ver_compare = 5; /* CPA_MDS_PVT_SUBPART_VERSION */
 	NCS_ENC_DEC_DECLARATION(DS);
 	NCS_ENC_DEC_ARRAY(DS){
 
@@ -699,6 +701,15 @@ FUNC_DECLARATION(DS)
 	     (long)&((DS *)0)->sect_desc, 0, NULL},
 	    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0, (long)&((DS *)0)->n_secs_trav, 0,
 	     NULL},
+	    {EDU_VER_GE, NULL, 0, 0, 2, 0, 0,
+	     (EDU_EXEC_RTINE)((uint16_t *)(&(ver_compare)))},
+	    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0, (long)&((DS *)0)->num_descs, 0,
+	     NULL},
+	    {EDU_EXEC, FUNC_NAME(SaCkptSectionDescriptorT), EDQ_VAR_LEN_DATA,
+	     ncs_edp_uns32, 0, (long)&((DS *)0)->descs,
+	     (long)&((DS *)0)->num_descs, NULL},
+	    {EDU_EXEC_EXT, NULL, NCS_SERVICE_ID_CPA /* Svc-ID */, NULL, 0,
+	     0 /* Sub-ID */, 0, NULL},
 	    {EDU_END, 0, 0, 0, 0, 0, 0, NULL},
 	};
 	NCS_ENC_DEC_REM_FLOW(DS)
@@ -1116,6 +1127,8 @@ FUNC_DECLARATION(DS)
 #define DS CPSV_A2ND_SECT_ITER_GETNEXT
 FUNC_DECLARATION(DS)
 {
+	uint16_t ver_compare = 0;
+	ver_compare = 5; /* CPA_MDS_PVT_SUBPART_VERSION */
 	NCS_ENC_DEC_DECLARATION(DS);
 	NCS_ENC_DEC_ARRAY(DS){
 
@@ -1133,6 +1146,10 @@ FUNC_DECLARATION(DS)
 	     NULL},
 	    {EDU_EXEC, ncs_edp_uns64, 0, 0, 0, (long)&((DS *)0)->exp_tmr, 0,
 	     NULL},
+	    {EDU_VER_GE, NULL, 0, 0, 2, 0, 0,
+	     (EDU_EXEC_RTINE)((uint16_t *)(&(ver_compare)))},
+	    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0, (long)&((DS *)0)->batch_size, 0,
+	     NULL},
 	    {EDU_END, 0, 0, 0, 0, 0, 0, NULL},
 	};
 	NCS_ENC_DEC_REM_FLOW(DS)
@@ -1254,6 +1271,8 @@ FUNC_DECLARATION(DS)
 #define DS CPSV_A2ND_CKPT_SYNC
 FUNC_DECLARATION(DS)
 {
+	uint16_t ver_compare = 0;
+	ver_compare = 6; /* CPND_MDS_PVT_SUBPART_VERSION */
 	NCS_ENC_DEC_DECLARATION(DS);
 	NCS_ENC_DEC_ARRAY(DS){
 
@@ -1280,6 +1299,10 @@ FUNC_DECLARATION(DS)
 	    {EDU_EXEC, ncs_edp_uns8, EDQ_ARRAY, 0, 0,
 	     (long)&((DS *)0)->cpa_sinfo.ctxt.data, MDS_SYNC_SND_CTXT_LEN_MAX,
 	     NULL},
+	    {EDU_VER_GE, NULL, 0, 0, 2, 0, 0,
+	     (EDU_EXEC_RTINE)((uint16_t *)(&(ver_compare)))},
+	    {EDU_EXEC, ncs_edp_ncs_bool, 0, 0, 0,
+	     (long)&((DS *)0)->stream_sync, 0, NULL},
 	    {EDU_END, 0, 0, 0, 0, 0, 0, NULL},
 	};
 	NCS_ENC_DEC_REM_FLOW(DS)
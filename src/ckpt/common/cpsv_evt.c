@@ -799,6 +799,12 @@ char *cpsv_evt_str(CPSV_EVT *evt, char *o_evt_str, size_t len)
 			    "CPND_EVT_D2ND_CKPT_INFO_UPDATE_ACK(err=%u)",
 			    evt->info.cpnd.info.ckpt_info_update_ack.error);
 			break;
+		case CPND_EVT_ND2ND_CKPT_SYNC_ACK:
+			snprintf(o_evt_str, len,
+				 "[%llu] CPND_EVT_ND2ND_CKPT_SYNC_ACK(seqno=%u)",
+				 evt->info.cpnd.info.sync_ack.ckpt_id,
+				 evt->info.cpnd.info.sync_ack.seqno);
+			break;
 		default:
 			snprintf(o_evt_str, len, "INVALID_CPND_TYPE(type = %d)",
 				 evt->info.cpnd.type);
@@ -1749,8 +1755,13 @@ uint32_t cpsv_evt_enc_flat(EDU_HDL *edu_hdl, CPSV_EVT *i_evt, NCS_UBAID *o_ub)
 			    o_ub, i_evt->info.cpnd.info.ckpt_nd2nd_sync.data);
 		} else if (i_evt->info.cpnd.type ==
 			   CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_REQ) {
-			cpsv_ckpt_data_encode(
-			    o_ub, i_evt->info.cpnd.info.ckpt_nd2nd_data.data);
+			CPSV_CKPT_ACCESS *data_req =
+			    &i_evt->info.cpnd.info.ckpt_nd2nd_data;
+			cpsv_ckpt_data_encode(o_ub, data_req->data);
+			if (data_req->num_dest_nodes != 0)
+				ncs_encode_n_octets_in_uba(
+				    o_ub, (uint8_t *)data_req->dest_nodes,
+				    data_req->num_dest_nodes * sizeof(NODE_ID));
 		} else if (i_evt->info.cpnd.type ==
 			   CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_RSP) {
 			CPSV_ND2A_DATA_ACCESS_RSP *data_rsp =
@@ -2416,11 +2427,27 @@ uint32_t cpsv_evt_dec_flat(EDU_HDL *edu_hdl, NCS_UBAID *i_ub, CPSV_EVT *o_evt)
 			    &o_evt->info.cpnd.info.ckpt_nd2nd_sync.data, i_ub);
 			break;
 
-		case CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_REQ:
-
-			cpsv_ckpt_data_decode(
-			    &o_evt->info.cpnd.info.ckpt_nd2nd_data.data, i_ub);
+		case CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_REQ: {
+			CPSV_CKPT_ACCESS *data_req =
+			    &o_evt->info.cpnd.info.ckpt_nd2nd_data;
+
+			cpsv_ckpt_data_decode(&data_req->data, i_ub);
+			data_req->dest_nodes = NULL;
+			if (data_req->num_dest_nodes != 0) {
+				size = data_req->num_dest_nodes *
+				       sizeof(NODE_ID);
+				data_req->dest_nodes =
+				    m_MMGR_ALLOC_CPSV_SYS_MEMORY(size);
+				if (data_req->dest_nodes == NULL) {
+					data_req->num_dest_nodes = 0;
+					return NCSCC_RC_OUT_OF_MEM;
+				}
+				ncs_decode_n_octets_from_uba(
+				    i_ub, (uint8_t *)data_req->dest_nodes,
+				    size);
+			}
 			break;
+		}
 
 		case CPSV_EVT_ND2ND_CKPT_SECT_ACTIVE_DATA_ACCESS_RSP: {
 			CPSV_ND2A_DATA_ACCESS_RSP *data_rsp =
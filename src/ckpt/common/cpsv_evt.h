@@ -191,6 +191,7 @@ typedef enum cpnd_evt_type {
   CPND_EVT_A2ND_CKPT_LIST_UPDATE, /* Checkpoint ckpt list update Call */
   CPND_EVT_A2ND_ARRIVAL_CB_UNREG, /* Checkpoint Arrival Callback Un-Register*/
   CPND_EVT_D2ND_CKPT_INFO_UPDATE_ACK, /* Checkpoint information update ack */
+  CPND_EVT_ND2ND_CKPT_SYNC_ACK,       /* Ack of a streamed sync chunk */
   CPND_EVT_MAX
 
 } CPND_EVT_TYPE;
@@ -251,6 +252,7 @@ typedef struct cpsv_mds_info {
   MDS_SVC_ID svc_id;
   NODE_ID node_id;
   V_DEST_RL role;
+  MDS_SVC_PVT_SUB_PART_VER rem_svc_pvt_ver;
 } CPSV_MDS_INFO;
 
 /* Struct used for convaying MDS dest info of a ckpt */
@@ -272,7 +274,8 @@ typedef enum cpndq_tmr_type {
   CPND_ALL_REPL_RSP_EXPI,
   CPND_TMR_OPEN_ACTIVE_SYNC,
   CPND_TMR_TYPE_NON_COLLOC_RETENTION,
-  CPND_TMR_TYPE_MAX = CPND_TMR_TYPE_NON_COLLOC_RETENTION,
+  CPND_TMR_TYPE_RMT_WRITE,
+  CPND_TMR_TYPE_MAX = CPND_TMR_TYPE_RMT_WRITE,
 } CPND_TMR_TYPE;
 typedef struct cpnd_tmr {
   CPND_TMR_TYPE type;
@@ -287,6 +290,7 @@ typedef struct cpnd_tmr {
   SaInvocationT invocation;
   SaCkptCheckpointHandleT lcl_ckpt_hdl;
   bool is_active_sync_err;
+  SaUint32T write_seqno;
 } CPND_TMR;
 /* Struct used for convaying MDS active dest and other dest list info of a ckpt
    This is used in CPND_EVT_D2ND_CKPT_REP_ADD & CPSV_D2ND_RESTART_DONE */
@@ -401,8 +405,12 @@ typedef struct cpsv_a2nd_sect_iter_getnext {
   SaCkptSectionsChosenT filter;
   uint32_t n_secs_trav;
   SaTimeT exp_tmr;
+  uint32_t batch_size; /* Max number of sections to return */
 } CPSV_A2ND_SECT_ITER_GETNEXT;
 
+/* Max number of sections returned by one section iteration request */
+#define CPSV_SECT_ITER_BATCH_MAX 1024
+
 typedef struct cpsv_a2nd_arrival_reg {
   SaCkptCheckpointHandleT client_hdl;
 } CPSV_A2ND_ARRIVAL_REG;
@@ -418,6 +426,7 @@ typedef struct cpsv_a2nd_sync_ckpt {
   SaInvocationT invocation;
   CPSV_SEND_INFO cpa_sinfo;
   bool is_ckpt_open;
+  bool stream_sync; /* Replica is synced in acknowledged chunks */
 } CPSV_A2ND_CKPT_SYNC;
 
 typedef struct cpsv_ckpt_data {
@@ -456,7 +465,9 @@ typedef struct cpsv_ckpt_access {
   SaUint32T seqno;   /* sequence number of the imessage */
   SaUint8T last_seq; /* Last sequence true/false */
   CPSV_A2ND_CKPT_SYNC ckpt_sync;
-
+  /* Nodes of the replicas a multicast all replica write is meant for */
+  SaUint32T num_dest_nodes;
+  NODE_ID *dest_nodes;
 } CPSV_CKPT_ACCESS;
 
 /****************************************************************************
@@ -498,7 +509,9 @@ typedef struct cpsv_nd2a_sect_iter_getnext_rsp {
   SaAisErrorT error;
   SaCkptSectionDescriptorT sect_desc; /* Section Description */
   uint32_t n_secs_trav;
-
+  /* The sections following sect_desc, if a batch was asked for */
+  uint32_t num_descs;
+  SaCkptSectionDescriptorT *descs;
 } CPSV_ND2A_SECT_ITER_GETNEXT_RSP;
 
 typedef struct cpsv_nd2a_arrival_msg {
@@ -545,6 +558,7 @@ typedef struct cpsv_nd2a_read_rsp {
 
   } info;
   SaCkptCheckpointHandleT lcl_ckpt_id;
+  SaUint32T seqno; /* sequence number of the all replica write */
 } CPSV_ND2A_DATA_ACCESS_RSP;
 
 typedef struct cpsv_ckpt_status {
@@ -634,6 +648,12 @@ typedef struct cpsv_ckpt_id_info {
   SaCkptCheckpointHandleT ckpt_id;
 } CPSV_CKPT_ID_INFO;
 
+/* Ack of the chunks of a streamed sync up to and including seqno */
+typedef struct cpsv_nd2nd_sync_ack {
+  SaCkptCheckpointHandleT ckpt_id;
+  SaUint32T seqno;
+} CPSV_ND2ND_SYNC_ACK;
+
 typedef struct cpsv_nd2d_ckpt_unlink {
   SaNameT ckpt_name;
   /* Deleted    SaCkptCheckpointHandleT   ckpt_id;   */
@@ -724,6 +744,7 @@ typedef struct cpnd_tmr_info {
   SaInvocationT invocation;
   SaCkptCheckpointHandleT lcl_ckpt_hdl;
   CPND_TMR *cpnd_tmr;
+  SaUint32T write_seqno;
 } CPND_TMR_INFO;
 
 /******************************************************************************
@@ -804,6 +825,7 @@ typedef struct cpnd_evt {
     CPSV_A2ND_CKPT_SYNC sync_req;
     CPSV_CKPT_ACCESS ckpt_nd2nd_sync;
     CPSV_SAERR_INFO active_sync_rsp;
+    CPSV_ND2ND_SYNC_ACK sync_ack;
 
     CPSV_CKPT_ACCESS ckpt_nd2nd_data;
     CPSV_ND2A_DATA_ACCESS_RSP ckpt_nd2nd_data_rsp;
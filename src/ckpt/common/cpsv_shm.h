@@ -22,6 +22,9 @@
 
 #define MAX_CLIENTS 1000
 #define MAX_CKPTS 2000
+/* The client and checkpoint infos beyond MAX_CLIENTS and MAX_CKPTS are kept
+   in overflow segments of the same size, up to this number of segments */
+#define MAX_SHM_SEGMENTS 64
 #define MAX_SIZE 30
 #define CPND_ERR -2
 #define SHM_NEXT -3
@@ -97,9 +97,17 @@ extern uint32_t clms_mds_msg_send(CLMS_CB *cb, CLMSV_MSG *msg, MDS_DEST *dest,
                                   NCSMDS_SVC_ID svc_id);
 
 extern uint32_t clms_mds_msg_bcast(CLMS_CB *cb, CLMSV_MSG *bcast_msg);
+extern void clms_mds_ntf_buf_encode(
+    const SaClmClusterNotificationBufferT_4 *buf);
+extern void clms_mds_ntf_buf_release();
 extern SaAisErrorT clms_imm_activate(CLMS_CB *cb);
 extern uint32_t clms_node_trackresplist_empty(CLMS_CLUSTER_NODE *op_node);
 extern uint32_t clms_send_cbk_start_sub(CLMS_CB *cb, CLMS_CLUSTER_NODE *node);
+extern void clms_view_change_add(CLMS_CLUSTER_NODE *node,
+                                 SaClmClusterChangesT change);
+extern bool clms_view_change_pending(const CLMS_CLUSTER_NODE *node);
+extern int clms_view_change_timeout();
+extern void clms_view_change_flush();
 extern void clms_clear_node_dep_list(CLMS_CLUSTER_NODE *node, bool checkpoint);
 extern uint32_t clms_client_del_trackresp(SaUint32T client_id);
 extern CLMS_CLUSTER_NODE *clms_node_get_by_name(const SaNameT *name);
@@ -22,7 +22,9 @@
 #include "osaf/config.h"
 #endif
 #include <pthread.h>
+#include <time.h>
 #include <set>
+#include <vector>
 #include <saImm.h>
 #include <saImmOi.h>
 #include <saPlm.h>
@@ -47,6 +49,11 @@
 /* Full path to the scale-out script. */
 #define SCALE_OUT_SCRIPT PKGLIBDIR "/opensaf_scale_out"
 
+/* Default time in milliseconds during which node joins and leaves are
+   collected and reported to the trackers in one cluster membership view.
+   Overridden by the CLMSV_VIEW_CHANGE_WINDOW environment variable. */
+#define CLMS_VIEW_CHANGE_WINDOW 20
+
 typedef enum clms_tmr_type_t {
   CLMS_TMR_BASE,
   CLMS_CLIENT_RESP_TMR = CLMS_TMR_BASE,
@@ -241,6 +248,14 @@ typedef struct clms_cb_t {
   NODE_DOWN_LIST *node_down_list_tail;
   // Record node id when receive MDS node down
   std::set<SaUint32T> mds_node_down_list;
+  // Nodes that joined or left the cluster and are not yet reported to the
+  // trackers. They are reported together, in one view, when the aggregation
+  // window ends at view_change_deadline.
+  std::vector<CLMS_CLUSTER_NODE *> view_changes;
+  struct timespec view_change_deadline;
+  // Length of the aggregation window in milliseconds, 0 reports every
+  // membership change in a view of its own
+  uint32_t view_change_window;
   bool is_impl_set;
   bool nid_started;         /**< true if started by NID */
   NCS_PATRICIA_TREE iplist; /* To temporarily store ipaddress information
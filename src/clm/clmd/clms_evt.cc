@@ -659,6 +659,9 @@ uint32_t proc_node_up_msg(CLMS_CB *cb, CLMSV_CLMS_EVT *evt) {
     goto done;
   }
 
+  /* Report a pending leave of the node before it joins again */
+  if (clms_view_change_pending(node)) clms_view_change_flush();
+
   /* This has to be updated always */
   node->nodeup = SA_TRUE;
   check_member = node->member;
@@ -703,23 +706,9 @@ uint32_t proc_node_up_msg(CLMS_CB *cb, CLMSV_CLMS_EVT *evt) {
       if (check_member == SA_FALSE) {
         ++(osaf_cluster->num_nodes);
       }
-      node->stat_change = SA_TRUE;
-      node->init_view = ++(clms_cb->cluster_view_num);
-      TRACE("node->init_view %llu", node->init_view);
-      node->change = SA_CLM_NODE_JOINED;
-      clms_send_track(clms_cb, node, SA_CLM_CHANGE_COMPLETED, false, 0);
-      /* Clear node->stat_change after sending the callback to
-       * its clients */
-      node->stat_change = SA_FALSE;
-
-      /* Send Node join notification */
-      clms_node_join_ntf(clms_cb, node);
-      clms_node_update_rattr(node);
-      clms_cluster_update_rattr(osaf_cluster);
-      node->change = SA_CLM_NODE_NO_CHANGE;
-      /* Update Standby */
-      ckpt_node_rec(node);
-      ckpt_cluster_rec();
+      /* The track callbacks, the join notification and the updates of
+       * IMM and the standby are sent when the view is reported */
+      clms_view_change_add(node, SA_CLM_NODE_JOINED);
     }
   }
 
@@ -766,6 +755,9 @@ done:
 }
 
 void clms_track_send_node_down(CLMS_CLUSTER_NODE *node) {
+  /* Report a pending join of the node before it leaves */
+  if (clms_view_change_pending(node)) clms_view_change_flush();
+
   node->nodeup = SA_FALSE;
   TRACE_ENTER2("MDS Down nodeup info %d", node->nodeup);
 
@@ -791,25 +783,18 @@ void clms_track_send_node_down(CLMS_CLUSTER_NODE *node) {
   /*Irrespective of plm in system or not,toggle the membership status for
    * MDS NODE DOWN*/
   node->member = SA_FALSE;
-  node->stat_change = SA_TRUE;
-  node->change = SA_CLM_NODE_LEFT;
-  ++(clms_cb->cluster_view_num);
-  clms_send_track(clms_cb, node, SA_CLM_CHANGE_COMPLETED, true, 0);
-  /* Clear node->stat_change after sending the callback to its clients */
-  node->stat_change = SA_FALSE;
-
-  clms_node_exit_ntf(clms_cb, node);
-  /*Update IMMSV */
-  clms_node_update_rattr(node);
-  clms_cluster_update_rattr(osaf_cluster);
 
-  if (clms_cb->ha_state == SA_AMF_HA_ACTIVE) {
-    ckpt_node_rec(node);
-    ckpt_node_down_rec(node);
-    ckpt_cluster_rec();
+  /* Delete the node reference from the nodeid database before the change
+   * is reported, the track callbacks, the exit notification and the updates
+   * of IMM and the standby are sent when the view is reported */
+  if (clms_node_delete(node, 0) != NCSCC_RC_SUCCESS) {
+    LOG_ER("CLMS node delete by nodeid failed");
   }
+  clms_view_change_add(node, SA_CLM_NODE_LEFT);
 
-/*For the NODE DOWN, boottimestamp will not be updated */
+  /*For the NODE DOWN, boottimestamp will not be updated */
+  TRACE_LEAVE();
+  return;
 
 /* Delete the node reference from the nodeid database */
 done:
@@ -1707,6 +1692,25 @@ static uint32_t process_api_evt(CLMSV_CLMS_EVT *evt) {
   return NCSCC_RC_SUCCESS;
 }
 
+/**
+ * Check if an event may change the cluster membership and add to the
+ * membership changes waiting to be reported
+ * @param  evt  - Message that was posted to the CLMS Mail box.
+ * @return true for a node join request or a node down
+ */
+static bool clms_is_view_change_evt(const CLMSV_CLMS_EVT *evt) {
+  switch (evt->type) {
+    case CLMSV_CLMS_CLMSV_MSG:
+      return evt->info.msg.evt_type == CLMSV_CLMA_TO_CLMS_API_MSG &&
+             evt->info.msg.info.api_info.type == CLMSV_CLUSTER_JOIN_REQ;
+    case CLMSV_CLMS_MDS_NODE_EVT:
+    case CLMSV_AVND_DOWN_EVT:
+      return true;
+    default:
+      return false;
+  }
+}
+
 /**
  *
  * This is the function which process the IPC mail box of CLMS
@@ -1728,6 +1732,10 @@ void clms_process_mbx(SYSF_MBX *mbx) {
     goto done;
   }
 
+  /* Node joins and leaves are collected into one view, the other events
+   * see the membership changes reported */
+  if (!clms_is_view_change_evt(msg)) clms_view_change_flush();
+
   switch (msg->type) {
     case CLMSV_CLMS_CLMSV_MSG:
     case CLMSV_CLMS_CLMA_UP:
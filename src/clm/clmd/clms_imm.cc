@@ -1234,8 +1234,8 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
                      const SaNameT *rootCauseEntity) {
   CLMS_CLIENT_INFO *rec;
   uint32_t client_id = 0;
-  SaClmClusterNotificationT_4 *notify_changes = nullptr;
-  SaClmClusterNotificationT_4 *notify_changes_only = nullptr;
+  SaClmClusterNotificationBufferT_4 notify_changes;
+  SaClmClusterNotificationBufferT_4 notify_changes_only;
   uint32_t rc = NCSCC_RC_SUCCESS;
   SaUint32T node_id;
 
@@ -1252,8 +1252,10 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
   if (ncs_patricia_tree_size(&node->trackresp) != 0)
     clms_node_trackresplist_empty(node);
 
-  notify_changes_only = clms_notbuffer_changes_only(step);
-  notify_changes = clms_notbuffer_changes(step);
+  clms_notbuffer_get(step, true, &notify_changes_only);
+  clms_notbuffer_get(step, false, &notify_changes);
+  clms_mds_ntf_buf_encode(&notify_changes_only);
+  clms_mds_ntf_buf_encode(&notify_changes);
 
   while ((rec = clms_client_getnext_by_id(client_id)) != nullptr) {
     client_id = rec->client_id;
@@ -1275,7 +1277,7 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
 
           } else
             rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_START,
-                                          notify_changes_only,
+                                          &notify_changes_only,
                                           rootCauseEntity);
 
         } else if (rec->track_flags & SA_TRACK_CHANGES) {
@@ -1289,7 +1291,7 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
 
           } else
             rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_START,
-                                          notify_changes, rootCauseEntity);
+                                          &notify_changes, rootCauseEntity);
         }
 
         if (rc != NCSCC_RC_SUCCESS) {
@@ -1319,7 +1321,8 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
 
           } else
             rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_VALIDATE,
-                                          notify_changes_only, rootCauseEntity);
+                                          &notify_changes_only,
+                                          rootCauseEntity);
 
         } else if (rec->track_flags & SA_TRACK_CHANGES) {
           if (rec->track_flags & SA_TRACK_LOCAL) {
@@ -1332,7 +1335,7 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
 
           } else
             rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_VALIDATE,
-                                          notify_changes, rootCauseEntity);
+                                          &notify_changes, rootCauseEntity);
         }
 
         if (rc != NCSCC_RC_SUCCESS) {
@@ -1369,7 +1372,7 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
                 node_id);
           } else {
             rc = clms_prep_and_send_track(
-                cb, node, rec, SA_CLM_CHANGE_COMPLETED, notify_changes_only,
+                cb, node, rec, SA_CLM_CHANGE_COMPLETED, &notify_changes_only,
                 rootCauseEntity);
           }
         }
@@ -1393,7 +1396,7 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
                 node_id);
           } else {
             rc = clms_prep_and_send_track(
-                cb, node, rec, SA_CLM_CHANGE_COMPLETED, notify_changes,
+                cb, node, rec, SA_CLM_CHANGE_COMPLETED, &notify_changes,
                 rootCauseEntity);
           }
         }
@@ -1412,10 +1415,10 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
 
         if (rec->track_flags & SA_TRACK_CHANGES_ONLY)
           rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_ABORTED,
-                                        notify_changes_only, rootCauseEntity);
+                                        &notify_changes_only, rootCauseEntity);
         else if (rec->track_flags & SA_TRACK_CHANGES)
           rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_ABORTED,
-                                        notify_changes, rootCauseEntity);
+                                        &notify_changes, rootCauseEntity);
 
         if (rc != NCSCC_RC_SUCCESS) {
           TRACE("Sending track callback failed for SA_CLM_CHANGE_ABORTED");
@@ -1427,10 +1430,10 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
 
         if (rec->track_flags & SA_TRACK_CHANGES_ONLY)
           rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_ABORTED,
-                                        notify_changes_only, rootCauseEntity);
+                                        &notify_changes_only, rootCauseEntity);
         else if (rec->track_flags & SA_TRACK_CHANGES)
           rc = clms_prep_and_send_track(cb, node, rec, SA_CLM_CHANGE_ABORTED,
-                                        notify_changes, rootCauseEntity);
+                                        &notify_changes, rootCauseEntity);
 
         if (rc != NCSCC_RC_SUCCESS) {
           TRACE("Sending track callback failed for SA_CLM_CHANGE_ABORTED");
@@ -1438,8 +1441,9 @@ void clms_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
       }
     }
   }
-  free(notify_changes_only);
-  free(notify_changes);
+  clms_mds_ntf_buf_release();
+  free(notify_changes_only.notification);
+  free(notify_changes.notification);
   TRACE_LEAVE();
 }
 
@@ -1588,12 +1592,12 @@ uint32_t clms_send_track_local(CLMS_CLUSTER_NODE *node,
  * @param[in] node
  * @param[in] client
  * @param[in] step
- * @param[in] notification buffer
+ * @param[in] notification buffer, filled once for all clients
  */
 uint32_t clms_prep_and_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
                                   CLMS_CLIENT_INFO *client,
                                   SaClmChangeStepT step,
-                                  SaClmClusterNotificationT_4 *notify,
+                                  const SaClmClusterNotificationBufferT_4 *buf,
                                   const SaNameT *rootCauseEntity) {
   CLMSV_MSG msg;
   uint32_t rc = NCSCC_RC_SUCCESS;
@@ -1640,34 +1644,9 @@ uint32_t clms_prep_and_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
   else
     msg.info.cbk_info.param.track.time_super = (SaTimeT)SA_TIME_UNKNOWN;
 
-  msg.info.cbk_info.param.track.buf_info.viewNumber = clms_cb->cluster_view_num;
-
-  if (client->track_flags & SA_TRACK_CHANGES_ONLY)
-    msg.info.cbk_info.param.track.buf_info.numberOfItems =
-        clms_nodedb_lookup(0);
-  else if (client->track_flags & SA_TRACK_CHANGES)
-    msg.info.cbk_info.param.track.buf_info.numberOfItems =
-        clms_nodedb_lookup(1);
-
-  msg.info.cbk_info.param.track.buf_info.notification =
-      (SaClmClusterNotificationT_4 *)malloc(
-          msg.info.cbk_info.param.track.buf_info.numberOfItems *
-          sizeof(SaClmClusterNotificationT_4));
-
-  if (!msg.info.cbk_info.param.track.buf_info.notification) {
-    LOG_ER("Malloc failed for notification");
-    osafassert(0);
-  }
-
-  memset(msg.info.cbk_info.param.track.buf_info.notification, 0,
-         (msg.info.cbk_info.param.track.buf_info.numberOfItems *
-          sizeof(SaClmClusterNotificationT_4)));
-
-  if (notify != nullptr) {
-    memcpy(msg.info.cbk_info.param.track.buf_info.notification, notify,
-           (msg.info.cbk_info.param.track.buf_info.numberOfItems *
-            sizeof(SaClmClusterNotificationT_4)));
-  }
+  /* The buffer is shared by all clients and is not copied, it is encoded
+   * once if clms_mds_ntf_buf_encode() was called for it */
+  msg.info.cbk_info.param.track.buf_info = *buf;
 
   rc = clms_mds_msg_send(cb, &msg, &client->mds_dest, nullptr,
                          MDS_SEND_PRIORITY_MEDIUM, NCSMDS_SVC_ID_CLMA);
@@ -1676,8 +1655,6 @@ uint32_t clms_prep_and_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
     TRACE("callback msg send to clma  failed");
   }
 
-  if (msg.info.cbk_info.param.track.buf_info.notification)
-    free(msg.info.cbk_info.param.track.buf_info.notification);
   free(msg.info.cbk_info.param.track.root_cause_ent);
   free(msg.info.cbk_info.param.track.cor_ids);
 
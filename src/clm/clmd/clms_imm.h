@@ -39,6 +39,8 @@ extern SaClmClusterNotificationT_4 *clms_notbuffer_changes_only(
     SaClmChangeStepT step);
 extern SaClmClusterNotificationT_4 *clms_notbuffer_changes(
     SaClmChangeStepT step);
+extern void clms_notbuffer_get(SaClmChangeStepT step, bool changes_only,
+                               SaClmClusterNotificationBufferT_4 *buf);
 extern uint32_t clms_node_delete(CLMS_CLUSTER_NODE *nd, int i);
 extern uint32_t clms_nodedb_lookup(int i);
 extern uint32_t clms_num_mem_node();
@@ -46,11 +48,10 @@ extern SaAisErrorT clms_node_ccb_comp_modify(CcbUtilOperationData_t *opdata);
 extern void clms_lock_timer_exp(int signo, siginfo_t *info, void *context);
 extern SaAisErrorT clms_node_ccb_apply_cb(CcbUtilOperationData_t *opdata);
 extern CLMS_CLUSTER_NODE *clms_node_get_by_eename(SaNameT *name);
-extern uint32_t clms_prep_and_send_track(CLMS_CB *cb, CLMS_CLUSTER_NODE *node,
-                                         CLMS_CLIENT_INFO *client,
-                                         SaClmChangeStepT step,
-                                         SaClmClusterNotificationT_4 *notify,
-                                         const SaNameT *rootCauseEntity);
+extern uint32_t clms_prep_and_send_track(
+    CLMS_CB *cb, CLMS_CLUSTER_NODE *node, CLMS_CLIENT_INFO *client,
+    SaClmChangeStepT step, const SaClmClusterNotificationBufferT_4 *buf,
+    const SaNameT *rootCauseEntity);
 extern uint32_t clms_send_track_local(CLMS_CLUSTER_NODE *node,
                                       CLMS_CLIENT_INFO *client,
                                       SaClmChangeStepT step,
@@ -263,6 +263,14 @@ uint32_t clms_cb_init(CLMS_CB *clms_cb) {
     LOG_IN("Scale out not enabled");
   }
 
+  clms_cb->view_change_window = CLMS_VIEW_CHANGE_WINDOW;
+  char *view_change_window = getenv("CLMSV_VIEW_CHANGE_WINDOW");
+  if (view_change_window != nullptr) {
+    clms_cb->view_change_window = strtoul(view_change_window, nullptr, 0);
+  }
+  LOG_IN("Membership change aggregation window %u ms",
+         clms_cb->view_change_window);
+
   /* Assign Version. Currently, hardcoded, This will change later */
   clms_cb->clm_ver.releaseCode = CLM_RELEASE_CODE;
   clms_cb->clm_ver.majorVersion = CLM_MAJOR_VERSION_4;
@@ -493,6 +501,11 @@ int main(int argc, char *argv[]) {
       timeout = -1;
     }
 
+    /* Wake up when the membership changes are to be reported */
+    int view_timeout = clms_view_change_timeout();
+    if (view_timeout != -1 && (timeout == -1 || view_timeout < timeout))
+      timeout = view_timeout;
+
     if ((clms_cb->immOiHandle != 0) && (clms_cb->is_impl_set == true)) {
       fds[FD_IMM].fd = clms_cb->imm_sel_obj;
       fds[FD_IMM].events = POLLIN;
@@ -510,12 +523,25 @@ int main(int argc, char *argv[]) {
     }
 
     if (ret == 0) {
+      if (clms_view_change_timeout() == 0) clms_view_change_flush();
       /* Process any/all pending RTAttribute updates to IMM */
-      TRACE("poll time out processing pending updates");
-      clms_retry_pending_rtupdates();
+      if (clms_cb->rtu_pending == true) {
+        TRACE("poll time out processing pending updates");
+        clms_retry_pending_rtupdates();
+      }
       continue;
     }
 
+    /* Report the membership changes before other services are dispatched,
+     * the mailbox events are checked in clms_process_mbx() */
+    if ((fds[FD_AMF].revents | fds[FD_MBCSV].revents) & POLLIN)
+      clms_view_change_flush();
+#ifdef ENABLE_AIS_PLM
+    if (fds[FD_PLM].revents & POLLIN) clms_view_change_flush();
+#endif
+    if (nfds == NUM_FD && (fds[FD_IMM].revents & POLLIN))
+      clms_view_change_flush();
+
     if (fds[FD_TERM].revents & POLLIN) {
       daemon_exit();
     }
@@ -602,6 +628,9 @@ int main(int argc, char *argv[]) {
         }
       }
     }
+    /* Report the membership changes of an ended aggregation window also
+     * when events keep arriving */
+    if (clms_view_change_timeout() == 0) clms_view_change_flush();
     /* Retry any pending updates */
     if (clms_cb->rtu_pending == true) clms_retry_pending_rtupdates();
   } /* End while (1) */
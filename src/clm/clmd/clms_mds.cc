@@ -18,8 +18,10 @@
 
 #include <cinttypes>
 #include <cstring>
+#include <vector>
 #include "base/logtrace.h"
 #include "base/ncsencdec_pub.h"
+#include "base/ncssysf_mem.h"
 #include "clm/clmd/clms.h"
 #include "clm/common/clmsv_enc_dec.h"
 
@@ -390,6 +392,101 @@ static uint32_t clms_enc_cluster_ntf_buf_msg(
   return total_bytes;
 }
 
+/* A notification buffer of track callbacks, encoded once */
+typedef struct clms_encoded_ntf_buf_t {
+  SaClmClusterNotificationBufferT_4 buf;
+  USRBUF *ub;
+  uint32_t len;
+} CLMS_ENCODED_NTF_BUF;
+
+/* The notification buffers encoded by clms_mds_ntf_buf_encode() */
+static std::vector<CLMS_ENCODED_NTF_BUF> clms_encoded_ntf_bufs;
+
+/****************************************************************************
+  Name          : clms_mds_ntf_buf_encode
+
+  Description   : This routine encodes a notification buffer that is sent
+                  in the track callbacks to several clients. The track
+                  callbacks carrying the same buffer append a reference to
+                  the encoded buffer instead of encoding it again, until
+                  clms_mds_ntf_buf_release() is called.
+
+  Arguments     : SaClmClusterNotificationBufferT_4 *buf
+
+  Return Values : None.
+
+  Notes         : The buffer must not change until it is released.
+******************************************************************************/
+void clms_mds_ntf_buf_encode(const SaClmClusterNotificationBufferT_4 *buf) {
+  CLMS_ENCODED_NTF_BUF encoded;
+  NCS_UBAID uba;
+
+  if (buf->notification == nullptr) return;
+
+  if (ncs_enc_init_space(&uba) != NCSCC_RC_SUCCESS) {
+    TRACE("ncs_enc_init_space failed");
+    return;
+  }
+
+  encoded.buf = *buf;
+  encoded.len = clms_enc_cluster_ntf_buf_msg(
+      &uba, const_cast<SaClmClusterNotificationBufferT_4 *>(buf));
+  encoded.ub = uba.start;
+  if (encoded.len == 0) {
+    m_MMGR_FREE_BUFR_LIST(encoded.ub);
+    return;
+  }
+
+  TRACE("Encoded %u items in %u bytes", buf->numberOfItems, encoded.len);
+  clms_encoded_ntf_bufs.push_back(encoded);
+}
+
+/****************************************************************************
+  Name          : clms_mds_ntf_buf_release
+
+  Description   : This routine frees the encoded notification buffers.
+
+  Arguments     : None.
+
+  Return Values : None.
+
+  Notes         : None.
+******************************************************************************/
+void clms_mds_ntf_buf_release() {
+  for (auto &encoded : clms_encoded_ntf_bufs) {
+    m_MMGR_FREE_BUFR_LIST(encoded.ub);
+  }
+  clms_encoded_ntf_bufs.clear();
+}
+
+/****************************************************************************
+  Name          : clms_enc_encoded_ntf_buf
+
+  Description   : This routine appends a notification buffer, if it is
+                  encoded already, to a message.
+
+  Arguments     : NCS_UBAID *uba,
+                  SaClmClusterNotificationBufferT_4 *buf
+
+  Return Values : Number of bytes appended, 0 if the buffer is not encoded.
+
+  Notes         : The payload of the encoded buffer is shared, not copied.
+******************************************************************************/
+static uint32_t clms_enc_encoded_ntf_buf(
+    NCS_UBAID *uba, const SaClmClusterNotificationBufferT_4 *buf) {
+  for (const auto &encoded : clms_encoded_ntf_bufs) {
+    if (encoded.buf.notification == buf->notification &&
+        encoded.buf.numberOfItems == buf->numberOfItems &&
+        encoded.buf.viewNumber == buf->viewNumber) {
+      USRBUF *ub = m_MMGR_DITTO_BUFR(encoded.ub);
+      if (ub == nullptr) return 0;
+      ncs_enc_append_usrbuf(uba, ub);
+      return encoded.len;
+    }
+  }
+  return 0;
+}
+
 /****************************************************************************
   Name          : clms_enc_track_current_rsp_msg
 
@@ -493,9 +590,13 @@ static uint32_t clms_enc_track_cbk_msg(NCS_UBAID *uba, CLMSV_MSG *msg) {
   uint8_t *p8;
   uint32_t total_bytes = 0;
   CLMSV_TRACK_CBK_INFO *track = &msg->info.cbk_info.param.track;
+  uint32_t ntf_buf_bytes;
   TRACE_ENTER();
 
-  total_bytes += clms_enc_cluster_ntf_buf_msg(uba, &track->buf_info);
+  ntf_buf_bytes = clms_enc_encoded_ntf_buf(uba, &track->buf_info);
+  if (ntf_buf_bytes == 0)
+    ntf_buf_bytes = clms_enc_cluster_ntf_buf_msg(uba, &track->buf_info);
+  total_bytes += ntf_buf_bytes;
 
   p8 = ncs_enc_reserve_space(uba, 4);
   if (!p8) {
@@ -15,6 +15,8 @@
  *
  */
 
+#include <unordered_map>
+#include <vector>
 #include "base/osaf_extended_name.h"
 #include "base/osaf_time.h"
 #include "clm/clmd/clms.h"
@@ -373,6 +375,42 @@ uint32_t clms_nodedb_lookup(int i) {
   return num_nd_changes;
 }
 
+/**
+ * Fill one item of a notification buffer with the node info
+ * @param[out] notify
+ * @param[in] node
+ * @param[in] ClmChangestep
+ */
+static void clms_notbuffer_fill_item(SaClmClusterNotificationT_4 *notify,
+                                     const CLMS_CLUSTER_NODE *node,
+                                     SaClmChangeStepT step) {
+  notify->clusterNode.nodeId = node->node_id;
+  notify->clusterNode.nodeAddress.family = node->node_addr.family;
+  notify->clusterNode.nodeAddress.length = node->node_addr.length;
+  memcpy(notify->clusterNode.nodeAddress.value, node->node_addr.value,
+         notify->clusterNode.nodeAddress.length);
+
+  notify->clusterNode.nodeName.length = node->node_name.length;
+  memcpy(notify->clusterNode.nodeName.value, node->node_name.value,
+         notify->clusterNode.nodeName.length);
+
+  notify->clusterNode.executionEnvironment.length = node->ee_name.length;
+  memcpy(notify->clusterNode.executionEnvironment.value, node->ee_name.value,
+         notify->clusterNode.executionEnvironment.length);
+
+  /* If a node leaves the cluster, member field should be
+   * false */
+  if ((node->change == SA_CLM_NODE_LEFT) && (step == SA_CLM_CHANGE_COMPLETED))
+    notify->clusterNode.member = SA_FALSE;
+  else
+    notify->clusterNode.member = node->member;
+
+  notify->clusterNode.bootTimestamp = node->boot_time;
+  notify->clusterNode.initialViewNumber = node->init_view;
+
+  notify->clusterChange = node->change;
+}
+
 /**
  * Fill the Notification buffer for SA_TRACK_CHANGES_ONLY trackflag
  * @param[in] ClmChangestep
@@ -410,33 +448,7 @@ SaClmClusterNotificationT_4 *clms_notbuffer_changes_only(
   while ((nullptr != (node = clms_node_getnext_by_id(nodeid))) && (i < num)) {
     nodeid = node->node_id;
     if (node->stat_change == SA_TRUE) {
-      notify[i].clusterNode.nodeId = node->node_id;
-      notify[i].clusterNode.nodeAddress.family = node->node_addr.family;
-      notify[i].clusterNode.nodeAddress.length = node->node_addr.length;
-      memcpy(notify[i].clusterNode.nodeAddress.value, node->node_addr.value,
-             notify[i].clusterNode.nodeAddress.length);
-
-      notify[i].clusterNode.nodeName.length = node->node_name.length;
-      memcpy(notify[i].clusterNode.nodeName.value, node->node_name.value,
-             notify[i].clusterNode.nodeName.length);
-
-      notify[i].clusterNode.executionEnvironment.length = node->ee_name.length;
-      memcpy(notify[i].clusterNode.executionEnvironment.value,
-             node->ee_name.value,
-             notify[i].clusterNode.executionEnvironment.length);
-
-      /* If a node leaves the cluster, member field should be
-       * false */
-      if ((node->change == SA_CLM_NODE_LEFT) &&
-          (step == SA_CLM_CHANGE_COMPLETED))
-        notify[i].clusterNode.member = SA_FALSE;
-      else
-        notify[i].clusterNode.member = node->member;
-
-      notify[i].clusterNode.bootTimestamp = node->boot_time;
-      notify[i].clusterNode.initialViewNumber = node->init_view;
-
-      notify[i].clusterChange = node->change;
+      clms_notbuffer_fill_item(&notify[i], node, step);
       i++;
     }
   }
@@ -479,33 +491,7 @@ SaClmClusterNotificationT_4 *clms_notbuffer_changes(SaClmChangeStepT step) {
   while ((nullptr != (node = clms_node_getnext_by_id(nodeid))) && (i < num)) {
     nodeid = node->node_id;
     if ((node->stat_change == SA_TRUE) || (node->member == SA_TRUE)) {
-      notify[i].clusterNode.nodeId = node->node_id;
-      notify[i].clusterNode.nodeAddress.family = node->node_addr.family;
-      notify[i].clusterNode.nodeAddress.length = node->node_addr.length;
-      memcpy(notify[i].clusterNode.nodeAddress.value, node->node_addr.value,
-             notify[i].clusterNode.nodeAddress.length);
-
-      notify[i].clusterNode.nodeName.length = node->node_name.length;
-      memcpy(notify[i].clusterNode.nodeName.value, node->node_name.value,
-             notify[i].clusterNode.nodeName.length);
-
-      notify[i].clusterNode.executionEnvironment.length = node->ee_name.length;
-      memcpy(notify[i].clusterNode.executionEnvironment.value,
-             node->ee_name.value,
-             notify[i].clusterNode.executionEnvironment.length);
-
-      /* If a node leaves the cluster, member field should be
-       * false */
-      if ((node->change == SA_CLM_NODE_LEFT) &&
-          (step == SA_CLM_CHANGE_COMPLETED))
-        notify[i].clusterNode.member = SA_FALSE;
-      else
-        notify[i].clusterNode.member = node->member;
-
-      notify[i].clusterNode.bootTimestamp = node->boot_time;
-      notify[i].clusterNode.initialViewNumber = node->init_view;
-
-      notify[i].clusterChange = node->change;
+      clms_notbuffer_fill_item(&notify[i], node, step);
       i++;
     }
   }
@@ -514,6 +500,85 @@ SaClmClusterNotificationT_4 *clms_notbuffer_changes(SaClmChangeStepT step) {
   return notify;
 }
 
+/**
+ * Fill the notification buffer of a track callback, with the number of
+ * items, for the current view. The buffer is filled once per view change and
+ * sent to all the clients tracking with the same trackflag.
+ * @param[in] ClmChangestep
+ * @param[in] changes_only  true for SA_TRACK_CHANGES_ONLY, false for
+ *                          SA_TRACK_CHANGES
+ * @param[out] buf  the notification is freed by the caller
+ */
+void clms_notbuffer_get(SaClmChangeStepT step, bool changes_only,
+                        SaClmClusterNotificationBufferT_4 *buf) {
+  buf->viewNumber = clms_cb->cluster_view_num;
+  if (changes_only) {
+    buf->numberOfItems = clms_nodedb_lookup(0);
+    buf->notification = clms_notbuffer_changes_only(step);
+  } else {
+    buf->numberOfItems = clms_nodedb_lookup(1);
+    buf->notification = clms_notbuffer_changes(step);
+  }
+}
+
+/**
+ * Fill the notification buffers of a view that reports several membership
+ * changes. The nodes that left the cluster are no longer in the node id
+ * database and are added from the list of changes.
+ * @param[in] changes  nodes that joined or left the cluster
+ * @param[out] changes_only  buffer for SA_TRACK_CHANGES_ONLY
+ * @param[out] changes_all  buffer for SA_TRACK_CHANGES
+ */
+static void clms_notbuffer_view(
+    const std::vector<CLMS_CLUSTER_NODE *> &changes,
+    SaClmClusterNotificationBufferT_4 *changes_only,
+    SaClmClusterNotificationBufferT_4 *changes_all) {
+  std::vector<CLMS_CLUSTER_NODE *> members;
+  CLMS_CLUSTER_NODE *node = nullptr;
+  SaUint32T nodeid = 0;
+  uint32_t i = 0, j = 0;
+
+  TRACE_ENTER();
+
+  while (nullptr != (node = clms_node_getnext_by_id(nodeid))) {
+    nodeid = node->node_id;
+    if ((node->stat_change == SA_TRUE) || (node->member == SA_TRUE))
+      members.push_back(node);
+  }
+
+  changes_only->viewNumber = clms_cb->cluster_view_num;
+  changes_all->viewNumber = clms_cb->cluster_view_num;
+  changes_only->notification = static_cast<SaClmClusterNotificationT_4 *>(
+      calloc(changes.size(), sizeof(SaClmClusterNotificationT_4)));
+  changes_all->notification = static_cast<SaClmClusterNotificationT_4 *>(
+      calloc(members.size() + changes.size(),
+             sizeof(SaClmClusterNotificationT_4)));
+  if (!changes_only->notification || !changes_all->notification) {
+    LOG_ER("calloc failed for SaClmClusterNotificationT_4");
+    osafassert(0);
+  }
+
+  /* Nodes in node id order, followed by the nodes that left */
+  for (const auto &member : members) {
+    clms_notbuffer_fill_item(&changes_all->notification[j++], member,
+                             SA_CLM_CHANGE_COMPLETED);
+    if (member->stat_change == SA_TRUE)
+      clms_notbuffer_fill_item(&changes_only->notification[i++], member,
+                               SA_CLM_CHANGE_COMPLETED);
+  }
+  for (const auto &changed : changes) {
+    if (changed->change != SA_CLM_NODE_LEFT) continue;
+    clms_notbuffer_fill_item(&changes_all->notification[j++], changed,
+                             SA_CLM_CHANGE_COMPLETED);
+    clms_notbuffer_fill_item(&changes_only->notification[i++], changed,
+                             SA_CLM_CHANGE_COMPLETED);
+  }
+
+  changes_only->numberOfItems = i;
+  changes_all->numberOfItems = j;
+  TRACE_LEAVE2("changes %u, members %u", i, j);
+}
+
 /**
  * Delete client from the track resonse list
  * @param[in] client_id
@@ -1060,8 +1125,8 @@ void clms_adminop_pending() {
 
 uint32_t clms_send_cbk_start_sub(CLMS_CB *cb, CLMS_CLUSTER_NODE *node) {
   CLMS_CLIENT_INFO *rec = nullptr;
-  SaClmClusterNotificationT_4 *notify_changes = nullptr;
-  SaClmClusterNotificationT_4 *notify_changes_only = nullptr;
+  SaClmClusterNotificationBufferT_4 notify_changes;
+  SaClmClusterNotificationBufferT_4 notify_changes_only;
   uint32_t rc = NCSCC_RC_SUCCESS;
   uint32_t client_id = 0;
   SaClmChangeStepT step = SA_CLM_CHANGE_COMPLETED;
@@ -1075,8 +1140,10 @@ uint32_t clms_send_cbk_start_sub(CLMS_CB *cb, CLMS_CLUSTER_NODE *node) {
     LOG_NO("%s SHUTDOWN, view number=%llu", node->node_name.value,
            node->init_view);
 
-  notify_changes_only = clms_notbuffer_changes_only(step);
-  notify_changes = clms_notbuffer_changes(step);
+  clms_notbuffer_get(step, true, &notify_changes_only);
+  clms_notbuffer_get(step, false, &notify_changes);
+  clms_mds_ntf_buf_encode(&notify_changes_only);
+  clms_mds_ntf_buf_encode(&notify_changes);
 
   while (nullptr != (rec = clms_client_getnext_by_id(client_id))) {
     client_id = rec->client_id;
@@ -1094,9 +1161,9 @@ uint32_t clms_send_cbk_start_sub(CLMS_CB *cb, CLMS_CLUSTER_NODE *node) {
             rc = clms_send_track_local(node, rec, SA_CLM_CHANGE_COMPLETED, 0);
           }
         } else {
-          if (notify_changes_only != nullptr) {
+          if (notify_changes_only.notification != nullptr) {
             rc = clms_prep_and_send_track(cb, node, rec, step,
-                                          notify_changes_only, 0);
+                                          &notify_changes_only, 0);
           } else {
             LOG_ER(
                 "Inconsistent node db,Unable to send track callback for SA_TRACK_CHANGES_ONLY clients");
@@ -1110,9 +1177,9 @@ uint32_t clms_send_cbk_start_sub(CLMS_CB *cb, CLMS_CLUSTER_NODE *node) {
             rc = clms_send_track_local(node, rec, SA_CLM_CHANGE_COMPLETED, 0);
           }
         } else {
-          if (notify_changes != nullptr) {
-            rc = clms_prep_and_send_track(cb, node, rec, step, notify_changes,
-                                          0);
+          if (notify_changes.notification != nullptr) {
+            rc = clms_prep_and_send_track(cb, node, rec, step,
+                                          &notify_changes, 0);
           } else {
             LOG_ER(
                 "Inconsistent node db,Unable to send track callback for SA_TRACK_CHANGES clients");
@@ -1126,12 +1193,187 @@ uint32_t clms_send_cbk_start_sub(CLMS_CB *cb, CLMS_CLUSTER_NODE *node) {
     }
   }
 
-  free(notify_changes_only);
-  free(notify_changes);
+  clms_mds_ntf_buf_release();
+  free(notify_changes_only.notification);
+  free(notify_changes.notification);
   TRACE_LEAVE();
   return rc;
 }
 
+/**
+ * Send the track callback of a view that reports several membership changes
+ * to all clients. The notification buffers are filled and encoded once.
+ * Clients tracking with SA_TRACK_LOCAL get a callback if their own node
+ * changed, clients on a node that left the cluster get no callback.
+ * @param[in] cb       CLM CB
+ * @param[in] changes  nodes that joined or left the cluster
+ */
+static void clms_send_track_view(
+    CLMS_CB *cb, const std::vector<CLMS_CLUSTER_NODE *> &changes) {
+  std::unordered_map<SaUint32T, CLMS_CLUSTER_NODE *> changed;
+  SaClmClusterNotificationBufferT_4 notify_changes;
+  SaClmClusterNotificationBufferT_4 notify_changes_only;
+  CLMS_CLIENT_INFO *rec = nullptr;
+  uint32_t client_id = 0;
+  uint32_t rc;
+
+  TRACE_ENTER2("%zu changes, view number %llu", changes.size(),
+               cb->cluster_view_num);
+
+  for (const auto &node : changes) changed[node->node_id] = node;
+
+  clms_notbuffer_view(changes, &notify_changes_only, &notify_changes);
+  clms_mds_ntf_buf_encode(&notify_changes_only);
+  clms_mds_ntf_buf_encode(&notify_changes);
+
+  while (nullptr != (rec = clms_client_getnext_by_id(client_id))) {
+    client_id = rec->client_id;
+    rec->inv_id = 0; /*No resp for Completed Step */
+    if (!(rec->track_flags & (SA_TRACK_CHANGES_ONLY | SA_TRACK_CHANGES)))
+      continue;
+
+    SaUint32T node_id = m_NCS_NODE_ID_FROM_MDS_DEST(rec->mds_dest);
+    auto it = changed.find(node_id);
+    CLMS_CLUSTER_NODE *local = it != changed.end() ? it->second : nullptr;
+
+    if (rec->track_flags & SA_TRACK_LOCAL) {
+      if (local == nullptr) continue;
+      rc = clms_send_track_local(local, rec, SA_CLM_CHANGE_COMPLETED, 0);
+    } else if (local != nullptr && local->change == SA_CLM_NODE_LEFT) {
+      LOG_NO(
+          "Node %u went down. Not sending track callback for agents on that node",
+          node_id);
+      continue;
+    } else if (rec->track_flags & SA_TRACK_CHANGES_ONLY) {
+      rc = clms_prep_and_send_track(cb, changes.front(), rec,
+                                    SA_CLM_CHANGE_COMPLETED,
+                                    &notify_changes_only, 0);
+    } else {
+      rc = clms_prep_and_send_track(cb, changes.front(), rec,
+                                    SA_CLM_CHANGE_COMPLETED, &notify_changes,
+                                    0);
+    }
+
+    if (rc != NCSCC_RC_SUCCESS) {
+      TRACE("Sending track callback failed for SA_CLM_CHANGE_COMPLETED");
+    }
+  }
+
+  clms_mds_ntf_buf_release();
+  free(notify_changes_only.notification);
+  free(notify_changes.notification);
+  TRACE_LEAVE();
+}
+
+/**
+ * Report that a node joined or left the cluster. The node's membership is
+ * already updated. While the server is active the change is held for the
+ * aggregation window, so that the changes of the window are reported to the
+ * trackers in one view, encoded once. A node that left is already removed
+ * from the node id database.
+ * @param[in] node    the node
+ * @param[in] change  SA_CLM_NODE_JOINED or SA_CLM_NODE_LEFT
+ */
+void clms_view_change_add(CLMS_CLUSTER_NODE *node,
+                          SaClmClusterChangesT change) {
+  TRACE_ENTER2("node %u, change %d", node->node_id, change);
+
+  /* A node changes once per view */
+  if (clms_view_change_pending(node)) clms_view_change_flush();
+
+  node->change = change;
+  if (clms_cb->view_changes.empty())
+    osaf_set_millis_timeout(clms_cb->view_change_window,
+                            &clms_cb->view_change_deadline);
+  clms_cb->view_changes.push_back(node);
+
+  if ((clms_cb->ha_state != SA_AMF_HA_ACTIVE) ||
+      (clms_cb->view_change_window == 0))
+    clms_view_change_flush();
+
+  TRACE_LEAVE();
+}
+
+/**
+ * Check if a membership change of the node is waiting to be reported
+ * @param[in] node
+ * @return true if the node joined or left in the current aggregation window
+ */
+bool clms_view_change_pending(const CLMS_CLUSTER_NODE *node) {
+  for (const auto &changed : clms_cb->view_changes) {
+    if (changed == node) return true;
+  }
+  return false;
+}
+
+/**
+ * Time left of the aggregation window
+ * @return milliseconds until the pending membership changes are to be
+ *         reported, -1 if there are none
+ */
+int clms_view_change_timeout() {
+  struct timespec now;
+  struct timespec left;
+
+  if (clms_cb->view_changes.empty()) return -1;
+
+  osaf_clock_gettime(CLOCK_MONOTONIC, &now);
+  if (osaf_timespec_compare(&now, &clms_cb->view_change_deadline) >= 0)
+    return 0;
+  osaf_timespec_subtract(&clms_cb->view_change_deadline, &now, &left);
+  /* Round up, to not wake up before the deadline */
+  return (osaf_timespec_to_nanos(&left) + 999999) / 1000000;
+}
+
+/**
+ * Report the pending membership changes to the trackers in a new view, then
+ * send the notifications, update IMM and the standby for each changed node.
+ */
+void clms_view_change_flush() {
+  std::vector<CLMS_CLUSTER_NODE *> changes;
+
+  if (clms_cb->view_changes.empty()) return;
+
+  TRACE_ENTER();
+  changes.swap(clms_cb->view_changes);
+
+  ++(clms_cb->cluster_view_num);
+  for (const auto &node : changes) {
+    /* Check for previous stale tracklist on this node and delete it */
+    if (ncs_patricia_tree_size(&node->trackresp) != 0)
+      clms_node_trackresplist_empty(node);
+    node->stat_change = SA_TRUE;
+    if (node->change == SA_CLM_NODE_JOINED)
+      node->init_view = clms_cb->cluster_view_num;
+  }
+
+  clms_send_track_view(clms_cb, changes);
+
+  for (const auto &node : changes) {
+    /* Clear node->stat_change after sending the callback to its clients */
+    node->stat_change = SA_FALSE;
+
+    if (node->change == SA_CLM_NODE_JOINED) {
+      clms_node_join_ntf(clms_cb, node);
+      clms_node_update_rattr(node);
+      node->change = SA_CLM_NODE_NO_CHANGE;
+    } else {
+      clms_node_exit_ntf(clms_cb, node);
+      clms_node_update_rattr(node);
+    }
+
+    if (clms_cb->ha_state == SA_AMF_HA_ACTIVE) {
+      ckpt_node_rec(node);
+      if (node->member == SA_FALSE) ckpt_node_down_rec(node);
+    }
+  }
+
+  clms_cluster_update_rattr(osaf_cluster);
+  if (clms_cb->ha_state == SA_AMF_HA_ACTIVE) ckpt_cluster_rec();
+
+  TRACE_LEAVE2("view number %llu", clms_cb->cluster_view_num);
+}
+
 /*walk though client list, from client mds_dest extract node_id,
 if node is match send mds msg to that client*/
 
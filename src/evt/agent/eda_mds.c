@@ -22,7 +22,8 @@
 
 MDS_CLIENT_MSG_FORMAT_VER
 EDA_WRT_EDS_MSG_FMT_ARRAY[EDA_WRT_EDS_SUBPART_VER_RANGE] = {
-    1 /*msg format version for EDA subpart version 1 */
+    1, /*msg format version for EDS subpart version 1 */
+    2  /*msg format version for EDS subpart version 2 */
 };
 
 /****************************************************************************
@@ -556,18 +557,20 @@ static uint32_t eda_dec_chan_open_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 }
 
 /****************************************************************************
-  Name          : eda_dec_delv_evt_cbk_msg
+  Name          : eda_dec_delv_evt
 
-  Description   : This routine decodes a deliver event callback message
+  Description   : This routine decodes the event of a deliver event callback
+		  message, i.e. all but the subscription it is delivered to.
 
   Arguments     : NCS_UBAID *msg,
-		  EDSV_MSG *msg
+		  EDSV_EDA_EVT_DELIVER_CBK_PARAM *param
 
   Return Values : uint32_t
 
   Notes         : None.
 ******************************************************************************/
-static uint32_t eda_dec_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
+static uint32_t eda_dec_delv_evt(NCS_UBAID *uba,
+				 EDSV_EDA_EVT_DELIVER_CBK_PARAM *param)
 {
 	uint8_t *p8;
 	uint32_t x;
@@ -575,23 +578,8 @@ static uint32_t eda_dec_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 	uint64_t num_patterns;
 	uint32_t total_bytes = 0;
 	SaEvtEventPatternT *pattern_ptr;
-	EDSV_EDA_EVT_DELIVER_CBK_PARAM *param =
-	    &msg->info.cbk_info.param.evt_deliver_cbk;
 	uint8_t local_data[1024];
 
-	if (uba == NULL) {
-		TRACE_4("uba is NULL");
-		return 0;
-	}
-
-	/* sub_id, chan_id, chan_open_id */
-	p8 = ncs_dec_flatten_space(uba, local_data, 12);
-	param->sub_id = ncs_decode_32bit(&p8);
-	param->chan_id = ncs_decode_32bit(&p8);
-	param->chan_open_id = ncs_decode_32bit(&p8);
-	ncs_dec_skip_space(uba, 12);
-	total_bytes += 12;
-
 	/* Decode the patterns.
 	 * Must allocate space for these.
 	 */
@@ -702,6 +690,105 @@ static uint32_t eda_dec_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 	return total_bytes;
 }
 
+/****************************************************************************
+  Name          : eda_dec_delv_evt_cbk_msg
+
+  Description   : This routine decodes a deliver event callback message
+
+  Arguments     : NCS_UBAID *msg,
+		  EDSV_MSG *msg
+
+  Return Values : uint32_t
+
+  Notes         : None.
+******************************************************************************/
+static uint32_t eda_dec_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
+{
+	uint8_t *p8;
+	uint32_t total_bytes = 0;
+	EDSV_EDA_EVT_DELIVER_CBK_PARAM *param =
+	    &msg->info.cbk_info.param.evt_deliver_cbk;
+	uint8_t local_data[20];
+
+	if (uba == NULL) {
+		TRACE_4("uba is NULL");
+		return 0;
+	}
+
+	/* sub_id, chan_id, chan_open_id */
+	p8 = ncs_dec_flatten_space(uba, local_data, 12);
+	param->sub_id = ncs_decode_32bit(&p8);
+	param->chan_id = ncs_decode_32bit(&p8);
+	param->chan_open_id = ncs_decode_32bit(&p8);
+	ncs_dec_skip_space(uba, 12);
+	total_bytes += 12;
+
+	total_bytes += eda_dec_delv_evt(uba, param);
+
+	return total_bytes;
+}
+
+/****************************************************************************
+  Name          : eda_dec_delv_evt_multi_cbk_msg
+
+  Description   : This routine decodes a deliver event callback message for
+		  several subscriptions of this EDA.
+
+  Arguments     : NCS_UBAID *msg,
+		  EDSV_MSG *msg
+
+  Return Values : uint32_t
+
+  Notes         : None.
+******************************************************************************/
+static uint32_t eda_dec_delv_evt_multi_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
+{
+	uint8_t *p8;
+	uint32_t x;
+	uint32_t total_bytes = 0;
+	EDSV_EDA_EVT_DELIVER_MULTI_CBK_PARAM *param =
+	    &msg->info.cbk_info.param.evt_deliver_multi_cbk;
+	uint8_t local_data[20];
+
+	if (uba == NULL) {
+		TRACE_4("uba is NULL");
+		return 0;
+	}
+
+	/* chan_id, num_subs */
+	p8 = ncs_dec_flatten_space(uba, local_data, 8);
+	param->evt.chan_id = ncs_decode_32bit(&p8);
+	param->num_subs = ncs_decode_32bit(&p8);
+	ncs_dec_skip_space(uba, 8);
+	total_bytes += 8;
+
+	if (param->num_subs == 0) {
+		TRACE_4("no subscriptions");
+		return 0;
+	}
+
+	param->subs = m_MMGR_ALLOC_EDSV_DELIVER_SUBS(param->num_subs);
+	if (!param->subs) {
+		TRACE_4("malloc failed for subscriptions");
+		param->num_subs = 0;
+		return 0;
+	}
+
+	/* reg_id, chan_open_id, sub_id of each subscription */
+	for (x = 0; x < param->num_subs; x++) {
+		p8 = ncs_dec_flatten_space(uba, local_data, 12);
+		param->subs[x].reg_id = ncs_decode_32bit(&p8);
+		param->subs[x].chan_open_id = ncs_decode_32bit(&p8);
+		param->subs[x].sub_id = ncs_decode_32bit(&p8);
+		ncs_dec_skip_space(uba, 12);
+		total_bytes += 12;
+	}
+
+	total_bytes += eda_dec_delv_evt(uba, &param->evt);
+
+	return total_bytes;
+}
+
 static uint32_t eda_dec_clm_status_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 {
 	uint8_t *p8;
@@ -723,6 +810,9 @@ static uint32_t eda_dec_clm_status_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 	return total_bytes;
 }
 
+static uint32_t eda_eds_deliver_multi_proc(EDA_CB *eda_cb, EDSV_MSG *edsv_msg,
+					   MDS_SEND_PRIORITY_TYPE prio);
+
 /****************************************************************************
   Name          : eda_eds_msg_proc
 
@@ -915,6 +1005,9 @@ static uint32_t eda_eds_msg_proc(EDA_CB *eda_cb, EDSV_MSG *edsv_msg,
 			}
 
 		} break;
+		case EDSV_EDS_DELIVER_EVENT_MULTI:
+			return eda_eds_deliver_multi_proc(eda_cb, edsv_msg,
+							  prio);
 		case EDSV_EDS_CLMNODE_STATUS: {
 			EDSV_EDA_CLM_STATUS_CBK_PARAM *clm_status_param =
 			    &edsv_msg->info.cbk_info.param.clm_status_cbk;
@@ -945,6 +1038,98 @@ static uint32_t eda_eds_msg_proc(EDA_CB *eda_cb, EDSV_MSG *edsv_msg,
 	return NCSCC_RC_SUCCESS;
 }
 
+/****************************************************************************
+  Name          : eda_eds_deliver_multi_proc
+
+  Description   : This routine splits an event delivered once for several
+		  subscriptions of this EDA into an event deliver callback
+		  message per subscription, and processes these.
+
+  Arguments     : EDA_CB *eda_cb,
+		  EDSV_MSG *edsv_msg,
+		  MDS_SEND_PRIORITY_TYPE prio
+
+  Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+
+  Notes         : The last subscription takes the decoded event, the others
+		  get a copy.
+******************************************************************************/
+static uint32_t eda_eds_deliver_multi_proc(EDA_CB *eda_cb, EDSV_MSG *edsv_msg,
+					   MDS_SEND_PRIORITY_TYPE prio)
+{
+	EDSV_EDA_EVT_DELIVER_MULTI_CBK_PARAM *multi_param =
+	    &edsv_msg->info.cbk_info.param.evt_deliver_multi_cbk;
+	EDSV_EDA_EVT_DELIVER_CBK_PARAM *evt_dlv_param;
+	EDSV_MSG *msg;
+	SaAisErrorT error;
+	uint32_t rc = NCSCC_RC_SUCCESS;
+	uint32_t x;
+
+	for (x = 0; x < multi_param->num_subs; x++) {
+		if (NULL == (msg = m_MMGR_ALLOC_EDSV_MSG)) {
+			TRACE_4("malloc failed");
+			rc = NCSCC_RC_FAILURE;
+			break;
+		}
+
+		memset(msg, '\0', sizeof(EDSV_MSG));
+		msg->type = EDSV_EDS_CBK_MSG;
+		msg->info.cbk_info.type = EDSV_EDS_DELIVER_EVENT;
+		msg->info.cbk_info.eds_reg_id = multi_param->subs[x].reg_id;
+		evt_dlv_param = &msg->info.cbk_info.param.evt_deliver_cbk;
+		*evt_dlv_param = multi_param->evt;
+		evt_dlv_param->sub_id = multi_param->subs[x].sub_id;
+		evt_dlv_param->chan_open_id = multi_param->subs[x].chan_open_id;
+
+		if (x + 1 < multi_param->num_subs) {
+			evt_dlv_param->data = NULL;
+			evt_dlv_param->pattern_array =
+			    edsv_copy_evt_pattern_array(
+				multi_param->evt.pattern_array, &error);
+			if (evt_dlv_param->pattern_array == NULL) {
+				TRACE_4("pattern array copy failed: %u", error);
+				eda_msg_destroy(msg);
+				rc = NCSCC_RC_FAILURE;
+				break;
+			}
+			if (multi_param->evt.data != NULL) {
+				evt_dlv_param->data =
+				    m_MMGR_ALLOC_EDSV_EVENT_DATA(
+					(uint32_t)multi_param->evt.data_len);
+				if (evt_dlv_param->data == NULL) {
+					TRACE_4("malloc failed for event data");
+					edsv_free_evt_pattern_array(
+					    evt_dlv_param->pattern_array);
+					eda_msg_destroy(msg);
+					rc = NCSCC_RC_FAILURE;
+					break;
+				}
+				memcpy(evt_dlv_param->data,
+				       multi_param->evt.data,
+				       (size_t)multi_param->evt.data_len);
+			}
+		} else {
+			multi_param->evt.pattern_array = NULL;
+			multi_param->evt.data = NULL;
+		}
+
+		if (NCSCC_RC_SUCCESS != eda_eds_msg_proc(eda_cb, msg, prio))
+			rc = NCSCC_RC_FAILURE;
+	}
+
+	/** free the event if not handed over
+	 **/
+	edsv_free_evt_pattern_array(multi_param->evt.pattern_array);
+	multi_param->evt.pattern_array = NULL;
+	if (multi_param->evt.data) {
+		m_MMGR_FREE_EDSV_EVENT_DATA(multi_param->evt.data);
+		multi_param->evt.data = NULL;
+	}
+	eda_msg_destroy(edsv_msg);
+
+	return rc;
+}
+
 /****************************************************************************
   Name          : eda_mds_svc_evt
 
@@ -1385,6 +1570,9 @@ static uint32_t eda_mds_dec(struct ncsmds_callback_info *info)
 		case EDSV_EDS_DELIVER_EVENT:
 			total_bytes += eda_dec_delv_evt_cbk_msg(uba, msg);
 			break;
+		case EDSV_EDS_DELIVER_EVENT_MULTI:
+			total_bytes += eda_dec_delv_evt_multi_cbk_msg(uba, msg);
+			break;
 		case EDSV_EDS_CLMNODE_STATUS:
 			total_bytes += eda_dec_clm_status_cbk_msg(uba, msg);
 		default:
@@ -37,9 +37,9 @@
  * semantics for communication with EDS
  */
 
-#define EDA_SVC_PVT_SUBPART_VERSION 1
+#define EDA_SVC_PVT_SUBPART_VERSION 2
 #define EDA_WRT_EDS_SUBPART_VER_AT_MIN_MSG_FMT 1
-#define EDA_WRT_EDS_SUBPART_VER_AT_MAX_MSG_FMT 1
+#define EDA_WRT_EDS_SUBPART_VER_AT_MAX_MSG_FMT 2
 #define EDA_WRT_EDS_SUBPART_VER_RANGE       \
   (EDA_WRT_EDS_SUBPART_VER_AT_MAX_MSG_FMT - \
    EDA_WRT_EDS_SUBPART_VER_AT_MIN_MSG_FMT + 1)
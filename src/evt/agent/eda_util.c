@@ -232,6 +232,13 @@ void eda_msg_destroy(EDSV_MSG *msg)
 				    msg->info.api_info.param.subscribe
 					.filter_array);
 		}
+	} else if ((EDSV_EDS_CBK_MSG == msg->type) &&
+		   (EDSV_EDS_DELIVER_EVENT_MULTI == msg->info.cbk_info.type)) {
+		/* free the subscriptions */
+		if (NULL != msg->info.cbk_info.param.evt_deliver_multi_cbk.subs)
+			m_MMGR_FREE_EDSV_DELIVER_SUBS(
+			    msg->info.cbk_info.param.evt_deliver_multi_cbk
+				.subs);
 	}
 
 	/** There are no other pointers
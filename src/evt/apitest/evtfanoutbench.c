@@ -0,0 +1,274 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the rate of publishing
+ * events on a channel, until delivered to all subscribers, for a growing
+ * number of subscribers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <poll.h>
+
+#include <saAis.h>
+#include <saEvt.h>
+#include "base/osaf_time.h"
+#include "osaf/apitest/bench.h"
+
+#define BENCH_CHANNEL_NAME "safChnl=evtfanoutbench"
+#define BENCH_PATTERN "fanout"
+
+static SaVersionT evtVersion = {'B', 3, 1};
+static unsigned int subscriberCounts[BENCH_MAX_COUNTS] = {1, 100, 1000};
+static unsigned int numCounts = 3;
+static unsigned int numEvents = 1000;
+static unsigned int dataSize = 64;
+static const char *channelName = BENCH_CHANNEL_NAME;
+static unsigned long numDelivered;
+
+static void usage(const char *progname)
+{
+	static const char *const options[] = {
+	    "-s, --subscribers <list> comma separated subscriber counts (default 1,100,1000)",
+	    "-e, --events <n>       events per subscriber count (default 1000)",
+	    "-z, --size <n>         event data size in bytes (default 64)",
+	    "-n, --name <name>      channel (default " BENCH_CHANNEL_NAME ")",
+	    NULL};
+
+	bench_usage(
+	    progname, "measure the EVT publish rate to many subscribers",
+	    "is an EVT test client opening a channel a growing number of\n"
+	    "\ttimes, with a subscription matching all events at each channel\n"
+	    "\topen. At each subscriber count it publishes a number of events\n"
+	    "\tand reports the rate of events delivered to all subscribers.\n",
+	    options, "-s 1,10,100,1000 -e 10000");
+}
+
+static void deliver_callback(SaEvtSubscriptionIdT subscriptionId,
+			     SaEvtEventHandleT eventHandle,
+			     SaSizeT eventDataSize)
+{
+	numDelivered++;
+	saEvtEventFree(eventHandle);
+}
+
+static void subscribe(SaEvtHandleT evtHandle, const SaNameT *name,
+		      SaEvtChannelHandleT *channelHandle,
+		      SaEvtSubscriptionIdT id)
+{
+	SaEvtEventFilterT filter;
+	SaEvtEventFilterArrayT filterArray;
+	SaAisErrorT rc;
+
+	filter.filterType = SA_EVT_EXACT_FILTER;
+	filter.filter.allocatedSize = filter.filter.patternSize =
+	    strlen(BENCH_PATTERN);
+	filter.filter.pattern = (SaUint8T *)BENCH_PATTERN;
+	filterArray.filtersNumber = 1;
+	filterArray.filters = &filter;
+
+	rc = saEvtChannelOpen(evtHandle, name, SA_EVT_CHANNEL_SUBSCRIBER,
+			      SA_TIME_ONE_SECOND * 10, channelHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtChannelOpen", rc);
+
+	rc = saEvtEventSubscribe(*channelHandle, &filterArray, id);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventSubscribe", rc);
+}
+
+static void dispatch(SaEvtHandleT evtHandle, SaSelectionObjectT selObj,
+		     int timeout)
+{
+	struct pollfd fds;
+	SaAisErrorT rc;
+	int n;
+
+	fds.fd = (int)selObj;
+	fds.events = POLLIN;
+	n = poll(&fds, 1, timeout);
+	if (n < 0) {
+		perror("poll");
+		exit(EXIT_FAILURE);
+	}
+	if (n == 0)
+		return;
+
+	rc = saEvtDispatch(evtHandle, SA_DISPATCH_ALL);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtDispatch", rc);
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {
+	    {"help", no_argument, 0, 'h'},
+	    {"subscribers", required_argument, 0, 's'},
+	    {"events", required_argument, 0, 'e'},
+	    {"size", required_argument, 0, 'z'},
+	    {"name", required_argument, 0, 'n'},
+	    {0, 0, 0, 0}};
+	SaEvtCallbacksT callbacks = {NULL, deliver_callback};
+	SaEvtHandleT evtHandle;
+	SaEvtChannelHandleT pubHandle, *subHandles;
+	SaEvtEventHandleT eventHandle;
+	SaEvtEventPatternT pat;
+	SaEvtEventPatternArrayT patternArray;
+	SaEvtEventIdT eventId;
+	SaSelectionObjectT selObj;
+	SaNameT name, publisher;
+	struct timespec start, end, elapsed;
+	unsigned int i, j, maxSubscribers = 0, numSubscribers = 0;
+	unsigned long expected;
+	char *data;
+	double secs;
+	SaAisErrorT rc;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "hs:e:z:n:", long_options,
+				NULL)) != -1) {
+		switch (c) {
+		case 's':
+			numCounts = bench_parse_counts(
+			    optarg, subscriberCounts, "subscriber");
+			break;
+		case 'e':
+			numEvents = strtoul(optarg, NULL, 0);
+			break;
+		case 'z':
+			dataSize = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			channelName = optarg;
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numCounts == 0 || numEvents == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < numCounts; ++i) {
+		if (subscriberCounts[i] == 0 ||
+		    (i > 0 && subscriberCounts[i] <= subscriberCounts[i - 1])) {
+			fprintf(stderr, "Subscriber counts must be increasing\n");
+			exit(EXIT_FAILURE);
+		}
+		maxSubscribers = subscriberCounts[i];
+	}
+
+	if (strlen(channelName) >= SA_MAX_NAME_LENGTH) {
+		fprintf(stderr, "Channel name too long\n");
+		exit(EXIT_FAILURE);
+	}
+
+	subHandles = calloc(maxSubscribers, sizeof(*subHandles));
+	data = calloc(1, dataSize ? dataSize : 1);
+	if (subHandles == NULL || data == NULL) {
+		perror("calloc");
+		exit(EXIT_FAILURE);
+	}
+
+	name.length = strlen(channelName);
+	memcpy(name.value, channelName, name.length);
+
+	rc = saEvtInitialize(&evtHandle, &callbacks, &evtVersion);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtInitialize", rc);
+
+	rc = saEvtSelectionObjectGet(evtHandle, &selObj);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtSelectionObjectGet", rc);
+
+	rc = saEvtChannelOpen(evtHandle, &name,
+			      SA_EVT_CHANNEL_CREATE | SA_EVT_CHANNEL_PUBLISHER,
+			      SA_TIME_ONE_SECOND * 10, &pubHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtChannelOpen", rc);
+
+	pat.allocatedSize = pat.patternSize = strlen(BENCH_PATTERN);
+	pat.pattern = (SaUint8T *)BENCH_PATTERN;
+	patternArray.allocatedNumber = patternArray.patternsNumber = 1;
+	patternArray.patterns = &pat;
+	publisher.length = strlen("evtfanoutbench");
+	memcpy(publisher.value, "evtfanoutbench", publisher.length);
+
+	rc = saEvtEventAllocate(pubHandle, &eventHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventAllocate", rc);
+	rc = saEvtEventAttributesSet(eventHandle, &patternArray,
+				     SA_EVT_LOWEST_PRIORITY, 0, &publisher);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventAttributesSet", rc);
+
+	for (i = 0; i < numCounts; ++i) {
+		for (; numSubscribers < subscriberCounts[i]; ++numSubscribers)
+			subscribe(evtHandle, &name,
+				  &subHandles[numSubscribers],
+				  numSubscribers + 1);
+
+		numDelivered = 0;
+		expected = (unsigned long)numEvents * numSubscribers;
+		osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+		for (j = 0; j < numEvents; ++j) {
+			rc = saEvtEventPublish(eventHandle, data, dataSize,
+					       &eventId);
+			if (rc != SA_AIS_OK)
+				bench_fail("saEvtEventPublish", rc);
+			/* Keep the callback queue short */
+			dispatch(evtHandle, selObj, 0);
+		}
+		while (numDelivered < expected) {
+			j = numDelivered;
+			dispatch(evtHandle, selObj, 10000);
+			if (numDelivered == j) {
+				fprintf(stderr, "Received %lu of %lu events\n",
+					numDelivered, expected);
+				exit(EXIT_FAILURE);
+			}
+		}
+		osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+		osaf_timespec_subtract(&end, &start, &elapsed);
+		secs = osaf_timespec_to_double(&elapsed);
+
+		printf("subscribers:%u events:%u time:%.3fs rate:%.1f events/s "
+		       "deliveries:%.1f/s\n",
+		       numSubscribers, numEvents, secs, numEvents / secs,
+		       expected / secs);
+	}
+
+	saEvtEventFree(eventHandle);
+	for (i = 0; i < numSubscribers; ++i)
+		saEvtChannelClose(subHandles[i]);
+	saEvtChannelClose(pubHandle);
+	saEvtChannelUnlink(evtHandle, &name);
+	saEvtFinalize(evtHandle);
+	free(subHandles);
+	free(data);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,305 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the latency of an
+ * event subscription, until the matching retained events are delivered, for
+ * a growing number of retained events on a channel.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <poll.h>
+
+#include <saAis.h>
+#include <saEvt.h>
+#include "base/osaf_time.h"
+#include "osaf/apitest/bench.h"
+
+#define BENCH_CHANNEL_NAME "safChnl=evtretbench"
+#define BENCH_MATCH_PATTERN "match"
+#define BENCH_SYNC_PATTERN "sync"
+
+static SaVersionT evtVersion = {'B', 3, 1};
+static unsigned int eventCounts[BENCH_MAX_COUNTS] = {1000, 10000, 100000};
+static unsigned int numCounts = 3;
+static unsigned int numMatches = 10;
+static unsigned int numRepeats = 10;
+static SaEvtEventFilterTypeT filterType = SA_EVT_EXACT_FILTER;
+static const char *channelName = BENCH_CHANNEL_NAME;
+static unsigned int numDelivered;
+
+static void usage(const char *progname)
+{
+	static const char *const options[] = {
+	    "-e, --events <list>    comma separated event counts (default 1000,10000,100000)",
+	    "-m, --matches <n>      matching events (default 10)",
+	    "-r, --repeat <n>       subscriptions per event count (default 10)",
+	    "-p, --prefix           use a prefix filter instead of an exact filter",
+	    "-n, --name <name>      channel (default " BENCH_CHANNEL_NAME ")",
+	    NULL};
+
+	bench_usage(
+	    progname, "measure the EVT subscribe latency with retained events",
+	    "is an EVT test client publishing a growing number of\n"
+	    "\tretained events on a channel, of which a few match the filter\n"
+	    "\tof a subscription. At each event count it reports the time from\n"
+	    "\tsubscribing until the matching retained events are delivered,\n"
+	    "\tand at the end the rate of clearing all retained events.\n",
+	    options, "-e 1000,200000 -p");
+}
+
+static void deliver_callback(SaEvtSubscriptionIdT subscriptionId,
+			     SaEvtEventHandleT eventHandle,
+			     SaSizeT eventDataSize)
+{
+	numDelivered++;
+	saEvtEventFree(eventHandle);
+}
+
+static void publish(SaEvtChannelHandleT channelHandle, const char *pattern,
+		    SaEvtEventIdT *eventId)
+{
+	SaEvtEventHandleT eventHandle;
+	SaEvtEventPatternT pat;
+	SaEvtEventPatternArrayT patternArray;
+	SaNameT publisher;
+	SaAisErrorT rc;
+
+	pat.allocatedSize = pat.patternSize = strlen(pattern);
+	pat.pattern = (SaUint8T *)pattern;
+	patternArray.allocatedNumber = patternArray.patternsNumber = 1;
+	patternArray.patterns = &pat;
+	publisher.length = strlen("evtretbench");
+	memcpy(publisher.value, "evtretbench", publisher.length);
+
+	rc = saEvtEventAllocate(channelHandle, &eventHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventAllocate", rc);
+	rc = saEvtEventAttributesSet(eventHandle, &patternArray,
+				     SA_EVT_LOWEST_PRIORITY,
+				     SA_TIME_ONE_HOUR, &publisher);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventAttributesSet", rc);
+	rc = saEvtEventPublish(eventHandle, NULL, 0, eventId);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventPublish", rc);
+	saEvtEventFree(eventHandle);
+}
+
+/* Subscribe and dispatch until the expected number of retained events has
+ * been delivered */
+static void subscribe(SaEvtHandleT evtHandle,
+		      SaEvtChannelHandleT channelHandle,
+		      SaSelectionObjectT selObj, const char *pattern,
+		      SaEvtEventFilterTypeT type, SaEvtSubscriptionIdT id,
+		      unsigned int expected)
+{
+	SaEvtEventFilterT filter;
+	SaEvtEventFilterArrayT filterArray;
+	struct pollfd fds;
+	SaAisErrorT rc;
+
+	filter.filterType = type;
+	filter.filter.allocatedSize = filter.filter.patternSize =
+	    strlen(pattern);
+	filter.filter.pattern = (SaUint8T *)pattern;
+	filterArray.filtersNumber = 1;
+	filterArray.filters = &filter;
+
+	numDelivered = 0;
+	rc = saEvtEventSubscribe(channelHandle, &filterArray, id);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventSubscribe", rc);
+
+	fds.fd = (int)selObj;
+	fds.events = POLLIN;
+	while (numDelivered < expected) {
+		if (poll(&fds, 1, 10000) <= 0) {
+			fprintf(stderr, "Received %u of %u events\n",
+				numDelivered, expected);
+			exit(EXIT_FAILURE);
+		}
+		rc = saEvtDispatch(evtHandle, SA_DISPATCH_ALL);
+		if (rc != SA_AIS_OK)
+			bench_fail("saEvtDispatch", rc);
+	}
+
+	rc = saEvtEventUnsubscribe(channelHandle, id);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtEventUnsubscribe", rc);
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"events", required_argument, 0, 'e'},
+					{"matches", required_argument, 0, 'm'},
+					{"repeat", required_argument, 0, 'r'},
+					{"prefix", no_argument, 0, 'p'},
+					{"name", required_argument, 0, 'n'},
+					{0, 0, 0, 0}};
+	SaEvtCallbacksT callbacks = {NULL, deliver_callback};
+	SaEvtHandleT evtHandle;
+	SaEvtChannelHandleT channelHandle;
+	SaSelectionObjectT selObj;
+	SaEvtSubscriptionIdT subId = 1;
+	SaEvtEventIdT *eventIds, syncId;
+	struct timespec start, end, elapsed;
+	unsigned int i, j, maxEvents = 0, numEvents = 0;
+	const char *filterPattern;
+	char pattern[32];
+	SaNameT name;
+	double secs;
+	SaAisErrorT rc;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "he:m:r:pn:", long_options,
+				NULL)) != -1) {
+		switch (c) {
+		case 'e':
+			numCounts = bench_parse_counts(
+			    optarg, eventCounts, "event");
+			break;
+		case 'm':
+			numMatches = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			numRepeats = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			filterType = SA_EVT_PREFIX_FILTER;
+			break;
+		case 'n':
+			channelName = optarg;
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numCounts == 0 || numRepeats == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < numCounts; ++i) {
+		if (eventCounts[i] <= numMatches ||
+		    (i > 0 && eventCounts[i] <= eventCounts[i - 1])) {
+			fprintf(stderr, "Event counts must be increasing and "
+					"larger than the matches\n");
+			exit(EXIT_FAILURE);
+		}
+		maxEvents = eventCounts[i];
+	}
+
+	if (strlen(channelName) >= SA_MAX_NAME_LENGTH) {
+		fprintf(stderr, "Channel name too long\n");
+		exit(EXIT_FAILURE);
+	}
+
+	eventIds = calloc(maxEvents, sizeof(*eventIds));
+	if (eventIds == NULL) {
+		perror("calloc");
+		exit(EXIT_FAILURE);
+	}
+
+	name.length = strlen(channelName);
+	memcpy(name.value, channelName, name.length);
+
+	rc = saEvtInitialize(&evtHandle, &callbacks, &evtVersion);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtInitialize", rc);
+
+	rc = saEvtSelectionObjectGet(evtHandle, &selObj);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtSelectionObjectGet", rc);
+
+	/* Start from a channel without retained events */
+	saEvtChannelUnlink(evtHandle, &name);
+
+	rc = saEvtChannelOpen(evtHandle, &name,
+			      SA_EVT_CHANNEL_CREATE | SA_EVT_CHANNEL_PUBLISHER |
+				  SA_EVT_CHANNEL_SUBSCRIBER,
+			      SA_TIME_ONE_SECOND * 10, &channelHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saEvtChannelOpen", rc);
+
+	/* The prefix filter matches the same events, without the bucket */
+	filterPattern = filterType == SA_EVT_EXACT_FILTER
+			    ? BENCH_MATCH_PATTERN
+			    : "ma";
+
+	for (i = 0; i < numCounts; ++i) {
+		for (; numEvents < eventCounts[i]; ++numEvents) {
+			if (numEvents < numMatches) {
+				publish(channelHandle, BENCH_MATCH_PATTERN,
+					&eventIds[numEvents]);
+			} else {
+				snprintf(pattern, sizeof(pattern), "e%u",
+					 numEvents);
+				publish(channelHandle, pattern,
+					&eventIds[numEvents]);
+			}
+		}
+
+		/* Wait until the server has retained all events */
+		publish(channelHandle, BENCH_SYNC_PATTERN, &syncId);
+		subscribe(evtHandle, channelHandle, selObj, BENCH_SYNC_PATTERN,
+			  SA_EVT_EXACT_FILTER, subId++, 1);
+		rc = saEvtEventRetentionTimeClear(channelHandle, syncId);
+		if (rc != SA_AIS_OK)
+			bench_fail("saEvtEventRetentionTimeClear", rc);
+
+		osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+		for (j = 0; j < numRepeats; ++j)
+			subscribe(evtHandle, channelHandle, selObj,
+				  filterPattern, filterType, subId++,
+				  numMatches);
+		osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+		osaf_timespec_subtract(&end, &start, &elapsed);
+		secs = osaf_timespec_to_double(&elapsed) / numRepeats;
+
+		printf("retained:%u matches:%u subscribe:%.3fms\n", numEvents,
+		       numMatches, secs * 1000);
+	}
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numEvents; ++i) {
+		rc = saEvtEventRetentionTimeClear(channelHandle, eventIds[i]);
+		if (rc != SA_AIS_OK)
+			bench_fail("saEvtEventRetentionTimeClear", rc);
+	}
+	osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+	osaf_timespec_subtract(&end, &start, &elapsed);
+	secs = osaf_timespec_to_double(&elapsed);
+	printf("clear events:%u time:%.3fs rate:%.1f events/s\n", numEvents,
+	       secs, numEvents / secs);
+
+	saEvtChannelClose(channelHandle);
+	saEvtChannelUnlink(evtHandle, &name);
+	saEvtFinalize(evtHandle);
+	free(eventIds);
+
+	return EXIT_SUCCESS;
+}
@@ -40,7 +40,8 @@ typedef enum {
   NCS_SERVICE_SUB_ID_EDSV_EVENT_FILTER_ARRAY,
   NCS_SERVICE_SUB_ID_EDSV_EVENT_FILTERS,
   NCS_SERVICE_SUB_ID_EDSV_EVENT_DATA,
-  NCS_SERVICE_SUB_ID_EDSV_CKPT_MSG
+  NCS_SERVICE_SUB_ID_EDSV_CKPT_MSG,
+  NCS_SERVICE_SUB_ID_EDSV_DELIVER_SUBS
 } NCS_SERVICE_EDSV_SUBID;
 
 /****************************************
@@ -98,4 +99,13 @@ typedef enum {
   m_NCS_MEM_FREE(p, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_EDA, \
                  NCS_SERVICE_SUB_ID_EDSV_EVENT_DATA)
 
+#define m_MMGR_ALLOC_EDSV_DELIVER_SUBS(n)                                \
+  (EDSV_EDA_EVT_DELIVER_SUB *)m_NCS_MEM_ALLOC(                          \
+      (n) * sizeof(EDSV_EDA_EVT_DELIVER_SUB), NCS_MEM_REGION_PERSISTENT, \
+      NCS_SERVICE_ID_EDA, NCS_SERVICE_SUB_ID_EDSV_DELIVER_SUBS)
+
+#define m_MMGR_FREE_EDSV_DELIVER_SUBS(p)                           \
+  m_NCS_MEM_FREE(p, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_EDA, \
+                 NCS_SERVICE_SUB_ID_EDSV_DELIVER_SUBS)
+
 #endif  // EVT_COMMON_EDSV_MEM_H_
@@ -79,6 +79,7 @@ typedef enum edsv_cbk_msg_type {
   EDSV_EDS_CHAN_OPEN = EDSV_CBK_BASE_MSG,
   EDSV_EDS_DELIVER_EVENT,
   EDSV_EDS_CLMNODE_STATUS,
+  EDSV_EDS_DELIVER_EVENT_MULTI, /* from message format version 2 */
   EDSV_EDS_CBK_MAX
 } EDSV_CBK_TYPE;
 
@@ -248,6 +249,24 @@ typedef struct edsv_eda_evt_deliver_cb_param_tag {
   uint8_t *data;
 } EDSV_EDA_EVT_DELIVER_CBK_PARAM;
 
+/* A subscription matched by a published event */
+typedef struct edsv_eda_evt_deliver_sub_tag {
+  uint32_t reg_id;
+  uint32_t chan_open_id;
+  SaEvtSubscriptionIdT sub_id;
+} EDSV_EDA_EVT_DELIVER_SUB;
+
+/*
+ * An event delivered once to an EDA for all its matching subscriptions.
+ * The sub_id and chan_open_id of evt are taken from each entry of subs.
+ */
+typedef struct edsv_eda_evt_deliver_multi_cb_param_tag {
+  EDSV_EDA_EVT_DELIVER_CBK_PARAM evt;
+  uint32_t num_subs;
+  EDSV_EDA_EVT_DELIVER_SUB *subs;
+  USRBUF *evt_ub; /* event encoded once at the EDS, NULL at EDA */
+} EDSV_EDA_EVT_DELIVER_MULTI_CBK_PARAM;
+
 typedef struct edsv_eda_clm_status_param_tag {
   uint16_t node_status;
 } EDSV_EDA_CLM_STATUS_CBK_PARAM;
@@ -261,6 +280,7 @@ typedef struct edsv_cbk_info {
   union {
     EDSV_EDA_CHAN_OPEN_CBK_PARAM chan_open_cbk;
     EDSV_EDA_EVT_DELIVER_CBK_PARAM evt_deliver_cbk;
+    EDSV_EDA_EVT_DELIVER_MULTI_CBK_PARAM evt_deliver_multi_cbk;
     EDSV_EDA_CLM_STATUS_CBK_PARAM clm_status_cbk;
   } param;
 } EDSV_CBK_INFO;
@@ -52,15 +52,17 @@ static nfds_t nfds = 6;
  *****************************************************************************/
 uint32_t eds_cb_init(EDS_CB *eds_cb)
 {
-	NCS_PATRICIA_PARAMS reg_param, cname_param, nodelist_param;
+	NCS_PATRICIA_PARAMS reg_param, cname_param, nodelist_param, dest_param;
 
 	memset(&reg_param, 0, sizeof(NCS_PATRICIA_PARAMS));
 	memset(&cname_param, 0, sizeof(NCS_PATRICIA_PARAMS));
 	memset(&nodelist_param, 0, sizeof(NCS_PATRICIA_PARAMS));
+	memset(&dest_param, 0, sizeof(NCS_PATRICIA_PARAMS));
 
 	reg_param.key_size = sizeof(uint32_t);
 	cname_param.key_size = sizeof(SaNameT);
 	nodelist_param.key_size = sizeof(uint32_t);
+	dest_param.key_size = sizeof(MDS_DEST);
 	TRACE_ENTER();
 
 	/* Assign Initial HA state */
@@ -101,6 +103,14 @@ uint32_t eds_cb_init(EDS_CB *eds_cb)
 		return NCSCC_RC_FAILURE;
 	}
 
+	/* Initialize patricia tree for EDA dest list */
+	if (NCSCC_RC_SUCCESS !=
+	    ncs_patricia_tree_init(&eds_cb->eda_dest_list, &dest_param)) {
+		LOG_ER("Patricia Init for EDA Dest List failed");
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
 	TRACE_LEAVE();
 	return NCSCC_RC_SUCCESS;
 }
@@ -124,6 +134,8 @@ void eds_cb_destroy(EDS_CB *eds_cb)
 	/* Check if other lists are deleted as well */
 	ncs_patricia_tree_destroy(&eds_cb->eds_cname_list);
 	ncs_patricia_tree_destroy(&eds_cb->eds_cluster_nodes_list);
+	eds_remove_eda_dest_recs(eds_cb);
+	ncs_patricia_tree_destroy(&eds_cb->eda_dest_list);
 
 	return;
 }
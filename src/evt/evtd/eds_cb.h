@@ -66,6 +66,12 @@ struct eda_reg_list_tag;
 #define EDS_MAX_NUM_FILTERS EDS_MAX_NUM_PATTERNS
 #define EDS_MAX_FILTER_SIZE EDS_MAX_PATTERN_SIZE
 #define EDSV_CLM_TIMEOUT 10000000000LL
+/* Retained events are expired by a timing wheel of EDS_RET_WHEEL_SLOTS
+ * slots, that is advanced every EDS_RET_WHEEL_TICK nanoseconds */
+#define EDS_RET_WHEEL_SLOTS 1024
+#define EDS_RET_WHEEL_TICK 100000000LL
+/* Number of hash buckets of the retained events of a channel (power of 2) */
+#define EDS_RET_EVT_BUCKETS 256
 
 typedef enum eds_svc_state {
   RUNNING = 1,
@@ -102,14 +108,17 @@ typedef struct eds_tmr_tag {
   bool is_active;
 } EDS_TMR;
 
+/* Key of the retained event index of a channel */
+typedef struct eds_retd_evt_key_tag {
+  uint32_t chan_open_id;
+  uint32_t event_id;
+} EDS_RETD_EVT_KEY;
+
 typedef struct edsv_retained_evt_list_tag {
+  NCS_PATRICIA_NODE pat_node; /* Node of the channel's retained event index */
+  EDS_RETD_EVT_KEY key;
   uint32_t event_id; /* From the EDA */
 
-  /** hdl-mgr hdl, to be used for ret timer exp
-   ** processing
-   **/
-  uint32_t retd_evt_hdl;
-
   /** Event details **/
   uint8_t priority;
   SaTimeT retentionTime;
@@ -126,12 +135,38 @@ typedef struct edsv_retained_evt_list_tag {
   uint32_t reg_id;
   uint32_t chan_id;
 
-  /* Retention tmr */
-  struct eds_tmr_tag ret_tmr;
+  /* Hash of the first pattern, selects the bucket of the event */
+  uint32_t pattern_hash;
+
+  /* Wheel tick at which the retention expires, 0 if never */
+  uint64_t expiry_tick;
 
+  struct edsv_retained_evt_list_tag *prev; /* Priority queue links */
   struct edsv_retained_evt_list_tag *next;
+  struct edsv_retained_evt_list_tag *bucket_prev; /* Bucket links */
+  struct edsv_retained_evt_list_tag *bucket_next;
+  struct edsv_retained_evt_list_tag *wheel_prev; /* Wheel slot links */
+  struct edsv_retained_evt_list_tag *wheel_next;
 } EDS_RETAINED_EVT_REC;
 
+/* Iterator over the retained events of a priority, that may match a filter
+ * array. With an exact first filter only the bucket of the filter is walked */
+typedef struct eds_retd_evt_iter_tag {
+  EDS_RETAINED_EVT_REC *rec;
+  uint8_t priority;
+  bool exact;
+  uint32_t hash;
+} EDS_RETD_EVT_ITER;
+
+/* Timing wheel of the retention times of all channels. A single timer is
+ * running while there are events on the wheel */
+typedef struct eds_ret_wheel_tag {
+  EDS_TMR tmr;
+  uint64_t cur_tick; /* Last tick processed */
+  uint32_t num_evts;
+  EDS_RETAINED_EVT_REC *slots[EDS_RET_WHEEL_SLOTS];
+} EDS_RET_WHEEL;
+
 typedef struct subsc_rec_tag {
   uint32_t subscript_id;
   uint32_t chan_id;
@@ -208,6 +243,10 @@ typedef struct eds_worklist_tag {
       *ret_evt_list_head[SA_EVT_LOWEST_PRIORITY + 1]; /* priority queues head */
   EDS_RETAINED_EVT_REC
       *ret_evt_list_tail[SA_EVT_LOWEST_PRIORITY + 1]; /* priority queues tail */
+  NCS_PATRICIA_TREE ret_evt_index; /* Retained events by chan_open_id and *
+                                    * event_id                             */
+  EDS_RETAINED_EVT_REC *ret_evt_bucket_head[EDS_RET_EVT_BUCKETS];
+  EDS_RETAINED_EVT_REC *ret_evt_bucket_tail[EDS_RET_EVT_BUCKETS];
   struct eds_worklist_tag *prev;
   struct eds_worklist_tag *next;
 } EDS_WORKLIST;
@@ -225,6 +264,18 @@ typedef struct eda_down_list_tag {
   struct eda_down_list_tag *next;
 } EDA_DOWN_LIST;
 
+/* EDA instances known through MDS, keyed by MDS dest */
+typedef struct eda_dest_rec_tag {
+  NCS_PATRICIA_NODE pat_node;
+  MDS_DEST dest;
+  MDS_SVC_PVT_SUB_PART_VER svc_pvt_ver; /* MDS subpart version of the EDA */
+  /* Subscriptions of this EDA matched by the event being published */
+  uint32_t num_subs;
+  uint32_t max_subs;
+  EDSV_EDA_EVT_DELIVER_SUB *subs;
+  struct eda_dest_rec_tag *next_match; /* Next EDA with matches */
+} EDA_DEST_REC;
+
 /* List of current nodes in the cluster */
 typedef struct node_info_tag {
   NCS_PATRICIA_NODE pat_node;
@@ -243,6 +294,7 @@ typedef struct eds_cb_tag {
   MDS_DEST vaddr;         /* My identification in MDS                  */
   SaVersionT eds_version; /* The version currently supported           */
   NCS_PATRICIA_TREE eda_reg_list; /* EDA Library instantiation list */
+  NCS_PATRICIA_TREE eda_dest_list; /* EDA instances by MDS dest */
   EDS_WORKLIST *eds_work_list; /* Master publish/subscribe worklist         */
   NCS_PATRICIA_TREE
       eds_cname_list; /* EDS cname tree cname/poniter to worklist node */
@@ -278,6 +330,7 @@ typedef struct eds_cb_tag {
   SaSelectionObjectT imm_sel_obj; /* Selection object to wait for IMM events */
   bool is_impl_set;
   bool fully_initialized;
+  EDS_RET_WHEEL ret_wheel; /* Retention timing wheel */
 } EDS_CB;
 
 #define EDS_INIT_CHAN_RTINFO(wp, chan_create_time) \
@@ -308,6 +361,14 @@ bool eds_eda_entry_valid(EDS_CB *, MDS_DEST);
 
 uint32_t eds_remove_eda_down_rec(EDS_CB *, MDS_DEST);
 
+uint32_t eds_add_eda_dest_rec(EDS_CB *, MDS_DEST, MDS_SVC_PVT_SUB_PART_VER);
+
+void eds_remove_eda_dest_rec(EDS_CB *, MDS_DEST);
+
+EDA_DEST_REC *eds_get_eda_dest_rec(EDS_CB *, MDS_DEST);
+
+void eds_remove_eda_dest_recs(EDS_CB *);
+
 uint32_t eds_channel_open(EDS_CB *, uint32_t, uint32_t, uint16_t, uint8_t *,
                           MDS_DEST, uint32_t *, uint32_t *, SaTimeT);
 
@@ -329,10 +390,17 @@ bool eds_pattern_match(SaEvtEventPatternArrayT *, SaEvtEventFilterArrayT *);
 uint32_t eds_store_retained_event(EDS_CB *, EDS_WORKLIST *, CHAN_OPEN_REC *,
                                   EDSV_EDA_PUBLISH_PARAM *, SaTimeT);
 
-uint32_t eds_clear_retained_event(EDS_CB *, uint32_t, uint32_t, uint32_t, bool);
+uint32_t eds_clear_retained_event(EDS_CB *, uint32_t, uint32_t, uint32_t);
 
-void eds_remove_retained_events(EDS_RETAINED_EVT_REC **,
-                                EDS_RETAINED_EVT_REC **);
+uint32_t eds_retd_evt_index_init(EDS_WORKLIST *);
+
+void eds_remove_retained_events(EDS_CB *, EDS_WORKLIST *);
+
+EDS_RETAINED_EVT_REC *eds_retd_evt_first(EDS_WORKLIST *,
+                                         SaEvtEventFilterArrayT *, uint8_t,
+                                         EDS_RETD_EVT_ITER *);
+
+EDS_RETAINED_EVT_REC *eds_retd_evt_next(EDS_RETD_EVT_ITER *);
 
 void eds_dump_event_patterns(SaEvtEventPatternArrayT *);
 
@@ -348,6 +416,11 @@ uint32_t eds_start_tmr(EDS_CB *cb, EDS_TMR *tmr, EDS_TMR_TYPE type,
 void eds_stop_tmr(EDS_TMR *tmr);
 void eds_tmr_exp(void *uarg);
 
+uint32_t eds_ret_wheel_add(EDS_CB *cb, EDS_RETAINED_EVT_REC *evt);
+void eds_ret_wheel_del(EDS_CB *cb, EDS_RETAINED_EVT_REC *evt);
+void eds_ret_wheel_expire(EDS_CB *cb);
+SaTimeT eds_ret_wheel_remaining(EDS_CB *cb, EDS_RETAINED_EVT_REC *evt);
+
 SaBoolT update_node_db(EDS_CB *, NODE_ID, SaBoolT);
 
 void send_clm_status_change(EDS_CB *, SaClmClusterChangesT, NODE_ID);
@@ -849,7 +849,6 @@ uint32_t eds_edu_enc_reten_list(EDS_CB *cb, NCS_UBAID *uba)
 	uint32_t rc = NCSCC_RC_SUCCESS, num_rec = 0;
 	uint8_t *pheader = NULL;
 	EDS_CKPT_HEADER ckpt_hdr;
-	int64_t remaining_time = 0;
 	SaUint8T list_iter;
 	EDS_WORKLIST *wp = NULL;
 	TRACE_ENTER();
@@ -880,7 +879,8 @@ uint32_t eds_edu_enc_reten_list(EDS_CB *cb, NCS_UBAID *uba)
 			    wp->ret_evt_list_head
 				[list_iter]; /* calculate new time and encode */
 			while (ret_rec) {
-				m_EDS_COPY_RETEN_REC(ckpt_reten_rec, ret_rec);
+				m_EDS_COPY_RETEN_REC(cb, ckpt_reten_rec,
+						     ret_rec);
 				if (ret_rec->retentionTime == SA_TIME_MAX) {
 					ckpt_reten_rec->data.retention_time =
 					    SA_TIME_MAX;
@@ -2126,7 +2126,7 @@ uint32_t eds_ckpt_proc_ret_time_clr_rec(EDS_CB *cb, EDS_CKPT_DATA *data)
 	/* Lock the EDS_CB */
 	m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 	rc = eds_clear_retained_event(cb, param->chan_id, param->chan_open_id,
-				      param->event_id, false);
+				      param->event_id);
 
 	/* Unlock the EDS_CB */
 	m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
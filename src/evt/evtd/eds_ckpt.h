@@ -271,7 +271,7 @@ typedef enum eds_ckpt_dec_err {
     rec->data.filter_array = s->filters;      \
   }
 
-#define m_EDS_COPY_RETEN_REC(rec, list)                               \
+#define m_EDS_COPY_RETEN_REC(cb, rec, list)                           \
   {                                                                   \
     rec->pubtime = list->publishTime;                                 \
     rec->data.event_id = list->event_id;                              \
@@ -280,10 +280,7 @@ typedef enum eds_ckpt_dec_err {
     rec->data.chan_open_id = list->retd_evt_chan_open_id;             \
     rec->data.pattern_array = list->patternArray;                     \
     rec->data.priority = list->priority;                              \
-    m_NCS_TMR_MSEC_REMAINING(list->ret_tmr.tmr_id, &remaining_time);  \
-    rec->data.retention_time = (SaTimeT)remaining_time;               \
-    rec->data.retention_time =                                        \
-        rec->data.retention_time * 100000; /*Revisit this */          \
+    rec->data.retention_time = eds_ret_wheel_remaining(cb, list);     \
     rec->data.publisher_name.length = list->publisherName.length;     \
     memcpy(rec->data.publisher_name.value, list->publisherName.value, \
            list->publisherName.length);                               \
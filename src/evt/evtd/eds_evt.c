@@ -504,6 +504,119 @@ static uint32_t eds_proc_chan_unlink_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 	return rc;
 }
 
+/****************************************************************************
+ * Name          : eds_add_deliver_match
+ *
+ * Description   : This is the function which adds a subscription matched
+ *                 by a published event to the matches of the subscriber's
+ *                 EDA, when the EDA takes the event once for all its
+ *                 matching subscriptions.
+ *
+ * Arguments     : cb          - EDS control block.
+ *                 co          - Channel open record of the subscriber.
+ *                 subrec      - Matching subscription.
+ *                 match_dests - List of EDAs with matches.
+ *
+ * Return Values : true if added, false if the event is to be sent for this
+ *                 subscription alone.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static bool eds_add_deliver_match(EDS_CB *cb, CHAN_OPEN_REC *co,
+				  SUBSC_REC *subrec,
+				  EDA_DEST_REC **match_dests)
+{
+	EDA_DEST_REC *dr;
+	EDSV_EDA_EVT_DELIVER_SUB *subs;
+	uint32_t max_subs;
+
+	dr = eds_get_eda_dest_rec(cb, co->chan_opener_dest);
+	if ((dr == NULL) ||
+	    (dr->svc_pvt_ver < EDS_EDA_DELIVER_MULTI_SUBPART_VER))
+		return false;
+
+	if (dr->num_subs == dr->max_subs) {
+		max_subs = (dr->max_subs != 0) ? dr->max_subs * 2 : 8;
+		if (NULL == (subs = m_MMGR_ALLOC_EDSV_DELIVER_SUBS(max_subs))) {
+			LOG_CR("malloc failed for subscription matches");
+			return false;
+		}
+		if (dr->subs != NULL) {
+			memcpy(subs, dr->subs,
+			       dr->num_subs * sizeof(EDSV_EDA_EVT_DELIVER_SUB));
+			m_MMGR_FREE_EDSV_DELIVER_SUBS(dr->subs);
+		}
+		dr->subs = subs;
+		dr->max_subs = max_subs;
+	}
+
+	/* First match of this EDA */
+	if (dr->num_subs == 0) {
+		dr->next_match = *match_dests;
+		*match_dests = dr;
+	}
+
+	dr->subs[dr->num_subs].reg_id = co->reg_id;
+	dr->subs[dr->num_subs].chan_open_id = subrec->chan_open_id;
+	dr->subs[dr->num_subs].sub_id = subrec->subscript_id;
+	dr->num_subs++;
+
+	return true;
+}
+
+/****************************************************************************
+ * Name          : eds_deliver_event_multi
+ *
+ * Description   : This is the function which sends a published event once
+ *                 to each EDA with matching subscriptions. The event is
+ *                 encoded once for all of them.
+ *
+ * Arguments     : cb          - EDS control block.
+ *                 evt         - Publish event that was posted to the EDS
+ *                               Mail box.
+ *                 msg         - Event deliver message of the event.
+ *                 match_dests - List of EDAs with matches.
+ *                 prio        - MDS priority of the event.
+ *
+ * Return Values : None.
+ *
+ * Notes         : The matches of the EDAs are cleared.
+ *****************************************************************************/
+static void eds_deliver_event_multi(EDS_CB *cb, EDSV_EDS_EVT *evt,
+				    EDSV_MSG *msg, EDA_DEST_REC *match_dests,
+				    MDS_SEND_PRIORITY_TYPE prio)
+{
+	EDSV_MSG multi_msg;
+	EDA_DEST_REC *dr;
+	USRBUF *evt_ub;
+
+	/* On failure the event is encoded for each EDA instead */
+	evt_ub =
+	    eds_mds_enc_delv_evt(&msg->info.cbk_info.param.evt_deliver_cbk);
+
+	for (dr = match_dests; dr != NULL; dr = dr->next_match) {
+		m_EDS_EDSV_DELIVER_EVENT_MULTI_CB_MSG_FILL(
+		    multi_msg, *msg, dr->num_subs, dr->subs, evt_ub)
+
+		if (NCSCC_RC_SUCCESS != eds_mds_msg_send(cb, &multi_msg,
+							 &dr->dest, NULL,
+							 prio)) {
+			LOG_ER(
+			    "Event Publish(MDS send) failed. From publisher dest: %" PRIx64
+			    ", To subscriber dest: %" PRIx64
+			    ",on Node_id: %u, subscriptions: %u",
+			    evt->fr_dest, dr->dest,
+			    m_NCS_NODE_ID_FROM_MDS_DEST(dr->dest),
+			    dr->num_subs);
+		}
+
+		dr->num_subs = 0;
+	}
+
+	if (evt_ub != NULL)
+		m_MMGR_FREE_BUFR_LIST(evt_ub);
+}
+
 /****************************************************************************
  * Name          : eds_proc_publish_msg
  *
@@ -530,6 +643,7 @@ static uint32_t eds_proc_publish_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 	time_t time_of_day;
 	EDSV_EDA_PUBLISH_PARAM *publish_param;
 	uint32_t retd_evt_chan_open_id = 0;
+	EDA_DEST_REC *match_dests = NULL;
 	EDS_CKPT_DATA ckpt;
 	publish_param = &(evt->info.msg.info.api_info.param).publish;
 	TRACE_ENTER2("agent dest: %" PRIx64, evt->fr_dest);
@@ -577,6 +691,17 @@ static uint32_t eds_proc_publish_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 	 ** this event now
 	 **/
 
+	/* Fill in the event record to send */
+	m_EDS_EDSV_DELIVER_EVENT_CB_MSG_FILL(
+	    msg, 0, 0, publish_param->chan_id, 0, publish_param->pattern_array,
+	    publish_param->priority, publish_param->publisher_name,
+	    publish_time, publish_param->retention_time,
+	    publish_param->event_id, retd_evt_chan_open_id,
+	    publish_param->data_len, publish_param->data)
+
+	/* Determine evt to MDS priority mapping */
+	prio = edsv_map_ais_prio_to_mds_snd_prio(publish_param->priority);
+
 	/* Go through all chan_open_rec's under this channel */
 	co = (CHAN_OPEN_REC *)ncs_patricia_tree_getnext(&wp->chan_open_rec,
 							(uint8_t *)0);
@@ -586,26 +711,20 @@ static uint32_t eds_proc_publish_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 			/* Does the patterns/filters match? */
 			if (eds_pattern_match(publish_param->pattern_array,
 					      subrec->filters)) {
+				/* Send the event. Only once per match/per
+				 * open_id. EDAs taking it are sent the event
+				 * once for all their matches below.
+				 */
+				if (eds_add_deliver_match(cb, co, subrec,
+							  &match_dests))
+					break;
 
-				/* Fill in the event record to send */
-				m_EDS_EDSV_DELIVER_EVENT_CB_MSG_FILL(
-				    msg, co->reg_id, subrec->subscript_id,
-				    subrec->chan_id, subrec->chan_open_id,
-				    publish_param->pattern_array,
-				    publish_param->priority,
-				    publish_param->publisher_name, publish_time,
-				    publish_param->retention_time,
-				    publish_param->event_id,
-				    retd_evt_chan_open_id,
-				    publish_param->data_len,
-				    publish_param->data)
-
-				    /* Determine evt to MDS priority mapping */
-				    prio = edsv_map_ais_prio_to_mds_snd_prio(
-					publish_param->priority);
+				msg.info.cbk_info.eds_reg_id = co->reg_id;
+				msg.info.cbk_info.param.evt_deliver_cbk.sub_id =
+				    subrec->subscript_id;
+				msg.info.cbk_info.param.evt_deliver_cbk
+				    .chan_open_id = subrec->chan_open_id;
 
-				/* Send the event. Only once per match/per
-				 * open_id */
 				if (NCSCC_RC_SUCCESS !=
 				    (rc = eds_mds_msg_send(
 					 cb, &msg, &co->chan_opener_dest, NULL,
@@ -627,6 +746,9 @@ static uint32_t eds_proc_publish_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 		    &wp->chan_open_rec, (uint8_t *)&co->copen_id_Net);
 	}
 
+	if (match_dests != NULL)
+		eds_deliver_event_multi(cb, evt, &msg, match_dests, prio);
+
 	/** If this event has been retained, send an async update &
 	 ** transfer memory ownership here.
 	 **/
@@ -672,6 +794,7 @@ static uint32_t eds_proc_subscribe_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 	EDSV_EDA_SUBSCRIBE_PARAM *subscribe_param;
 	EDS_WORKLIST *channel_entry;
 	EDS_RETAINED_EVT_REC *retd_evt_rec;
+	EDS_RETD_EVT_ITER iter;
 	MDS_SEND_PRIORITY_TYPE prio;
 	EDSV_MSG msg;
 	EDS_CKPT_DATA ckpt;
@@ -727,8 +850,9 @@ static uint32_t eds_proc_subscribe_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 
 		for (list_iter = SA_EVT_HIGHEST_PRIORITY;
 		     list_iter <= SA_EVT_LOWEST_PRIORITY; list_iter++) {
-			retd_evt_rec =
-			    channel_entry->ret_evt_list_head[list_iter];
+			retd_evt_rec = eds_retd_evt_first(
+			    channel_entry, subscribe_param->filter_array,
+			    list_iter, &iter);
 			while (retd_evt_rec) {
 				if (eds_pattern_match(
 					retd_evt_rec->patternArray,
@@ -766,7 +890,7 @@ static uint32_t eds_proc_subscribe_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 					}
 
 				} /*end pattern match */
-				retd_evt_rec = retd_evt_rec->next;
+				retd_evt_rec = eds_retd_evt_next(&iter);
 			}
 		}
 	}
@@ -859,7 +983,7 @@ static uint32_t eds_proc_retention_time_clr_msg(EDS_CB *cb, EDSV_EDS_EVT *evt)
 	m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 
 	rc = eds_clear_retained_event(cb, param->chan_id, param->chan_open_id,
-				      param->event_id, false);
+				      param->event_id);
 	if (rc != NCSCC_RC_SUCCESS)
 		TRACE("Retained event clear failed");
 
@@ -989,7 +1113,7 @@ static uint32_t eds_proc_eda_misc_msg(EDSV_EDS_EVT *evt)
  * Name          : eds_proc_ret_tmr_exp_evt
  *
  * Description   : This is the function which is called when eds receives any
- *                 a retention tmr expiry evt
+ *                 a retention wheel tmr expiry evt
  *
  * Arguments     : evt  - Evt that was posted to the EDS Mail box.
  *
@@ -999,50 +1123,28 @@ static uint32_t eds_proc_eda_misc_msg(EDSV_EDS_EVT *evt)
  *****************************************************************************/
 static uint32_t eds_proc_ret_tmr_exp_evt(EDSV_EDS_EVT *evt)
 {
-	EDS_RETAINED_EVT_REC *ret_evt;
-	uint32_t rc = NCSCC_RC_SUCCESS;
 	EDS_CB *eds_cb;
 	TRACE_ENTER();
 
-	/* retrieve retained evt */
+	/* retrieve EDS CB */
 	if (NULL == (eds_cb = (EDS_CB *)ncshm_take_hdl(NCS_SERVICE_ID_EDS,
 						       evt->cb_hdl))) {
 		TRACE_LEAVE2("take handle failed for cb");
 		return NCSCC_RC_FAILURE;
 	}
 
-	/* retrieve retained evt */
-	if (NULL == (ret_evt = (EDS_RETAINED_EVT_REC *)ncshm_take_hdl(
-			 NCS_SERVICE_ID_EDS, evt->info.tmr_info.opq_hdl))) {
-		TRACE_LEAVE2("take handle failed for retained evt rec.");
-		return NCSCC_RC_FAILURE;
-	}
-
 	m_NCS_LOCK(&eds_cb->cb_lock, NCS_LOCK_WRITE);
 
-	/** store the chan id as we would need it
-	 ** after the event is freed
-	 **/
-
 	/* CHECKPOINT:
 	   if ( EDS_CB->ha_state == standby)
 		compose a EDSV_CKPT_RETENTION_TIME_CLEAR_MSG and send to standby
 	   peer.
 	*/
-	/** This also frees the event **/
-	rc = eds_clear_retained_event(eds_cb, ret_evt->chan_id,
-				      ret_evt->retd_evt_chan_open_id,
-				      ret_evt->event_id, true);
+	/** Clear all retained events whose retention has expired **/
+	eds_ret_wheel_expire(eds_cb);
 
 	m_NCS_UNLOCK(&eds_cb->cb_lock, NCS_LOCK_WRITE);
 
-	if (NCSCC_RC_SUCCESS != rc) {
-		ncshm_give_hdl(evt->info.tmr_info.opq_hdl);
-		ncshm_give_hdl(evt->cb_hdl);
-		TRACE_LEAVE();
-		return rc;
-	}
-
 	ncshm_give_hdl(evt->cb_hdl);
 	TRACE_LEAVE();
 	return NCSCC_RC_SUCCESS;
@@ -1078,9 +1180,12 @@ static uint32_t eds_proc_eda_updn_mds_msg(EDSV_EDS_EVT *evt)
 	switch (evt->evt_type) {
 	case EDSV_EDS_EVT_EDA_UP:
 		TRACE("Agent UP");
+		eds_add_eda_dest_rec(cb, evt->fr_dest,
+				     evt->info.mds_info.rem_svc_pvt_ver);
 		break;
 	case EDSV_EDS_EVT_EDA_DOWN:
 		TRACE("Agent DOWN");
+		eds_remove_eda_dest_rec(cb, evt->fr_dest);
 		if ((cb->ha_state == SA_AMF_HA_ACTIVE) ||
 		    (cb->ha_state == SA_AMF_HA_QUIESCED)) {
 			/* Remove this EDA entry from our processing lists */
@@ -1296,6 +1401,7 @@ uint32_t eds_process_evt(EDSV_EDS_EVT *evt)
 			TRACE("Event processing failed");
 	} else {
 		if ((evt->evt_type == EDSV_EDS_RET_TIMER_EXP) ||
+		    (evt->evt_type == EDSV_EDS_EVT_EDA_UP) ||
 		    (evt->evt_type == EDSV_EDS_EVT_EDA_DOWN))
 			/** Invoke the evt dispatcher **/
 			eds_edsv_top_level_evt_dispatch_tbl[evt->evt_type](evt);
@@ -62,8 +62,8 @@
  *     |                                           |
  *     v    CHAN_OPEN_REC                          |    EDS_RETAINED_EVT_REC
  *     +----------------------+                    \->+---------------------+
- *     | NCS_PATRICIA_NODE    |                       | event_id            |
- *     | reg_id               |                       | retd_evt_hdl        |
+ *     | NCS_PATRICIA_NODE    |                       | NCS_PATRICIA_NODE   |
+ *     | reg_id               |                       | event_id            |
  *     | chan_id              |                       | priority            |
  *     | chan_open_id         |                       | retentionTime       |
  *     | copen_id_Net         |                       | publishTime         |
@@ -74,7 +74,7 @@
  *                                         |          | retd_chan_open_id   |
  *                           SUBSC_REC     v          | reg_id              |
  *                       +-----------------+          | chan_id             |
- *                       | subscript_id    |          | EDS_TMR             |
+ *                       | subscript_id    |          | expiry_tick         |
  *                       | chan_id         |          | next *              |
  *                       | chan_open_id    |          +---------------------+
  *                       | FilterArray *   |
@@ -477,9 +477,7 @@ uint32_t eds_remove_worklist_entry(EDS_CB *cb, uint32_t chan_id)
 				m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 				/* Make sure all retained events have been
 				 * removed */
-				eds_remove_retained_events(
-				    wp->ret_evt_list_head,
-				    wp->ret_evt_list_tail);
+				eds_remove_retained_events(cb, wp);
 				/* Destroy the patricia tree for channel open
 				 * recs */
 				ncs_patricia_tree_destroy(&wp->chan_open_rec);
@@ -500,9 +498,7 @@ uint32_t eds_remove_worklist_entry(EDS_CB *cb, uint32_t chan_id)
 				m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 				/* Make sure all retained events have been
 				 * removed */
-				eds_remove_retained_events(
-				    wp->ret_evt_list_head,
-				    wp->ret_evt_list_tail);
+				eds_remove_retained_events(cb, wp);
 				/* Destroy the patricia tree for channel open
 				 * recs */
 				ncs_patricia_tree_destroy(&wp->chan_open_rec);
@@ -524,9 +520,7 @@ uint32_t eds_remove_worklist_entry(EDS_CB *cb, uint32_t chan_id)
 				m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 				/* Make sure all retained events have been
 				 * removed */
-				eds_remove_retained_events(
-				    wp->ret_evt_list_head,
-				    wp->ret_evt_list_tail);
+				eds_remove_retained_events(cb, wp);
 				/* Destroy the patricia tree for channel open
 				 * recs */
 				ncs_patricia_tree_destroy(&wp->chan_open_rec);
@@ -938,8 +932,7 @@ static void eds_del_work_list(EDS_CB *cb, EDS_WORKLIST **p_work_list)
 		eds_remove_cname_rec(cb, work_list);
 		*p_work_list = work_list->next;
 
-		eds_remove_retained_events(work_list->ret_evt_list_head,
-					   work_list->ret_evt_list_tail);
+		eds_remove_retained_events(cb, work_list);
 
 		/** We assume that the channel open records must have been
 		** erased
@@ -1156,6 +1149,104 @@ uint32_t eds_remove_eda_down_rec(EDS_CB *cb, MDS_DEST mds_dest)
 	return NCSCC_RC_SUCCESS;
 }
 
+/****************************************************************************
+ *
+ * eds_add_eda_dest_rec
+ *
+ *  Records an EDA instance reported up by MDS, with the MDS subpart version
+ *  it installed. An already known EDA gets the version updated.
+ *
+ ****************************************************************************/
+uint32_t eds_add_eda_dest_rec(EDS_CB *cb, MDS_DEST mds_dest,
+			      MDS_SVC_PVT_SUB_PART_VER svc_pvt_ver)
+{
+	EDA_DEST_REC *rec;
+	TRACE_ENTER2("mds_dest: %" PRIx64 ", version: %u", mds_dest,
+		     svc_pvt_ver);
+
+	if (NULL != (rec = eds_get_eda_dest_rec(cb, mds_dest))) {
+		rec->svc_pvt_ver = svc_pvt_ver;
+		TRACE_LEAVE();
+		return NCSCC_RC_SUCCESS;
+	}
+
+	if (NULL == (rec = m_MMGR_ALLOC_EDA_DEST_REC(sizeof(EDA_DEST_REC)))) {
+		LOG_CR("malloc failed for EDA dest record");
+		TRACE_LEAVE();
+		return NCSCC_RC_OUT_OF_MEM;
+	}
+
+	memset(rec, 0, sizeof(EDA_DEST_REC));
+	rec->dest = mds_dest;
+	rec->svc_pvt_ver = svc_pvt_ver;
+	rec->pat_node.key_info = (uint8_t *)&rec->dest;
+
+	if (NCSCC_RC_SUCCESS !=
+	    ncs_patricia_tree_add(&cb->eda_dest_list, &rec->pat_node)) {
+		LOG_WA("patricia tree add failed for agent dest: %" PRIx64,
+		       mds_dest);
+		m_MMGR_FREE_EDA_DEST_REC(rec);
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	TRACE_LEAVE();
+	return NCSCC_RC_SUCCESS;
+}
+
+/****************************************************************************
+ *
+ * eds_remove_eda_dest_rec
+ *
+ *  Removes the record of an EDA instance reported down by MDS.
+ *
+ ****************************************************************************/
+void eds_remove_eda_dest_rec(EDS_CB *cb, MDS_DEST mds_dest)
+{
+	EDA_DEST_REC *rec;
+	TRACE_ENTER2("mds_dest: %" PRIx64, mds_dest);
+
+	if (NULL != (rec = eds_get_eda_dest_rec(cb, mds_dest))) {
+		ncs_patricia_tree_del(&cb->eda_dest_list, &rec->pat_node);
+		if (rec->subs)
+			m_MMGR_FREE_EDSV_DELIVER_SUBS(rec->subs);
+		m_MMGR_FREE_EDA_DEST_REC(rec);
+	}
+
+	TRACE_LEAVE();
+}
+
+/****************************************************************************
+ *
+ * eds_get_eda_dest_rec
+ *
+ *  Returns the record of the EDA instance at the passed MDS_DEST, NULL if
+ *  MDS has not reported it up.
+ *
+ ****************************************************************************/
+EDA_DEST_REC *eds_get_eda_dest_rec(EDS_CB *cb, MDS_DEST mds_dest)
+{
+	return (EDA_DEST_REC *)ncs_patricia_tree_get(&cb->eda_dest_list,
+						     (uint8_t *)&mds_dest);
+}
+
+/****************************************************************************
+ *
+ * eds_remove_eda_dest_recs
+ *
+ *  Removes the records of all EDA instances. This is only called upon a
+ *  shutdown of EDS.
+ *
+ ****************************************************************************/
+void eds_remove_eda_dest_recs(EDS_CB *cb)
+{
+	EDA_DEST_REC *rec;
+
+	while (NULL != (rec = (EDA_DEST_REC *)ncs_patricia_tree_getnext(
+			    &cb->eda_dest_list, (uint8_t *)0)))
+		eds_remove_eda_dest_rec(cb, rec->dest);
+}
+
 /****************************************************************************
  *
  * eds_remove_regid_by_mds_dest
@@ -1434,7 +1525,6 @@ uint32_t eds_channel_open(EDS_CB *cb, uint32_t reg_id, uint32_t flags,
 	EDS_WORKLIST *wp = NULL;
 	EDS_WORKLIST *prevp = NULL;
 	/* time_t          time_of_day; */
-	SaUint8T list_iter;
 	SaAmfHAStateT ha_state;
 	CHAN_OPEN_REC *co = NULL;
 	uint32_t copen_id_Net;
@@ -1505,11 +1595,11 @@ uint32_t eds_channel_open(EDS_CB *cb, uint32_t reg_id, uint32_t flags,
 			    "SA_AIS_ERR_LIBRARY: channel open patricia tree init failed");
 			return (SA_AIS_ERR_LIBRARY);
 		}
-		/* Initialize retevent list to NULL. Fix */
-		for (list_iter = SA_EVT_HIGHEST_PRIORITY;
-		     list_iter <= SA_EVT_LOWEST_PRIORITY; list_iter++) {
-			wp->ret_evt_list_head[list_iter] = NULL;
-			wp->ret_evt_list_tail[list_iter] = NULL;
+		/* Initialize the retained event lists and index */
+		if (eds_retd_evt_index_init(wp) != NCSCC_RC_SUCCESS) {
+			TRACE_LEAVE2(
+			    "SA_AIS_ERR_LIBRARY: retained event index init failed");
+			return (SA_AIS_ERR_LIBRARY);
 		}
 
 		if (reg_id != 0) {
@@ -1684,11 +1774,11 @@ uint32_t eds_channel_open(EDS_CB *cb, uint32_t reg_id, uint32_t flags,
 		wp->prev = prevp;
 		prevp->next = wp;
 
-		/* Initialize the retained Event List */
-		for (list_iter = SA_EVT_HIGHEST_PRIORITY;
-		     list_iter <= SA_EVT_LOWEST_PRIORITY; list_iter++) {
-			wp->ret_evt_list_head[list_iter] = NULL;
-			wp->ret_evt_list_tail[list_iter] = NULL;
+		/* Initialize the retained event lists and index */
+		if (eds_retd_evt_index_init(wp) != NCSCC_RC_SUCCESS) {
+			TRACE_LEAVE2(
+			    "SA_AIS_ERR_LIBRARY: retained event index init failed");
+			return (SA_AIS_ERR_LIBRARY);
 		}
 
 		if (reg_id != 0) {
@@ -1899,8 +1989,56 @@ uint32_t eds_channel_unlink(EDS_CB *cb, uint32_t chan_name_len,
 					  found. */
 }
 
-static void eds_retd_evt_del(EDS_RETAINED_EVT_REC **, EDS_RETAINED_EVT_REC **,
-			     EDS_RETAINED_EVT_REC *, bool);
+/****************************************************************************
+ *
+ * eds_retd_evt_pattern_hash - Hash of the first pattern of an event, the
+ *                             one compared against the first filter.
+ *
+ ****************************************************************************/
+static uint32_t eds_retd_evt_pattern_hash(const SaUint8T *pattern,
+					  SaSizeT size)
+{
+	uint32_t hash = 2166136261u;
+	SaSizeT i;
+
+	for (i = 0; i < size; i++) {
+		hash ^= pattern[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/****************************************************************************
+ *
+ * eds_retd_evt_index_init - Init the retained event lists and the retained
+ *                           event index of a channel.
+ *
+ ****************************************************************************/
+uint32_t eds_retd_evt_index_init(EDS_WORKLIST *wp)
+{
+	NCS_PATRICIA_PARAMS param;
+	TRACE_ENTER();
+
+	memset(wp->ret_evt_list_head, 0, sizeof(wp->ret_evt_list_head));
+	memset(wp->ret_evt_list_tail, 0, sizeof(wp->ret_evt_list_tail));
+	memset(wp->ret_evt_bucket_head, 0, sizeof(wp->ret_evt_bucket_head));
+	memset(wp->ret_evt_bucket_tail, 0, sizeof(wp->ret_evt_bucket_tail));
+
+	memset(&param, 0, sizeof(NCS_PATRICIA_PARAMS));
+	param.key_size = sizeof(EDS_RETD_EVT_KEY);
+
+	if (NCSCC_RC_SUCCESS !=
+	    ncs_patricia_tree_init(&wp->ret_evt_index, &param)) {
+		TRACE_LEAVE2("patricia tree init failed");
+		return NCSCC_RC_FAILURE;
+	}
+
+	TRACE_LEAVE();
+	return NCSCC_RC_SUCCESS;
+}
+
+static void eds_retd_evt_del(EDS_CB *, EDS_WORKLIST *,
+			     EDS_RETAINED_EVT_REC *);
 /****************************************************************************
  *
  * eds_store_retained_event - Adds an event which has the retention timer set
@@ -1913,7 +2051,8 @@ uint32_t eds_store_retained_event(EDS_CB *cb, EDS_WORKLIST *wp,
 				  SaTimeT orig_publish_time)
 {
 	EDS_RETAINED_EVT_REC *retained_evt = NULL;
-	SaAisErrorT error = NCSCC_RC_SUCCESS;
+	SaEvtEventPatternArrayT *patternArray;
+	uint32_t bucket, rc;
 	TRACE_ENTER2("chan_name: %s", wp->cname);
 
 	retained_evt = m_MMGR_ALLOC_EDS_RETAINED_EVT;
@@ -1927,22 +2066,13 @@ uint32_t eds_store_retained_event(EDS_CB *cb, EDS_WORKLIST *wp,
 
 	memset(retained_evt, '\0', sizeof(EDS_RETAINED_EVT_REC));
 
-	/* create the association with hdl-mngr */
-	if (0 == (retained_evt->retd_evt_hdl = ncshm_create_hdl(
-		      NCS_HM_POOL_ID_COMMON, NCS_SERVICE_ID_EDS,
-		      (NCSCONTEXT)retained_evt))) {
-		m_MMGR_FREE_EDS_RETAINED_EVT(retained_evt);
-		TRACE_LEAVE2("Create handle failed. Freed the retained event");
-		return NCSCC_RC_FAILURE;
-	}
-
 	retained_evt->event_id = publish_param->event_id;
 	retained_evt->priority = publish_param->priority;
 	retained_evt->retentionTime = publish_param->retention_time;
 	retained_evt->publishTime = orig_publish_time;
 
 	/** The following fields are required to delete the event
-	 ** when the timer expires.
+	 ** when the retention expires.
 	 **/
 	if (co) {
 		retained_evt->reg_id = co->reg_id;
@@ -1955,6 +2085,17 @@ uint32_t eds_store_retained_event(EDS_CB *cb, EDS_WORKLIST *wp,
 		    publish_param->chan_open_id;
 	}
 
+	/* Add to the index of the channel */
+	retained_evt->key.chan_open_id = retained_evt->retd_evt_chan_open_id;
+	retained_evt->key.event_id = retained_evt->event_id;
+	retained_evt->pat_node.key_info = (uint8_t *)&retained_evt->key;
+	rc = ncs_patricia_tree_add(&wp->ret_evt_index, &retained_evt->pat_node);
+	if (rc != NCSCC_RC_SUCCESS) {
+		m_MMGR_FREE_EDS_RETAINED_EVT(retained_evt);
+		TRACE_LEAVE2("Retained event already exists");
+		return NCSCC_RC_FAILURE;
+	}
+
 	/* Copy the publisher name */
 	memcpy(retained_evt->publisherName.value,
 	       publish_param->publisher_name.value, SA_MAX_NAME_LENGTH);
@@ -1979,166 +2120,99 @@ uint32_t eds_store_retained_event(EDS_CB *cb, EDS_WORKLIST *wp,
 	} else {
 		wp->ret_evt_list_tail[retained_evt->priority]->next =
 		    retained_evt;
+		retained_evt->prev =
+		    wp->ret_evt_list_tail[retained_evt->priority];
 	}
 	wp->ret_evt_list_tail[retained_evt->priority] = retained_evt;
 
-	/* Start the retention timer now */
-	if (retained_evt->retentionTime != SA_TIME_MAX)
-		error = eds_start_tmr(
-		    cb, &retained_evt->ret_tmr, EDS_RET_EVT_TMR,
-		    retained_evt->retentionTime, retained_evt->retd_evt_hdl);
+	/* Attach to rear of the bucket of the first pattern, the same
+	 * pattern eds_pattern_match() compares with the first filter */
+	patternArray = retained_evt->patternArray;
+	if (patternArray && patternArray->patterns)
+		retained_evt->pattern_hash = eds_retd_evt_pattern_hash(
+		    patternArray->patterns[0].pattern,
+		    patternArray->patterns[0].patternSize);
+	else
+		retained_evt->pattern_hash = eds_retd_evt_pattern_hash(NULL, 0);
+	bucket = retained_evt->pattern_hash & (EDS_RET_EVT_BUCKETS - 1);
+	if (wp->ret_evt_bucket_head[bucket] == NULL) {
+		wp->ret_evt_bucket_head[bucket] = retained_evt;
+	} else {
+		wp->ret_evt_bucket_tail[bucket]->bucket_next = retained_evt;
+		retained_evt->bucket_prev = wp->ret_evt_bucket_tail[bucket];
+	}
+	wp->ret_evt_bucket_tail[bucket] = retained_evt;
+	wp->chan_row.num_ret_evts++;
 
-	if (error != NCSCC_RC_SUCCESS) {
+	/* Put it on the retention wheel now */
+	if (retained_evt->retentionTime != SA_TIME_MAX &&
+	    eds_ret_wheel_add(cb, retained_evt) != NCSCC_RC_SUCCESS) {
 		LOG_ER("event retention timer start failed");
 		/* This will be from eds_evt_destroy flow */
 		retained_evt->patternArray = NULL;
 		retained_evt->data_len = 0;
 		retained_evt->data = NULL;
-		eds_retd_evt_del(&wp->ret_evt_list_head[retained_evt->priority],
-				 &wp->ret_evt_list_tail[retained_evt->priority],
-				 retained_evt, true);
-	} else {
-		wp->chan_row.num_ret_evts++;
-		TRACE("Number of retained events: %u",
-		      wp->chan_row.num_ret_evts);
+		eds_retd_evt_del(cb, wp, retained_evt);
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
 	}
 
+	TRACE("Number of retained events: %u", wp->chan_row.num_ret_evts);
 	TRACE_LEAVE();
-	return error;
+	return NCSCC_RC_SUCCESS;
 }
 
 /****************************************************************************
   Name          : eds_retd_evt_del
 
   Description   : This routine deletes the a retd evt record from
-		  a list of retd events.
+		  the lists, the index and the retention wheel.
 
-  Arguments     : EDS_RETAINED_EVT_REC **list_head
+  Arguments     : EDS_CB *cb
+		  EDS_WORKLIST *wp
 		  EDS_RETAINED_EVT_REC *rm_node
 
   Return Values : None
 
   Notes         :
 ******************************************************************************/
-static void eds_retd_evt_del(EDS_RETAINED_EVT_REC **list_head,
-			     EDS_RETAINED_EVT_REC **list_tail,
-			     EDS_RETAINED_EVT_REC *rm_node, bool give_hdl)
+static void eds_retd_evt_del(EDS_CB *cb, EDS_WORKLIST *wp,
+			     EDS_RETAINED_EVT_REC *rm_node)
 {
-	/* Find the client hdl record in the list of records */
-	EDS_RETAINED_EVT_REC *list_iter = *list_head;
+	uint32_t bucket = rm_node->pattern_hash & (EDS_RET_EVT_BUCKETS - 1);
 	TRACE_ENTER();
 
-	/* If the to be removed record is the first record */
-	if (list_iter == rm_node) {
-		/* If this is the last node then modify the tail pointer */
-		if (*list_tail == rm_node)
-			*list_tail = NULL;
-
-		*list_head = rm_node->next;
-		/* Free memory associated with this event */
-		edsv_free_evt_pattern_array(rm_node->patternArray);
-		if (rm_node->data)
-			m_MMGR_FREE_EDSV_EVENT_DATA(rm_node->data);
-
-		/* Give the ret evt hdl if it was taken */
-		if (give_hdl)
-			ncshm_give_hdl(rm_node->retd_evt_hdl);
-
-		/* Gotta destroy the hdl anyway */
-		ncshm_destroy_hdl(NCS_SERVICE_ID_EDS, rm_node->retd_evt_hdl);
-
-		/* "STOP" the retention timer only if trigger is thro'
-		 * saEvtEventRetentionTimeClear api.
-		 * In the timer expiry case, stopping and clearing
-		 * timer resources is getting done automatically.
-		 */
-		if (!give_hdl)
-			eds_stop_tmr(&rm_node->ret_tmr);
-
-		m_MMGR_FREE_EDS_RETAINED_EVT(rm_node);
-		TRACE_LEAVE();
-		return;
-	} else { /* find the rec */
-
-		while (NULL != list_iter) {
-			if (list_iter->next == rm_node) {
-				/* If this is the last node then modify the tail
-				 * pointer */
-				if (*list_tail == rm_node)
-					*list_tail = list_iter;
-
-				list_iter->next = rm_node->next;
-				/* Free memory associated with this event */
-				edsv_free_evt_pattern_array(
-				    rm_node->patternArray);
-				if (rm_node->data)
-					m_MMGR_FREE_EDSV_EVENT_DATA(
-					    rm_node->data);
-
-				/* Give the ret evt hdl if it was taken */
-				if (give_hdl)
-					ncshm_give_hdl(rm_node->retd_evt_hdl);
-
-				/* Gotta destroy the hdl anyway */
-				ncshm_destroy_hdl(NCS_SERVICE_ID_EDS,
-						  rm_node->retd_evt_hdl);
-
-				/* stop the retention timer */
-				if (!give_hdl)
-					eds_stop_tmr(&rm_node->ret_tmr);
-
-				m_MMGR_FREE_EDS_RETAINED_EVT(rm_node);
-
-				TRACE_LEAVE();
-				return;
-			}
-
-			/* move onto the next one */
-			list_iter = list_iter->next;
-		}
-	}
-
+	/* Unlink from the priority queue */
+	if (rm_node->prev)
+		rm_node->prev->next = rm_node->next;
+	else
+		wp->ret_evt_list_head[rm_node->priority] = rm_node->next;
+	if (rm_node->next)
+		rm_node->next->prev = rm_node->prev;
+	else
+		wp->ret_evt_list_tail[rm_node->priority] = rm_node->prev;
+
+	/* Unlink from the bucket */
+	if (rm_node->bucket_prev)
+		rm_node->bucket_prev->bucket_next = rm_node->bucket_next;
+	else
+		wp->ret_evt_bucket_head[bucket] = rm_node->bucket_next;
+	if (rm_node->bucket_next)
+		rm_node->bucket_next->bucket_prev = rm_node->bucket_prev;
+	else
+		wp->ret_evt_bucket_tail[bucket] = rm_node->bucket_prev;
+
+	ncs_patricia_tree_del(&wp->ret_evt_index, &rm_node->pat_node);
+	eds_ret_wheel_del(cb, rm_node);
+	wp->chan_row.num_ret_evts--;
+
+	/* Free memory associated with this event */
+	edsv_free_evt_pattern_array(rm_node->patternArray);
+	if (rm_node->data)
+		m_MMGR_FREE_EDSV_EVENT_DATA(rm_node->data);
+
+	m_MMGR_FREE_EDS_RETAINED_EVT(rm_node);
 	TRACE_LEAVE();
-	return;
-}
-
-/****************************************************************************
-  Name          : eds_find_retd_evt_by_chan_open_id
-
-  Description   : This routine searches a retained event in the
-		  list of events.
-
-  Arguments     : EDS_WORKLIST *wp,
-		  uint32_t chan_open_id,
-		  uint32_t event_id
-
-  Return Values : None
-
-  Notes         :
-******************************************************************************/
-static EDS_RETAINED_EVT_REC *
-eds_find_retd_evt_by_chan_open_id(EDS_WORKLIST *wp, uint32_t chan_open_id,
-				  uint32_t event_id)
-{
-	EDS_RETAINED_EVT_REC *retd_evt;
-	SaUint8T list_iter;
-	TRACE_ENTER2("chan_name: %s, chan_open_id: %u, event_id: %u", wp->cname,
-		     chan_open_id, event_id);
-
-	for (list_iter = SA_EVT_HIGHEST_PRIORITY;
-	     list_iter <= SA_EVT_LOWEST_PRIORITY; list_iter++) {
-		retd_evt = wp->ret_evt_list_head[list_iter];
-		while (retd_evt) {
-			if (retd_evt->retd_evt_chan_open_id == chan_open_id &&
-			    retd_evt->event_id == event_id) {
-				TRACE_LEAVE();
-				return retd_evt;
-			}
-			retd_evt = retd_evt->next;
-		}
-	}
-	TRACE_LEAVE2("record not found");
-	return NULL;
 }
 
 /****************************************************************************
@@ -2148,11 +2222,11 @@ eds_find_retd_evt_by_chan_open_id(EDS_WORKLIST *wp, uint32_t chan_open_id,
  *
  ****************************************************************************/
 uint32_t eds_clear_retained_event(EDS_CB *cb, uint32_t chan_id,
-				  uint32_t chan_open_id, uint32_t event_id,
-				  bool give_hdl)
+				  uint32_t chan_open_id, uint32_t event_id)
 {
 	EDS_WORKLIST *wp;
 	EDS_RETAINED_EVT_REC *retained_evt;
+	EDS_RETD_EVT_KEY key;
 	TRACE_ENTER2("chan_id: %u, chan_open_id: %u", chan_id, chan_open_id);
 
 	/* Get worklist ptr for this chan_id */
@@ -2163,60 +2237,108 @@ uint32_t eds_clear_retained_event(EDS_CB *cb, uint32_t chan_id,
 	}
 	TRACE("chan_name: %s", wp->cname);
 	/** Find and delete the retained event **/
-	if (NULL != (retained_evt = eds_find_retd_evt_by_chan_open_id(
-			 wp, chan_open_id, event_id))) {
-		eds_retd_evt_del(&wp->ret_evt_list_head[retained_evt->priority],
-				 &wp->ret_evt_list_tail[retained_evt->priority],
-				 retained_evt, give_hdl);
-		wp->chan_row.num_ret_evts--;
-		TRACE("Number of retained events: %u",
-		      wp->chan_row.num_ret_evts);
-	} else {
+	memset(&key, 0, sizeof(key));
+	key.chan_open_id = chan_open_id;
+	key.event_id = event_id;
+	retained_evt = (EDS_RETAINED_EVT_REC *)ncs_patricia_tree_get(
+	    &wp->ret_evt_index, (uint8_t *)&key);
+	if (retained_evt == NULL) {
 		TRACE_LEAVE2("SA_AIS_ERR_NOT_EXIST: Retained event not found");
 		return SA_AIS_ERR_NOT_EXIST;
 	}
+	eds_retd_evt_del(cb, wp, retained_evt);
+	TRACE("Number of retained events: %u", wp->chan_row.num_ret_evts);
 	TRACE_LEAVE();
 	return (SA_AIS_OK);
 }
 
 /****************************************************************************
  *
- * eds_remove_retained_events - Removes all retained events attached
- *                              to the specified channel open record.
+ * eds_remove_retained_events - Removes all retained events of the specified
+ *                              channel and destroys its index.
  *
  ****************************************************************************/
-void eds_remove_retained_events(EDS_RETAINED_EVT_REC **p_retd_evt_rec,
-				EDS_RETAINED_EVT_REC **list_tail)
+void eds_remove_retained_events(EDS_CB *cb, EDS_WORKLIST *wp)
 {
-	EDS_RETAINED_EVT_REC *retd_evt_rec;
 	SaUint8T list_iter;
 	TRACE_ENTER();
 
 	for (list_iter = SA_EVT_HIGHEST_PRIORITY;
 	     list_iter <= SA_EVT_LOWEST_PRIORITY; list_iter++) {
-		while (NULL != (retd_evt_rec = *(p_retd_evt_rec + list_iter))) {
+		while (NULL != wp->ret_evt_list_head[list_iter])
+			eds_retd_evt_del(cb, wp,
+					 wp->ret_evt_list_head[list_iter]);
+	}
+	ncs_patricia_tree_destroy(&wp->ret_evt_index);
+	TRACE_LEAVE();
+}
+
+/****************************************************************************
+ *
+ * eds_retd_evt_skip - Skips the retained events of another priority and,
+ *                     for an exact first filter, of another first pattern.
+ *
+ ****************************************************************************/
+static EDS_RETAINED_EVT_REC *eds_retd_evt_skip(EDS_RETD_EVT_ITER *iter)
+{
+	while (iter->rec && (iter->rec->priority != iter->priority ||
+			     iter->rec->pattern_hash != iter->hash))
+		iter->rec = iter->rec->bucket_next;
+	return iter->rec;
+}
 
-			*(p_retd_evt_rec + list_iter) = retd_evt_rec->next;
+/****************************************************************************
+ *
+ * eds_retd_evt_first - Returns the first retained event of a priority that
+ *                      may match the filters. When the first filter is an
+ *                      exact filter only the bucket of its pattern is
+ *                      walked, otherwise the whole priority queue. The
+ *                      events are returned in the order they were retained,
+ *                      and must still be checked with eds_pattern_match().
+ *
+ ****************************************************************************/
+EDS_RETAINED_EVT_REC *eds_retd_evt_first(EDS_WORKLIST *wp,
+					 SaEvtEventFilterArrayT *filterArray,
+					 uint8_t priority,
+					 EDS_RETD_EVT_ITER *iter)
+{
+	SaEvtEventFilterT *filter;
 
-			if (NULL != retd_evt_rec->patternArray)
-				edsv_free_evt_pattern_array(
-				    retd_evt_rec->patternArray);
+	memset(iter, 0, sizeof(*iter));
+	iter->priority = priority;
 
-			if (NULL != retd_evt_rec->data)
-				m_MMGR_FREE_EDSV_EVENT_DATA(retd_evt_rec->data);
+	if (filterArray && filterArray->filtersNumber > 0 &&
+	    filterArray->filters[0].filterType == SA_EVT_EXACT_FILTER) {
+		filter = &filterArray->filters[0];
+		iter->exact = true;
+		iter->hash = eds_retd_evt_pattern_hash(
+		    filter->filter.pattern, filter->filter.patternSize);
+		iter->rec = wp->ret_evt_bucket_head[iter->hash &
+						    (EDS_RET_EVT_BUCKETS - 1)];
+		return eds_retd_evt_skip(iter);
+	}
 
-			ncshm_destroy_hdl(NCS_SERVICE_ID_EDS,
-					  retd_evt_rec->retd_evt_hdl);
+	iter->rec = wp->ret_evt_list_head[priority];
+	return iter->rec;
+}
 
-			/* stop the retention timer */
-			eds_stop_tmr(&retd_evt_rec->ret_tmr);
+/****************************************************************************
+ *
+ * eds_retd_evt_next - Returns the next retained event that may match.
+ *
+ ****************************************************************************/
+EDS_RETAINED_EVT_REC *eds_retd_evt_next(EDS_RETD_EVT_ITER *iter)
+{
+	if (iter->rec == NULL)
+		return NULL;
 
-			m_MMGR_FREE_EDS_RETAINED_EVT(retd_evt_rec);
-			retd_evt_rec = NULL;
-		}
-		*(list_tail + list_iter) = NULL;
+	if (iter->exact) {
+		iter->rec = iter->rec->bucket_next;
+		return eds_retd_evt_skip(iter);
 	}
-	TRACE_LEAVE();
+
+	iter->rec = iter->rec->next;
+	return iter->rec;
 }
 
 /* End eds_ll.c */
@@ -21,7 +21,8 @@
 
 MDS_CLIENT_MSG_FORMAT_VER
 EDS_WRT_EDA_MSG_FMT_ARRAY[EDS_WRT_EDA_SUBPART_VER_RANGE] = {
-    1 /*msg format version for EDA subpart version 1 */
+    1, /*msg format version for EDA subpart version 1 */
+    2  /*msg format version for EDA subpart version 2 */
 };
 
 /****************************************************************************
@@ -811,41 +812,25 @@ static uint32_t eds_enc_chan_open_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 }
 
 /****************************************************************************
-  Name          : eds_enc_delv_evt_cbk_msg
+  Name          : eds_enc_delv_evt
 
-  Description   : This routine encodes an event callback msg
+  Description   : This routine encodes the event of an event callback msg,
+		  i.e. all but the subscription it is delivered to.
 
   Arguments     : NCS_UBAID *msg,
-		  EDSV_MSG *msg
+		  EDSV_EDA_EVT_DELIVER_CBK_PARAM *param
 
   Return Values : uns32
 
   Notes         : None.
 ******************************************************************************/
-static uint32_t eds_enc_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
+static uint32_t eds_enc_delv_evt(NCS_UBAID *uba,
+				 EDSV_EDA_EVT_DELIVER_CBK_PARAM *param)
 {
 	uint8_t *p8;
 	uint32_t x;
 	uint32_t total_bytes = 0;
 	SaEvtEventPatternT *pattern_ptr;
-	EDSV_EDA_EVT_DELIVER_CBK_PARAM *param =
-	    &msg->info.cbk_info.param.evt_deliver_cbk;
-
-	if (uba == NULL) {
-		TRACE_4("uba is NULL");
-		return 0;
-	}
-
-	/* type, reg_id, sub_id, chan_id, chan_open_id */
-	p8 = ncs_enc_reserve_space(uba, 12);
-	if (!p8) {
-		LOG_WA("encode reserve space failed");
-	}
-	ncs_encode_32bit(&p8, param->sub_id);
-	ncs_encode_32bit(&p8, param->chan_id);
-	ncs_encode_32bit(&p8, param->chan_open_id);
-	ncs_enc_claim_space(uba, 12);
-	total_bytes += 12;
 
 	/* Encode the patterns */
 
@@ -942,6 +927,136 @@ static uint32_t eds_enc_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 	return total_bytes;
 }
 
+/****************************************************************************
+  Name          : eds_enc_delv_evt_cbk_msg
+
+  Description   : This routine encodes an event callback msg
+
+  Arguments     : NCS_UBAID *msg,
+		  EDSV_MSG *msg
+
+  Return Values : uns32
+
+  Notes         : None.
+******************************************************************************/
+static uint32_t eds_enc_delv_evt_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
+{
+	uint8_t *p8;
+	uint32_t total_bytes = 0;
+	EDSV_EDA_EVT_DELIVER_CBK_PARAM *param =
+	    &msg->info.cbk_info.param.evt_deliver_cbk;
+
+	if (uba == NULL) {
+		TRACE_4("uba is NULL");
+		return 0;
+	}
+
+	/* sub_id, chan_id, chan_open_id */
+	p8 = ncs_enc_reserve_space(uba, 12);
+	if (!p8) {
+		LOG_WA("encode reserve space failed");
+	}
+	ncs_encode_32bit(&p8, param->sub_id);
+	ncs_encode_32bit(&p8, param->chan_id);
+	ncs_encode_32bit(&p8, param->chan_open_id);
+	ncs_enc_claim_space(uba, 12);
+	total_bytes += 12;
+
+	total_bytes += eds_enc_delv_evt(uba, param);
+
+	return total_bytes;
+}
+
+/****************************************************************************
+  Name          : eds_enc_delv_evt_multi_cbk_msg
+
+  Description   : This routine encodes an event callback msg for all the
+		  matching subscriptions of an EDA.
+
+  Arguments     : NCS_UBAID *msg,
+		  EDSV_MSG *msg
+
+  Return Values : uns32
+
+  Notes         : An event already encoded by eds_mds_enc_delv_evt() is
+		  appended by reference instead of being encoded again.
+******************************************************************************/
+static uint32_t eds_enc_delv_evt_multi_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
+{
+	uint8_t *p8;
+	uint32_t x;
+	uint32_t total_bytes = 0;
+	USRBUF *ub = NULL;
+	EDSV_EDA_EVT_DELIVER_MULTI_CBK_PARAM *param =
+	    &msg->info.cbk_info.param.evt_deliver_multi_cbk;
+
+	if (uba == NULL) {
+		TRACE_4("uba is NULL");
+		return 0;
+	}
+
+	/* chan_id, num_subs */
+	p8 = ncs_enc_reserve_space(uba, 8);
+	if (!p8) {
+		LOG_WA("encode reserve space failed");
+	}
+	ncs_encode_32bit(&p8, param->evt.chan_id);
+	ncs_encode_32bit(&p8, param->num_subs);
+	ncs_enc_claim_space(uba, 8);
+	total_bytes += 8;
+
+	/* reg_id, chan_open_id, sub_id of each subscription */
+	for (x = 0; x < param->num_subs; x++) {
+		p8 = ncs_enc_reserve_space(uba, 12);
+		if (!p8) {
+			LOG_WA("encode reserve space failed");
+		}
+		ncs_encode_32bit(&p8, param->subs[x].reg_id);
+		ncs_encode_32bit(&p8, param->subs[x].chan_open_id);
+		ncs_encode_32bit(&p8, param->subs[x].sub_id);
+		ncs_enc_claim_space(uba, 12);
+		total_bytes += 12;
+	}
+
+	if (param->evt_ub != NULL)
+		ub = m_MMGR_DITTO_BUFR(param->evt_ub);
+	if (ub != NULL) {
+		total_bytes += m_MMGR_LINK_DATA_LEN(ub);
+		ncs_enc_append_usrbuf(uba, ub);
+	} else {
+		total_bytes += eds_enc_delv_evt(uba, &param->evt);
+	}
+
+	return total_bytes;
+}
+
+/****************************************************************************
+  Name          : eds_mds_enc_delv_evt
+
+  Description   : This routine encodes the event of an event callback msg
+		  once, to be sent to several EDAs.
+
+  Arguments     : EDSV_EDA_EVT_DELIVER_CBK_PARAM *param
+
+  Return Values : The encoded event, NULL on failure.
+
+  Notes         : The caller frees the returned USRBUF.
+******************************************************************************/
+USRBUF *eds_mds_enc_delv_evt(EDSV_EDA_EVT_DELIVER_CBK_PARAM *param)
+{
+	NCS_UBAID uba;
+
+	memset(&uba, 0, sizeof(uba));
+	if (ncs_enc_init_space(&uba) != NCSCC_RC_SUCCESS) {
+		LOG_WA("encode init space failed");
+		return NULL;
+	}
+
+	eds_enc_delv_evt(&uba, param);
+
+	return uba.start;
+}
+
 static uint32_t eds_enc_clm_status_cbk_msg(NCS_UBAID *uba, EDSV_MSG *msg)
 {
 	uint8_t *p8;
@@ -1092,6 +1207,9 @@ static uint32_t eds_mds_enc(struct ncsmds_callback_info *info)
 		case EDSV_EDS_DELIVER_EVENT:
 			total_bytes += eds_enc_delv_evt_cbk_msg(uba, msg);
 			break;
+		case EDSV_EDS_DELIVER_EVENT_MULTI:
+			total_bytes += eds_enc_delv_evt_multi_cbk_msg(uba, msg);
+			break;
 		case EDSV_EDS_CLMNODE_STATUS:
 			total_bytes += eds_enc_clm_status_cbk_msg(uba, msg);
 			break;
@@ -1375,7 +1493,8 @@ static uint32_t eds_mds_svc_event(struct ncsmds_callback_info *info)
 
 	/* If this evt was sent from EDA act on this */
 	if (info->info.svc_evt.i_svc_id == NCSMDS_SVC_ID_EDA) {
-		if (info->info.svc_evt.i_change == NCSMDS_DOWN) {
+		if ((info->info.svc_evt.i_change == NCSMDS_DOWN) ||
+		    (info->info.svc_evt.i_change == NCSMDS_UP)) {
 			/* As of now we are only interested in EDA events */
 			if (NULL == (evt = m_MMGR_ALLOC_EDSV_EDS_EVT)) {
 				LOG_CR("malloc failed for EDS event");
@@ -1383,7 +1502,10 @@ static uint32_t eds_mds_svc_event(struct ncsmds_callback_info *info)
 			}
 
 			memset(evt, '\0', sizeof(EDSV_EDS_EVT));
-			evt->evt_type = EDSV_EDS_EVT_EDA_DOWN;
+			if (info->info.svc_evt.i_change == NCSMDS_DOWN)
+				evt->evt_type = EDSV_EDS_EVT_EDA_DOWN;
+			else
+				evt->evt_type = EDSV_EDS_EVT_EDA_UP;
 
 			/** Initialize the Event Header **/
 			evt->cb_hdl = eds_cb_hdl;
@@ -1395,13 +1517,15 @@ static uint32_t eds_mds_svc_event(struct ncsmds_callback_info *info)
 			    info->info.svc_evt.i_node_id;
 			evt->info.mds_info.mds_dest_id =
 			    info->info.svc_evt.i_dest;
+			evt->info.mds_info.rem_svc_pvt_ver =
+			    info->info.svc_evt.i_rem_svc_pvt_ver;
 
 			/* Push the event and we are done */
 			if (m_NCS_IPC_SEND(&eds_cb->mbx, evt,
 					   NCS_IPC_PRIORITY_NORMAL) ==
 			    NCSCC_RC_FAILURE) {
 				LOG_WA(
-				    "Mailbox IPC send failed for eda_down event, from node_id: %u",
+				    "Mailbox IPC send failed for eda up/down event, from node_id: %u",
 				    evt->info.mds_info.node_id);
 				eds_evt_destroy(evt);
 				goto give_hdl;
@@ -32,13 +32,16 @@
 #ifndef EVT_EVTD_EDS_MDS_H_
 #define EVT_EVTD_EDS_MDS_H_
 
-#define EDS_SVC_PVT_SUBPART_VERSION 1
+#define EDS_SVC_PVT_SUBPART_VERSION 2
 #define EDS_WRT_EDA_SUBPART_VER_AT_MIN_MSG_FMT 1
-#define EDS_WRT_EDA_SUBPART_VER_AT_MAX_MSG_FMT 1
+#define EDS_WRT_EDA_SUBPART_VER_AT_MAX_MSG_FMT 2
 #define EDS_WRT_EDA_SUBPART_VER_RANGE       \
   (EDS_WRT_EDA_SUBPART_VER_AT_MAX_MSG_FMT - \
    EDS_WRT_EDA_SUBPART_VER_AT_MIN_MSG_FMT + 1)
 
+/* First EDA subpart version taking EDSV_EDS_DELIVER_EVENT_MULTI */
+#define EDS_EDA_DELIVER_MULTI_SUBPART_VER 2
+
 uint32_t eds_mds_init(EDS_CB *);
 uint32_t eds_mds_vdest_create(EDS_CB *);
 uint32_t eds_mds_finalize(EDS_CB *cb);
@@ -55,6 +58,8 @@ uint32_t eds_dec_subscribe_msg(NCS_UBAID *uba, long msg_hdl, uint8_t ckpt_flag);
 
 uint32_t eds_dec_publish_msg(NCS_UBAID *uba, long msg_hdl, uint8_t ckpt_flag);
 
+USRBUF *eds_mds_enc_delv_evt(EDSV_EDA_EVT_DELIVER_CBK_PARAM *param);
+
 /*****************************************************************************
                  Macros to fill the MDS message structure
 *****************************************************************************/
@@ -163,6 +168,22 @@ uint32_t eds_dec_publish_msg(NCS_UBAID *uba, long msg_hdl, uint8_t ckpt_flag);
     (m).info.cbk_info.param.evt_deliver_cbk.data = (buf);                      \
   } while (0);
 
+/* Macro to populate the 'EVT Event Deliver' callback message sent once to an
+ * EDA for all its matching subscriptions. The event is taken from an
+ * 'EVT Event Deliver' message (dm).
+ */
+#define m_EDS_EDSV_DELIVER_EVENT_MULTI_CB_MSG_FILL(m, dm, nsubs, sublist, ub) \
+  do {                                                                        \
+    memset(&(m), 0, sizeof(EDSV_MSG));                                        \
+    (m).type = EDSV_EDS_CBK_MSG;                                              \
+    (m).info.cbk_info.type = EDSV_EDS_DELIVER_EVENT_MULTI;                    \
+    (m).info.cbk_info.param.evt_deliver_multi_cbk.evt =                       \
+        (dm).info.cbk_info.param.evt_deliver_cbk;                             \
+    (m).info.cbk_info.param.evt_deliver_multi_cbk.num_subs = (nsubs);         \
+    (m).info.cbk_info.param.evt_deliver_multi_cbk.subs = (sublist);           \
+    (m).info.cbk_info.param.evt_deliver_multi_cbk.evt_ub = (ub);              \
+  } while (0);
+
 /* Macro to populate the 'CLM Cluster Node Status' callback message */
 #define m_EDS_EDSV_CLM_STATUS_CB_MSG_FILL(m, cluster_change)               \
   do {                                                                     \
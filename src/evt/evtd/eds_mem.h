@@ -48,6 +48,7 @@ typedef enum {
   NCS_SERVICE_EDS_CNAME_REC,
   NCS_SERVICE_EDA_DOWN_LIST,
   NCS_SERVICE_EDS_CLUSTER_NODE_LIST,
+  NCS_SERVICE_EDA_DEST_REC,
 } NCS_SERVICE_EDS_SUBID;
 
 /****************************************
@@ -162,4 +163,12 @@ typedef enum {
   m_NCS_MEM_FREE(p, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_EDS, \
                  NCS_SERVICE_EDS_CLUSTER_NODE_LIST)
 
+#define m_MMGR_ALLOC_EDA_DEST_REC(size)                                \
+  m_NCS_MEM_ALLOC(size, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_EDS, \
+                  NCS_SERVICE_EDA_DEST_REC)
+
+#define m_MMGR_FREE_EDA_DEST_REC(p)                                \
+  m_NCS_MEM_FREE(p, NCS_MEM_REGION_PERSISTENT, NCS_SERVICE_ID_EDS, \
+                 NCS_SERVICE_EDA_DEST_REC)
+
 #endif  // EVT_EVTD_EDS_MEM_H_
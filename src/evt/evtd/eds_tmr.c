@@ -31,6 +31,7 @@
 
 *******************************************************************************/
 #include "eds.h"
+#include "base/osaf_time.h"
 
 /*****************************************************************************
   PROCEDURE NAME : eds_start_tmr
@@ -206,3 +207,201 @@ void eds_tmr_exp(void *uarg)
 
 	return;
 }
+
+/*****************************************************************************
+  PROCEDURE NAME : eds_ret_wheel_now
+
+  DESCRIPTION    : Returns the current tick of the retention timing wheel.
+
+  ARGUMENTS      : None
+
+  RETURNS        : current tick
+
+  NOTES          : None
+*****************************************************************************/
+static uint64_t eds_ret_wheel_now(void)
+{
+	struct timespec now;
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &now);
+	return osaf_timespec_to_nanos(&now) / EDS_RET_WHEEL_TICK;
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : eds_ret_wheel_add
+
+  DESCRIPTION    : Puts a retained event on the retention timing wheel and
+		   starts the wheel timer if it is not running. The retention
+		   time is rounded up to a whole number of ticks.
+
+  ARGUMENTS      : cb  - ptr to the EDS control block
+		   evt - ptr to the retained event
+
+  RETURNS        : NCSCC_RC_SUCCESS - Success
+		   NCSCC_RC_FAILURE  - Failure
+
+  NOTES          : None
+*****************************************************************************/
+uint32_t eds_ret_wheel_add(EDS_CB *cb, EDS_RETAINED_EVT_REC *evt)
+{
+	EDS_RET_WHEEL *wheel = &cb->ret_wheel;
+	EDS_RETAINED_EVT_REC **slot;
+	uint64_t now = eds_ret_wheel_now();
+
+	if (wheel->num_evts == 0)
+		wheel->cur_tick = now;
+
+	evt->expiry_tick = now + evt->retentionTime / EDS_RET_WHEEL_TICK + 1;
+	if (evt->expiry_tick <= wheel->cur_tick)
+		evt->expiry_tick = wheel->cur_tick + 1;
+
+	slot = &wheel->slots[evt->expiry_tick % EDS_RET_WHEEL_SLOTS];
+	evt->wheel_prev = NULL;
+	evt->wheel_next = *slot;
+	if (*slot)
+		(*slot)->wheel_prev = evt;
+	*slot = evt;
+
+	if (wheel->num_evts++ == 0 &&
+	    eds_start_tmr(cb, &wheel->tmr, EDS_RET_EVT_TMR, EDS_RET_WHEEL_TICK,
+			  0) != NCSCC_RC_SUCCESS) {
+		eds_ret_wheel_del(cb, evt);
+		return NCSCC_RC_FAILURE;
+	}
+	return NCSCC_RC_SUCCESS;
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : eds_ret_wheel_del
+
+  DESCRIPTION    : Takes a retained event off the retention timing wheel and
+		   stops the wheel timer when the wheel is empty.
+
+  ARGUMENTS      : cb  - ptr to the EDS control block
+		   evt - ptr to the retained event
+
+  RETURNS        : void
+
+  NOTES          : Events that are not on the wheel are ignored.
+*****************************************************************************/
+void eds_ret_wheel_del(EDS_CB *cb, EDS_RETAINED_EVT_REC *evt)
+{
+	EDS_RET_WHEEL *wheel = &cb->ret_wheel;
+
+	if (evt->expiry_tick == 0)
+		return;
+
+	if (evt->wheel_prev)
+		evt->wheel_prev->wheel_next = evt->wheel_next;
+	else
+		wheel->slots[evt->expiry_tick % EDS_RET_WHEEL_SLOTS] =
+		    evt->wheel_next;
+	if (evt->wheel_next)
+		evt->wheel_next->wheel_prev = evt->wheel_prev;
+	evt->wheel_prev = evt->wheel_next = NULL;
+	evt->expiry_tick = 0;
+
+	if (--wheel->num_evts == 0)
+		eds_stop_tmr(&wheel->tmr);
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : eds_ret_wheel_expire_slot
+
+  DESCRIPTION    : Clears the retained events of a wheel slot whose retention
+		   expires at or before the given tick.
+
+  ARGUMENTS      : cb   - ptr to the EDS control block
+		   slot - slot number
+		   tick - current tick
+
+  RETURNS        : void
+
+  NOTES          : None
+*****************************************************************************/
+static void eds_ret_wheel_expire_slot(EDS_CB *cb, uint32_t slot,
+				      uint64_t tick)
+{
+	EDS_RETAINED_EVT_REC *evt = cb->ret_wheel.slots[slot];
+	EDS_RETAINED_EVT_REC *next;
+
+	while (evt) {
+		next = evt->wheel_next;
+		/** This also frees the event **/
+		if (evt->expiry_tick <= tick &&
+		    eds_clear_retained_event(cb, evt->chan_id,
+					     evt->retd_evt_chan_open_id,
+					     evt->event_id) != SA_AIS_OK) {
+			/* Not indexed in its channel, never expire it */
+			LOG_WA("Retained event %u not found on channel %u",
+			       evt->event_id, evt->chan_id);
+			eds_ret_wheel_del(cb, evt);
+		}
+		evt = next;
+	}
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : eds_ret_wheel_expire
+
+  DESCRIPTION    : Advances the retention timing wheel up to the current
+		   tick, clearing the retained events that have expired, and
+		   restarts the wheel timer while there are events left.
+
+  ARGUMENTS      : cb - ptr to the EDS control block
+
+  RETURNS        : void
+
+  NOTES          : Called on the wheel timer expiry, with the cb locked.
+*****************************************************************************/
+void eds_ret_wheel_expire(EDS_CB *cb)
+{
+	EDS_RET_WHEEL *wheel = &cb->ret_wheel;
+	uint64_t now = eds_ret_wheel_now();
+	uint32_t slot;
+
+	TRACE_ENTER2("events on wheel: %u", wheel->num_evts);
+
+	if (now - wheel->cur_tick >= EDS_RET_WHEEL_SLOTS) {
+		/* Behind by a full turn, visit every slot once */
+		for (slot = 0; slot < EDS_RET_WHEEL_SLOTS; slot++)
+			eds_ret_wheel_expire_slot(cb, slot, now);
+		wheel->cur_tick = now;
+	}
+	while (wheel->cur_tick < now) {
+		wheel->cur_tick++;
+		eds_ret_wheel_expire_slot(
+		    cb, wheel->cur_tick % EDS_RET_WHEEL_SLOTS, now);
+	}
+
+	if (wheel->num_evts > 0 &&
+	    eds_start_tmr(cb, &wheel->tmr, EDS_RET_EVT_TMR, EDS_RET_WHEEL_TICK,
+			  0) != NCSCC_RC_SUCCESS)
+		LOG_ER("Retention wheel timer start failed");
+
+	TRACE_LEAVE();
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : eds_ret_wheel_remaining
+
+  DESCRIPTION    : Returns the remaining retention time of a retained event.
+
+  ARGUMENTS      : cb  - ptr to the EDS control block
+		   evt - ptr to the retained event
+
+  RETURNS        : remaining time in nanoseconds, SA_TIME_MAX if the event
+		   never expires
+
+  NOTES          : None
+*****************************************************************************/
+SaTimeT eds_ret_wheel_remaining(EDS_CB *cb, EDS_RETAINED_EVT_REC *evt)
+{
+	uint64_t now = eds_ret_wheel_now();
+
+	if (evt->expiry_tick == 0)
+		return SA_TIME_MAX;
+	if (evt->expiry_tick <= now)
+		return 0;
+	return (SaTimeT)(evt->expiry_tick - now) * EDS_RET_WHEEL_TICK;
+}
@@ -29,6 +29,7 @@ This file contains the main() routine for FM.
 #include "base/daemon.h"
 #include "base/logtrace.h"
 #include "base/osaf_extended_name.h"
+#include "base/osaf_failover_timeline.h"
 #include "base/osaf_poll.h"
 #include "base/osaf_time.h"
 #include "fm/fmd/fm.h"
@@ -571,6 +572,8 @@ static void fm_mbx_msg_handler(FM_CB *fm_cb, FM_EVT *fm_mbx_evt) {
       Consensus consensus_service;
       LOG_NO("Current role: %s", role_string[fm_cb->role]);
       if ((fm_mbx_evt->node_id == fm_cb->peer_node_id)) {
+        if (fm_cb->role != PCS_RDA_ACTIVE)
+          osaf_failover_timeline_begin("peer controller down");
         /* Check whether node(AMF) initialization is done */
         if ((fm_cb->csi_assigned == false) &&
             (fm_cb->role != PCS_RDA_ACTIVE)) {
@@ -633,6 +636,7 @@ static void fm_mbx_msg_handler(FM_CB *fm_cb, FM_EVT *fm_mbx_evt) {
                 (fm_cb->amf_state == (SaAmfHAStateT)PCS_RDA_ACTIVE))) {
             fm_cb->role = PCS_RDA_ACTIVE;
             LOG_NO("Controller Failover: Setting role to ACTIVE");
+            osaf_failover_timeline_mark("set role active");
             fm_rda_set_role(fm_cb, PCS_RDA_ACTIVE);
           }
         }
@@ -701,6 +705,7 @@ static void fm_mbx_msg_handler(FM_CB *fm_cb, FM_EVT *fm_mbx_evt) {
           opensaf_reboot(fm_cb->peer_node_id, peer_node_name.c_str(),
                          "Received Node Down for Active peer");
         }
+        osaf_failover_timeline_mark("set role active");
         fm_rda_set_role(fm_cb, PCS_RDA_ACTIVE);
       } else if (fm_mbx_evt->info.fm_tmr->type ==
                  FM_TMR_ACTIVATION_SUPERVISION) {
@@ -739,6 +744,7 @@ static void fm_evt_proc_rda_callback(FM_CB *cb, FM_EVT *evt) {
   TRACE_ENTER2("%d", (int)evt->info.rda_info.role);
   if (evt->info.rda_info.role == PCS_RDA_ACTIVE) {
     LOG_NO("Controller promoted. Stop supervision timer");
+    osaf_failover_timeline_mark("controller promoted");
     fm_tmr_stop(&fm_cb->consensus_service_supervision_tmr);
   }
   if (evt->info.rda_info.role != PCS_RDA_ACTIVE &&
@@ -19,11 +19,21 @@
 #ifndef IMM_AGENT_IMMA_CB_H_
 #define IMM_AGENT_IMMA_CB_H_
 
+#include <map>
 #include <set>
+#include <string>
 
 /* Node to store Ccb info for OI client */
 struct imma_callback_info;
 
+/* Class description cached by saImmOmClassDescriptionGet_2 */
+struct imma_class_descr {
+  SaImmClassCategoryT classCategory;
+  SaImmAttrDefinitionT_2 **attrDefinitions;
+};
+
+typedef std::map<std::string, struct imma_class_descr> IMMA_CLASS_CACHE;
+
 struct imma_oi_ccb_record {
   struct imma_oi_ccb_record *next;
   SaImmOiCcbIdT ccbId; /* High order 32 bits used for PRTO 'pseudo ccbs'.*/
@@ -82,6 +92,7 @@ typedef struct imma_client_node {
   bool isImmA2x10;   /* Version A.02.16 */
   bool isImmA2x11;   /* Version A.02.17 */
   bool isImmA2x12;   /* Version A.02.18 */
+  bool isImmA2x13;   /* Version A.02.19 */
   bool isApplier;    /* True => This is an Applier-OI */
   bool isAug;        /* True => handle internal to OI augmented CCB */
   bool isBusy;       /* True => handle is locked by a thread until a function
@@ -134,6 +145,13 @@ typedef struct imma_ccb_node {
   bool mAugCcb;    /* Current and only mCcbId is an augment. */
   bool
       mAugIsTainted; /* AugCcb has tainted root CCB => apply aug or abort root*/
+  /* Operations streamed by saImmOmCcbObject*Async, not yet sent. Each one is
+     the encoded IMMND event preceded by its size, see IMMSV_OM_CCB_BATCH. */
+  char *mBatchBuf;
+  SaUint32T mBatchSize;
+  SaUint32T mBatchOps;
+  SaUint32T mBatchNo; /* Number of the last batch sent for mCcbId */
+  bool mBatchUnsynced; /* Operations streamed since the last sync */
 } IMMA_CCB_NODE;
 
 /* Node to store Search info */
@@ -196,6 +214,12 @@ typedef struct imma_cb {
   bool immnd_sync_awaited;
   NCS_SEL_OBJ immnd_sync_sel;
   bool clmMemberNode; /* True if the node is CLM Member node */
+
+  /* Class descriptions are only cached when the IMMND notifies the agent
+     of class changes, see IMMA_EVT_ND2A_CLASS_CHANGED. */
+  bool immnd_class_notify;         /* IMMND supports class notifications */
+  uint64_t class_cache_generation; /* Incremented on every invalidation */
+  IMMA_CLASS_CACHE *class_cache;
 } IMMA_CB;
 
 #define m_IMMSV_SET_SANAMET(name)                      \
@@ -300,8 +324,22 @@ SaStringT *imma_getErrorStrings(IMMSV_SAERR_INFO *errRsp);
 
 void imma_client_tree_mark_clmexposed(IMMA_CB *cb);
 
+/* class description cache */
+SaImmAttrDefinitionT_2 **imma_copyAttrDefinitions(
+    SaImmAttrDefinitionT_2 *const *attrDefinitions);
+void imma_freeAttrDefinitions(SaImmAttrDefinitionT_2 **attrDefinitions);
+const struct imma_class_descr *imma_class_cache_get(IMMA_CB *cb,
+                                                    const char *className);
+void imma_class_cache_add(IMMA_CB *cb, const char *className,
+                          SaImmClassCategoryT classCategory,
+                          SaImmAttrDefinitionT_2 *const *attrDefinitions,
+                          uint64_t generation);
+void imma_class_cache_invalidate(IMMA_CB *cb, const char *className);
+
 /*30B Versioning Changes */
 #define IMMA_MDS_PVT_SUBPART_VERSION 1
+/* IMMND subpart version supporting IMMND_EVT_A2ND_CLASS_DESCR_GET_2 */
+#define IMMA_IMMND_CLASS_NOTIFY_SUBPART_VER 2
 /*IMMA - IMMND communication */
 #define IMMA_WRT_IMMND_SUBPART_VER_MIN 1
 #define IMMA_WRT_IMMND_SUBPART_VER_MAX 1
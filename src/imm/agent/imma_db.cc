@@ -1155,6 +1155,10 @@ uint32_t imma_ccb_node_delete(IMMA_CB *cb, IMMA_CCB_NODE *ccb_node) {
   imma_free_errorStrings(ccb_node->mErrorStrings);
   ccb_node->mErrorStrings = NULL;
 
+  /* Streamed operations not sent */
+  free(ccb_node->mBatchBuf);
+  ccb_node->mBatchBuf = NULL;
+
   TRACE("Freeing ccb_node handle %llx ccbid %u", ccb_node->ccb_hdl,
         ccb_node->mCcbId);
   free(ccb_node);
@@ -1416,6 +1420,8 @@ uint32_t imma_db_destroy(IMMA_CB *cb) {
   imma_ccb_tree_destroy(cb);
 
   imma_search_tree_destroy(cb);
+
+  imma_class_cache_invalidate(cb, NULL);
   TRACE_LEAVE();
   return NCSCC_RC_SUCCESS;
 }
@@ -1489,3 +1495,126 @@ void imma_freeSearchAttrs(SaImmAttrValuesT_2 **attr) {
 
   free(attr); /*free-1 */
 }
+
+SaImmAttrDefinitionT_2 **imma_copyAttrDefinitions(
+    SaImmAttrDefinitionT_2 *const *attrDefinitions) {
+  SaImmAttrDefinitionT_2 **attr = NULL;
+  int noOfAttributes = 0;
+  int i;
+
+  while (attrDefinitions[noOfAttributes]) ++noOfAttributes;
+
+  attr = (SaImmAttrDefinitionT_2 **)calloc(
+      noOfAttributes + 1, sizeof(SaImmAttrDefinitionT_2 *)); /*alloc-1 */
+  for (i = 0; i < noOfAttributes; ++i) {
+    const SaImmAttrDefinitionT_2 *q = attrDefinitions[i];
+    attr[i] = (SaImmAttrDefinitionT_2 *)malloc(
+        sizeof(SaImmAttrDefinitionT_2));     /*alloc-2 */
+    attr[i]->attrName = strdup(q->attrName); /*alloc-3 */
+    attr[i]->attrValueType = q->attrValueType;
+    attr[i]->attrFlags = q->attrFlags;
+    attr[i]->attrDefaultValue = NULL;
+    if (q->attrDefaultValue) {
+      IMMSV_EDU_ATTR_VAL tmp;
+      memset(&tmp, 0, sizeof(IMMSV_EDU_ATTR_VAL));
+      imma_copyAttrValue(&tmp, q->attrValueType, q->attrDefaultValue);
+      /* Steals the buffer of tmp, if any. */
+      attr[i]->attrDefaultValue =
+          imma_copyAttrValue3(q->attrValueType, &tmp); /*alloc-4, alloc-5 */
+    }
+  }
+
+  return attr;
+}
+
+void imma_freeAttrDefinitions(SaImmAttrDefinitionT_2 **attrDefinitions) {
+  int i;
+  for (i = 0; attrDefinitions[i]; ++i) {
+    if (attrDefinitions[i]->attrDefaultValue) {
+      imma_freeAttrValue3(
+          attrDefinitions[i]->attrDefaultValue,
+          attrDefinitions[i]->attrValueType); /* free-4, free-5 */
+      attrDefinitions[i]->attrDefaultValue = 0;
+    }
+    free(attrDefinitions[i]->attrName); /*free-3 */
+    attrDefinitions[i]->attrName = 0;
+    free(attrDefinitions[i]); /*free-2 */
+    attrDefinitions[i] = 0;
+  }
+  free(attrDefinitions); /*free-1 */
+}
+
+/****************************************************************************
+  Name          : imma_class_cache_get
+  Description   : Look up a class description in the class cache.
+  Arguments     : cb - IMMA Control Block.
+                  className - The class name.
+  Return Values : The cached description or NULL.
+  Notes         : The caller takes the cb lock before calling this function
+                  and must copy the description before releasing the lock.
+******************************************************************************/
+const struct imma_class_descr *imma_class_cache_get(IMMA_CB *cb,
+                                                    const char *className) {
+  if (!cb->class_cache) return NULL;
+
+  IMMA_CLASS_CACHE::const_iterator it = cb->class_cache->find(className);
+  return (it != cb->class_cache->end()) ? &it->second : NULL;
+}
+
+/****************************************************************************
+  Name          : imma_class_cache_add
+  Description   : Add a copy of a class description to the class cache.
+  Arguments     : cb - IMMA Control Block.
+                  className - The class name.
+                  classCategory, attrDefinitions - The class description
+                  generation - cb->class_cache_generation when the
+                               description was requested from the IMMND.
+  Notes         : The caller takes the cb lock before calling this function.
+                  The description is not cached if the cache was invalidated
+                  while it was fetched, it may then already be out of date.
+******************************************************************************/
+void imma_class_cache_add(IMMA_CB *cb, const char *className,
+                          SaImmClassCategoryT classCategory,
+                          SaImmAttrDefinitionT_2 *const *attrDefinitions,
+                          uint64_t generation) {
+  if (!cb->immnd_class_notify || generation != cb->class_cache_generation) {
+    TRACE("Class %s not cached, cache invalidated", className);
+    return;
+  }
+
+  if (!cb->class_cache) cb->class_cache = new IMMA_CLASS_CACHE;
+
+  struct imma_class_descr &descr = (*cb->class_cache)[className];
+  if (descr.attrDefinitions) imma_freeAttrDefinitions(descr.attrDefinitions);
+  descr.classCategory = classCategory;
+  descr.attrDefinitions = imma_copyAttrDefinitions(attrDefinitions);
+  TRACE("Class %s cached", className);
+}
+
+/****************************************************************************
+  Name          : imma_class_cache_invalidate
+  Description   : Remove a class description from the class cache.
+  Arguments     : cb - IMMA Control Block.
+                  className - The class name, NULL removes all classes.
+  Notes         : The caller takes the cb lock before calling this function
+******************************************************************************/
+void imma_class_cache_invalidate(IMMA_CB *cb, const char *className) {
+  ++cb->class_cache_generation;
+  if (!cb->class_cache) return;
+
+  if (className) {
+    IMMA_CLASS_CACHE::iterator it = cb->class_cache->find(className);
+    if (it != cb->class_cache->end()) {
+      imma_freeAttrDefinitions(it->second.attrDefinitions);
+      cb->class_cache->erase(it);
+      TRACE("Class %s removed from cache", className);
+    }
+    return;
+  }
+
+  for (auto &it : *cb->class_cache) {
+    imma_freeAttrDefinitions(it.second.attrDefinitions);
+  }
+  delete cb->class_cache;
+  cb->class_cache = NULL;
+}
@@ -411,6 +411,9 @@ static uint32_t imma_mds_svc_evt(IMMA_CB *cb,
       }
       locked = true;
       imma_mark_clients_stale(cb, false);
+      /* Class changes are not notified while IMMND is down */
+      cb->immnd_class_notify = false;
+      imma_class_cache_invalidate(cb, NULL);
       m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
       locked = false;
       break;
@@ -438,6 +441,8 @@ static uint32_t imma_mds_svc_evt(IMMA_CB *cb,
         abort();
       }
       locked = true;
+      cb->immnd_class_notify =
+          svc_evt->i_rem_svc_pvt_ver >= IMMA_IMMND_CLASS_NOTIFY_SUBPART_VER;
       /* Check again if some clients have been exposed during down time.
          Also determine if there are candidates for active resurrection.
          Inform IMMND of highest used client id. Increases chances of success
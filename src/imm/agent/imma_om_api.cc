@@ -61,6 +61,7 @@ static int imma_om_resurrect(IMMA_CB *cb, IMMA_CLIENT_NODE *cl_node,
 static SaAisErrorT imma_finalizeCcb(SaImmCcbHandleT ccbHandle,
                                     bool keepCcbHandleOpen);
 static SaAisErrorT imma_applyCcb(SaImmCcbHandleT ccbHandle, bool onlyValidate);
+static void imma_ccb_batch_discard(IMMA_CCB_NODE *ccb_node);
 
 /****************************************************************************
   Name          :  SaImmOmInitialize
@@ -147,6 +148,9 @@ SaAisErrorT saImmOmInitialize_o2(SaImmHandleT *immHandle,
             cl_node->isImmA2x11 = true;
             if (requested_version.minorVersion >= 0x12) {
               cl_node->isImmA2x12 = true;
+              if (requested_version.minorVersion >= 0x13) {
+                cl_node->isImmA2x13 = true;
+              }
             }
           }
         }
@@ -210,6 +214,9 @@ SaAisErrorT saImmOmInitialize(SaImmHandleT *immHandle,
                 cl_node->isImmA2x11 = true;
                 if (requested_version.minorVersion >= 0x12) {
                   cl_node->isImmA2x12 = true;
+                  if (requested_version.minorVersion >= 0x13) {
+                    cl_node->isImmA2x13 = true;
+                  }
                 }
               }
             }
@@ -1362,6 +1369,7 @@ mds_send_fail:
   if (rc == SA_AIS_OK) {
     ccb_node->mApplied = false;
     ccb_node->mCcbId = ccbId;
+    imma_ccb_batch_discard(ccb_node);
     TRACE("CcbId:%u admin ownerId:%u\n", ccb_node->mCcbId, adminOwnerId);
   }
 
@@ -1628,6 +1636,369 @@ done:
   return rc;
 }
 
+/*******************************************************************
+ * Streamed ccb operations, see saImmOmCcbObjectCreateAsync.
+ *
+ * The operations are encoded as for fevs and collected in the ccb node, each
+ * one preceded by its size in network byte order. A full batch is sent in an
+ * IMMND_EVT_A2ND_CCB_BATCH message without waiting for any reply. The rest
+ * is sent by saImmOmCcbSync, or by the next synchronous call on the ccb,
+ * which waits until all streamed operations are done.
+ *******************************************************************/
+static void imma_ccb_batch_discard(IMMA_CCB_NODE *ccb_node) {
+  free(ccb_node->mBatchBuf);
+  ccb_node->mBatchBuf = NULL;
+  ccb_node->mBatchSize = 0;
+  ccb_node->mBatchOps = 0;
+  ccb_node->mBatchNo = 0;
+  ccb_node->mBatchUnsynced = false;
+}
+
+/* Access to the IMM service objects is checked by the IMMND for each
+   modification, such modifications are not streamed. */
+static bool imma_is_imm_service_object(SaConstStringT objectName) {
+  return objectName &&
+         ((strcmp(objectName, OPENSAF_IMM_OBJECT_DN) == 0) ||
+          (strcmp(objectName, "safRdn=immManagement,safApp=safImmService") ==
+           0));
+}
+
+/*******************************************************************
+ * imma_ccb_batch_send internal function
+ *
+ * Sends a batch of streamed operations and frees the buffer. The batch is
+ * sent asynchronously if o_evt is NULL.
+ *
+ * NOTE: The CB must be LOCKED on entry of this function!!
+ *       It will usually be unlocked on exit, as reflected in the 'locked'
+ *       parameter.
+ *******************************************************************/
+static SaAisErrorT imma_ccb_batch_send(IMMA_CB *cb, SaUint32T ccbId,
+                                       SaUint32T batchNo, SaUint32T numOps,
+                                       char *buf, SaUint32T size,
+                                       IMMSV_EVT **o_evt, SaTimeT timeout,
+                                       SaImmHandleT immHandle, bool *locked) {
+  IMMSV_EVT evt;
+  SaAisErrorT rc;
+
+  TRACE("Sending batch %u of ccb %u with %u operations", batchNo, ccbId,
+        numOps);
+
+  memset(&evt, 0, sizeof(IMMSV_EVT));
+  evt.type = IMMSV_EVT_TYPE_IMMND;
+  evt.info.immnd.type = IMMND_EVT_A2ND_CCB_BATCH;
+  evt.info.immnd.info.ccbBatch.ccbId = ccbId;
+  evt.info.immnd.info.ccbBatch.batchNo = batchNo;
+  evt.info.immnd.info.ccbBatch.numOps = numOps;
+  evt.info.immnd.info.ccbBatch.replyWanted = (o_evt != NULL);
+  evt.info.immnd.info.ccbBatch.ops.size = size;
+  evt.info.immnd.info.ccbBatch.ops.buf = buf;
+
+  rc = imma_evt_fake_evs(cb, &evt, o_evt, timeout, immHandle, locked, false);
+  free(buf);
+
+  return rc;
+}
+
+/*******************************************************************
+ * imma_ccb_stream_op internal function
+ *
+ * Appends an operation to the batch of the ccb and sends the batch if it is
+ * full. The outcome of the operation is known after the next sync.
+ *
+ * NOTE: The CB must be LOCKED on entry of this function!!
+ *       It may be unlocked on exit, as reflected in the 'locked'
+ *       parameter.
+ *******************************************************************/
+static SaAisErrorT imma_ccb_stream_op(IMMA_CB *cb, IMMA_CCB_NODE *ccb_node,
+                                      IMMSV_EVT *evt, SaImmHandleT immHandle,
+                                      bool *locked) {
+  SaAisErrorT rc = SA_AIS_OK;
+  uint32_t proc_rc;
+  NCS_UBAID uba;
+  uba.start = NULL;
+  SaUint32T size;
+  char *sendBuf = NULL;
+  SaUint32T sendSize = 0;
+  SaUint32T sendOps = 0;
+  uint8_t *p8;
+  char *data;
+
+  osafassert(locked && (*locked));
+
+  if (ncs_enc_init_space(&uba) != NCSCC_RC_SUCCESS) {
+    TRACE_2("ERR_LIBRARY: Failed init ubaid");
+    return SA_AIS_ERR_LIBRARY;
+  }
+
+  proc_rc = immsv_evt_enc(evt, &uba);
+  if (proc_rc == NCSCC_RC_NO_OBJECT) {
+    TRACE_2("ERR_NO_RESOURCES: Failed to pre-pack");
+    rc = SA_AIS_ERR_NO_RESOURCES;
+    goto done;
+  }
+
+  if (proc_rc != NCSCC_RC_SUCCESS) {
+    TRACE_2("ERR_LIBRARY: Failed to pre-pack");
+    rc = SA_AIS_ERR_LIBRARY;
+    goto done;
+  }
+
+  size = uba.ttl;
+  if (ccb_node->mBatchOps &&
+      (ccb_node->mBatchSize + 4 + size > IMMSV_MAX_CCB_BATCH_SIZE)) {
+    /* The operation starts the next batch */
+    sendBuf = ccb_node->mBatchBuf;
+    sendSize = ccb_node->mBatchSize;
+    sendOps = ccb_node->mBatchOps;
+    ccb_node->mBatchBuf = NULL;
+    ccb_node->mBatchSize = 0;
+    ccb_node->mBatchOps = 0;
+  }
+
+  ccb_node->mBatchBuf =
+      (char *)realloc(ccb_node->mBatchBuf, ccb_node->mBatchSize + 4 + size);
+  osafassert(ccb_node->mBatchBuf);
+  p8 = (uint8_t *)ccb_node->mBatchBuf + ccb_node->mBatchSize;
+  ncs_encode_32bit(&p8, size);
+  data = m_MMGR_DATA_AT_START(uba.start, size, (char *)p8);
+  if (data != (char *)p8) {
+    memcpy(p8, data, size);
+  }
+  ccb_node->mBatchSize += 4 + size;
+  ++(ccb_node->mBatchOps);
+  ccb_node->mBatchUnsynced = true;
+
+  if (!sendBuf && ccb_node->mBatchOps >= IMMSV_MAX_OPS_IN_CCB_BATCH) {
+    sendBuf = ccb_node->mBatchBuf;
+    sendSize = ccb_node->mBatchSize;
+    sendOps = ccb_node->mBatchOps;
+    ccb_node->mBatchBuf = NULL;
+    ccb_node->mBatchSize = 0;
+    ccb_node->mBatchOps = 0;
+  }
+
+  if (sendBuf) {
+    rc = imma_ccb_batch_send(cb, ccb_node->mCcbId, ++(ccb_node->mBatchNo),
+                             sendOps, sendBuf, sendSize, NULL, 0, immHandle,
+                             locked);
+    if (rc != SA_AIS_OK) {
+      /* The operations sent are lost */
+      TRACE_3("ERR_FAILED_OPERATION: Sending streamed operations failed: %u",
+              rc);
+      rc = SA_AIS_ERR_FAILED_OPERATION;
+    }
+  }
+
+done:
+  if (uba.start) {
+    m_MMGR_FREE_BUFR_LIST(uba.start);
+  }
+
+  return rc;
+}
+
+/****************************************************************************
+  Name          :  saImmOmCcbSync
+
+  Description   :  Waits until all operations streamed to the ccb by the
+                   saImmOmCcbObject*Async functions are done.
+                   This a blocking syncronous call.
+
+  Arguments     :  ccbHandle - Ccb Handle
+
+  Return Values :  SA_AIS_OK - All streamed operations succeeded.
+
+                   SA_AIS_ERR_FAILED_OPERATION - A streamed operation failed
+                   and the ccb is aborted, see saImmOmCcbGetErrorStrings.
+
+                   SA_AIS_ERR_VERSION - Not allowed for IMM API version below
+                   A.02.19.
+
+                   Remaining returncodes as for saImmOmCcbApply.
+******************************************************************************/
+static SaAisErrorT ccb_sync_common(SaImmCcbHandleT ccbHandle,
+                                   bool explicitCall) {
+  SaAisErrorT rc = SA_AIS_OK;
+  IMMA_CB *cb = &imma_cb;
+  IMMSV_EVT *out_evt = NULL;
+  IMMA_CLIENT_NODE *cl_node = NULL;
+  IMMA_CCB_NODE *ccb_node = NULL;
+  bool locked = false;
+  SaImmHandleT immHandle = 0LL;
+  SaStringT *newErrorStrings = NULL;
+  char *buf = NULL;
+  SaUint32T size = 0;
+  SaUint32T numOps = 0;
+  TRACE_ENTER();
+
+  if (cb->sv_id == 0) {
+    TRACE_2("ERR_BAD_HANDLE: No initialized handle exists!");
+    TRACE_LEAVE();
+    return SA_AIS_ERR_BAD_HANDLE;
+  }
+
+  if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
+    rc = SA_AIS_ERR_LIBRARY;
+    TRACE_4("ERR_LIBRARY: Lock failed");
+    goto lock_fail;
+  }
+  locked = true;
+
+  imma_ccb_node_get(&cb->ccb_tree, &ccbHandle, &ccb_node);
+  if (!ccb_node) {
+    rc = SA_AIS_ERR_BAD_HANDLE;
+    TRACE_2("ERR_BAD_HANDLE: Ccb handle not valid");
+    goto done;
+  }
+
+  immHandle = ccb_node->mImmHandle;
+
+  imma_client_node_get(&cb->client_tree, &immHandle, &cl_node);
+  if (!(cl_node && cl_node->isOm)) {
+    rc = SA_AIS_ERR_LIBRARY;
+    TRACE_4("ERR_LIBRARY: SaImmHandleT associated with Ccb is not valid");
+    goto done;
+  }
+
+  if (explicitCall && !cl_node->isImmA2x13) {
+    rc = SA_AIS_ERR_VERSION;
+    TRACE_2(
+        "ERR_VERSION: saImmOmCcbSync only supported for A.02.19 and above");
+    goto done;
+  }
+
+  if (cl_node->isImmA2x12 && cl_node->clmExposed) {
+    TRACE_2("SA_AIS_ERR_UNAVAILABLE: imma CLM node left the cluster");
+    rc = SA_AIS_ERR_UNAVAILABLE;
+    goto done;
+  }
+
+  if (ccb_node->mApplied) {
+    /* Any operations streamed were done by the apply or abort */
+    imma_ccb_batch_discard(ccb_node);
+    goto done;
+  }
+
+  if (!ccb_node->mBatchUnsynced) {
+    goto done;
+  }
+
+  if (ccb_node->mExclusive) {
+    rc = SA_AIS_ERR_TRY_AGAIN;
+    TRACE_3(
+        "ERR_TRY_AGAIN: Ccb-id %u being created or in critical phase, in another thread",
+        ccb_node->mCcbId);
+    goto done;
+  }
+
+  if (ccb_node->mAborted || cl_node->stale) {
+    TRACE_3("ERR_FAILED_OPERATION: CCB %u with streamed operations aborted",
+            ccb_node->mCcbId);
+    ccb_node->mAborted = true;
+    imma_ccb_batch_discard(ccb_node);
+    rc = SA_AIS_ERR_FAILED_OPERATION;
+    goto done;
+  }
+
+  if ((rc = imma_proc_increment_pending_reply(cl_node, true)) != SA_AIS_OK) {
+    TRACE_4("ERR_LIBRARY: Overlapping use of IMM handle by multiple threads");
+    goto done;
+  }
+
+  buf = ccb_node->mBatchBuf;
+  size = ccb_node->mBatchSize;
+  numOps = ccb_node->mBatchOps;
+  ccb_node->mBatchBuf = NULL;
+  ccb_node->mBatchSize = 0;
+  ccb_node->mBatchOps = 0;
+
+  rc = imma_ccb_batch_send(cb, ccb_node->mCcbId, ++(ccb_node->mBatchNo),
+                           numOps, buf, size, &out_evt, cl_node->syncr_timeout,
+                           cl_node->handle, &locked);
+  cl_node = NULL;
+  ccb_node = NULL;
+
+  TRACE("ccbSync send RETURNED:%u", rc);
+
+  if (out_evt) {
+    /* Process the outcome, note this is after a blocking call. */
+    osafassert(out_evt->type == IMMSV_EVT_TYPE_IMMA);
+    osafassert((out_evt->info.imma.type == IMMA_EVT_ND2A_IMM_ERROR) ||
+               (out_evt->info.imma.type == IMMA_EVT_ND2A_IMM_ERROR_2));
+    if (rc == SA_AIS_OK) {
+      rc = out_evt->info.imma.info.errRsp.error;
+      if (out_evt->info.imma.type == IMMA_EVT_ND2A_IMM_ERROR_2) {
+        newErrorStrings =
+            imma_getErrorStrings(&(out_evt->info.imma.info.errRsp));
+      }
+    }
+    free(out_evt);
+    out_evt = NULL;
+  }
+
+  if (!locked && m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
+    TRACE_4("ERR_LIBRARY: Lock failed");
+    rc = SA_AIS_ERR_LIBRARY;
+    goto lock_fail;
+  }
+  locked = true;
+
+  imma_client_node_get(&cb->client_tree, &immHandle, &cl_node);
+  if (!(cl_node && cl_node->isOm)) {
+    if (rc == SA_AIS_OK) {
+      TRACE_3("ERR_BAD_HANDLE: client_node gone on return from down-call");
+      rc = SA_AIS_ERR_BAD_HANDLE;
+    }
+    goto done;
+  }
+
+  imma_proc_decrement_pending_reply(cl_node, true);
+
+  imma_ccb_node_get(&cb->ccb_tree, &ccbHandle, &ccb_node);
+  if (!ccb_node) {
+    TRACE_3("ERR_BAD_HANDLE: ccb-node gone on return from down call");
+    rc = SA_AIS_ERR_BAD_HANDLE;
+    goto done;
+  }
+
+  imma_free_errorStrings(ccb_node->mErrorStrings);
+  ccb_node->mErrorStrings = newErrorStrings;
+  newErrorStrings = NULL;
+
+  if (rc == SA_AIS_OK && cl_node->stale) {
+    TRACE_3(
+        "ERR_FAILED_OPERATION: Handle %llx became stale "
+        "during the down-call",
+        immHandle);
+    rc = SA_AIS_ERR_FAILED_OPERATION;
+  }
+
+  if (rc == SA_AIS_OK) {
+    ccb_node->mBatchUnsynced = false;
+  } else {
+    /* The streamed operations are lost or failed, the ccb is aborted. The
+       error of the failed operation is in the error strings. */
+    if (rc != SA_AIS_ERR_TIMEOUT && rc != SA_AIS_ERR_BAD_HANDLE) {
+      rc = SA_AIS_ERR_FAILED_OPERATION;
+    }
+    ccb_node->mAborted = true;
+  }
+
+done:
+  imma_free_errorStrings(newErrorStrings);
+
+  if (locked) m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
+
+lock_fail:
+  TRACE_LEAVE();
+  return rc;
+}
+
+SaAisErrorT saImmOmCcbSync(SaImmCcbHandleT ccbHandle) {
+  return ccb_sync_common(ccbHandle, true);
+}
+
 /****************************************************************************
   Name          :  saImmOmCcbObjectCreate/_2
 
@@ -1645,7 +2016,7 @@ done:
 static SaAisErrorT ccb_object_create_common(
     SaImmCcbHandleT ccbHandle, const SaImmClassNameT className,
     const SaNameT *parentName, const SaConstStringT objectName,
-    const SaImmAttrValuesT_2 **attrValues);
+    const SaImmAttrValuesT_2 **attrValues, bool async);
 
 SaAisErrorT saImmOmCcbObjectCreate_2(SaImmCcbHandleT ccbHandle,
                                      const SaImmClassNameT className,
@@ -1657,7 +2028,7 @@ SaAisErrorT saImmOmCcbObjectCreate_2(SaImmCcbHandleT ccbHandle,
   }
 
   return ccb_object_create_common(ccbHandle, className, parentName, NULL,
-                                  attrValues);
+                                  attrValues, false);
 }
 
 SaAisErrorT saImmOmCcbObjectCreate_o3(SaImmCcbHandleT ccbHandle,
@@ -1670,13 +2041,84 @@ SaAisErrorT saImmOmCcbObjectCreate_o3(SaImmCcbHandleT ccbHandle,
   }
 
   return ccb_object_create_common(ccbHandle, className, NULL, objectName,
-                                  attrValues);
+                                  attrValues, false);
+}
+
+/****************************************************************************
+  Name          :  saImmOmCcbObjectCreateAsync
+
+  Description   :  Streams a config object create to the ccb, the call
+                   returns without waiting for the outcome. The operations
+                   streamed are done in order and their outcome is returned
+                   by saImmOmCcbSync, or by the next synchronous call on the
+                   ccb. If one of them fails the ccb is aborted.
+
+  Arguments     :  Same as saImmOmCcbObjectCreate_2.
+
+  Return Values :  SA_AIS_OK - The operation is accepted by the library.
+
+                   SA_AIS_ERR_VERSION - Not allowed for IMM API version below
+                   A.02.19.
+
+                   Remaining returncodes as for saImmOmCcbObjectCreate_2.
+******************************************************************************/
+SaAisErrorT saImmOmCcbObjectCreateAsync(SaImmCcbHandleT ccbHandle,
+                                        const SaImmClassNameT className,
+                                        const SaNameT *parentName,
+                                        const SaImmAttrValuesT_2 **attrValues) {
+  if (attrValues == NULL) {
+    TRACE_2("ERR_INVALID_PARAM: attrValues is NULL");
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  return ccb_object_create_common(ccbHandle, className, parentName, NULL,
+                                  attrValues, true);
+}
+
+/* Check an attribute assigned in an object create against the cached
+   description of the class, as the IMMND would. Rejecting the create here
+   saves the round trip to the IMMND. */
+static SaAisErrorT ccb_object_create_check_attr(
+    const struct imma_class_descr *descr, const SaImmAttrValuesT_2 *attr,
+    SaStringT **errorStrings) {
+  SaImmAttrDefinitionT_2 *const *def = descr->attrDefinitions;
+  for (; *def; ++def) {
+    if (strcmp((*def)->attrName, attr->attrName) == 0) break;
+  }
+
+  if (!*def) {
+    TRACE_2("ERR_NOT_EXIST: attr '%s' not defined", attr->attrName);
+    *errorStrings = (SaStringT *)calloc(2, sizeof(SaStringT));
+    if (*errorStrings &&
+        asprintf(&(*errorStrings)[0],
+                 "IMM: ERR_NOT_EXIST: attr '%s' not defined",
+                 attr->attrName) == -1) {
+      (*errorStrings)[0] = NULL;
+    }
+    return SA_AIS_ERR_NOT_EXIST;
+  }
+
+  if ((*def)->attrValueType != attr->attrValueType) {
+    TRACE_2("ERR_INVALID_PARAM: attr '%s' type missmatch", attr->attrName);
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  if (((*def)->attrFlags & SA_IMM_ATTR_RUNTIME) &&
+      !((*def)->attrFlags & SA_IMM_ATTR_PERSISTENT)) {
+    TRACE_2(
+        "ERR_INVALID_PARAM: attr '%s' is a runtime attribute => "
+        "can not be assigned over OM-API.",
+        attr->attrName);
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  return SA_AIS_OK;
 }
 
 static SaAisErrorT ccb_object_create_common(
     SaImmCcbHandleT ccbHandle, const SaImmClassNameT className,
     const SaNameT *parentName, const SaConstStringT objectName,
-    const SaImmAttrValuesT_2 **attrValues) {
+    const SaImmAttrValuesT_2 **attrValues, bool async) {
   SaAisErrorT rc = SA_AIS_OK;
   IMMA_CB *cb = &imma_cb;
   IMMSV_EVT evt;
@@ -1689,6 +2131,7 @@ static SaAisErrorT ccb_object_create_common(
   SaUint32T adminOwnerId = 0;
   SaStringT *newErrorStrings = NULL;
   size_t parentNameLength = 0;
+  const struct imma_class_descr *classDescr = NULL;
   TRACE_ENTER();
 
   if (cb->sv_id == 0) {
@@ -1719,6 +2162,15 @@ static SaAisErrorT ccb_object_create_common(
     return SA_AIS_ERR_TRY_AGAIN;
   }
 
+  if (!async) {
+    /* The operations streamed before are done first */
+    rc = ccb_sync_common(ccbHandle, false);
+    if (rc != SA_AIS_OK) {
+      TRACE_LEAVE();
+      return rc;
+    }
+  }
+
   /* get the CB Lock */
   if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
     rc = SA_AIS_ERR_LIBRARY;
@@ -1772,6 +2224,20 @@ static SaAisErrorT ccb_object_create_common(
         "A.02.15 and above");
     goto done;
   }
+
+  if (async && !cl_node->isImmA2x13) {
+    rc = SA_AIS_ERR_VERSION;
+    TRACE_2(
+        "ERR_VERSION: saImmOmCcbObjectCreateAsync only supported for "
+        "A.02.19 and above");
+    goto done;
+  }
+
+  if (ccb_node->mAugCcb) {
+    /* Operations in an augmentation are not streamed */
+    async = false;
+  }
+
   if (cl_node->isImmA2x12 && cl_node->clmExposed) {
     TRACE_2("SA_AIS_ERR_UNAVAILABLE: imma CLM node left the cluster");
     rc = SA_AIS_ERR_UNAVAILABLE;
@@ -1981,6 +2447,13 @@ static SaAisErrorT ccb_object_create_common(
   if (attrValues) {
     const SaImmAttrValuesT_2 *attr;
     int i;
+
+    /* Objects of runtime classes are rejected by the IMMND. */
+    classDescr = imma_class_cache_get(cb, className);
+    if (classDescr && classDescr->classCategory != SA_IMM_CLASS_CONFIG) {
+      classDescr = NULL;
+    }
+
     for (i = 0; attrValues[i]; ++i) {
       attr = attrValues[i];
       TRACE("attr:%s \n", attr->attrName);
@@ -2042,6 +2515,11 @@ static SaAisErrorT ccb_object_create_common(
         continue;
       }
 
+      if (classDescr) {
+        rc = ccb_object_create_check_attr(classDescr, attr, &newErrorStrings);
+        if (rc != SA_AIS_OK) goto mds_send_fail;
+      }
+
       /*alloc-3 */
       p = (IMMSV_ATTR_VALUES_LIST *)calloc(1, sizeof(IMMSV_ATTR_VALUES_LIST));
 
@@ -2089,8 +2567,12 @@ static SaAisErrorT ccb_object_create_common(
   }
 
 
-  rc = imma_evt_fake_evs(cb, &evt, &out_evt, cl_node->syncr_timeout,
-                         cl_node->handle, &locked, false);
+  if (async) {
+    rc = imma_ccb_stream_op(cb, ccb_node, &evt, cl_node->handle, &locked);
+  } else {
+    rc = imma_evt_fake_evs(cb, &evt, &out_evt, cl_node->syncr_timeout,
+                           cl_node->handle, &locked, false);
+  }
   cl_node = NULL;
   ccb_node = NULL;
 
@@ -2252,11 +2734,11 @@ lock_fail:
 ******************************************************************************/
 static SaAisErrorT ccb_object_modify_common(
     SaImmCcbHandleT ccbHandle, SaConstStringT objectName,
-    const SaImmAttrModificationT_2 **attrMods, bool bUseString);
+    const SaImmAttrModificationT_2 **attrMods, bool bUseString, bool async);
 
-SaAisErrorT saImmOmCcbObjectModify_2(
+static SaAisErrorT ccb_object_modify_name(
     SaImmCcbHandleT ccbHandle, const SaNameT *objectName,
-    const SaImmAttrModificationT_2 **attrMods) {
+    const SaImmAttrModificationT_2 **attrMods, bool async) {
   bool freeMemory = false;
   SaStringT objectNameStr = NULL;
   SaAisErrorT rc;
@@ -2278,7 +2760,8 @@ SaAisErrorT saImmOmCcbObjectModify_2(
     }
   }
 
-  rc = ccb_object_modify_common(ccbHandle, objectNameStr, attrMods, false);
+  rc = ccb_object_modify_common(ccbHandle, objectNameStr, attrMods, false,
+                                async);
 
   if (freeMemory) {
     free(objectNameStr);
@@ -2287,15 +2770,39 @@ SaAisErrorT saImmOmCcbObjectModify_2(
   return rc;
 }
 
+SaAisErrorT saImmOmCcbObjectModify_2(
+    SaImmCcbHandleT ccbHandle, const SaNameT *objectName,
+    const SaImmAttrModificationT_2 **attrMods) {
+  return ccb_object_modify_name(ccbHandle, objectName, attrMods, false);
+}
+
 SaAisErrorT saImmOmCcbObjectModify_o3(
     SaImmCcbHandleT ccbHandle, SaConstStringT objectName,
     const SaImmAttrModificationT_2 **attrMods) {
-  return ccb_object_modify_common(ccbHandle, objectName, attrMods, true);
+  return ccb_object_modify_common(ccbHandle, objectName, attrMods, true,
+                                  false);
+}
+
+/****************************************************************************
+  Name          :  saImmOmCcbObjectModifyAsync
+
+  Description   :  Streams a config object modify to the ccb, see
+                   saImmOmCcbObjectCreateAsync. Modifications of the IMM
+                   service objects are made synchronously.
+
+  Arguments     :  Same as saImmOmCcbObjectModify_2.
+
+  Return Values :  As for saImmOmCcbObjectCreateAsync.
+******************************************************************************/
+SaAisErrorT saImmOmCcbObjectModifyAsync(
+    SaImmCcbHandleT ccbHandle, const SaNameT *objectName,
+    const SaImmAttrModificationT_2 **attrMods) {
+  return ccb_object_modify_name(ccbHandle, objectName, attrMods, true);
 }
 
 static SaAisErrorT ccb_object_modify_common(
     SaImmCcbHandleT ccbHandle, SaConstStringT objectName,
-    const SaImmAttrModificationT_2 **attrMods, bool bUseString) {
+    const SaImmAttrModificationT_2 **attrMods, bool bUseString, bool async) {
   SaAisErrorT rc = SA_AIS_OK;
   IMMA_CB *cb = &imma_cb;
   IMMSV_EVT evt;
@@ -2343,6 +2850,19 @@ static SaAisErrorT ccb_object_modify_common(
     return SA_AIS_ERR_TRY_AGAIN;
   }
 
+  if (async && imma_is_imm_service_object(objectName)) {
+    async = false;
+  }
+
+  if (!async) {
+    /* The operations streamed before are done first */
+    rc = ccb_sync_common(ccbHandle, false);
+    if (rc != SA_AIS_OK) {
+      TRACE_LEAVE();
+      return rc;
+    }
+  }
+
   /* get the CB Lock */
   if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
     rc = SA_AIS_ERR_LIBRARY;
@@ -2396,6 +2916,20 @@ static SaAisErrorT ccb_object_modify_common(
         "A.02.15 and above");
     goto done;
   }
+
+  if (async && !cl_node->isImmA2x13) {
+    rc = SA_AIS_ERR_VERSION;
+    TRACE_2(
+        "ERR_VERSION: saImmOmCcbObjectModifyAsync only supported for "
+        "A.02.19 and above");
+    goto done;
+  }
+
+  if (ccb_node->mAugCcb) {
+    /* Operations in an augmentation are not streamed */
+    async = false;
+  }
+
   if (cl_node->isImmA2x12 && cl_node->clmExposed) {
     TRACE_2("SA_AIS_ERR_UNAVAILABLE: imma CLM node left the cluster");
     rc = SA_AIS_ERR_UNAVAILABLE;
@@ -2619,8 +3153,12 @@ static SaAisErrorT ccb_object_modify_common(
     evt.info.immnd.info.objModify.attrMods = p;
   }
 
-  rc = imma_evt_fake_evs(cb, &evt, &out_evt, cl_node->syncr_timeout,
-                         cl_node->handle, &locked, false);
+  if (async) {
+    rc = imma_ccb_stream_op(cb, ccb_node, &evt, cl_node->handle, &locked);
+  } else {
+    rc = imma_evt_fake_evs(cb, &evt, &out_evt, cl_node->syncr_timeout,
+                           cl_node->handle, &locked, false);
+  }
   cl_node = NULL;
   ccb_node = NULL;
 
@@ -2772,10 +3310,11 @@ lock_fail:
 ******************************************************************************/
 static SaAisErrorT ccb_object_delete_common(SaImmCcbHandleT ccbHandle,
                                             SaConstStringT objectName,
-                                            bool bUseString);
+                                            bool bUseString, bool async);
 
-SaAisErrorT saImmOmCcbObjectDelete(SaImmCcbHandleT ccbHandle,
-                                   const SaNameT *objectName) {
+static SaAisErrorT ccb_object_delete_name(SaImmCcbHandleT ccbHandle,
+                                          const SaNameT *objectName,
+                                          bool async) {
   bool freeMemory = false;
   SaStringT objectNameStr = NULL;
   SaAisErrorT rc;
@@ -2797,7 +3336,7 @@ SaAisErrorT saImmOmCcbObjectDelete(SaImmCcbHandleT ccbHandle,
     }
   }
 
-  rc = ccb_object_delete_common(ccbHandle, objectNameStr, false);
+  rc = ccb_object_delete_common(ccbHandle, objectNameStr, false, async);
 
   if (freeMemory) {
     free(objectNameStr);
@@ -2806,14 +3345,34 @@ SaAisErrorT saImmOmCcbObjectDelete(SaImmCcbHandleT ccbHandle,
   return rc;
 }
 
+SaAisErrorT saImmOmCcbObjectDelete(SaImmCcbHandleT ccbHandle,
+                                   const SaNameT *objectName) {
+  return ccb_object_delete_name(ccbHandle, objectName, false);
+}
+
 SaAisErrorT saImmOmCcbObjectDelete_o3(SaImmCcbHandleT ccbHandle,
                                       SaConstStringT objectName) {
-  return ccb_object_delete_common(ccbHandle, objectName, true);
+  return ccb_object_delete_common(ccbHandle, objectName, true, false);
+}
+
+/****************************************************************************
+  Name          :  saImmOmCcbObjectDeleteAsync
+
+  Description   :  Streams a config object delete to the ccb, see
+                   saImmOmCcbObjectCreateAsync.
+
+  Arguments     :  Same as saImmOmCcbObjectDelete.
+
+  Return Values :  As for saImmOmCcbObjectCreateAsync.
+******************************************************************************/
+SaAisErrorT saImmOmCcbObjectDeleteAsync(SaImmCcbHandleT ccbHandle,
+                                        const SaNameT *objectName) {
+  return ccb_object_delete_name(ccbHandle, objectName, true);
 }
 
 static SaAisErrorT ccb_object_delete_common(SaImmCcbHandleT ccbHandle,
                                             SaConstStringT objectName,
-                                            bool bUseString) {
+                                            bool bUseString, bool async) {
   SaAisErrorT rc = SA_AIS_OK;
   IMMA_CB *cb = &imma_cb;
   IMMSV_EVT evt;
@@ -2848,6 +3407,15 @@ static SaAisErrorT ccb_object_delete_common(SaImmCcbHandleT ccbHandle,
     return SA_AIS_ERR_TRY_AGAIN;
   }
 
+  if (!async) {
+    /* The operations streamed before are done first */
+    rc = ccb_sync_common(ccbHandle, false);
+    if (rc != SA_AIS_OK) {
+      TRACE_LEAVE();
+      return rc;
+    }
+  }
+
   /* get the CB Lock */
   if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
     rc = SA_AIS_ERR_LIBRARY;
@@ -2900,6 +3468,20 @@ static SaAisErrorT ccb_object_delete_common(SaImmCcbHandleT ccbHandle,
         "A.02.15 and above");
     goto done;
   }
+
+  if (async && !cl_node->isImmA2x13) {
+    rc = SA_AIS_ERR_VERSION;
+    TRACE_2(
+        "ERR_VERSION: saImmOmCcbObjectDeleteAsync only supported for "
+        "A.02.19 and above");
+    goto done;
+  }
+
+  if (ccb_node->mAugCcb) {
+    /* Operations in an augmentation are not streamed */
+    async = false;
+  }
+
   if (cl_node->isImmA2x12 && cl_node->clmExposed) {
     TRACE_2("SA_AIS_ERR_UNAVAILABLE: imma CLM node left the cluster");
     rc = SA_AIS_ERR_UNAVAILABLE;
@@ -3057,8 +3639,12 @@ static SaAisErrorT ccb_object_delete_common(SaImmCcbHandleT ccbHandle,
   evt.info.immnd.info.objDelete.objectName.size = strlen(objectName) + 1;
   evt.info.immnd.info.objDelete.objectName.buf = (char *)objectName;
 
-  rc = imma_evt_fake_evs(cb, &evt, &out_evt, cl_node->syncr_timeout,
-                         cl_node->handle, &locked, false);
+  if (async) {
+    rc = imma_ccb_stream_op(cb, ccb_node, &evt, cl_node->handle, &locked);
+  } else {
+    rc = imma_evt_fake_evs(cb, &evt, &out_evt, cl_node->syncr_timeout,
+                           cl_node->handle, &locked, false);
+  }
   cl_node = NULL;
   ccb_node = NULL;
 
@@ -3203,6 +3789,13 @@ SaAisErrorT imma_applyCcb(SaImmCcbHandleT ccbHandle, bool onlyValidate) {
      An apply would not be the first op for a ccb-id.
    */
 
+  /* The operations streamed before are done first */
+  rc = ccb_sync_common(ccbHandle, false);
+  if (rc != SA_AIS_OK) {
+    TRACE_LEAVE();
+    return rc;
+  }
+
   /* get the CB Lock */
   if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
     rc = SA_AIS_ERR_LIBRARY;
@@ -5235,6 +5828,10 @@ SaAisErrorT saImmOmClassDescriptionGet_2(
   IMMSV_EVT *out_evt = NULL;
   IMMA_CLIENT_NODE *cl_node = NULL;
   SaTimeT timeout = 0;
+  const struct imma_class_descr *cached = NULL;
+  bool cacheable = false;
+  bool fetched = false;
+  uint64_t generation = 0;
 
   if (cb->sv_id == 0) {
     TRACE_2("ERR_BAD_HANDLE: No initialized handle exists!");
@@ -5299,6 +5896,14 @@ SaAisErrorT saImmOmClassDescriptionGet_2(
     TRACE_1("Reactive resurrect of handle %llx succeeded", immHandle);
   }
 
+  cached = imma_class_cache_get(cb, className);
+  if (cached) {
+    TRACE("Class %s found in cache", className);
+    *classCategory = cached->classCategory;
+    *attrDefinition = imma_copyAttrDefinitions(cached->attrDefinitions);
+    goto cache_hit;
+  }
+
   if ((rc = imma_proc_increment_pending_reply(cl_node, true)) != SA_AIS_OK) {
     TRACE_4("ERR_LIBRARY: Overlapping use of IMM handle by multiple threads");
     goto bad_sync;
@@ -5307,7 +5912,13 @@ SaAisErrorT saImmOmClassDescriptionGet_2(
   /* Populate the ClassDescriptionGet event */
   memset(&evt, 0, sizeof(IMMSV_EVT));
   evt.type = IMMSV_EVT_TYPE_IMMND;
-  evt.info.immnd.type = IMMND_EVT_A2ND_CLASS_DESCR_GET;
+  /* The reply can only be cached if the IMMND notifies this agent when the
+     class is changed. A change notified before the reply arrives increments
+     the generation and the reply is then not cached. */
+  cacheable = cb->immnd_class_notify;
+  generation = cb->class_cache_generation;
+  evt.info.immnd.type = cacheable ? IMMND_EVT_A2ND_CLASS_DESCR_GET_2
+                                  : IMMND_EVT_A2ND_CLASS_DESCR_GET;
 
   evt.info.immnd.info.classDescr.className.size = strlen(className) + 1;
   evt.info.immnd.info.classDescr.className.buf = (char *)malloc(
@@ -5511,6 +6122,7 @@ SaAisErrorT saImmOmClassDescriptionGet_2(
       attr[noOfAttributes] = 0;
 
       *attrDefinition = attr;
+      fetched = true;
       /*Will return a 0 terminated array of pointers to defs */
 
     } /*if (out_evtt->info.imma.type == IMMA_EVT_ND2A_IMM_ERROR){}else{ */
@@ -5556,29 +6168,22 @@ mds_send_fail:
     cl_node->exposed = true;
   }
 
+  if (fetched && cacheable) {
+    imma_class_cache_add(cb, className, *classCategory, *attrDefinition,
+                         generation);
+  }
+
 clm_left:
 client_not_found:
 stale_handle:
 bad_sync:
+cache_hit:
   if (locked) m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 
 lock_fail1:
 
   if (out_evt && rc == SA_AIS_ERR_LIBRARY && *attrDefinition) {
-    SaImmAttrDefinitionT_2 **attr1 = *attrDefinition;
-    int i;
-    for (i = 0; attr1[i]; ++i) {
-      if (attr1[i]->attrDefaultValue) {
-        imma_freeAttrValue3(attr1[i]->attrDefaultValue,
-                            attr1[i]->attrValueType); /* free-4, free-5 */
-        attr1[i]->attrDefaultValue = 0;
-      }
-      free(attr1[i]->attrName); /*free-3 */
-      attr1[i]->attrName = 0;
-      free(attr1[i]); /*free-2 */
-      attr1[i] = 0;
-    }
-    free(attr1); /*free-1 */
+    imma_freeAttrDefinitions(*attrDefinition);
   }
 
 lock_fail:
@@ -5627,20 +6232,7 @@ SaAisErrorT saImmOmClassDescriptionMemoryFree_2(
   }
 
   if (attrDefinition) {
-    int i;
-    for (i = 0; attrDefinition[i]; ++i) {
-      if (attrDefinition[i]->attrDefaultValue) {
-        imma_freeAttrValue3(
-            attrDefinition[i]->attrDefaultValue,
-            attrDefinition[i]->attrValueType); /* free-4, free-5 */
-        attrDefinition[i]->attrDefaultValue = 0;
-      }
-      free(attrDefinition[i]->attrName); /*free-3 */
-      attrDefinition[i]->attrName = 0;
-      free(attrDefinition[i]); /*free-2 */
-      attrDefinition[i] = 0;
-    }
-    free(attrDefinition); /*free-1 */
+    imma_freeAttrDefinitions(attrDefinition);
   }
 
   m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
@@ -6595,6 +7187,13 @@ SaAisErrorT saImmOmCcbObjectRead(SaImmCcbHandleT ccbHandle,
     return SA_AIS_ERR_TRY_AGAIN;
   }
 
+  /* The operations streamed before are done first */
+  rc = ccb_sync_common(ccbHandle, false);
+  if (rc != SA_AIS_OK) {
+    TRACE_LEAVE();
+    return rc;
+  }
+
   /* get the CB Lock */
   if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
     rc = SA_AIS_ERR_LIBRARY;
@@ -6917,6 +7516,124 @@ lock_fail:
   return rc;
 }
 
+/* Fill in an object to sync from the search result. On failure the parts
+   already filled in are left in the object, to be freed by the caller. */
+static SaAisErrorT sync_object_fill(IMMSV_OM_OBJECT_SYNC *obj,
+                                    const SaImmClassNameT className,
+                                    const SaNameT *objectName,
+                                    const SaImmAttrValuesT_2 **attrValues) {
+  osafassert(!osaf_is_extended_name_empty(objectName) &&
+             osaf_is_extended_name_valid(objectName));
+
+  obj->className.size = strlen(className) + 1;
+
+  /*alloc-1 */
+  obj->className.buf = (char *)malloc(obj->className.size);
+  strcpy(obj->className.buf, className);
+
+  obj->objectName.size = osaf_extended_name_length(objectName) + 1;
+
+  /*alloc-2 */
+  obj->objectName.buf = (char *)malloc(obj->objectName.size);
+  memcpy(obj->objectName.buf, osaf_extended_name_borrow(objectName),
+         obj->objectName.size - 1);
+  obj->objectName.buf[obj->objectName.size - 1] = '\0';
+
+  osafassert(obj->attrValues == NULL);
+  const SaImmAttrValuesT_2 *attr;
+  int i;
+  for (i = 0; attrValues[i]; ++i) {
+    attr = attrValues[i];
+
+    if (attr->attrValuesNumber == 0) {
+      /*TRACE("Attribute without values DN:%s ATT:%s, skipped in sync",
+        objectName->value, attr->attrName);*/
+      continue;
+    }
+
+    /*alloc-3 */
+    IMMSV_ATTR_VALUES_LIST *p =
+        (IMMSV_ATTR_VALUES_LIST *)calloc(1, sizeof(IMMSV_ATTR_VALUES_LIST));
+
+    p->n.attrName.size = strlen(attr->attrName) + 1;
+    if (p->n.attrName.size >= IMMSV_MAX_ATTR_NAME_LENGTH) {
+      TRACE_2("ERR_INVALID_PARAM: Attribute name too long: %u",
+              p->n.attrName.size);
+      free(p);
+      p = NULL;
+      return SA_AIS_ERR_INVALID_PARAM;
+    }
+
+    /*alloc-4 */
+    p->n.attrName.buf = (char *)malloc(p->n.attrName.size);
+    strncpy(p->n.attrName.buf, attr->attrName, p->n.attrName.size);
+
+    p->n.attrValuesNumber = attr->attrValuesNumber;
+    p->n.attrValueType = attr->attrValueType;
+
+    const SaImmAttrValueT *avarr = attr->attrValues;
+    /*alloc-5 */
+    imma_copyAttrValue(&(p->n.attrValue), attr->attrValueType, avarr[0]);
+
+    if (attr->attrValuesNumber > 1) {
+      unsigned int numAdded = attr->attrValuesNumber - 1;
+      unsigned int i;
+      for (i = 1; i <= numAdded; ++i) {
+        /*alloc-6 */
+        IMMSV_EDU_ATTR_VAL_LIST *al = (IMMSV_EDU_ATTR_VAL_LIST *)calloc(
+            1, sizeof(IMMSV_EDU_ATTR_VAL_LIST));
+
+        /*alloc-7 */
+        imma_copyAttrValue(&(al->n), attr->attrValueType, avarr[i]);
+        al->next = p->n.attrMoreValues;
+        p->n.attrMoreValues = al;
+      }
+    }
+
+    p->next = obj->attrValues; /* NULL initially */
+    obj->attrValues = p;
+  }
+
+  return SA_AIS_OK;
+}
+
+static void sync_object_free(IMMSV_OM_OBJECT_SYNC *obj) {
+  if (obj->className.buf) { /*free-1 */
+    free(obj->className.buf);
+    obj->className.buf = NULL;
+  }
+
+  if (obj->objectName.buf) { /*free-2 */
+    free(obj->objectName.buf);
+    obj->objectName.buf = NULL;
+  }
+
+  while (obj->attrValues) {
+    IMMSV_ATTR_VALUES_LIST *p = obj->attrValues;
+    obj->attrValues = p->next;
+    p->next = NULL;
+    if (p->n.attrName.buf) { /*free-4 */
+      free(p->n.attrName.buf);
+      p->n.attrName.buf = NULL;
+    }
+
+    immsv_evt_free_att_val(&(p->n.attrValue),
+                           (SaImmValueTypeT)p->n.attrValueType); /*free-5 */
+
+    while (p->n.attrMoreValues) {
+      IMMSV_EDU_ATTR_VAL_LIST *al = p->n.attrMoreValues;
+      p->n.attrMoreValues = al->next;
+      al->next = NULL;
+      immsv_evt_free_att_val(&(al->n),
+                             (SaImmValueTypeT)p->n.attrValueType); /*free-7 */
+
+      free(al); /*free-6 */
+    }
+    p->next = NULL;
+    free(p); /*free-3 */
+  }
+}
+
 SaAisErrorT immsv_sync(SaImmHandleT immHandle, const SaImmClassNameT className,
                        const SaNameT *objectName,
                        const SaImmAttrValuesT_2 **attrValues, void **batchp,
@@ -6991,82 +7708,10 @@ SaAisErrorT immsv_sync(SaImmHandleT immHandle, const SaImmClassNameT className,
 
   /* (attrValues != NULL) Case B or C */
 
-  osafassert(!osaf_is_extended_name_empty(objectName) &&
-             osaf_is_extended_name_valid(objectName));
-
-  evt.info.immnd.info.obj_sync.className.size = strlen(className) + 1;
-
-  /*alloc-1 */
-  evt.info.immnd.info.obj_sync.className.buf =
-      (char *)malloc(evt.info.immnd.info.obj_sync.className.size);
-  strcpy(evt.info.immnd.info.obj_sync.className.buf, className);
-
-  evt.info.immnd.info.obj_sync.objectName.size =
-      osaf_extended_name_length(objectName) + 1;
-
-  /*alloc-2 */
-  evt.info.immnd.info.obj_sync.objectName.buf =
-      (char *)malloc(evt.info.immnd.info.obj_sync.objectName.size);
-  memcpy(evt.info.immnd.info.obj_sync.objectName.buf,
-         osaf_extended_name_borrow(objectName),
-         evt.info.immnd.info.obj_sync.objectName.size - 1);
-  evt.info.immnd.info.obj_sync.objectName
-      .buf[evt.info.immnd.info.obj_sync.objectName.size - 1] = '\0';
-
-  osafassert(evt.info.immnd.info.obj_sync.attrValues == NULL);
-  const SaImmAttrValuesT_2 *attr;
-  int i;
-  for (i = 0; attrValues[i]; ++i) {
-    attr = attrValues[i];
-
-    if (attr->attrValuesNumber == 0) {
-      /*TRACE("Attribute without values DN:%s ATT:%s, skipped in sync",
-        objectName->value, attr->attrName);*/
-      continue;
-    }
-
-    /*alloc-3 */
-    IMMSV_ATTR_VALUES_LIST *p =
-        (IMMSV_ATTR_VALUES_LIST *)calloc(1, sizeof(IMMSV_ATTR_VALUES_LIST));
-
-    p->n.attrName.size = strlen(attr->attrName) + 1;
-    if (p->n.attrName.size >= IMMSV_MAX_ATTR_NAME_LENGTH) {
-      TRACE_2("ERR_INVALID_PARAM: Attribute name too long: %u",
-              p->n.attrName.size);
-      rc = SA_AIS_ERR_INVALID_PARAM;
-      free(p);
-      p = NULL;
-      goto free_data;
-    }
-
-    /*alloc-4 */
-    p->n.attrName.buf = (char *)malloc(p->n.attrName.size);
-    strncpy(p->n.attrName.buf, attr->attrName, p->n.attrName.size);
-
-    p->n.attrValuesNumber = attr->attrValuesNumber;
-    p->n.attrValueType = attr->attrValueType;
-
-    const SaImmAttrValueT *avarr = attr->attrValues;
-    /*alloc-5 */
-    imma_copyAttrValue(&(p->n.attrValue), attr->attrValueType, avarr[0]);
-
-    if (attr->attrValuesNumber > 1) {
-      unsigned int numAdded = attr->attrValuesNumber - 1;
-      unsigned int i;
-      for (i = 1; i <= numAdded; ++i) {
-        /*alloc-6 */
-        IMMSV_EDU_ATTR_VAL_LIST *al = (IMMSV_EDU_ATTR_VAL_LIST *)calloc(
-            1, sizeof(IMMSV_EDU_ATTR_VAL_LIST));
-
-        /*alloc-7 */
-        imma_copyAttrValue(&(al->n), attr->attrValueType, avarr[i]);
-        al->next = p->n.attrMoreValues;
-        p->n.attrMoreValues = al;
-      }
-    }
-
-    p->next = evt.info.immnd.info.obj_sync.attrValues; /* NULL initially */
-    evt.info.immnd.info.obj_sync.attrValues = p;
+  rc = sync_object_fill(&evt.info.immnd.info.obj_sync, className, objectName,
+                        attrValues);
+  if (rc != SA_AIS_OK) {
+    goto free_data;
   }
 
   evt.info.immnd.info.obj_sync.next = batch;
@@ -7156,40 +7801,7 @@ free_data:
   tmp = &(evt.info.immnd.info.obj_sync);
 
   do {
-    if (tmp->className.buf) { /*free-1 */
-      free(tmp->className.buf);
-      tmp->className.buf = NULL;
-    }
-
-    if (tmp->objectName.buf) { /*free-2 */
-      free(tmp->objectName.buf);
-      tmp->objectName.buf = NULL;
-    }
-
-    while (tmp->attrValues) {
-      IMMSV_ATTR_VALUES_LIST *p = tmp->attrValues;
-      tmp->attrValues = p->next;
-      p->next = NULL;
-      if (p->n.attrName.buf) { /*free-4 */
-        free(p->n.attrName.buf);
-        p->n.attrName.buf = NULL;
-      }
-
-      immsv_evt_free_att_val(&(p->n.attrValue),
-                             (SaImmValueTypeT)p->n.attrValueType); /*free-5 */
-
-      while (p->n.attrMoreValues) {
-        IMMSV_EDU_ATTR_VAL_LIST *al = p->n.attrMoreValues;
-        p->n.attrMoreValues = al->next;
-        al->next = NULL;
-        immsv_evt_free_att_val(&(al->n),
-                               (SaImmValueTypeT)p->n.attrValueType); /*free-7 */
-
-        free(al); /*free-6 */
-      }
-      p->next = NULL;
-      free(p); /*free-3 */
-    }
+    sync_object_free(tmp);
 
     /* Free heap allocated objects, but not the top (stack allocated) EVT object
      */
@@ -7208,6 +7820,47 @@ free_data:
   return rc;
 }
 
+SaAisErrorT immsv_sync_add(const SaImmClassNameT className,
+                           const SaNameT *objectName,
+                           const SaImmAttrValuesT_2 **attrValues,
+                           void **batchp, int *remainingSpacep,
+                           int objsInBatch) {
+  IMMSV_OM_OBJECT_SYNC *obj;
+  SaAisErrorT rc;
+  TRACE_ENTER2("remainingSpace %d objsInBatch:%u", *remainingSpacep,
+               objsInBatch);
+
+  if ((className == NULL) || (objectName == NULL) || (attrValues == NULL) ||
+      (batchp == NULL)) {
+    LOG_ER(
+        "(className == NULL) || (objectName == NULL) || (attrValues == NULL) || (batchp == NULL)");
+    abort();
+  }
+
+  obj = (IMMSV_OM_OBJECT_SYNC *)calloc(1, sizeof(IMMSV_OM_OBJECT_SYNC));
+  rc = sync_object_fill(obj, className, objectName, attrValues);
+  if (rc != SA_AIS_OK) {
+    sync_object_free(obj);
+    free(obj);
+    TRACE_LEAVE();
+    return rc;
+  }
+
+  /* Same limits as for a batch built by immsv_sync */
+  if ((objsInBatch - 2) > IMMSV_MAX_OBJS_IN_SYNCBATCH) {
+    TRACE("Limit for # of objects in batch reached: %d", objsInBatch);
+    *remainingSpacep = 0;
+  } else {
+    (*remainingSpacep) -= get_obj_size(obj);
+  }
+
+  obj->next = (IMMSV_OM_OBJECT_SYNC *)(*batchp);
+  (*batchp) = obj;
+
+  TRACE_LEAVE();
+  return ((*remainingSpacep) > 0) ? SA_AIS_ERR_NOT_READY : SA_AIS_OK;
+}
+
 SaAisErrorT immsv_finalize_sync(SaImmHandleT immHandle) {
   SaAisErrorT rc = SA_AIS_OK;
   uint32_t proc_rc = NCSCC_RC_SUCCESS;
@@ -9469,6 +10122,7 @@ static SaAisErrorT imma_finalizeCcb(SaImmCcbHandleT ccbHandle,
     if (keepCcbHandleOpen) { /* saImmOmCcbAbort */
       ccb_node->mApplied = true;
       ccb_node->mAborted = false;
+      imma_ccb_batch_discard(ccb_node);
       ccb_node->mValidated = false;
       ccb_node->mExclusive = false;
 
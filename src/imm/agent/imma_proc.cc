@@ -1404,6 +1404,12 @@ void imma_proc_free_pointers(IMMA_CB *cb, IMMA_EVT *evt) {
     case IMMA_EVT_ND2A_PROC_STALE_CLIENTS:
       break;
 
+    case IMMA_EVT_ND2A_CLASS_CHANGED:
+      free(evt->info.classDescr.className.buf);
+      evt->info.classDescr.className.buf = NULL;
+      evt->info.classDescr.className.size = 0;
+      break;
+
     default:
       TRACE_4("Unknown event type %u", evt->type);
       break;
@@ -1435,6 +1441,25 @@ static void imma_proc_clm_status_changed(IMMA_CB *cb, IMMA_EVT *evt) {
   m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
 }
 
+/****************************************************************************
+  Name          : imma_proc_class_changed
+  Description   : This function removes a created, upgraded or deleted class
+                  from the class description cache.
+  Arguments     : cb - IMMA CB.
+                  evt - IMMA_EVT.
+  Return Values : None
+******************************************************************************/
+static void imma_proc_class_changed(IMMA_CB *cb, IMMA_EVT *evt) {
+  if (m_NCS_LOCK(&cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
+    TRACE_3("Lock failure");
+    return;
+  }
+
+  TRACE("Class %s changed", evt->info.classDescr.className.buf);
+  imma_class_cache_invalidate(cb, evt->info.classDescr.className.buf);
+  m_NCS_UNLOCK(&cb->cb_lock, NCS_LOCK_WRITE);
+}
+
 /****************************************************************************
   Name          : imma_process_evt
   Description   : This routine will process the callback event received from
@@ -1507,6 +1532,10 @@ void imma_process_evt(IMMA_CB *cb, IMMSV_EVT *evt) {
       imma_proc_clm_status_changed(cb, &evt->info.imma);
       break;
 
+    case IMMA_EVT_ND2A_CLASS_CHANGED:
+      imma_proc_class_changed(cb, &evt->info.imma);
+      break;
+
     default:
       TRACE_4("Unknown event type %u", evt->info.imma.type);
       break;
@@ -22,8 +22,8 @@
 #include <pthread.h>
 #include "imm/apitest/immtest.h"
 
-const SaVersionT constImmVersion = {'A', 0x02, 0x12};
-SaVersionT immVersion = {'A', 0x02, 0x12};
+const SaVersionT constImmVersion = {'A', 0x02, 0x13};
+SaVersionT immVersion = {'A', 0x02, 0x13};
 SaAisErrorT rc;
 SaImmHandleT immOmHandle;
 SaImmHandleT immOiHandle;
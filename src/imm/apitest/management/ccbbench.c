@@ -0,0 +1,405 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the rate of CCB
+ * commits. A number of threads, each with its own OM handle, repeatedly apply
+ * a CCB modifying one attribute of an object of their own. With PBE enabled
+ * this measures the PBE commit rate, see "PBE group commit" in the README.
+ * Optionally the modify operations are streamed, see "Pipelined CCB
+ * operations" in the README. Optionally reader threads search the whole model
+ * while the CCBs are applied, see "Snapshot readers" in the README.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <libgen.h>
+
+#include <saAis.h>
+#include <saImmOm.h>
+#include "osaf/immutil/immutil.h"
+#include "base/osaf_extended_name.h"
+#include "base/osaf_time.h"
+#include "base/saf_error.h"
+
+#define BENCH_CLASS_NAME "ImmCcbBench"
+#define BENCH_RDN_NAME "immCcbBenchObj"
+#define BENCH_ATTR_NAME "value"
+#define BENCH_GET_DN "safRdn=immManagement,safApp=safImmService"
+
+extern struct ImmutilWrapperProfile immutilWrapperProfile;
+
+static const SaVersionT immVersion = {'A', 2, 11};
+static unsigned int numCcbs = 1000;
+static unsigned int numOpsPerCcb = 1;
+static int streamOps;
+static volatile int writersDone;
+
+struct bench_thread {
+	pthread_t thread;
+	unsigned int id;
+	unsigned int failed;
+	unsigned int searches;
+	unsigned int gets;
+	unsigned long long objects;
+};
+
+static void usage(const char *progname)
+{
+	printf("\nNAME\n");
+	printf("\t%s - measure the IMM CCB commit rate\n", progname);
+
+	printf("\nSYNOPSIS\n");
+	printf("\t%s [options]\n", progname);
+
+	printf("\nDESCRIPTION\n");
+	printf(
+	    "\t%s is an IMM OM test client applying CCBs from a number of concurrent\n"
+	    "\tthreads and reporting the number of CCBs committed per second.\n"
+	    "\tWith reader threads the whole model is searched, and an object\n"
+	    "\tread with an accessor, repeatedly while the CCBs are applied and\n"
+	    "\tthe read rates are reported as well.\n"
+	    "\tThe class " BENCH_CLASS_NAME
+	    " and one object per thread are created and removed.\n",
+	    progname);
+
+	printf("\nOPTIONS\n");
+	printf("\t-h, --help             this help\n");
+	printf(
+	    "\t-t, --threads <n>      number of concurrent OM clients (default 1)\n");
+	printf(
+	    "\t-n, --ccbs <n>         number of CCBs per thread (default 1000)\n");
+	printf(
+	    "\t-o, --ops <n>          number of modify operations per CCB (default 1)\n");
+	printf(
+	    "\t-a, --async            stream the modify operations with\n"
+	    "\t                       saImmOmCcbObjectModifyAsync\n");
+	printf(
+	    "\t-r, --readers <n>      number of threads reading the model (default 0)\n");
+
+	printf("\nEXAMPLE\n");
+	printf("\t%s -t 16 -n 500\n", progname);
+	printf("\t%s -n 10 -o 1000 -a\n", progname);
+	printf("\t%s -t 4 -n 500 -r 4\n", progname);
+}
+
+static void bench_dn(unsigned int id, SaNameT *dn)
+{
+	char buf[64];
+	snprintf(buf, sizeof(buf), BENCH_RDN_NAME "=%u", id);
+	osaf_extended_name_alloc(buf, dn);
+}
+
+static SaAisErrorT bench_ccb(SaImmAdminOwnerHandleT ownerHandle,
+			     const SaNameT *dn, SaUint32T value, int create,
+			     int delete)
+{
+	SaImmCcbHandleT ccbHandle;
+	SaAisErrorT rc;
+	unsigned int i;
+
+	rc = immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle);
+	if (rc != SA_AIS_OK)
+		return rc;
+
+	if (create) {
+		SaStringT rdn = (SaStringT)osaf_extended_name_borrow(dn);
+		SaImmAttrValueT rdnValues[] = {&rdn};
+		SaImmAttrValuesT_2 rdnAttr = {BENCH_RDN_NAME,
+					      SA_IMM_ATTR_SASTRINGT, 1,
+					      rdnValues};
+		const SaImmAttrValuesT_2 *attrValues[] = {&rdnAttr, NULL};
+		rc = immutil_saImmOmCcbObjectCreate_2(
+		    ccbHandle, BENCH_CLASS_NAME, NULL, attrValues);
+	} else if (delete) {
+		rc = immutil_saImmOmCcbObjectDelete(ccbHandle, dn);
+	} else {
+		for (i = 0; i < numOpsPerCcb && rc == SA_AIS_OK; ++i) {
+			SaUint32T v = value + i;
+			SaImmAttrValueT values[] = {&v};
+			SaImmAttrModificationT_2 attrMod = {
+			    SA_IMM_ATTR_VALUES_REPLACE,
+			    {BENCH_ATTR_NAME, SA_IMM_ATTR_SAUINT32T, 1,
+			     values}};
+			const SaImmAttrModificationT_2 *attrMods[] = {&attrMod,
+								      NULL};
+			if (streamOps)
+				rc = saImmOmCcbObjectModifyAsync(ccbHandle, dn,
+								 attrMods);
+			else
+				rc = immutil_saImmOmCcbObjectModify_2(
+				    ccbHandle, dn, attrMods);
+		}
+	}
+
+	if (rc == SA_AIS_OK)
+		rc = immutil_saImmOmCcbApply(ccbHandle);
+
+	immutil_saImmOmCcbFinalize(ccbHandle);
+	return rc;
+}
+
+static void *bench_thread_main(void *arg)
+{
+	struct bench_thread *bt = (struct bench_thread *)arg;
+	SaImmHandleT immHandle;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaVersionT version = immVersion;
+	SaNameT dn;
+	const SaNameT *objectNames[] = {&dn, NULL};
+	char ownerName[64];
+	unsigned int i;
+	SaAisErrorT rc;
+
+	if (streamOps)
+		version.minorVersion = 0x13;
+	bench_dn(bt->id, &dn);
+	snprintf(ownerName, sizeof(ownerName), "immccbbench_%d_%u", getpid(),
+		 bt->id);
+
+	rc = immutil_saImmOmInitialize(&immHandle, NULL, &version);
+	if (rc != SA_AIS_OK) {
+		fprintf(stderr, "saImmOmInitialize FAILED: %s\n",
+			saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+
+	rc = immutil_saImmOmAdminOwnerInitialize(immHandle, ownerName, SA_TRUE,
+						 &ownerHandle);
+	if (rc != SA_AIS_OK) {
+		fprintf(stderr, "saImmOmAdminOwnerInitialize FAILED: %s\n",
+			saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+
+	rc = bench_ccb(ownerHandle, &dn, 0, 1, 0);
+	if (rc != SA_AIS_OK) {
+		fprintf(stderr, "Create of %s FAILED: %s\n",
+			osaf_extended_name_borrow(&dn), saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+
+	rc = immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE);
+	if (rc != SA_AIS_OK) {
+		fprintf(stderr, "saImmOmAdminOwnerSet FAILED: %s\n",
+			saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < numCcbs; ++i) {
+		if (bench_ccb(ownerHandle, &dn, i, 0, 0) != SA_AIS_OK)
+			++bt->failed;
+	}
+
+	bench_ccb(ownerHandle, &dn, 0, 0, 1);
+	osaf_extended_name_free(&dn);
+	immutil_saImmOmAdminOwnerFinalize(ownerHandle);
+	immutil_saImmOmFinalize(immHandle);
+	return NULL;
+}
+
+static void *bench_reader_main(void *arg)
+{
+	struct bench_thread *bt = (struct bench_thread *)arg;
+	SaImmHandleT immHandle;
+	SaImmSearchHandleT searchHandle;
+	SaImmAccessorHandleT accessorHandle;
+	SaVersionT version = immVersion;
+	SaNameT objectName;
+	SaNameT getName;
+	SaImmAttrValuesT_2 **attributes;
+	SaAisErrorT rc;
+
+	rc = immutil_saImmOmInitialize(&immHandle, NULL, &version);
+	if (rc != SA_AIS_OK) {
+		fprintf(stderr, "saImmOmInitialize FAILED: %s\n",
+			saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+
+	rc = immutil_saImmOmAccessorInitialize(immHandle, &accessorHandle);
+	if (rc != SA_AIS_OK) {
+		fprintf(stderr, "saImmOmAccessorInitialize FAILED: %s\n",
+			saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+	osaf_extended_name_lend(BENCH_GET_DN, &getName);
+
+	while (!writersDone) {
+		rc = immutil_saImmOmSearchInitialize_2(
+		    immHandle, NULL, SA_IMM_SUBTREE, SA_IMM_SEARCH_GET_ALL_ATTR,
+		    NULL, NULL, &searchHandle);
+		if (rc == SA_AIS_OK) {
+			while ((rc = immutil_saImmOmSearchNext_2(
+				    searchHandle, &objectName, &attributes)) ==
+			       SA_AIS_OK)
+				++bt->objects;
+			immutil_saImmOmSearchFinalize(searchHandle);
+		}
+		if (rc != SA_AIS_ERR_NOT_EXIST)
+			++bt->failed;
+		++bt->searches;
+
+		if (immutil_saImmOmAccessorGet_2(accessorHandle, &getName, NULL,
+						 &attributes) != SA_AIS_OK)
+			++bt->failed;
+		++bt->gets;
+	}
+
+	immutil_saImmOmAccessorFinalize(accessorHandle);
+	immutil_saImmOmFinalize(immHandle);
+	return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"threads", required_argument, 0, 't'},
+					{"ccbs", required_argument, 0, 'n'},
+					{"ops", required_argument, 0, 'o'},
+					{"async", no_argument, 0, 'a'},
+					{"readers", required_argument, 0, 'r'},
+					{0, 0, 0, 0}};
+	unsigned int numThreads = 1;
+	unsigned int numReaders = 0;
+	struct bench_thread *threads;
+	struct bench_thread *readers;
+	unsigned int searches = 0, gets = 0, readFailed = 0;
+	unsigned long long objects = 0;
+	SaImmHandleT immHandle;
+	SaVersionT version = immVersion;
+	struct timespec start, end, elapsed;
+	unsigned int i, failed = 0;
+	double secs;
+	int c;
+
+	SaImmAttrDefinitionT_2 rdnDef = {
+	    BENCH_RDN_NAME, SA_IMM_ATTR_SASTRINGT,
+	    SA_IMM_ATTR_RDN | SA_IMM_ATTR_CONFIG | SA_IMM_ATTR_INITIALIZED,
+	    NULL};
+	SaImmAttrDefinitionT_2 valueDef = {
+	    BENCH_ATTR_NAME, SA_IMM_ATTR_SAUINT32T,
+	    SA_IMM_ATTR_CONFIG | SA_IMM_ATTR_WRITABLE, NULL};
+	const SaImmAttrDefinitionT_2 *attrDefs[] = {&rdnDef, &valueDef, NULL};
+
+	while ((c = getopt_long(argc, argv, "ht:n:o:ar:", long_options,
+				NULL)) != -1) {
+		switch (c) {
+		case 't':
+			numThreads = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			numCcbs = strtoul(optarg, NULL, 0);
+			break;
+		case 'o':
+			numOpsPerCcb = strtoul(optarg, NULL, 0);
+			break;
+		case 'a':
+			streamOps = 1;
+			break;
+		case 'r':
+			numReaders = strtoul(optarg, NULL, 0);
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numThreads == 0 || numCcbs == 0 || numOpsPerCcb == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	immutilWrapperProfile.errorsAreFatal = 0;
+
+	if (immutil_saImmOmInitialize(&immHandle, NULL, &version) !=
+	    SA_AIS_OK) {
+		fprintf(stderr, "saImmOmInitialize FAILED\n");
+		exit(EXIT_FAILURE);
+	}
+
+	SaAisErrorT rc = immutil_saImmOmClassCreate_2(
+	    immHandle, BENCH_CLASS_NAME, SA_IMM_CLASS_CONFIG, attrDefs);
+	if (rc != SA_AIS_OK && rc != SA_AIS_ERR_EXIST) {
+		fprintf(stderr, "saImmOmClassCreate_2 FAILED: %s\n",
+			saf_error(rc));
+		exit(EXIT_FAILURE);
+	}
+
+	threads = calloc(numThreads, sizeof(struct bench_thread));
+	readers = calloc(numReaders + 1, sizeof(struct bench_thread));
+	if (threads == NULL || readers == NULL) {
+		fprintf(stderr, "calloc FAILED\n");
+		exit(EXIT_FAILURE);
+	}
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numReaders; ++i) {
+		readers[i].id = i;
+		if (pthread_create(&readers[i].thread, NULL, bench_reader_main,
+				   &readers[i]) != 0) {
+			fprintf(stderr, "pthread_create FAILED\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (i = 0; i < numThreads; ++i) {
+		threads[i].id = i;
+		if (pthread_create(&threads[i].thread, NULL, bench_thread_main,
+				   &threads[i]) != 0) {
+			fprintf(stderr, "pthread_create FAILED\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (i = 0; i < numThreads; ++i) {
+		pthread_join(threads[i].thread, NULL);
+		failed += threads[i].failed;
+	}
+	osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+	writersDone = 1;
+	for (i = 0; i < numReaders; ++i) {
+		pthread_join(readers[i].thread, NULL);
+		searches += readers[i].searches;
+		gets += readers[i].gets;
+		objects += readers[i].objects;
+		readFailed += readers[i].failed;
+	}
+
+	osaf_timespec_subtract(&end, &start, &elapsed);
+	secs = osaf_timespec_to_double(&elapsed);
+	printf("threads:%u ccbs:%u ops/ccb:%u failed:%u time:%.3fs "
+	       "rate:%.1f ccbs/s\n",
+	       numThreads, numThreads * numCcbs, numOpsPerCcb, failed, secs,
+	       (numThreads * numCcbs - failed) / secs);
+	if (numReaders != 0)
+		printf("readers:%u searches:%u objects:%llu gets:%u failed:%u "
+		       "rate:%.1f searches/s %.1f objects/s %.1f gets/s\n",
+		       numReaders, searches, objects, gets, readFailed,
+		       searches / secs, objects / secs, gets / secs);
+
+	immutil_saImmOmClassDelete(immHandle, BENCH_CLASS_NAME);
+	immutil_saImmOmFinalize(immHandle);
+	free(readers);
+	free(threads);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
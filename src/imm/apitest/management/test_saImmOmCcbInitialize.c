@@ -197,6 +197,14 @@ extern void saImmOmCcbValidate_02(void);
 extern void saImmOmCcbObjectRead_01(void);
 extern void saImmOmCcbObjectRead_02(void);
 extern void saImmOmCcbObjectRead_03(void);
+extern void saImmOmCcbSync_01(void);
+extern void saImmOmCcbSync_02(void);
+extern void saImmOmCcbSync_03(void);
+extern void saImmOmCcbSync_04(void);
+extern void saImmOmCcbSync_05(void);
+extern void saImmOmCcbSync_06(void);
+extern void saImmOmCcbSync_07(void);
+extern void saImmOmCcbSync_08(void);
 
 __attribute__((constructor)) static void saImmOmInitialize_constructor(void)
 {
@@ -400,4 +408,29 @@ __attribute__((constructor)) static void saImmOmInitialize_constructor(void)
 		      "saImmOmCcbObjectRead escalated to modify - SA_AIS_OK");
 	test_case_add(6, saImmOmCcbObjectRead_03,
 		      "saImmOmCcbObjectRead escalated to delete - SA_AIS_OK");
+
+	test_case_add(
+	    6, saImmOmCcbSync_01,
+	    "saImmOmCcbObjectCreateAsync and saImmOmCcbSync - SA_AIS_OK");
+	test_case_add(
+	    6, saImmOmCcbSync_02,
+	    "saImmOmCcbObjectModifyAsync and saImmOmCcbSync - SA_AIS_OK");
+	test_case_add(
+	    6, saImmOmCcbSync_03,
+	    "saImmOmCcbObjectDeleteAsync and saImmOmCcbSync - SA_AIS_OK");
+	test_case_add(
+	    6, saImmOmCcbSync_04,
+	    "saImmOmCcbSync, streamed create of existing object - SA_AIS_ERR_FAILED_OPERATION");
+	test_case_add(
+	    6, saImmOmCcbSync_05,
+	    "saImmOmCcbApply, streamed modify of missing object - SA_AIS_ERR_FAILED_OPERATION");
+	test_case_add(
+	    6, saImmOmCcbSync_06,
+	    "saImmOmCcbObjectModifyAsync on ccb aborted by streamed delete - SA_AIS_ERR_FAILED_OPERATION");
+	test_case_add(
+	    6, saImmOmCcbSync_07,
+	    "saImmOmCcbSync after saImmOmCcbAbort discarding streamed create - SA_AIS_OK");
+	test_case_add(
+	    6, saImmOmCcbSync_08,
+	    "saImmOmCcbObjectCreateAsync with version A.02.18 - SA_AIS_ERR_VERSION");
 }
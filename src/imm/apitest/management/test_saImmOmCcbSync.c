@@ -0,0 +1,324 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#include "imm/apitest/immtest.h"
+
+static SaNameT rdn = {sizeof("Obj1") - 1, "Obj1"};
+static SaNameT *nameValues[] = {&rdn};
+static SaUint32T int1Value1 = 7;
+static SaUint32T *int1Values[] = {&int1Value1};
+static const SaNameT objectName = {sizeof("Obj1,rdn=root") - 1,
+				   "Obj1,rdn=root"};
+static const SaNameT missingName = {sizeof("Obj3,rdn=root") - 1,
+				    "Obj3,rdn=root"};
+
+static const SaImmAttrValuesT_2 v1 = {"attr1", SA_IMM_ATTR_SAUINT32T, 1,
+				      (void **)int1Values};
+static const SaImmAttrValuesT_2 v2 = {"rdn", SA_IMM_ATTR_SANAMET, 1,
+				      (void **)nameValues};
+static const SaImmAttrValuesT_2 *attrValues[] = {&v1, &v2, NULL};
+
+static SaImmAttrModificationT_2 attrMod = {
+    SA_IMM_ATTR_VALUES_REPLACE,
+    {"attr1", SA_IMM_ATTR_SAUINT32T, 1, (void **)int1Values}};
+static const SaImmAttrModificationT_2 *attrMods[] = {&attrMod, NULL};
+
+static const SaNameT *objectNames[] = {&rootObj, NULL};
+
+/* Create Obj1 under the root object with a synchronous ccb */
+static void create_obj1(SaImmAdminOwnerHandleT ownerHandle)
+{
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmCcbObjectCreate_2(ccbHandle, configClassName,
+						   &rootObj, attrValues),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmCcbApply(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+}
+
+static void delete_obj1(SaImmAdminOwnerHandleT ownerHandle)
+{
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmCcbObjectDelete(ccbHandle, &objectName),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmCcbApply(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_01(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+	safassert(saImmOmCcbObjectCreateAsync(ccbHandle, configClassName,
+					      &rootObj, attrValues),
+		  SA_AIS_OK);
+
+	test_validate(saImmOmCcbSync(ccbHandle), SA_AIS_OK);
+
+	safassert(immutil_saImmOmCcbApply(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	delete_obj1(ownerHandle);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_02(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	create_obj1(ownerHandle);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+	safassert(saImmOmCcbObjectModifyAsync(ccbHandle, &objectName, attrMods),
+		  SA_AIS_OK);
+
+	test_validate(saImmOmCcbSync(ccbHandle), SA_AIS_OK);
+
+	safassert(immutil_saImmOmCcbApply(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	delete_obj1(ownerHandle);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_03(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	create_obj1(ownerHandle);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+	safassert(saImmOmCcbObjectDeleteAsync(ccbHandle, &objectName),
+		  SA_AIS_OK);
+
+	test_validate(saImmOmCcbSync(ccbHandle), SA_AIS_OK);
+
+	safassert(immutil_saImmOmCcbApply(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_04(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+	const SaStringT *errorStrings = NULL;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	create_obj1(ownerHandle);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+
+	/* Obj1 already exists, the create fails in the IMMND */
+	safassert(saImmOmCcbObjectCreateAsync(ccbHandle, configClassName,
+					      &rootObj, attrValues),
+		  SA_AIS_OK);
+
+	test_validate(saImmOmCcbSync(ccbHandle), SA_AIS_ERR_FAILED_OPERATION);
+
+	safassert(saImmOmCcbGetErrorStrings(ccbHandle, &errorStrings),
+		  SA_AIS_OK);
+	assert(errorStrings && errorStrings[0]);
+
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	delete_obj1(ownerHandle);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_05(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+
+	/* Obj1 does not exist, the modify fails in the IMMND */
+	safassert(saImmOmCcbObjectModifyAsync(ccbHandle, &objectName, attrMods),
+		  SA_AIS_OK);
+
+	/* The apply syncs the streamed operations first */
+	test_validate(immutil_saImmOmCcbApply(ccbHandle),
+		      SA_AIS_ERR_FAILED_OPERATION);
+
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_06(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	create_obj1(ownerHandle);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+
+	/* The failed delete aborts the ccb, the modify is not done */
+	safassert(saImmOmCcbObjectDeleteAsync(ccbHandle, &missingName),
+		  SA_AIS_OK);
+	safassert(saImmOmCcbObjectModifyAsync(ccbHandle, &objectName, attrMods),
+		  SA_AIS_OK);
+	safassert(saImmOmCcbSync(ccbHandle), SA_AIS_ERR_FAILED_OPERATION);
+
+	test_validate(
+	    saImmOmCcbObjectModifyAsync(ccbHandle, &objectName, attrMods),
+	    SA_AIS_ERR_FAILED_OPERATION);
+
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	delete_obj1(ownerHandle);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_07(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+
+	safassert(immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks,
+					    &immVersion),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(
+	    immutil_saImmOmAdminOwnerSet(ownerHandle, objectNames, SA_IMM_ONE),
+	    SA_AIS_OK);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+	safassert(saImmOmCcbObjectCreateAsync(ccbHandle, configClassName,
+					      &rootObj, attrValues),
+		  SA_AIS_OK);
+
+	/* The abort discards the streamed create */
+	safassert(immutil_saImmOmCcbAbort(ccbHandle), SA_AIS_OK);
+
+	test_validate(saImmOmCcbSync(ccbHandle), SA_AIS_OK);
+
+	safassert(immutil_saImmOmCcbObjectDelete(ccbHandle, &objectName),
+		  SA_AIS_ERR_NOT_EXIST);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
+
+void saImmOmCcbSync_08(void)
+{
+	const SaImmAdminOwnerNameT adminOwnerName =
+	    (SaImmAdminOwnerNameT) __FUNCTION__;
+	SaImmAdminOwnerHandleT ownerHandle;
+	SaImmCcbHandleT ccbHandle;
+	SaVersionT version = {'A', 0x02, 0x12};
+
+	safassert(
+	    immutil_saImmOmInitialize(&immOmHandle, &immOmCallbacks, &version),
+	    SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerInitialize(
+		      immOmHandle, adminOwnerName, SA_TRUE, &ownerHandle),
+		  SA_AIS_OK);
+	safassert(immutil_saImmOmCcbInitialize(ownerHandle, 0, &ccbHandle),
+		  SA_AIS_OK);
+
+	test_validate(saImmOmCcbObjectCreateAsync(ccbHandle, configClassName,
+						  &rootObj, attrValues),
+		      SA_AIS_ERR_VERSION);
+
+	safassert(saImmOmCcbSync(ccbHandle), SA_AIS_ERR_VERSION);
+	safassert(immutil_saImmOmCcbFinalize(ccbHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmAdminOwnerFinalize(ownerHandle), SA_AIS_OK);
+	safassert(immutil_saImmOmFinalize(immOmHandle), SA_AIS_OK);
+}
@@ -40,6 +40,24 @@
 #include "base/osaf_extended_name.h"
 #include "imm/common/immsv_utils.h"
 
+/* Removes any -wal/-shm file left by a PBE that ran with group commit.
+   A stale WAL must never be applied to a regenerated or discarded db file. */
+static void removeWalFiles(const std::string &filename) {
+  const char *suffixes[] = {"-wal", "-shm", NULL};
+  for (int ix = 0; suffixes[ix] != NULL; ++ix) {
+    std::string walFilename(filename);
+    walFilename.append(suffixes[ix]);
+    if (access(walFilename.c_str(), F_OK) != (-1)) {
+      if (unlink(walFilename.c_str()) != 0) {
+        LOG_ER("Failed to remove EXISTING obsolete WAL file: %s ",
+               walFilename.c_str());
+      } else {
+        LOG_NO("Removed obsolete WAL file: %s ", walFilename.c_str());
+      }
+    }
+  }
+}
+
 #ifdef HAVE_IMM_PBE
 
 /* Spinlock for sqlite access see pbeBeginTrans.
@@ -70,6 +88,11 @@ void pbeClosePrepareTrans() {
 
 static std::string *sPbeFileName;
 
+/* Set by pbeSetWalJournalMode() before the PBE daemon re-attaches to the
+   db file. sPbeWalActive tells if the open handle actually runs in WAL mode. */
+static bool sPbeWalJournal = false;
+static bool sPbeWalActive = false;
+
 #define SQL_STMT_SIZE 31
 
 enum {
@@ -547,6 +570,8 @@ void pbeAtomicSwitchFile(const char *filePath, std::string localTmpFilename) {
 
   LOG_NO("Moved %s to %s", globalTmpFilename.c_str(), filePath);
 
+  removeWalFiles(std::string(filePath));
+
   if (access(globalJournalFilename.c_str(), F_OK) != (-1)) {
     /* Remove -journal file */
     if (unlink(globalJournalFilename.c_str()) != 0) {
@@ -936,6 +961,10 @@ void *pbeRepositoryInit(const char *filePath, bool create,
 
       "COMMIT TRANSACTION",
       NULL};
+
+  const char *sql_wal[] = {"PRAGMA locking_mode=EXCLUSIVE",
+                           "PRAGMA journal_mode=WAL",
+                           "PRAGMA synchronous=FULL", NULL};
   TRACE_ENTER();
 
   if (!sPbeFileName) {
@@ -1150,13 +1179,32 @@ re_attach:
     goto bailout;
   }
 
-  rc = sqlite3_exec(dbHandle, sql_tr[0], NULL, NULL, &zErr);
-  if (rc != SQLITE_OK) {
-    LOG_ER("SQL statement ('%s') failed because:\n %s", sql_tr[0], zErr);
-    sqlite3_free(zErr);
-    goto bailout;
+  if (sPbeWalJournal) {
+    /* Group commit. Exclusive locking mode makes sqlite keep the WAL index in
+       heap memory instead of a -shm file, so WAL also works when the db file
+       resides on a replicated/network file system. The PBE is the only user
+       of the file while it is attached. */
+    for (int ix = 0; sql_wal[ix] != NULL; ++ix) {
+      rc = sqlite3_exec(dbHandle, sql_wal[ix], NULL, NULL, &zErr);
+      if (rc != SQLITE_OK) {
+        LOG_ER("SQL statement ('%s') failed because:\n %s", sql_wal[ix],
+               zErr);
+        sqlite3_free(zErr);
+        goto bailout;
+      }
+      TRACE("Successfully executed %s", sql_wal[ix]);
+    }
+    sPbeWalActive = true;
+    LOG_NO("PBE file %s attached in WAL journal mode", filePath);
+  } else {
+    rc = sqlite3_exec(dbHandle, sql_tr[0], NULL, NULL, &zErr);
+    if (rc != SQLITE_OK) {
+      LOG_ER("SQL statement ('%s') failed because:\n %s", sql_tr[0], zErr);
+      sqlite3_free(zErr);
+      goto bailout;
+    }
+    TRACE("Successfully executed %s", sql_tr[0]);
   }
-  TRACE("Successfully executed %s", sql_tr[0]);
 
   *sPbeFileName =
       std::string(filePath); /* Avoid apend to presumed empty string */
@@ -1190,6 +1238,17 @@ bailout:
 
 void pbeRepositoryClose(void *dbHandle) {
   finalizeSqlStatements();
+  if (sPbeWalActive) {
+    /* Leave the file in rollback journal mode for the loader and for a PBE
+       restarted without group commit. This also checkpoints the WAL. */
+    char *execErr = NULL;
+    if (sqlite3_exec((sqlite3 *)dbHandle, "PRAGMA journal_mode=TRUNCATE",
+                     NULL, NULL, &execErr) != SQLITE_OK) {
+      LOG_WA("Failed to leave WAL journal mode: %s", execErr);
+      sqlite3_free(execErr);
+    }
+    sPbeWalActive = false;
+  }
   sqlite3_close((sqlite3 *)dbHandle);
 
   if (sPbeFileName) {
@@ -3191,13 +3250,123 @@ SaAisErrorT pbeBeginTrans(void *db_handle) {
   return SA_AIS_OK;
 }
 
+/* Records the ccb as committed in the ccb_commits table, used by
+   getCcbOutcomeFromPbe(). Returns SQLITE_DONE on success, SQLITE_MISUSE if a
+   bind failed and the sqlite3_step() error code otherwise. */
+static int insertCcbCommit(sqlite3 *dbHandle, SaUint64T ccbId,
+                           SaUint32T currentEpoch, SaTimeT *externCommitTime) {
+  sqlite3_stmt *stmt = preparedStmt[SQL_INS_CCB_COMMITS];
+  unsigned int commitTime = (unsigned int)time(NULL);
+  int rc = 0;
+
+  *externCommitTime = commitTime * SA_TIME_ONE_SECOND;
+
+  if ((rc = sqlite3_bind_int64(stmt, 1, ccbId)) != SQLITE_OK) {
+    LOG_ER("Failed to bind ccb_id with error code: %d", rc);
+    return SQLITE_MISUSE;
+  }
+  if ((rc = sqlite3_bind_int(stmt, 2, currentEpoch)) != SQLITE_OK) {
+    LOG_ER("Failed to bind epoch with error code: %d", rc);
+    return SQLITE_MISUSE;
+  }
+  if ((rc = sqlite3_bind_int(stmt, 3, commitTime)) != SQLITE_OK) {
+    LOG_ER("Failed to bind commit_time with error code: %d", rc);
+    return SQLITE_MISUSE;
+  }
+  rc = sqlite3_step(stmt);
+  if (rc != SQLITE_DONE) {
+    LOG_ER("SQL statement ('%s') failed because:\n %s",
+           preparedSql[SQL_INS_CCB_COMMITS], sqlite3_errmsg(dbHandle));
+  }
+  sqlite3_reset(stmt);
+  return rc;
+}
+
+/* Group commit: several ccbs/PRT updates share one sqlite transaction
+   started by pbeBeginTrans() and terminated by pbeCommitTrans() with ccbId
+   zero. Each ccb is built inside its own savepoint so that a failing ccb can
+   be rolled back without affecting the other ccbs in the group.
+   The spinlock goes 1 -> 2 for each ccb (pbeClosePrepareTrans) and is moved
+   back to 1 when the next savepoint is opened. */
+SaAisErrorT pbeSavepointTrans(void *db_handle) {
+  sqlite3 *dbHandle = (sqlite3 *)db_handle;
+  char *execErr = NULL;
+
+  if (sqliteTransLock == 2) {
+    --sqliteTransLock; /* Re-open prepare for the next ccb in the group. */
+  }
+
+  if (sqliteTransLock != 1) {
+    LOG_ER("pbeSavepointTrans was called when sqliteTransLock(%u)!=1",
+           sqliteTransLock);
+    abort();
+  }
+
+  if (sqlite3_exec(dbHandle, "SAVEPOINT ccb", NULL, NULL, &execErr) !=
+      SQLITE_OK) {
+    LOG_ER("SQL statement ('SAVEPOINT ccb') failed because:\n %s", execErr);
+    sqlite3_free(execErr);
+    return SA_AIS_ERR_FAILED_OPERATION;
+  }
+  return SA_AIS_OK;
+}
+
+SaAisErrorT pbeReleaseSavepointTrans(void *db_handle, SaUint64T ccbId,
+                                     SaUint32T currentEpoch,
+                                     SaTimeT *externCommitTime) {
+  sqlite3 *dbHandle = (sqlite3 *)db_handle;
+  char *execErr = NULL;
+
+  if (sqliteTransLock != 2) {
+    LOG_ER("pbeReleaseSavepointTrans was called when sqliteTransLock(%u)!=2",
+           sqliteTransLock);
+    abort();
+  }
+
+  if (insertCcbCommit(dbHandle, ccbId, currentEpoch, externCommitTime) !=
+      SQLITE_DONE) {
+    pbeRollbackSavepointTrans(db_handle);
+    return SA_AIS_ERR_FAILED_OPERATION;
+  }
+
+  if (sqlite3_exec(dbHandle, "RELEASE ccb", NULL, NULL, &execErr) !=
+      SQLITE_OK) {
+    LOG_ER("SQL statement ('RELEASE ccb') failed because:\n %s", execErr);
+    sqlite3_free(execErr);
+    pbeRollbackSavepointTrans(db_handle);
+    return SA_AIS_ERR_FAILED_OPERATION;
+  }
+  return SA_AIS_OK;
+}
+
+void pbeRollbackSavepointTrans(void *db_handle) {
+  sqlite3 *dbHandle = (sqlite3 *)db_handle;
+  char *execErr = NULL;
+
+  if ((sqlite3_exec(dbHandle, "ROLLBACK TO ccb", NULL, NULL, &execErr) !=
+       SQLITE_OK) ||
+      (sqlite3_exec(dbHandle, "RELEASE ccb", NULL, NULL, &execErr) !=
+       SQLITE_OK)) {
+    LOG_ER("SQL statement ('ROLLBACK TO ccb') failed because:\n %s",
+           execErr);
+    sqlite3_free(execErr);
+    sqlite3_close(dbHandle);
+    LOG_ER("Exiting (line:%u)", __LINE__);
+    exit(1);
+  }
+
+  if (sqliteTransLock == 2) {
+    --sqliteTransLock;
+  }
+}
+
+void pbeSetWalJournalMode(bool wal) { sPbeWalJournal = wal; }
+
 SaAisErrorT pbeCommitTrans(void *db_handle, SaUint64T ccbId,
                            SaUint32T currentEpoch, SaTimeT *externCommitTime) {
   sqlite3 *dbHandle = (sqlite3 *)db_handle;
   char *execErr = NULL;
   int rc = 0;
-  unsigned int commitTime = 0;
-  time_t now = time(NULL);
   SaAisErrorT err = SA_AIS_OK;
 
   if (sqliteTransLock != 2) {
@@ -3209,35 +3378,15 @@ SaAisErrorT pbeCommitTrans(void *db_handle, SaUint64T ccbId,
   assert((++sqliteTransLock) == 3);
 
   if (ccbId) {
-    sqlite3_stmt *stmt = preparedStmt[SQL_INS_CCB_COMMITS];
-
-    commitTime = (unsigned int)now;
-    *externCommitTime = commitTime * SA_TIME_ONE_SECOND;
-
-    if ((rc = sqlite3_bind_int64(stmt, 1, ccbId)) != SQLITE_OK) {
-      LOG_ER("Failed to bind ccb_id with error code: %d", rc);
+    rc = insertCcbCommit(dbHandle, ccbId, currentEpoch, externCommitTime);
+    if (rc == SQLITE_MISUSE) {
       err = SA_AIS_ERR_FAILED_OPERATION;
       goto done;
-    }
-    if ((rc = sqlite3_bind_int(stmt, 2, currentEpoch)) != SQLITE_OK) {
-      LOG_ER("Failed to bind epoch with error code: %d", rc);
-      err = SA_AIS_ERR_FAILED_OPERATION;
-      goto done;
-    }
-    if ((rc = sqlite3_bind_int(stmt, 3, commitTime)) != SQLITE_OK) {
-      LOG_ER("Failed to bind commit_time with error code: %d", rc);
-      err = SA_AIS_ERR_FAILED_OPERATION;
-      goto done;
-    }
-    rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      LOG_ER("SQL statement ('%s') failed because:\n %s",
-             preparedSql[SQL_INS_CCB_COMMITS], sqlite3_errmsg(dbHandle));
+    } else if (rc != SQLITE_DONE) {
       pbeAbortTrans(db_handle);
       err = SA_AIS_ERR_FAILED_OPERATION;
       goto abort_done;
     }
-    sqlite3_reset(stmt);
   }
 
   rc = sqlite3_exec(dbHandle, "COMMIT TRANSACTION", NULL, NULL, &execErr);
@@ -3387,6 +3536,10 @@ bailout:
 
 void fsyncPbeJournalFile() {
   int fd = (-1);
+  if (sPbeWalActive) {
+    /* No -journal file. Sqlite syncs the WAL itself on each commit. */
+    return;
+  }
   std::string globalJournalFilename(*sPbeFileName);
   globalJournalFilename.append("-journal");
   fd = open(globalJournalFilename.c_str(), O_RDWR);
@@ -4105,6 +4258,20 @@ void pbeAbortTrans(void* db_handle) { abort(); }
 
 void pbeClosePrepareTrans() { abort(); }
 
+void pbeSetWalJournalMode(bool wal) {}
+
+SaAisErrorT pbeSavepointTrans(void* db_handle) {
+  return SA_AIS_ERR_NO_RESOURCES;
+}
+
+SaAisErrorT pbeReleaseSavepointTrans(void* db_handle, SaUint64T ccbId,
+                                     SaUint32T epoch,
+                                     SaTimeT* externCommitTime) {
+  return SA_AIS_ERR_NO_RESOURCES;
+}
+
+void pbeRollbackSavepointTrans(void* db_handle) { abort(); }
+
 void objectDeleteToPBE(std::string objectNameString, void* db_handle) {
   abort();
 }
@@ -4184,6 +4351,8 @@ void discardPbeFile(std::string filename) {
            filename.c_str(), newFilename.c_str());
   }
 
+  removeWalFiles(filename);
+
   if (access(globalJournalFilename.c_str(), F_OK) != (-1)) {
     /* Remove -journal file */
     if (unlink(globalJournalFilename.c_str()) != 0) {
@@ -102,6 +102,14 @@ void pbeClosePrepareTrans();
 bool pbeTransIsPrepared();
 bool pbeTransStarted();
 
+/* Group commit of several ccbs in one sqlite transaction. */
+void pbeSetWalJournalMode(bool wal);
+SaAisErrorT pbeSavepointTrans(void* db_handle);
+SaAisErrorT pbeReleaseSavepointTrans(void* db_handle, SaUint64T ccbId,
+                                     SaUint32T epoch,
+                                     SaTimeT* externCommitTime);
+void pbeRollbackSavepointTrans(void* db_handle);
+
 void purgeCcbCommitsFromPbe(void* sDbHandle, SaUint32T currentEpoch);
 
 void objectModifyDiscardAllValuesOfAttrToPBE(void* dbHandle,
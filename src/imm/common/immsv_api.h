@@ -61,6 +61,11 @@ extern "C" {
 #define IMMSV_DEFAULT_MAX_SYNC_BATCH_SIZE ((MDS_DIRECT_BUF_MAXSIZE / 100) * 90)
 #define IMMSV_MAX_OBJS_IN_SYNCBATCH (IMMSV_DEFAULT_MAX_SYNC_BATCH_SIZE / 10)
 
+/* Limits for the ccb operations packed in one message by the
+   saImmOmCcbObject*Async functions */
+#define IMMSV_MAX_CCB_BATCH_SIZE IMMSV_DEFAULT_MAX_SYNC_BATCH_SIZE
+#define IMMSV_MAX_OPS_IN_CCB_BATCH 256
+
 #define OPENSAF_IMM_LONG_DNS_ALLOWED "longDnsAllowed"
 #define OPENSAF_IMM_ACCESS_CONTROL_MODE "accessControlMode"
 #define OPENSAF_IMM_AUTHORIZED_GROUP "authorizedGroup"
@@ -152,6 +157,7 @@ typedef enum {
 #define OPENSAF_IMM_FLAG_PRT51_ALLOW 0x00000100
 #define OPENSAF_IMM_FLAG_PRT51710_ALLOW 0x00000200
 #define OPENSAF_IMM_FLAG_PRT51906_ALLOW 0x00000400
+#define OPENSAF_IMM_FLAG_PRT52103_ALLOW 0x00000800
 
 #define OPENSAF_IMM_SERVICE_NAME "safImmService"
 
@@ -208,6 +214,16 @@ SaAisErrorT immsv_sync(SaImmHandleT immHandle, const SaImmClassNameT className,
                        const SaImmAttrValuesT_2** atributes, void** batch,
                        int* remainingSpace, int objsInBatch);
 
+/* Add an object to a batch without sending it, so that the batch can be sent
+   with immsv_sync (attributes NULL) by another thread while the next batch is
+   built. Returns SA_AIS_ERR_NOT_READY while there is room for more objects in
+   the batch and SA_AIS_OK when the batch is full.
+*/
+SaAisErrorT immsv_sync_add(const SaImmClassNameT className,
+                           const SaNameT* objectName,
+                           const SaImmAttrValuesT_2** attributes, void** batch,
+                           int* remainingSpace, int objsInBatch);
+
 SaAisErrorT immsv_finalize_sync(SaImmHandleT immHandle);
 
 #ifdef __cplusplus
@@ -188,6 +188,9 @@ static const char *immnd_evt_names[] = {
     "IMMND_EVT_A2ND_OI_OBJ_CREATE_2", /* saImmOiRtObjectCreate_o3 */
     "IMMND_EVT_A2ND_OBJ_SAFE_READ",   /* saImmOmCcbObjectRead */
     "IMMND_EVT_D2ND_IMPLDELETE",
+    "IMMND_EVT_A2ND_CLASS_DESCR_GET_2", /* saImmOmClassDescriptionGet */
+    "IMMND_EVT_A2ND_CCB_BATCH",         /* saImmOmCcbObject*Async */
+    "IMMND_EVT_READER_DONE",
     "undefined (high)"};
 
 const char *immsv_get_immnd_evt_name(unsigned int id)
@@ -232,10 +235,95 @@ bool immsv_evt_enc_inline_text(int line, NCS_UBAID *o_ub,
 	return true;
 }
 
+/* Smallest block of an arena, blocks are sized from the encoded event */
+#define IMMSV_EVT_ARENA_MIN_BLOCK 1024
+#define IMMSV_EVT_ARENA_ALIGN(S) (((S) + 15) & ~(size_t)15)
+
+/* Arena the decoding thread allocates from, see immsv_evt_dec_arena */
+static __thread IMMSV_EVT_ARENA *dec_arena;
+
+static void *immsv_evt_arena_alloc(IMMSV_EVT_ARENA *arena, size_t size)
+{
+	const size_t hdr = IMMSV_EVT_ARENA_ALIGN(sizeof(IMMSV_EVT_ARENA_BLOCK));
+	IMMSV_EVT_ARENA_BLOCK *b = arena->blocks;
+	void *p;
+
+	size = IMMSV_EVT_ARENA_ALIGN(size);
+	if (b == NULL || b->size - b->used < size) {
+		size_t block_size =
+		    size > arena->block_size ? size : arena->block_size;
+
+		b = malloc(hdr + block_size);
+		osafassert(b);
+		b->size = block_size;
+		b->used = 0;
+		b->next = arena->blocks;
+		arena->blocks = b;
+	}
+
+	p = (uint8_t *)b + hdr + b->used;
+	b->used += size;
+	memset(p, 0, size);
+	return p;
+}
+
+/* Zeroed memory for a decoded event, from the arena if one is active */
+static void *immsv_evt_dec_alloc(size_t size)
+{
+	if (dec_arena != NULL)
+		return immsv_evt_arena_alloc(dec_arena, size);
+	return calloc(1, size);
+}
+
+/* Event types whose memory the receiving IMMND never takes over */
+static bool immsv_evt_arena_type(IMMND_EVT_TYPE type)
+{
+	switch (type) {
+	case IMMND_EVT_A2ND_OBJ_MODIFY:
+	case IMMND_EVT_A2ND_OBJ_DELETE:
+	case IMMND_EVT_A2ND_OI_OBJ_DELETE:
+	case IMMND_EVT_A2ND_CCB_BATCH:
+	case IMMND_EVT_A2ND_OBJ_SYNC:
+	case IMMND_EVT_A2ND_OBJ_SYNC_2:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void immsv_evt_arena_init(IMMSV_EVT_ARENA *arena, const char *base,
+			  uint32_t base_size)
+{
+	arena->blocks = NULL;
+	arena->block_size = 2 * (size_t)base_size;
+	if (arena->block_size < IMMSV_EVT_ARENA_MIN_BLOCK)
+		arena->block_size = IMMSV_EVT_ARENA_MIN_BLOCK;
+	arena->base = base;
+	arena->base_size = base_size;
+}
+
+void immsv_evt_arena_free(IMMSV_EVT_ARENA *arena)
+{
+	while (arena->blocks) {
+		IMMSV_EVT_ARENA_BLOCK *b = arena->blocks;
+		arena->blocks = b->next;
+		free(b);
+	}
+}
+
 void immsv_evt_dec_inline_string(NCS_UBAID *i_ub, IMMSV_OCTET_STRING *os)
 {
 	if (os->size) {
-		os->buf = (void *)calloc(1, os->size);
+		if (dec_arena != NULL && dec_arena->base != NULL &&
+		    (uint32_t)i_ub->ttl <= dec_arena->base_size &&
+		    os->size <= dec_arena->base_size - i_ub->ttl) {
+			/* The string is at the same offset in the flat copy */
+			os->buf = (char *)dec_arena->base + i_ub->ttl;
+			ncs_dec_skip_space(i_ub, os->size);
+			return;
+		}
+
+		os->buf = immsv_evt_dec_alloc(os->size);
 
 		if (ncs_decode_n_octets_from_uba(i_ub, (uint8_t *)os->buf,
 						 os->size) !=
@@ -626,8 +714,8 @@ static void immsv_evt_dec_attrmods(NCS_UBAID *i_ub, IMMSV_ATTR_MODS_LIST **p)
 		uint8_t *p8;
 		uint8_t local_data[8];
 
-		*p = (IMMSV_ATTR_MODS_LIST *)calloc(
-		    1, sizeof(IMMSV_ATTR_MODS_LIST));
+		*p = (IMMSV_ATTR_MODS_LIST *)immsv_evt_dec_alloc(
+		    sizeof(IMMSV_ATTR_MODS_LIST));
 
 		IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
 		(*p)->attrModType = ncs_decode_32bit(&p8);
@@ -658,8 +746,8 @@ static void immsv_evt_dec_attrmods(NCS_UBAID *i_ub, IMMSV_ATTR_MODS_LIST **p)
 			IMMSV_EDU_ATTR_VAL_LIST *al = NULL;
 
 			while (attrValuesNumber) {
-				al = (IMMSV_EDU_ATTR_VAL_LIST *)calloc(
-				    1, sizeof(IMMSV_EDU_ATTR_VAL_LIST));
+				al = immsv_evt_dec_alloc(
+				    sizeof(IMMSV_EDU_ATTR_VAL_LIST));
 
 				immsv_evt_dec_att_val(
 				    i_ub, &(al->n),
@@ -696,8 +784,8 @@ static void immsv_evt_dec_attributes(NCS_UBAID *i_ub,
 		uint8_t *p8;
 		uint8_t local_data[8];
 
-		*p = (IMMSV_ATTR_VALUES_LIST *)calloc(
-		    1, sizeof(IMMSV_ATTR_VALUES_LIST));
+		*p = (IMMSV_ATTR_VALUES_LIST *)immsv_evt_dec_alloc(
+		    sizeof(IMMSV_ATTR_VALUES_LIST));
 
 		IMMSV_OCTET_STRING *os = &((*p)->n.attrName);
 		IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
@@ -723,8 +811,8 @@ static void immsv_evt_dec_attributes(NCS_UBAID *i_ub,
 			IMMSV_EDU_ATTR_VAL_LIST *al = NULL;
 
 			while (attrValuesNumber) {
-				al = (IMMSV_EDU_ATTR_VAL_LIST *)calloc(
-				    1, sizeof(IMMSV_EDU_ATTR_VAL_LIST));
+				al = immsv_evt_dec_alloc(
+				    sizeof(IMMSV_EDU_ATTR_VAL_LIST));
 
 				immsv_evt_dec_att_val(i_ub, &(al->n),
 						      (*p)->n.attrValueType);
@@ -1515,6 +1603,14 @@ static uint32_t immsv_evt_enc_sublevels(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 			if (!immsv_evt_enc_inline_text(__LINE__, o_ub, os)) {
 				return NCSCC_RC_OUT_OF_MEM;
 			}
+		} else if (i_evt->info.imma.type ==
+			   IMMA_EVT_ND2A_CLASS_CHANGED) {
+			/*Encode the className */
+			IMMSV_OCTET_STRING *os =
+			    &(i_evt->info.imma.info.classDescr.className);
+			if (!immsv_evt_enc_inline_text(__LINE__, o_ub, os)) {
+				return NCSCC_RC_OUT_OF_MEM;
+			}
 		} else if ((i_evt->info.imma.type == IMMA_EVT_ND2A_IMM_ADMOP) ||
 			   (i_evt->info.imma.type ==
 			    IMMA_EVT_ND2A_IMM_PBE_ADMOP)) {
@@ -1759,7 +1855,9 @@ static uint32_t immsv_evt_enc_sublevels(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 		} else if ((i_evt->info.immnd.type ==
 			    IMMND_EVT_A2ND_CLASS_CREATE) ||
 			   (i_evt->info.immnd.type ==
-			    IMMND_EVT_A2ND_CLASS_DESCR_GET)) {
+			    IMMND_EVT_A2ND_CLASS_DESCR_GET) ||
+			   (i_evt->info.immnd.type ==
+			    IMMND_EVT_A2ND_CLASS_DESCR_GET_2)) {
 			int depth = 0;
 			IMMSV_OCTET_STRING *os =
 			    &(i_evt->info.immnd.info.classDescr.className);
@@ -1856,6 +1954,12 @@ static uint32_t immsv_evt_enc_sublevels(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 				return NCSCC_RC_OUT_OF_MEM;
 			}
 
+		} else if (i_evt->info.immnd.type ==
+			   IMMND_EVT_A2ND_CCB_BATCH) {
+			/*Encode the pre-packed operations */
+			IMMSV_OCTET_STRING *os =
+			    &(i_evt->info.immnd.info.ccbBatch.ops);
+			immsv_evt_enc_inline_string(o_ub, os);
 		} else if ((i_evt->info.immnd.type ==
 			    IMMND_EVT_A2ND_OBJ_SYNC) ||
 			   (i_evt->info.immnd.type ==
@@ -2361,6 +2465,13 @@ static uint32_t immsv_evt_dec_sublevels(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 			    &(o_evt->info.imma.info.objDelete.objectName);
 			immsv_evt_dec_inline_string(i_ub, os);
 
+		} else if (o_evt->info.imma.type ==
+			   IMMA_EVT_ND2A_CLASS_CHANGED) {
+			/*Decode the className */
+			IMMSV_OCTET_STRING *os =
+			    &(o_evt->info.imma.info.classDescr.className);
+			immsv_evt_dec_inline_string(i_ub, os);
+
 		} else if ((o_evt->info.imma.type == IMMA_EVT_ND2A_IMM_ADMOP) ||
 			   (o_evt->info.imma.type ==
 			    IMMA_EVT_ND2A_IMM_PBE_ADMOP)) {
@@ -2542,7 +2653,9 @@ static uint32_t immsv_evt_dec_sublevels(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 		} else if ((o_evt->info.immnd.type ==
 			    IMMND_EVT_A2ND_CLASS_CREATE) ||
 			   (o_evt->info.immnd.type ==
-			    IMMND_EVT_A2ND_CLASS_DESCR_GET)) {
+			    IMMND_EVT_A2ND_CLASS_DESCR_GET) ||
+			   (o_evt->info.immnd.type ==
+			    IMMND_EVT_A2ND_CLASS_DESCR_GET_2)) {
 			/*Decode the className */
 			IMMSV_OCTET_STRING *os =
 			    &(o_evt->info.immnd.info.classDescr.className);
@@ -2604,6 +2717,12 @@ static uint32_t immsv_evt_dec_sublevels(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 			IMMSV_OCTET_STRING *os =
 			    &(o_evt->info.immnd.info.objDelete.objectName);
 			immsv_evt_dec_inline_string(i_ub, os);
+		} else if (o_evt->info.immnd.type ==
+			   IMMND_EVT_A2ND_CCB_BATCH) {
+			/*Decode the pre-packed operations */
+			IMMSV_OCTET_STRING *os =
+			    &(o_evt->info.immnd.info.ccbBatch.ops);
+			immsv_evt_dec_inline_string(i_ub, os);
 		} else if ((o_evt->info.immnd.type ==
 			    IMMND_EVT_A2ND_OBJ_SYNC) ||
 			   (o_evt->info.immnd.type ==
@@ -2656,8 +2775,8 @@ static uint32_t immsv_evt_dec_sublevels(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 				IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub,
 							1);
 				if (ncs_decode_8bit(&p8)) {
-					obj_sync->next = calloc(
-					    1, sizeof(IMMSV_OM_OBJECT_SYNC));
+					obj_sync->next = immsv_evt_dec_alloc(
+					    sizeof(IMMSV_OM_OBJECT_SYNC));
 				}
 				ncs_dec_skip_space(i_ub, 1);
 
@@ -3321,6 +3440,14 @@ static uint32_t immsv_evt_enc_toplevel(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 			   encoding/decoding is not required */
 			break;
 
+		case IMMA_EVT_ND2A_CLASS_CHANGED:
+			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
+			ncs_encode_32bit(
+			    &p8, immaevt->info.classDescr.className.size);
+			ncs_enc_claim_space(o_ub, 4);
+			/* className.buf encoded by sublevel */
+			break;
+
 		default:
 			LOG_ER("Illegal IMMA message type:%u", immaevt->type);
 			rc = NCSCC_RC_OUT_OF_MEM;
@@ -3948,6 +4075,7 @@ static uint32_t immsv_evt_enc_toplevel(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 
 		case IMMND_EVT_A2ND_CLASS_DESCR_GET: /* saImmOmClassDescriptionGet
 						      */
+		case IMMND_EVT_A2ND_CLASS_DESCR_GET_2:
 			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
 			ncs_encode_32bit(
 			    &p8, immndevt->info.classDescr.className.size);
@@ -4079,6 +4207,30 @@ static uint32_t immsv_evt_enc_toplevel(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 			 * calls */
 			break;
 
+		case IMMND_EVT_A2ND_CCB_BATCH: /* saImmOmCcbObject*Async */
+			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
+			ncs_encode_32bit(&p8, immndevt->info.ccbBatch.ccbId);
+			ncs_enc_claim_space(o_ub, 4);
+
+			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
+			ncs_encode_32bit(&p8, immndevt->info.ccbBatch.batchNo);
+			ncs_enc_claim_space(o_ub, 4);
+
+			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
+			ncs_encode_32bit(&p8, immndevt->info.ccbBatch.numOps);
+			ncs_enc_claim_space(o_ub, 4);
+
+			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
+			ncs_encode_32bit(&p8,
+					 immndevt->info.ccbBatch.replyWanted);
+			ncs_enc_claim_space(o_ub, 4);
+
+			IMMSV_RSRV_SPACE_ASSERT(p8, o_ub, 4);
+			ncs_encode_32bit(&p8, immndevt->info.ccbBatch.ops.size);
+			ncs_enc_claim_space(o_ub, 4);
+			/* immndevt->info.ccbBatch.ops.buf encoded by sublevel */
+			break;
+
 		case IMMND_EVT_A2ND_CCB_APPLY:    /* saImmOmCcbApply */
 		case IMMND_EVT_A2ND_CCB_FINALIZE: /* saImmOmCcbFinalize */
 		case IMMND_EVT_A2ND_RECOVER_CCB_OUTCOME:
@@ -4663,6 +4815,7 @@ static uint32_t immsv_evt_enc_toplevel(IMMSV_EVT *i_evt, NCS_UBAID *o_ub)
 		case IMMND_EVT_MDS_INFO: /* IMMA/IMMND/IMMD UP/DOWN Info */
 		case IMMND_EVT_TIME_OUT: /* Time out event */
 		case IMMND_EVT_CB_DUMP:
+		case IMMND_EVT_READER_DONE:
 			LOG_ER("Unexpected event over MDS->IMMND:%u",
 			       immndevt->type);
 		/*Fall through */
@@ -5055,6 +5208,14 @@ static uint32_t immsv_evt_dec_toplevel(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 			   encoding/decoding is not required */
 			break;
 
+		case IMMA_EVT_ND2A_CLASS_CHANGED:
+			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
+			immaevt->info.classDescr.className.size =
+			    ncs_decode_32bit(&p8);
+			ncs_dec_skip_space(i_ub, 4);
+			/* className.buf decoded by sublevel */
+			break;
+
 		default:
 			LOG_ER("Illegal IMMA message type:%u", immaevt->type);
 			rc = NCSCC_RC_FAILURE;
@@ -5718,6 +5879,7 @@ static uint32_t immsv_evt_dec_toplevel(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 
 		case IMMND_EVT_A2ND_CLASS_DESCR_GET: /* saImmOmClassDescriptionGet
 						      */
+		case IMMND_EVT_A2ND_CLASS_DESCR_GET_2:
 			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
 			immndevt->info.classDescr.className.size =
 			    ncs_decode_32bit(&p8);
@@ -5854,6 +6016,30 @@ static uint32_t immsv_evt_dec_toplevel(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 			 * calls */
 			break;
 
+		case IMMND_EVT_A2ND_CCB_BATCH: /* saImmOmCcbObject*Async */
+			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
+			immndevt->info.ccbBatch.ccbId = ncs_decode_32bit(&p8);
+			ncs_dec_skip_space(i_ub, 4);
+
+			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
+			immndevt->info.ccbBatch.batchNo = ncs_decode_32bit(&p8);
+			ncs_dec_skip_space(i_ub, 4);
+
+			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
+			immndevt->info.ccbBatch.numOps = ncs_decode_32bit(&p8);
+			ncs_dec_skip_space(i_ub, 4);
+
+			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
+			immndevt->info.ccbBatch.replyWanted =
+			    ncs_decode_32bit(&p8);
+			ncs_dec_skip_space(i_ub, 4);
+
+			IMMSV_FLTN_SPACE_ASSERT(p8, local_data, i_ub, 4);
+			immndevt->info.ccbBatch.ops.size = ncs_decode_32bit(&p8);
+			ncs_dec_skip_space(i_ub, 4);
+			/* immndevt->info.ccbBatch.ops.buf decoded by sublevel */
+			break;
+
 		case IMMND_EVT_A2ND_CCB_APPLY:    /* saImmOmCcbApply */
 		case IMMND_EVT_A2ND_CCB_FINALIZE: /* saImmOmCcbFinalize */
 		case IMMND_EVT_A2ND_RECOVER_CCB_OUTCOME:
@@ -6475,6 +6661,7 @@ static uint32_t immsv_evt_dec_toplevel(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 		case IMMND_EVT_MDS_INFO: /* IMMA/IMMND/IMMD UP/DOWN Info */
 		case IMMND_EVT_TIME_OUT: /* Time out event */
 		case IMMND_EVT_CB_DUMP:
+		case IMMND_EVT_READER_DONE:
 			LOG_ER("Unexpected event over MDS->IMMND:%u",
 			       immndevt->type);
 			break;
@@ -6539,6 +6726,43 @@ uint32_t immsv_evt_dec(NCS_UBAID *i_ub, IMMSV_EVT *o_evt)
 	return rc;
 }
 
+/****************************************************************************\
+ PROCEDURE NAME : immsv_evt_dec_arena
+
+ DESCRIPTION    : Decodes the contents of IMMSV_EVT from user buf into memory
+		  owned by the arena, see immsv_evt.h.
+
+ ARGUMENTS      : *i_ub  - User Buff.
+		  *o_evt - Event Struct.
+		  *arena - Arena initialized by immsv_evt_arena_init.
+
+ RETURNS        : None
+
+ NOTES          :
+\*****************************************************************************/
+uint32_t immsv_evt_dec_arena(NCS_UBAID *i_ub, IMMSV_EVT *o_evt,
+			     IMMSV_EVT_ARENA *arena)
+{
+	uint32_t rc;
+	uint8_t *p8;
+	uint8_t local_data[8];
+
+	/* Peek at the event type and the IMMND event type */
+	p8 = ncs_dec_flatten_space(i_ub, local_data, 8);
+	if (p8 != NULL && ncs_decode_32bit(&p8) == IMMSV_EVT_TYPE_IMMND &&
+	    immsv_evt_arena_type(ncs_decode_32bit(&p8))) {
+		dec_arena = arena;
+	}
+
+	rc = immsv_evt_dec(i_ub, o_evt);
+
+	if (dec_arena != NULL) {
+		o_evt->info.immnd.dont_free_me = true;
+		dec_arena = NULL;
+	}
+	return rc;
+}
+
 void immsv_msg_trace_send(MDS_DEST to, IMMSV_EVT *evt)
 {
 	if (evt->type == IMMSV_EVT_TYPE_IMMD) {
@@ -105,6 +105,8 @@ typedef enum imma_evt_type {
       34, /* when clm-lock/clm-node left the cluster */
   IMMA_EVT_ND2A_IMM_CLM_NODE_JOINED =
       35, /* when clm-lock/clm-node join the cluster */
+  IMMA_EVT_ND2A_CLASS_CHANGED =
+      36, /* Class created, upgraded or deleted, see CLASS_DESCR_GET_2 */
 
   IMMA_EVT_MAX
 } IMMA_EVT_TYPE;
@@ -249,6 +251,13 @@ typedef enum immnd_evt_type {
 
   IMMND_EVT_D2ND_IMPLDELETE = 101, /* Applier delete */
 
+  IMMND_EVT_A2ND_CLASS_DESCR_GET_2 =
+      102, /* saImmOmClassDescriptionGet, agent caches the description */
+
+  IMMND_EVT_A2ND_CCB_BATCH = 103, /* saImmOmCcbObject*Async operations */
+
+  IMMND_EVT_READER_DONE = 104, /* Local: a snapshot reader is done */
+
   IMMND_EVT_MAX
 } IMMND_EVT_TYPE;
 /* Make sure the string array in immsv_evt.c matches the IMMND_EVT_TYPE enum. */
@@ -594,6 +603,7 @@ typedef struct immnd_evt {
     IMMSV_OM_CCB_OBJECT_CREATE objCreate;
     IMMSV_OM_CCB_OBJECT_MODIFY objModify;
     IMMSV_OM_CCB_OBJECT_DELETE objDelete;
+    IMMSV_OM_CCB_BATCH ccbBatch;
     IMMSV_OM_OBJECT_SYNC obj_sync;
     IMMSV_OM_FINALIZE_SYNC finSync;
 
@@ -610,6 +620,7 @@ typedef struct immnd_evt {
     IMMSV_D2ND_CCBINIT ccbinitGlobal;
 
     IMMSV_MDS_INFO mds_info; /* Locally generated events */
+    void *readerJob;         /* Locally generated events */
 
     SaUint64T syncFevsBase; /* FevsCount that sync iterator is
                                based on . */
@@ -671,6 +682,22 @@ typedef struct immsv_evt {
   IMMSV_SEND_INFO sinfo; /* MDS Sender information */
 } IMMSV_EVT;
 
+/******************************************************************************
+ Memory of an event decoded by immsv_evt_dec_arena
+ ******************************************************************************/
+typedef struct immsv_evt_arena_block {
+  struct immsv_evt_arena_block *next;
+  size_t size; /* Bytes following the header */
+  size_t used;
+} IMMSV_EVT_ARENA_BLOCK;
+
+typedef struct immsv_evt_arena {
+  IMMSV_EVT_ARENA_BLOCK *blocks; /* Block allocated from first */
+  size_t block_size;
+  const char *base; /* Flat copy of the decoded buffer, or NULL */
+  uint32_t base_size;
+} IMMSV_EVT_ARENA;
+
 /* Event Declerations */
 
 uint32_t immsv_evt_enc_flat(/*EDU_HDL *edu_hdl, */ IMMSV_EVT *i_evt,
@@ -682,6 +709,25 @@ uint32_t immsv_evt_enc(/*EDU_HDL *edu_hdl, */ IMMSV_EVT *i_evt,
 uint32_t immsv_evt_dec(/*EDU_HDL *edu_hdl, */ NCS_UBAID *i_ub,
                        IMMSV_EVT *o_evt);
 
+/* Decoding into an arena. Used for the events that are decoded, processed and
+   freed within one call, e.g. the messages dispatched over fevs. Instead of
+   allocating every name, value and list node separately the memory is taken
+   from the arena and released all at once by immsv_evt_arena_free.
+
+   If base is not NULL it is a flat copy of the buffer i_ub is decoded from,
+   strings of the event are then not copied but point into base, which must
+   outlive the event.
+
+   Only CCB modify/delete, RT object delete and sync messages are decoded into
+   the arena, the receiver of other messages may take over parts of them.
+   The dont_free_me flag of an event decoded into the arena is set, other
+   events are decoded as by immsv_evt_dec and freed as usual. */
+void immsv_evt_arena_init(IMMSV_EVT_ARENA *arena, const char *base,
+                          uint32_t base_size);
+uint32_t immsv_evt_dec_arena(NCS_UBAID *i_ub, IMMSV_EVT *o_evt,
+                             IMMSV_EVT_ARENA *arena);
+void immsv_evt_arena_free(IMMSV_EVT_ARENA *arena);
+
 void immsv_evt_enc_inline_string(NCS_UBAID *o_ub, IMMSV_OCTET_STRING *os);
 
 void immsv_evt_dec_inline_string(NCS_UBAID *i_ub, IMMSV_OCTET_STRING *os);
@@ -171,6 +171,18 @@ typedef struct ImmsvOmCcbObjectDelete {
   SaUint64T immHandle;  // only used for the ND->A up-call
 } IMMSV_OM_CCB_OBJECT_DELETE;
 
+/* Ccb operations streamed by the saImmOmCcbObject*Async functions and sent
+   in one message. The ops string holds the encoded IMMND events of the
+   operations, each preceded by its size as a 32 bit integer in network byte
+   order. */
+typedef struct ImmsvOmCcbBatch {
+  SaUint32T ccbId;
+  SaUint32T batchNo;      // 1 for the first batch sent for the ccb
+  SaUint32T numOps;
+  SaUint32T replyWanted;  // Client waits for all batches to be processed
+  IMMSV_OCTET_STRING ops;
+} IMMSV_OM_CCB_BATCH;
+
 typedef struct ImmsvOmCcbCompleted {
   SaUint32T ccbId;
   SaUint32T implId;
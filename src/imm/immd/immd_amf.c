@@ -20,6 +20,7 @@
 #include "immd.h"
 #include "imm/common/immsv.h"
 #include "base/osaf_extended_name.h"
+#include "base/osaf_failover_timeline.h"
 
 /**
  * Return string describing HA state
@@ -197,6 +198,9 @@ static void immd_saf_csi_set_cb(SaInvocationT invocation,
 	TRACE_ENTER();
 
 	prev_ha_state = cb->ha_state;
+	if (new_haState == SA_AMF_HA_ACTIVE &&
+	    prev_ha_state != SA_AMF_HA_ACTIVE)
+		osaf_failover_timeline_mark("csi set active");
 
 	bool was_fully_initialized = cb->fully_initialized;
 	if ((rc = initialize_for_assignment(cb, new_haState)) !=
@@ -285,6 +289,7 @@ static void immd_saf_csi_set_cb(SaInvocationT invocation,
 			}
 			immd_db_purge_fevs(cb);
 			immd_pending_discards(cb);
+			osaf_failover_timeline_mark("active role done");
 		}
 	}
 
@@ -21,8 +21,12 @@
 
 #include "imm/immloadd/imm_loader.h"
 #include "mds/mds_papi.h"
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <libxml/parser.h>
 #include <libxml/xpath.h>
 #include <stdio.h>
@@ -38,6 +42,7 @@
 
 #include <saAis.h>
 #include "base/osaf_extended_name.h"
+#include "base/osaf_time.h"
 #include "imm/common/immsv_utils.h"
 
 // Default value of accessControlMode attribute in the OpensafImm class
@@ -2209,8 +2214,103 @@ void syncClassDescription(std::string className, SaImmHandleT &immHandle) {
   saImmOmClassDescriptionMemoryFree_2(immHandle, attrDefinitions);
 }
 
+// Sends the batches of objects built by syncObjectsOfClass over fevs, so that
+// the next batch is fetched from the coordinator and built while the previous
+// one is encoded and sent. Batches are sent in the order they are queued.
+//
+// All batches of a class must be sent before the search for the next class is
+// initialized, since that search sets the fevs base that the sync clients use
+// for deferred runtime attribute updates of the objects they receive.
+class SyncSender {
+ public:
+  explicit SyncSender(SaImmHandleT immHandle)
+      : immHandle_(immHandle),
+        stop_(false),
+        sending_(false),
+        batches_(0),
+        thread_(&SyncSender::run, this) {}
+
+  ~SyncSender() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    queued_.notify_one();
+    thread_.join();
+  }
+
+  // Queue a batch built with immsv_sync_add. Waits while kMaxQueued batches
+  // are waiting to be sent.
+  void send(const std::string &className, void *batch, int objsInBatch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    sent_.wait(lock, [this] { return queue_.size() < kMaxQueued; });
+    queue_.push_back(Batch{className, batch, objsInBatch});
+    queued_.notify_one();
+  }
+
+  // Wait until all queued batches are sent.
+  void drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    sent_.wait(lock, [this] { return queue_.empty() && !sending_; });
+  }
+
+  unsigned int batches() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return batches_;
+  }
+
+ private:
+  struct Batch {
+    std::string className;
+    void *batch;
+    int objsInBatch;
+  };
+
+  static const size_t kMaxQueued = 2;
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      queued_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+      if (queue_.empty()) break;
+      Batch batch = queue_.front();
+      queue_.pop_front();
+      sending_ = true;
+      lock.unlock();
+      sendBatch(&batch);
+      lock.lock();
+      sending_ = false;
+      ++batches_;
+      sent_.notify_all();
+    }
+  }
+
+  void sendBatch(Batch *batch) {
+    SaNameT objectName;
+    int remainingSpace = 0;
+    osaf_extended_name_clear(&objectName);
+    SaAisErrorT err = immsv_sync(
+        immHandle_, const_cast<SaImmClassNameT>(batch->className.c_str()),
+        &objectName, NULL, &batch->batch, &remainingSpace, batch->objsInBatch);
+    if (err != SA_AIS_OK) {
+      LOG_ER("Object sync failed with error error:%u", err);
+      exit(1);
+    }
+  }
+
+  SaImmHandleT immHandle_;
+  std::mutex mutex_;
+  std::condition_variable queued_;
+  std::condition_variable sent_;
+  std::deque<Batch> queue_;
+  bool stop_;
+  bool sending_;
+  unsigned int batches_;
+  std::thread thread_;
+};
+
 int syncObjectsOfClass(std::string className, SaImmHandleT &immHandle,
-                       int maxBatchSize) {
+                       int maxBatchSize, SyncSender &sender) {
   SaImmClassCategoryT classCategory;
   SaImmAttrDefinitionT_2 **attrDefinitions;
   TRACE("Syncing instances of class %s", className.c_str());
@@ -2305,7 +2405,6 @@ int syncObjectsOfClass(std::string className, SaImmHandleT &immHandle,
   SaNameT objectName;
   osaf_extended_name_clear(&objectName);
   SaImmAttrValuesT_2 **attributes = NULL;
-  bool message_buffered = false;
   void *batch = NULL;
   int remainingSpace = maxBatchSize;
   int objsInBatch = 0;
@@ -2372,19 +2471,19 @@ int syncObjectsOfClass(std::string className, SaImmHandleT &immHandle,
 
     ++nrofObjs;
     ++objsInBatch;
-    /* Asyncronous */
-    err = immsv_sync(immHandle, cln, &objectName,
-                     (const SaImmAttrValuesT_2 **)attributes, &batch,
-                     &remainingSpace, objsInBatch);
+    err = immsv_sync_add(cln, &objectName,
+                         (const SaImmAttrValuesT_2 **)attributes, &batch,
+                         &remainingSpace, objsInBatch);
 
     if (err == SA_AIS_OK) {
-      TRACE("SA_AIS_OK => sync sent message");
-      message_buffered = false;
+      TRACE("SA_AIS_OK => batch full, queued for sending");
+      /* Asyncronous */
+      sender.send(className, batch, objsInBatch);
+      batch = NULL;
       remainingSpace = maxBatchSize;
       objsInBatch = 0;
     } else if (err == SA_AIS_ERR_NOT_READY) {
       TRACE("SA_AIS_ERR_NOT_READY => BUFFERED");
-      message_buffered = true;
       err = SA_AIS_OK;
     } else {
       LOG_ER("Object sync failed with error error:%u", err);
@@ -2404,16 +2503,12 @@ done:
     exit(1);
   }
 
-  if (message_buffered) {
+  if (batch != NULL) {
     TRACE(
         "SA_AIS_ERR_NOT_EXIST => BUFFERED & end of iter => send unfilled batch");
-    err = immsv_sync(immHandle, cln, &objectName, NULL, &batch, &remainingSpace,
-                     objsInBatch);
-    if (err != SA_AIS_OK) {
-      LOG_ER("Object sync failed with error error:%u", err);
-      exit(1);
-    }
+    sender.send(className, batch, objsInBatch);
   }
+  sender.drain();
 
   saImmOmSearchFinalize(searchHandle);
   return nrofObjs;
@@ -2462,13 +2557,25 @@ int immsync(int maxBatchSize) {
   it = classNamesList.begin();
 
   int nrofObjects = 0;
-  while (it != classNamesList.end()) {
-    int objects = syncObjectsOfClass(*it, immHandle, maxBatchSize);
-    TRACE("Synced %u objects of class %s", objects, (*it).c_str());
-    nrofObjects += objects;
-    ++it;
-  }
-  LOG_IN("Synced %u objects in total", nrofObjects);
+  unsigned int nrofBatches;
+  struct timespec start, end, elapsed;
+  osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+  {
+    SyncSender sender(immHandle);
+    while (it != classNamesList.end()) {
+      int objects = syncObjectsOfClass(*it, immHandle, maxBatchSize, sender);
+      TRACE("Synced %u objects of class %s", objects, (*it).c_str());
+      nrofObjects += objects;
+      ++it;
+    }
+    nrofBatches = sender.batches();
+  }
+  osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+  osaf_timespec_subtract(&end, &start, &elapsed);
+  double secs = osaf_timespec_to_double(&elapsed);
+  LOG_NO("Synced %d objects in %u messages in %.3f seconds (%.0f objects/s)",
+         nrofObjects, nrofBatches, secs,
+         secs > 0 ? nrofObjects / secs : 0.0);
 
   retries = 0;
   do {
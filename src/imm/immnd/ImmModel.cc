@@ -24,6 +24,7 @@
 #include "imm/immnd/ImmModel.h"
 #include "imm/immnd/ImmAttrValue.h"
 #include "imm/immnd/ImmSearchOp.h"
+#include "imm/immnd/ImmSnapshot.h"
 
 #include "immnd.h"
 #include "base/osaf_unicode.h"
@@ -613,6 +614,26 @@ static SaUint32T sTerminatedCcbcount = 0; /* Terminated ccbs count. calculated
 // Show the status of underlying file system.
 static bool sFileSystemAvailable = true;
 
+/* Snapshot readers, see ImmSnapshot.h. sReaderPool is NULL when they are not
+   enabled. Everything below is only touched by the IMMND thread. */
+struct ImmReaderJob {
+  IMMSV_EVT* mEvt;
+  std::shared_ptr<const ImmSnapshot> mSnapshot;
+  SaUint32T mGeneration;  // sSnapshotGeneration when dispatched
+  ImmSearchOp* mOp;
+  SaAisErrorT mErr;
+};
+static ImmReaderPool* sReaderPool = NULL;
+static std::shared_ptr<const ImmSnapshot> sSnapshot;
+static ObjectNameSet sSnapshotDirty;  // DNs changed since sSnapshot
+static bool sSnapshotRebuild = true;  // Rebuild sSnapshot from scratch
+/* Bumped when ImplementerInfo may be freed. A job dispatched before is
+   redone by the IMMND thread, see immModel_readerResult. */
+static SaUint32T sSnapshotGeneration = 0;
+static std::map<ClassInfo*, std::shared_ptr<const ImmSnapshotClass>>
+    sSnapshotClasses;
+static std::set<ImmReaderJob*> sReaderJobs;
+
 struct AttrFlagIncludes {
   explicit AttrFlagIncludes(SaImmAttrFlagsT attrFlag) : mFlag(attrFlag) {}
 
@@ -1132,6 +1153,10 @@ bool immModel_protocol51906Allowed(IMMND_CB* cb) {
   return ImmModel::instance(&cb->immModel)->protocol51906Allowed();
 }
 
+bool immModel_protocol52103Allowed(IMMND_CB* cb) {
+  return ImmModel::instance(&cb->immModel)->protocol52103Allowed();
+}
+
 OsafImmAccessControlModeT immModel_accessControlMode(IMMND_CB* cb) {
   return ImmModel::instance(&cb->immModel)->accessControlMode();
 }
@@ -1578,6 +1603,104 @@ SaAisErrorT immModel_searchInitialize(IMMND_CB* cb,
   return err;
 }
 
+void immModel_startReaders(IMMND_CB* cb, unsigned int threads) {
+  LOG_NO("Searches and accessor gets are served by %u snapshot readers",
+         threads);
+  sReaderPool = new ImmReaderPool(threads);
+}
+
+/* Hands a search or accessor get over to a snapshot reader. The request is
+   answered when IMMND_EVT_READER_DONE comes back, by the regular handler
+   using the result of the reader, see immModel_readerResult. Returns false
+   when the request has to be served by the IMMND thread. */
+bool immModel_readerDispatch(IMMND_CB* cb, IMMSV_EVT* evt) {
+  const ImmsvOmSearchInit* req = &evt->info.immnd.info.searchInit;
+  bool isAccessor = (evt->info.immnd.type == IMMND_EVT_A2ND_ACCESSOR_GET);
+
+  if (!sReaderPool || cb->mState != IMM_SERVER_READY || req->ccbId) {
+    return false;
+  }
+  /* The dump, the sync and searches for no dangling dependents use state
+     that is not in the snapshot. */
+  if (!isAccessor &&
+      (req->searchOptions & (SA_IMM_SEARCH_PERSISTENT_ATTRS |
+                             SA_IMM_SEARCH_SYNC_CACHED_ATTRS |
+                             SA_IMM_SEARCH_NO_DANGLING_DEPENDENTS))) {
+    return false;
+  }
+
+  ImmModel* model = ImmModel::instance(&cb->immModel);
+  ImmReaderJob* job = new ImmReaderJob();
+  job->mEvt = evt;
+  job->mSnapshot = model->snapshotPublish();
+  job->mGeneration = sSnapshotGeneration;
+  job->mOp = new ImmSearchOp();
+  job->mErr = SA_AIS_OK;
+  if (isAccessor) {
+    job->mOp->setIsAccessor();
+  }
+  sReaderJobs.insert(job);
+
+  SYSF_MBX* mbx = &cb->immnd_mbx;
+  sReaderPool->submit([model, job, req, isAccessor, mbx]() {
+    if (isAccessor) {
+      job->mErr = model->snapshotAccessorGet(*job->mSnapshot, req, *job->mOp);
+    } else {
+      job->mErr = model->snapshotSearch(*job->mSnapshot, req, *job->mOp);
+    }
+    job->mSnapshot.reset();
+
+    IMMSV_EVT* done = (IMMSV_EVT*)calloc(1, sizeof(IMMSV_EVT));
+    if (done == NULL) {
+      LOG_ER("calloc failed, reader job %p is lost", job);
+      return;
+    }
+    done->type = IMMSV_EVT_TYPE_IMMND;
+    done->info.immnd.type = IMMND_EVT_READER_DONE;
+    done->info.immnd.info.readerJob = job;
+    if (m_NCS_IPC_SEND(mbx, (NCSCONTEXT)done, NCS_IPC_PRIORITY_HIGH) !=
+        NCSCC_RC_SUCCESS) {
+      LOG_ER("NCS IPC Send Failed, reader job %p is lost", job);
+      free(done);
+    }
+  });
+
+  return true;
+}
+
+IMMSV_EVT* immModel_readerRequest(IMMND_CB* cb, void* job) {
+  ImmReaderJob* readerJob = static_cast<ImmReaderJob*>(job);
+  if (sReaderJobs.find(readerJob) == sReaderJobs.end()) {
+    return NULL;
+  }
+  return readerJob->mEvt;
+}
+
+SaAisErrorT immModel_readerResult(IMMND_CB* cb, void* job, void** searchOp) {
+  ImmReaderJob* readerJob = static_cast<ImmReaderJob*>(job);
+  if (readerJob->mGeneration != sSnapshotGeneration) {
+    /* Implementers may have been freed since the job was dispatched,
+       the result can not be used. */
+    TRACE("Reader job %p is stale, searching the model", job);
+    return immModel_searchInitialize(
+        cb, &readerJob->mEvt->info.immnd.info.searchInit, searchOp, false,
+        readerJob->mOp->isAccessor());
+  }
+
+  ImmSearchOp* op = readerJob->mOp;
+  readerJob->mOp = NULL;
+  op->updateSearchTime();
+  *searchOp = op;
+  return readerJob->mErr;
+}
+
+void immModel_readerRelease(IMMND_CB* cb, void* job) {
+  ImmReaderJob* readerJob = static_cast<ImmReaderJob*>(job);
+  sReaderJobs.erase(readerJob);
+  delete readerJob->mOp;
+  delete readerJob;
+}
+
 SaAisErrorT immModel_testTopResult(void* searchOp, SaUint32T* implNodeId,
                                    bool* bRtAttrsToFetch) {
   SaAisErrorT err;
@@ -2286,6 +2409,47 @@ void immModel_setCcbErrorString(IMMND_CB* cb, SaUint32T ccbId,
   va_end(vl);
 }
 
+/* Check if a ccb can take a new operation streamed by saImmOmCcbObject*Async.
+   TRY_AGAIN means that the previous operation is waiting for implementers. */
+SaAisErrorT immModel_ccbReadyForOp(IMMND_CB* cb, SaUint32T ccbId) {
+  CcbVector::iterator cvi =
+      std::find_if(sCcbVector.begin(), sCcbVector.end(), CcbIdIs(ccbId));
+  if (cvi == sCcbVector.end() || !(*cvi)->isActive()) {
+    return SA_AIS_ERR_BAD_HANDLE;
+  }
+
+  CcbInfo* ccb = *cvi;
+  if (!ccb->isOk()) {
+    return SA_AIS_ERR_FAILED_OPERATION;
+  }
+
+  if (ccb->mAugCcbParent || ccb->mState == IMM_CCB_CREATE_OP ||
+      ccb->mState == IMM_CCB_MODIFY_OP || ccb->mState == IMM_CCB_DELETE_OP) {
+    return SA_AIS_ERR_TRY_AGAIN;
+  }
+
+  return (ccb->mState <= IMM_CCB_READY) ? SA_AIS_OK
+                                        : SA_AIS_ERR_FAILED_OPERATION;
+}
+
+/* A streamed operation failed, the ccb can then only be aborted */
+void immModel_ccbVeto(IMMND_CB* cb, SaUint32T ccbId, SaAisErrorT err) {
+  CcbVector::iterator cvi =
+      std::find_if(sCcbVector.begin(), sCcbVector.end(), CcbIdIs(ccbId));
+  if (cvi == sCcbVector.end() || !(*cvi)->isActive() || !(*cvi)->isOk()) {
+    return;
+  }
+
+  LOG_NO("Ccb %u vetoed, streamed operation failed with error: %u", ccbId,
+         err);
+  (*cvi)->mVeto = SA_AIS_ERR_FAILED_OPERATION;
+  ImmModel::instance(&cb->immModel)
+      ->setCcbErrorString(*cvi,
+                          IMM_VALIDATION_ABORT
+                          "Streamed operation failed with error: %u",
+                          err);
+}
+
 void immModel_implementerDelete(IMMND_CB *cb, const char *implementerName) {
   ImmModel::instance(&cb->immModel)->implementerDelete(implementerName);
 }
@@ -2464,6 +2628,7 @@ bool ImmModel::immNotPbeWritable(bool isPrtoClient) {
 }
 
 void ImmModel::prepareForLoading() {
+  snapshotInvalidate();
   switch (sImmNodeState) {
     case IMM_NODE_UNKNOWN:
       sImmNodeState = IMM_NODE_LOADING;
@@ -2517,6 +2682,7 @@ void ImmModel::recognizedIsolated() {
 }
 
 void ImmModel::prepareForSync(bool isJoining) {
+  snapshotInvalidate();
   switch (sImmNodeState) {
     case IMM_NODE_ISOLATED:
       osafassert(isJoining);
@@ -2706,6 +2872,7 @@ void ImmModel::pbePrtoPurgeMutations(unsigned int nodeId,
 
 void ImmModel::abortSync() {
   ClassMap::iterator ci;
+  snapshotInvalidate();
   switch (sImmNodeState) {
     case IMM_NODE_R_AVAILABLE:
       sImmNodeState = IMM_NODE_FULLY_AVAILABLE;
@@ -2873,6 +3040,7 @@ int ImmModel::adjustEpoch(int suggestedEpoch, SaUint32T* continuationIdPtr,
   int restoredEpoch = 0;
   ImmAttrValueMap::iterator avi;
   ObjectMap::iterator oi = sObjectMap.find(immObjectDn);
+  snapshotMarkDirty(immObjectDn);
   osafassert(oi != sObjectMap.end() && oi->second);
 
   ObjectInfo* immObject = oi->second;
@@ -3776,6 +3944,7 @@ SaAisErrorT ImmModel::classCreate(const ImmsvOmClassDescr* req,
       }
     }
 
+    snapshotInvalidate();
     LOG_NO("Schema change completed for class %s %s", className.c_str(),
            pbeNodeIdPtr ? "(PBE changes still pending)." : "");
   } /* end of schema upgrade case. */
@@ -4066,6 +4235,27 @@ bool ImmModel::protocol51906Allowed() {
   return noStdFlags & OPENSAF_IMM_FLAG_PRT51906_ALLOW;
 }
 
+bool ImmModel::protocol52103Allowed() {
+  /* Assume that all nodes are running the same version when loading */
+  if (sImmNodeState == IMM_NODE_LOADING) {
+    return true;
+  }
+  ObjectMap::iterator oi = sObjectMap.find(immObjectDn);
+  if (oi == sObjectMap.end()) {
+    return false;
+  }
+
+  ObjectInfo* immObject = oi->second;
+  ImmAttrValueMap::iterator avi =
+      immObject->mAttrValueMap.find(immAttrNostFlags);
+  osafassert(avi != immObject->mAttrValueMap.end());
+  osafassert(!(avi->second->isMultiValued()));
+  ImmAttrValue* valuep = avi->second;
+  unsigned int noStdFlags = valuep->getValue_int();
+
+  return noStdFlags & OPENSAF_IMM_FLAG_PRT52103_ALLOW;
+}
+
 bool ImmModel::protocol41Allowed() {
   // TRACE_ENTER();
   ObjectMap::iterator oi = sObjectMap.find(immObjectDn);
@@ -4830,6 +5020,7 @@ SaAisErrorT ImmModel::classDelete(const ImmsvOmClassDescr* req,
         ++ai;
       }
       i->second->mAttrMap.clear();
+      sSnapshotClasses.erase(i->second);
       delete i->second;
       sClassMap.erase(i);
       updateImmObject(className, true);
@@ -5200,7 +5391,9 @@ SaAisErrorT ImmModel::adminOwnerDelete(SaUint32T ownerId, bool hard,
           } else {
             noStdFlags |= OPENSAF_IMM_FLAG_PRT51906_ALLOW;
           }
+          noStdFlags |= OPENSAF_IMM_FLAG_PRT52103_ALLOW;
           valuep->setValue_int(noStdFlags);
+          snapshotMarkDirty(immObjectDn);
           LOG_NO("%s changed to: 0x%x", immAttrNostFlags.c_str(), noStdFlags);
           /* END Temporary code. */
         } else {
@@ -6134,11 +6327,13 @@ void ImmModel::commitCreate(ObjectInfo* obj) {
   // obj->mCreateLock = false;
   obj->mObjFlags &= ~(IMM_CREATE_LOCK | IMM_NO_DANGLING_FLAG);
   /*TRACE_5("Flags after remove create lock:%u", obj->mObjFlags);*/
+  snapshotMarkDirty(obj);
 }
 
 bool ImmModel::commitModify(const std::string& dn, ObjectInfo* afterImage) {
   TRACE_ENTER();
   TRACE_5("COMMITING MODIFY of %s", dn.c_str());
+  snapshotMarkDirty(dn);
   ObjectMap::iterator oi = sObjectMap.find(dn);
   osafassert(oi != sObjectMap.end());
   ObjectInfo* beforeImage = oi->second;
@@ -6237,6 +6432,7 @@ bool ImmModel::commitModify(const std::string& dn, ObjectInfo* afterImage) {
 void ImmModel::commitDelete(const std::string& dn) {
   TRACE_ENTER();
   TRACE_5("COMMITING DELETE of %s", dn.c_str());
+  snapshotMarkDirty(dn);
   ObjectMap::iterator oi = sObjectMap.find(dn);
   osafassert(oi != sObjectMap.end());
 
@@ -13011,6 +13207,556 @@ searchInitializeExit:
   return err;
 }
 
+void ImmModel::snapshotMarkDirty(const std::string& dn) {
+  if (!sReaderPool || sSnapshotRebuild) {
+    return;
+  }
+  sSnapshotDirty.insert(dn);
+  if (sSnapshotDirty.size() > sObjectMap.size() / 2) {
+    /* Cheaper to copy all objects than to replace most of them. */
+    sSnapshotRebuild = true;
+    sSnapshotDirty.clear();
+  }
+}
+
+void ImmModel::snapshotMarkDirty(ObjectInfo* obj) {
+  if (!sReaderPool || sSnapshotRebuild) {
+    return;
+  }
+  std::string dn;
+  getObjectName(obj, dn);
+  if (obj->mObjFlags & IMM_DN_INTERNAL_REP) {
+    nameToInternal(dn);
+  }
+  snapshotMarkDirty(dn);
+}
+
+void ImmModel::snapshotInvalidate() {
+  sSnapshot.reset();
+  sSnapshotRebuild = true;
+  sSnapshotDirty.clear();
+  sSnapshotClasses.clear();
+  ++sSnapshotGeneration;
+}
+
+std::shared_ptr<const ImmSnapshotObject> ImmModel::snapshotObject(
+    ObjectInfo* obj) {
+  std::shared_ptr<const ImmSnapshotClass>& cls =
+      sSnapshotClasses[obj->mClassInfo];
+  if (!cls) {
+    std::shared_ptr<ImmSnapshotClass> newCls =
+        std::make_shared<ImmSnapshotClass>();
+    for (const auto& ci : sClassMap) {
+      if (ci.second == obj->mClassInfo) {
+        newCls->mName = ci.first;
+        break;
+      }
+    }
+    for (const auto& ai : obj->mClassInfo->mAttrMap) {
+      ImmSnapshotAttr& attr = newCls->mAttrMap[ai.first];
+      attr.mValueType = (SaImmValueTypeT)ai.second->mValueType;
+      attr.mFlags = ai.second->mFlags;
+    }
+    cls = newCls;
+  }
+
+  std::shared_ptr<ImmSnapshotObject> snapObj =
+      std::make_shared<ImmSnapshotObject>();
+  snapObj->mClass = cls;
+  snapObj->mValues.reserve(obj->mAttrValueMap.size());
+  for (const auto& av : obj->mAttrValueMap) {
+    ImmSnapshotValue value;
+    value.mAttr = cls->mAttrMap.find(av.first);
+    osafassert(value.mAttr != cls->mAttrMap.end());
+    if (av.second->isMultiValued()) {
+      value.mValue = new ImmAttrMultiValue(*((ImmAttrMultiValue*)av.second));
+    } else {
+      value.mValue = new ImmAttrValue(*av.second);
+    }
+    // The implementer name is added artificially, see accessorGet
+    if (obj->mImplementer && av.first == SA_IMM_ATTR_IMPLEMENTER_NAME) {
+      value.mValue->setValueC_str(obj->mImplementer->mImplementerName.c_str());
+    }
+    snapObj->mValues.push_back(value);
+  }
+  snapObj->mImplementer = obj->mImplementer;
+  snapObj->mInternalRep = (obj->mObjFlags & IMM_DN_INTERNAL_REP) != 0;
+  snapObj->mChildCount = obj->mChildCount;
+  return snapObj;
+}
+
+/* Returns the snapshot of the committed objects for the next reader job.
+   Only the objects marked dirty since the last one are copied again. */
+std::shared_ptr<const ImmSnapshot> ImmModel::snapshotPublish() {
+  std::shared_ptr<ImmSnapshot> snap;
+
+  if (!sSnapshot || sSnapshotRebuild) {
+    TRACE("Copying %u objects to a new snapshot",
+          (unsigned int)sObjectMap.size());
+    sSnapshotClasses.clear();
+    snap = std::make_shared<ImmSnapshot>();
+    for (const auto& oi : sObjectMap) {
+      if (!(oi.second->mObjFlags & IMM_CREATE_LOCK)) {
+        snap->setObject(oi.first, snapshotObject(oi.second));
+      }
+    }
+  } else if (!sSnapshotDirty.empty()) {
+    snap = std::make_shared<ImmSnapshot>(*sSnapshot);
+    ObjectNameSet ancestors;
+    for (const auto& dn : sSnapshotDirty) {
+      ObjectMap::iterator oi = sObjectMap.find(dn);
+      bool visible = (oi != sObjectMap.end()) &&
+                     !(oi->second->mObjFlags & IMM_CREATE_LOCK);
+      bool wasVisible = (snap->find(dn) != NULL);
+      if (visible) {
+        snap->setObject(dn, snapshotObject(oi->second));
+      } else {
+        snap->eraseObject(dn);
+      }
+      if (visible != wasVisible) {
+        /* The child counts of the ancestors have changed. */
+        std::string parentName;
+        getParentDn(parentName, dn);
+        while (!parentName.empty() && ancestors.insert(parentName).second) {
+          std::string objectName(parentName);
+          getParentDn(parentName, objectName);
+        }
+      }
+    }
+    for (const auto& dn : ancestors) {
+      ObjectMap::iterator oi = sObjectMap.find(dn);
+      if ((sSnapshotDirty.find(dn) == sSnapshotDirty.end()) &&
+          (oi != sObjectMap.end()) &&
+          !(oi->second->mObjFlags & IMM_CREATE_LOCK)) {
+        snap->setObject(dn, snapshotObject(oi->second));
+      }
+    }
+  }
+  sSnapshotDirty.clear();
+  sSnapshotRebuild = false;
+
+  /* Attachment of implementers is not tracked, copy it every time. */
+  std::shared_ptr<ImmSnapshotImplMap> impls =
+      std::make_shared<ImmSnapshotImplMap>();
+  for (const auto& info : sImplementerVector) {
+    if (!info->mApplier) {
+      ImmSnapshotImplementer& impl = (*impls)[info];
+      impl.mAttached = (info->mNodeId != 0);
+      impl.mDetached = (sImplDetachTime.find(info) != sImplDetachTime.end());
+    }
+  }
+  if (!snap && !(*sSnapshot->implementers() == *impls)) {
+    snap = std::make_shared<ImmSnapshot>(*sSnapshot);
+  }
+  if (snap) {
+    if (sSnapshot && (*sSnapshot->implementers() == *impls)) {
+      snap->setImplementers(sSnapshot->implementers());
+    } else {
+      snap->setImplementers(impls);
+    }
+    sSnapshot = snap;
+  }
+
+  return sSnapshot;
+}
+
+SaAisErrorT ImmModel::snapshotAccessorGet(const ImmSnapshot& snap,
+                                          const ImmsvOmSearchInit* req,
+                                          ImmSearchOp& op) {
+  TRACE_ENTER();
+  SaAisErrorT err = SA_AIS_OK;
+
+  size_t sz = strnlen((char*)req->rootName.buf, (size_t)req->rootName.size);
+  std::string objectName((const char*)req->rootName.buf, sz);
+
+  SaImmScopeT scope = (SaImmScopeT)req->scope;
+  SaImmSearchOptionsT searchOptions = (SaImmSearchOptionsT)req->searchOptions;
+  const ImmSnapshotObject* obj = NULL;
+  const ImmsvAttrNameList* list = NULL;
+  int matchedAttributes = 0;
+  int soughtAttributes = 0;
+  bool nonExtendedNameCheck =
+      req->searchParam.present > ImmOmSearchParameter_PR_oneAttrParam;
+
+  if (nonExtendedNameCheck) {
+    op.setNonExtendedName();
+  }
+
+  if (objectName.empty()) {
+    LOG_NO("ERR_INVALID_PARAM: Empty DN is not allowed");
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto accessorExit;
+  }
+
+  if (nonExtendedNameCheck &&
+      objectName.size() >= SA_MAX_UNEXTENDED_NAME_LENGTH) {
+    LOG_NO("ERR_NAME_TOO_LONG: Object name is too long");
+    err = SA_AIS_ERR_NAME_TOO_LONG;
+    goto accessorExit;
+  }
+
+  // Validate object name
+  if (!(nameCheck(objectName) || nameToInternal(objectName))) {
+    LOG_NO("ERR_INVALID_PARAM: Not a proper object name");
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto accessorExit;
+  }
+
+  obj = snap.find(objectName);
+  if (!obj) {
+    TRACE_7("ERR_NOT_EXIST: Object '%s' does not exist", objectName.c_str());
+    err = SA_AIS_ERR_NOT_EXIST;
+    goto accessorExit;
+  }
+
+  // Validate scope
+  if (scope != SA_IMM_ONE) {
+    LOG_NO("ERR_INVALID_PARAM: invalid search scope");
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto accessorExit;
+  }
+
+  // Validate searchOptions
+  if (searchOptions &
+      ~(SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_ALL_ATTR |
+        SA_IMM_SEARCH_GET_SOME_ATTR | SA_IMM_SEARCH_GET_CONFIG_ATTR |
+        SA_IMM_SEARCH_NO_RDN)) {
+    LOG_WA("ERR_LIBRARY: Invalid search criteria - library problem ?");
+    err = SA_AIS_ERR_LIBRARY;
+    goto accessorExit;
+  }
+
+  if (obj->mInternalRep) {
+    nameToExternal(objectName);
+  }
+  op.addObject(objectName);
+  err = snapshotAddAttributes(snap, objectName, *obj, req, op,
+                              &matchedAttributes);
+  if (err != SA_AIS_OK) {
+    goto accessorExit;
+  }
+
+  if (searchOptions & SA_IMM_SEARCH_GET_SOME_ATTR) {
+    for (list = req->attributeNames; list; list = list->next) {
+      ++soughtAttributes;
+    }
+    if (matchedAttributes != soughtAttributes) {
+      LOG_NO(
+          "ERR_NOT_EXIST: Some attributeNames did not exist in Object '%s' "
+          "(nrof names:%u matched:%u)",
+          objectName.c_str(), soughtAttributes, matchedAttributes);
+      err = SA_AIS_ERR_NOT_EXIST;
+    }
+  }
+
+accessorExit:
+  TRACE_LEAVE();
+  return err;
+}
+
+/* Same rules as the attribute loops of accessorGet and searchInitialize.
+   Counts the attributes of a SA_IMM_SEARCH_GET_SOME_ATTR in matched. */
+SaAisErrorT ImmModel::snapshotAddAttributes(const ImmSnapshot& snap,
+                                            const std::string& objectName,
+                                            const ImmSnapshotObject& obj,
+                                            const ImmsvOmSearchInit* req,
+                                            ImmSearchOp& op, int* matched) {
+  SaImmSearchOptionsT searchOptions = (SaImmSearchOptionsT)req->searchOptions;
+  bool nonExtendedNameCheck =
+      req->searchParam.present > ImmOmSearchParameter_PR_oneAttrParam;
+  const ImmSnapshotImplementer* impl = snap.findImplementer(obj.mImplementer);
+  bool implNotSet = true;
+
+  for (const auto& value : obj.mValues) {
+    const std::string& attrName = value.mAttr->first;
+    const ImmSnapshotAttr& attr = value.mAttr->second;
+    const ImmAttrValue* av = value.mValue;
+    bool checkAttribute = false;
+
+    if (searchOptions & SA_IMM_SEARCH_GET_SOME_ATTR) {
+      const ImmsvAttrNameList* list = req->attributeNames;
+      while (list) {
+        size_t sz = strnlen((char*)list->name.buf, (size_t)list->name.size);
+        if (attrName == std::string((const char*)list->name.buf, sz)) {
+          break;
+        }
+        list = list->next;
+      }
+      if (!list) {
+        continue;
+      }
+      if (matched) {
+        ++(*matched);
+      }
+    }
+
+    if ((searchOptions & SA_IMM_SEARCH_NO_RDN) &&
+        (attr.mFlags & SA_IMM_ATTR_RDN)) {
+      continue;
+    }
+
+    if ((searchOptions & SA_IMM_SEARCH_GET_CONFIG_ATTR) &&
+        (attr.mFlags & SA_IMM_ATTR_RUNTIME)) {
+      continue;
+    }
+
+    op.addAttribute(attrName, attr.mValueType, attr.mFlags);
+    if (attr.mFlags & SA_IMM_ATTR_CONFIG) {
+      if (!av->empty()) {
+        op.addAttrValue(*av);
+        checkAttribute = true;
+      }
+    } else if (impl && impl->mAttached) {
+      if (!(attr.mFlags & SA_IMM_ATTR_CACHED && av->empty())) {
+        op.addAttrValue(*av);
+      }
+      if (implNotSet && !(attr.mFlags & SA_IMM_ATTR_CACHED)) {
+        op.setImplementer(const_cast<void*>(obj.mImplementer));
+        implNotSet = false;
+      }
+      checkAttribute = true;
+    } else if (!av->empty() &&
+               ((attr.mFlags & SA_IMM_ATTR_PERSISTENT) ||
+                ((attr.mFlags & SA_IMM_ATTR_CACHED) &&
+                 ((impl && impl->mDetached) ||
+                  (objectName == immManagementDn))))) {
+      // Persistent rt attributes, or cached ones while the OI is
+      // transiently detached.
+      op.addAttrValue(*av);
+      checkAttribute = true;
+    }
+
+    if (nonExtendedNameCheck && checkAttribute &&
+        attr.mValueType == SA_IMM_ATTR_SANAMET) {
+      if (!av->empty() &&
+          strlen(av->getValueC_str()) >= SA_MAX_UNEXTENDED_NAME_LENGTH) {
+        TRACE("SEARCH_NON_EXTENDED_NAMES filter: %s has long DN value",
+              attrName.c_str());
+        return SA_AIS_ERR_NAME_TOO_LONG;
+      }
+
+      if (av->isMultiValued()) {
+        ImmAttrMultiValue* multi =
+            ((const ImmAttrMultiValue*)av)->getNextAttrValue();
+        while (multi) {
+          if (!multi->empty() &&
+              strlen(multi->getValueC_str()) >= SA_MAX_UNEXTENDED_NAME_LENGTH) {
+            TRACE("SEARCH_NON_EXTENDED_NAMES filter: %s has long DN value",
+                  attrName.c_str());
+            return SA_AIS_ERR_NAME_TOO_LONG;
+          }
+          multi = multi->getNextAttrValue();
+        }
+      }
+    }
+  }
+
+  return SA_AIS_OK;
+}
+
+bool ImmModel::snapshotFilterMatch(const ImmSnapshotObject& obj,
+                                   const ImmsvOmSearchOneAttr* filter,
+                                   SaAisErrorT& err, const char* objName) {
+  std::string attrName((const char*)filter->attrName.buf);
+
+  const ImmSnapshotValue* value = obj.findValue(attrName);
+  if (!value) {
+    return false;
+  }
+
+  if (filter->attrValueType == SA_IMM_ATTR_SASTRINGT &&
+      !filter->attrValue.val.x.size) {
+    return true;
+  }
+
+  const ImmSnapshotAttr& attr = value->mAttr->second;
+  if (attr.mValueType != (SaImmValueTypeT)filter->attrValueType) {
+    return false;
+  }
+
+  if ((attr.mFlags & SA_IMM_ATTR_RUNTIME) &&
+      !(attr.mFlags & SA_IMM_ATTR_CACHED)) {
+    LOG_WA(
+        "ERR_NO_RESOURCES: Attribute %s is a non-cached runtime "
+        "attribute in object %s => can not handle search with match "
+        "on such attributes currently.",
+        attrName.c_str(), objName);
+    err = SA_AIS_ERR_NO_RESOURCES;
+    return false;
+  }
+
+  if (value->mValue->empty()) {
+    return false;
+  }
+
+  IMMSV_OCTET_STRING tmpos;
+  eduAtValToOs(&tmpos, const_cast<immsv_edu_attr_val*>(&filter->attrValue),
+               (SaImmValueTypeT)filter->attrValueType);
+  return value->mValue->hasMatchingValue(tmpos);
+}
+
+SaAisErrorT ImmModel::snapshotSearch(const ImmSnapshot& snap,
+                                     const ImmsvOmSearchInit* req,
+                                     ImmSearchOp& op) {
+  TRACE_ENTER();
+  SaAisErrorT err = SA_AIS_OK;
+  bool nonExtendedNameCheck =
+      req->searchParam.present > ImmOmSearchParameter_PR_oneAttrParam;
+  const ImmsvOmSearchOneAttr* oneAttr = &req->searchParam.choice.oneAttrParam;
+  bool filter = (oneAttr->attrName.size != 0);
+  SaImmScopeT scope = (SaImmScopeT)req->scope;
+  SaImmSearchOptionsT searchOptions = (SaImmSearchOptionsT)req->searchOptions;
+  const ImmSnapshotObject* root = NULL;
+  const ImmSnapshot::Extent* extent = NULL;
+  SaUint32T childCount = 0xffffffff;
+  std::function<bool(const std::string&, const ImmSnapshotObject&)> visit;
+
+  if (nonExtendedNameCheck) {
+    op.setNonExtendedName();
+  }
+
+  size_t sz = strnlen((char*)req->rootName.buf, (size_t)req->rootName.size);
+  std::string rootName((const char*)req->rootName.buf, sz);
+  const size_t rootlen = rootName.length();
+
+  if (searchOptions &
+      ~(SA_IMM_SEARCH_ONE_ATTR | SA_IMM_SEARCH_GET_ALL_ATTR |
+        SA_IMM_SEARCH_GET_NO_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR |
+        SA_IMM_SEARCH_GET_CONFIG_ATTR | SA_IMM_SEARCH_NO_RDN)) {
+    LOG_NO("ERR_INVALID_PARAM: invalid search option 0x%llx",
+           searchOptions);
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto searchExit;
+  }
+
+  // Validate root name
+  if (!(nameCheck(rootName) || nameToInternal(rootName))) {
+    LOG_NO("ERR_INVALID_PARAM: Not a proper root name");
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto searchExit;
+  }
+
+  if (rootlen > 0) {
+    root = snap.find(rootName);
+    if (!root) {
+      TRACE_7("ERR_NOT_EXIST: root object '%s' does not exist",
+              rootName.c_str());
+      err = SA_AIS_ERR_NOT_EXIST;
+      goto searchExit;
+    }
+    childCount = root->mChildCount + 1; /* Add one for root itself */
+  }
+
+  // Validate scope
+  if ((scope != SA_IMM_SUBLEVEL) && (scope != SA_IMM_SUBTREE)) {
+    LOG_NO("ERR_INVALID_PARAM: invalid search scope");
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto searchExit;
+  }
+
+  // Validate searchOptions
+  if (filter && ((searchOptions & SA_IMM_SEARCH_ONE_ATTR) == 0)) {
+    LOG_NO(
+        "ERR_INVALID_PARAM: The SA_IMM_SEARCH_ONE_ATTR flag "
+        "must be set in the searchOptions parameter");
+    err = SA_AIS_ERR_INVALID_PARAM;
+    goto searchExit;
+  }
+
+  if (filter && (strcmp(oneAttr->attrName.buf, SA_IMM_ATTR_CLASS_NAME) == 0) &&
+      oneAttr->attrValue.val.x.size) {
+    const char* className = oneAttr->attrValue.val.x.buf;
+    extent = snap.findExtent(className);
+    if (!extent) {
+      /* Not an error, see searchInitialize */
+      TRACE("Extent for class:%s was empty, or class does not exist",
+            className);
+      goto searchExit;
+    }
+
+    if (searchOptions & SA_IMM_SEARCH_GET_SOME_ATTR) {
+      /* Explicit attributes requested, check that they exist in class. */
+      const ImmSnapshotAttrMap& attrMap =
+          snap.find(*extent->begin())->mClass->mAttrMap;
+      bool someAttrsNotFound = false;
+      for (const ImmsvAttrNameList* list = req->attributeNames; list;
+           list = list->next) {
+        size_t sz = strnlen((char*)list->name.buf, (size_t)list->name.size);
+        std::string attName((const char*)list->name.buf, sz);
+        if (attrMap.find(attName) == attrMap.end()) {
+          LOG_NO(
+              "SearchInit ERR_INVALID_PARAM: attribute %s does not exist "
+              "in class %s",
+              attName.c_str(), className);
+          someAttrsNotFound = true;
+        }
+      }
+      if (someAttrsNotFound) {
+        err = SA_AIS_ERR_INVALID_PARAM;
+        goto searchExit;
+      }
+    }
+
+    /* Class extent filter is handled by iterating over the extent */
+    filter = false;
+  }
+
+  visit = [&](const std::string& dn, const ImmSnapshotObject& obj) {
+    if (dn.length() < rootlen) {
+      return true;
+    }
+    size_t pos = dn.length() - rootlen;
+    if ((dn.rfind(rootName, pos) != pos) ||
+        (pos && rootlen && (dn[pos - 1] != ','))) {
+      return true;
+    }
+
+    if (nonExtendedNameCheck && dn.length() >= SA_MAX_UNEXTENDED_NAME_LENGTH) {
+      TRACE("SEARCH_NON_EXTENDED_NAMES filter: Object name is too long: %s",
+            dn.c_str());
+      err = SA_AIS_ERR_NAME_TOO_LONG;
+      return false;
+    }
+
+    if (scope == SA_IMM_SUBTREE || checkSubLevel(dn, pos)) {
+      --childCount;
+      if (!filter || snapshotFilterMatch(obj, oneAttr, err, dn.c_str())) {
+        std::string objectName(dn);
+        if (obj.mInternalRep) {
+          nameToExternal(objectName);
+        }
+        op.addObject(objectName);
+
+        if (searchOptions &
+            (SA_IMM_SEARCH_GET_ALL_ATTR | SA_IMM_SEARCH_GET_SOME_ATTR |
+             SA_IMM_SEARCH_GET_CONFIG_ATTR)) {
+          err = snapshotAddAttributes(snap, objectName, obj, req, op, NULL);
+        }
+      }
+    }
+
+    /* Done when all the children of the root have been found */
+    return (err == SA_AIS_OK) && childCount;
+  };
+
+  if (extent) {
+    for (const auto& dn : *extent) {
+      if (!visit(dn, *snap.find(dn))) {
+        break;
+      }
+    }
+  } else if (childCount == 1) {
+    TRACE("Singleton match");
+    visit(rootName, *root);
+  } else {
+    snap.forEach(visit);
+  }
+
+searchExit:
+  TRACE_LEAVE();
+  return err;
+}
+
 SaAisErrorT ImmModel::nextSyncResult(ImmsvOmRspSearchNext** rsp,
                                      ImmSearchOp& op) {
   TRACE_ENTER();
@@ -13515,6 +14261,7 @@ void ImmModel::updateImmObject(std::string newClassName,
 {
   TRACE_ENTER();
   ObjectMap::iterator oi = sObjectMap.find(immObjectDn);
+  snapshotMarkDirty(immObjectDn);
 
   if (oi == sObjectMap.end()) {
     TRACE_LEAVE();
@@ -13594,6 +14341,7 @@ SaAisErrorT ImmModel::updateImmObject2(const ImmsvOmAdminOperationInvoke* req) {
 
   TRACE_ENTER();
   ObjectMap::iterator oi = sObjectMap.find(immObjectDn);
+  snapshotMarkDirty(immObjectDn);
 
   if (oi == sObjectMap.end()) {
     err = SA_AIS_ERR_NOT_EXIST;
@@ -13873,6 +14621,7 @@ SaAisErrorT ImmModel::admoImmMngtObject(const ImmsvOmAdminOperationInvoke* req,
 
   TRACE_ENTER();
   ObjectMap::iterator oi = sObjectMap.find(immManagementDn);
+  snapshotMarkDirty(immManagementDn);
   if (oi == sObjectMap.end()) {
     return SA_AIS_ERR_NOT_EXIST;
   }
@@ -15414,6 +16163,7 @@ SaAisErrorT ImmModel::classImplementerSet(const struct ImmsvOiImplSetReq* req,
   /* Set the main implementer pointer in each object of the class extent. */
   for (os = classInfo->mExtent.begin(); os != classInfo->mExtent.end(); ++os) {
     (*os)->mImplementer = classInfo->mImplementer;
+    snapshotMarkDirty(*os);
   }
 
 done:
@@ -15959,6 +16709,7 @@ SaAisErrorT ImmModel::setOneObjectImplementer(std::string objectName,
       if (doIt) {
         /* Covers the idempotency case. */
         obj->mImplementer = info;
+        snapshotMarkDirty(obj);
         TRACE_5("Implementer for object '%s' is %s", objectName.c_str(),
                 info->mImplementerName.c_str());
       } else {  // not doIt => check not a class implementer & immwritable or
@@ -16116,6 +16867,7 @@ void ImmModel::clearImplName(ObjectInfo* obj) {
   if (!(att->empty())) {
     att->setValueC_str(NULL);
   }
+  snapshotMarkDirty(obj);
 }
 
 void ImmModel::implementerDelete(const char *implementerName) {
@@ -16209,6 +16961,7 @@ SaAisErrorT ImmModel::adminOwnerSet(std::string objectName, ObjectInfo* obj,
   if (oldOwner.empty() || oldOwner == loader) {
     if (doIt) {
       obj->mAdminOwnerAttrVal->setValueC_str(adm->mAdminOwnerName.c_str());
+      snapshotMarkDirty(obj);
       if (adm->mReleaseOnFinalize) {
         adm->mTouchedObjects.insert(obj);
       }
@@ -16270,6 +17023,7 @@ SaAisErrorT ImmModel::adminOwnerRelease(std::string objectName, ObjectInfo* obj,
       if (doIt) {
         // We may be pulling the rug out from under another admin owner
         obj->mAdminOwnerAttrVal->setValueC_str(NULL);
+        snapshotMarkDirty(obj);
         if (adm && adm->mReleaseOnFinalize) {
           adm->mTouchedObjects.erase(obj);
         }
@@ -17085,6 +17839,7 @@ SaAisErrorT ImmModel::rtObjectCreate(
 
     sObjectMap[objectName] = object;
     classInfo->mExtent.insert(object);
+    snapshotMarkDirty(objectName);
 
     if (className == immClassName) {
       updateImmObject(immClassName);
@@ -17148,6 +17903,7 @@ void ImmModel::pbePrtObjCreateContinuation(SaUint32T invocation,
   }
 
   oMut->mAfterImage->mObjFlags &= ~IMM_CREATE_LOCK;
+  snapshotMarkDirty(i2->first);
 
   if (error == SA_AIS_OK) {
     if (oMut->mAfterImage->mImplementer) {
@@ -17468,6 +18224,7 @@ void ImmModel::pbePrtAttrUpdateContinuation(
   osafassert(oi != sObjectMap.end());
   ObjectInfo* beforeImage = oi->second;
   beforeImage->mObjFlags &= ~IMM_RT_UPDATE_LOCK;
+  snapshotMarkDirty(objName);
 
   ClassInfo* classInfo = beforeImage->mClassInfo;
 
@@ -18361,6 +19118,10 @@ SaAisErrorT ImmModel::rtObjectUpdate(
     // err!=OK => breaks out of for loop
   }  // for(int doIt...
 
+  if (err == SA_AIS_OK) {
+    snapshotMarkDirty(objectName);
+  }
+
   if (modifiedNotifyAttr && (err == SA_AIS_OK)) {
     ImplementerInfo* spAppl = getSpecialApplier();
     if (spAppl && spApplConnPtr) {
@@ -18845,6 +19606,7 @@ SaAisErrorT ImmModel::deleteRtObject(ObjectMap::iterator& oi, bool doIt,
       // Here we are erasing based on value, not iterator position.
     }
 
+    snapshotMarkDirty(oi->first);
     delete object;
     sObjectMap.erase(oi);
   }
@@ -19231,6 +19993,7 @@ void ImmModel::getParentDn(std::string& parentName,
 
 void ImmModel::setScAbsenceAllowed(SaUint32T scAbsenceAllowed) {
   ObjectMap::iterator oi = sObjectMap.find(immObjectDn);
+  snapshotMarkDirty(immObjectDn);
   osafassert(oi != sObjectMap.end());
   ObjectInfo* immObject = oi->second;
   ImmAttrValueMap::iterator avi =
@@ -19254,6 +20017,7 @@ SaAisErrorT ImmModel::finalizeSync(ImmsvOmFinalizeSync* req, bool isCoord,
   SaAisErrorT err = SA_AIS_OK;
   osafassert(!(isCoord && isSyncClient));
   bool prt45allowed = this->protocol45Allowed();
+  snapshotInvalidate();
 
   switch (sImmNodeState) {
     case IMM_NODE_W_AVAILABLE:
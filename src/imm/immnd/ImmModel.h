@@ -25,8 +25,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 #include "imm/common/immsv_api.h"
 
+class ImmSnapshot;
+struct ImmSnapshotObject;
 struct ClassInfo;
 struct CcbInfo;
 struct ObjectInfo;
@@ -115,6 +118,7 @@ class ImmModel {
   bool protocol51Allowed();
   bool protocol51710Allowed();
   bool protocol51906Allowed();
+  bool protocol52103Allowed();
   bool oneSafe2PBEAllowed();
   bool purgeSyncRequest(SaUint32T clientId);
   bool verifySchemaChange(const std::string& className, ClassInfo* oldClass,
@@ -482,6 +486,14 @@ class ImmModel {
 
   void getLocalImplementers(ConnVector& cv, IdVector& idv);
 
+  // Snapshot readers, see ImmSnapshot.h
+  std::shared_ptr<const ImmSnapshot> snapshotPublish();
+  SaAisErrorT snapshotAccessorGet(const ImmSnapshot& snap,
+                                  const ImmsvOmSearchInit* req,
+                                  ImmSearchOp& op);
+  SaAisErrorT snapshotSearch(const ImmSnapshot& snap,
+                             const ImmsvOmSearchInit* req, ImmSearchOp& op);
+
  private:
   bool checkSubLevel(const std::string& objectName, size_t rootStart);
 
@@ -490,6 +502,19 @@ class ImmModel {
   bool nameToInternal(std::string& name);
   void nameToExternal(std::string& name);
 
+  void snapshotMarkDirty(const std::string& dn);
+  void snapshotMarkDirty(ObjectInfo* obj);
+  void snapshotInvalidate();
+  std::shared_ptr<const ImmSnapshotObject> snapshotObject(ObjectInfo* obj);
+  bool snapshotFilterMatch(const ImmSnapshotObject& obj,
+                           const ImmsvOmSearchOneAttr* filter,
+                           SaAisErrorT& err, const char* objName);
+  SaAisErrorT snapshotAddAttributes(const ImmSnapshot& snap,
+                                    const std::string& objectName,
+                                    const ImmSnapshotObject& obj,
+                                    const ImmsvOmSearchInit* req,
+                                    ImmSearchOp& op, int* matched);
+
   void updateImmObject(std::string newClassName, bool remove = false);
   SaAisErrorT updateImmObject2(const ImmsvOmAdminOperationInvoke* req);
   SaAisErrorT admoImmMngtObject(const ImmsvOmAdminOperationInvoke* req,
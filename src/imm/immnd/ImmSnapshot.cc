@@ -0,0 +1,212 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#include "imm/immnd/ImmSnapshot.h"
+
+#include <pthread.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include "base/logtrace.h"
+
+const size_t ImmSnapshot::kShards;
+
+ImmSnapshotObject::~ImmSnapshotObject() {
+  for (auto& v : mValues) {
+    delete v.mValue;
+  }
+}
+
+const ImmSnapshotValue* ImmSnapshotObject::findValue(
+    const std::string& attrName) const {
+  auto i = std::lower_bound(mValues.begin(), mValues.end(), attrName,
+                            [](const ImmSnapshotValue& v,
+                               const std::string& name) {
+                              return v.mAttr->first < name;
+                            });
+  if (i == mValues.end() || i->mAttr->first != attrName) {
+    return NULL;
+  }
+  return &(*i);
+}
+
+ImmSnapshot::ImmSnapshot()
+    : mOwnedShards(kShards, true),
+      mImplementers(std::make_shared<ImmSnapshotImplMap>()) {
+  mShards.reserve(kShards);
+  for (size_t i = 0; i < kShards; ++i) {
+    mShards.push_back(std::make_shared<ObjectShard>());
+  }
+}
+
+ImmSnapshot::ImmSnapshot(const ImmSnapshot& base)
+    : mShards(base.mShards),
+      mOwnedShards(kShards, false),
+      mExtents(base.mExtents),
+      mImplementers(base.mImplementers) {}
+
+size_t ImmSnapshot::shardOf(const std::string& dn) {
+  return std::hash<std::string>()(dn) % kShards;
+}
+
+const ImmSnapshotObject* ImmSnapshot::find(const std::string& dn) const {
+  const ObjectShard& shard = *mShards[shardOf(dn)];
+  ObjectShard::const_iterator i = shard.find(dn);
+  return (i == shard.end()) ? NULL : i->second.get();
+}
+
+const ImmSnapshot::Extent* ImmSnapshot::findExtent(
+    const std::string& className) const {
+  auto i = mExtents.find(className);
+  return (i == mExtents.end()) ? NULL : i->second.get();
+}
+
+const ImmSnapshotImplementer* ImmSnapshot::findImplementer(
+    const void* impl) const {
+  if (!impl) {
+    return NULL;
+  }
+  ImmSnapshotImplMap::const_iterator i = mImplementers->find(impl);
+  return (i == mImplementers->end()) ? NULL : &(i->second);
+}
+
+void ImmSnapshot::forEach(
+    const std::function<bool(const std::string&, const ImmSnapshotObject&)>&
+        visit) const {
+  // Merge the shards, each ordered by DN, with a heap of their cursors.
+  typedef std::pair<ObjectShard::const_iterator, ObjectShard::const_iterator>
+      Cursor;
+  auto later = [](const Cursor& a, const Cursor& b) {
+    return a.first->first > b.first->first;
+  };
+  std::vector<Cursor> heap;
+  for (const auto& shard : mShards) {
+    if (!shard->empty()) {
+      heap.push_back(Cursor(shard->begin(), shard->end()));
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), later);
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    Cursor& c = heap.back();
+    if (!visit(c.first->first, *c.first->second)) {
+      return;
+    }
+    if (++c.first == c.second) {
+      heap.pop_back();
+    } else {
+      std::push_heap(heap.begin(), heap.end(), later);
+    }
+  }
+}
+
+ImmSnapshot::ObjectShard& ImmSnapshot::writableShard(size_t shard) {
+  if (!mOwnedShards[shard]) {
+    mShards[shard] = std::make_shared<ObjectShard>(*mShards[shard]);
+    mOwnedShards[shard] = true;
+  }
+  return *mShards[shard];
+}
+
+ImmSnapshot::Extent& ImmSnapshot::writableExtent(
+    const std::string& className) {
+  std::shared_ptr<Extent>& extent = mExtents[className];
+  if (!extent) {
+    extent = std::make_shared<Extent>();
+    mOwnedExtents.insert(className);
+  } else if (mOwnedExtents.insert(className).second) {
+    extent = std::make_shared<Extent>(*extent);
+  }
+  return *extent;
+}
+
+void ImmSnapshot::setObject(
+    const std::string& dn,
+    const std::shared_ptr<const ImmSnapshotObject>& obj) {
+  ObjectShard& shard = writableShard(shardOf(dn));
+  ObjectShard::iterator i = shard.find(dn);
+  if (i != shard.end() && i->second->mClass->mName != obj->mClass->mName) {
+    eraseObject(dn);
+    i = shard.end();
+  }
+  if (i == shard.end()) {
+    writableExtent(obj->mClass->mName).insert(dn);
+    shard[dn] = obj;
+  } else {
+    i->second = obj;
+  }
+}
+
+void ImmSnapshot::eraseObject(const std::string& dn) {
+  ObjectShard& shard = writableShard(shardOf(dn));
+  ObjectShard::iterator i = shard.find(dn);
+  if (i == shard.end()) {
+    return;
+  }
+  std::string className(i->second->mClass->mName);
+  shard.erase(i);
+
+  if (mExtents.find(className) != mExtents.end()) {
+    Extent& extent = writableExtent(className);
+    extent.erase(dn);
+    if (extent.empty()) {
+      mExtents.erase(className);
+      mOwnedExtents.erase(className);
+    }
+  }
+}
+
+/* The pool is never destroyed, its threads run until the IMMND exits. */
+ImmReaderPool::ImmReaderPool(unsigned int threads) {
+  pthread_t thread;
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+  for (unsigned int i = 0; i < threads; ++i) {
+    int rc = pthread_create(&thread, &attr, start, this);
+    if (rc != 0) {
+      LOG_ER("pthread_create FAILED: %s", strerror(rc));
+      exit(1);
+    }
+  }
+
+  pthread_attr_destroy(&attr);
+}
+
+void* ImmReaderPool::start(void* arg) {
+  static_cast<ImmReaderPool*>(arg)->run();
+  return NULL;
+}
+
+void ImmReaderPool::submit(const std::function<void()>& job) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mJobs.push_back(job);
+  mCond.notify_one();
+}
+
+void ImmReaderPool::run() {
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mCond.wait(lock, [this] { return !mJobs.empty(); });
+      job = std::move(mJobs.front());
+      mJobs.pop_front();
+    }
+    job();
+  }
+}
@@ -0,0 +1,153 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+  Read only copies of the committed objects of the IMM model, searched by the
+  reader threads of the IMMND while the IMMND thread goes on mutating the
+  ImmModel. See "Snapshot readers" in the README.
+
+  A snapshot is never changed after it has been published to the readers.
+  The next one starts as a copy of the previous one and only the objects
+  changed since are replaced (copy on write). The objects are held in
+  shards by a hash of their DN, so unchanged shards and objects are shared
+  between successive snapshots.
+*/
+
+#ifndef IMM_IMMND_IMMSNAPSHOT_H_
+#define IMM_IMMND_IMMSNAPSHOT_H_ 1
+
+#include <saImmOm.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "imm/immnd/ImmAttrValue.h"
+
+struct ImmSnapshotAttr {
+  SaImmValueTypeT mValueType;
+  SaImmAttrFlagsT mFlags;
+};
+typedef std::map<std::string, ImmSnapshotAttr> ImmSnapshotAttrMap;
+
+/* Class of snapshot objects, shared by all its instances. */
+struct ImmSnapshotClass {
+  std::string mName;
+  ImmSnapshotAttrMap mAttrMap;
+};
+
+struct ImmSnapshotValue {
+  ImmSnapshotAttrMap::const_iterator mAttr;  //<-Points INTO the class
+  ImmAttrValue* mValue;                      //<-Owned by the object
+};
+
+struct ImmSnapshotObject {
+  ImmSnapshotObject()
+      : mImplementer(NULL), mInternalRep(false), mChildCount(0) {}
+  ~ImmSnapshotObject();
+
+  const ImmSnapshotValue* findValue(const std::string& attrName) const;
+
+  std::shared_ptr<const ImmSnapshotClass> mClass;
+  std::vector<ImmSnapshotValue> mValues;  // Ordered by attribute name
+  const void* mImplementer;  // ImplementerInfo*, only used as a key
+  bool mInternalRep;         // DN is in the internal representation
+  SaUint32T mChildCount;     // At least the number of descendants
+
+ private:
+  ImmSnapshotObject(const ImmSnapshotObject&);
+  ImmSnapshotObject& operator=(const ImmSnapshotObject&);
+};
+
+/* State of an implementer at the time of the snapshot. Its name is held
+   by the objects, as the value of SA_IMM_ATTR_IMPLEMENTER_NAME. */
+struct ImmSnapshotImplementer {
+  bool operator==(const ImmSnapshotImplementer& b) const {
+    return mAttached == b.mAttached && mDetached == b.mDetached;
+  }
+
+  bool mAttached;  // Has a node id
+  bool mDetached;  // Transiently detached, cached attrs still valid
+};
+typedef std::map<const void*, ImmSnapshotImplementer> ImmSnapshotImplMap;
+
+class ImmSnapshot {
+ public:
+  typedef std::map<std::string, std::shared_ptr<const ImmSnapshotObject>>
+      ObjectShard;
+  typedef std::set<std::string> Extent;
+
+  ImmSnapshot();
+  // Starts a new snapshot sharing everything with base.
+  ImmSnapshot(const ImmSnapshot& base);
+
+  const ImmSnapshotObject* find(const std::string& dn) const;
+  // NULL if the class is unknown or has no instances.
+  const Extent* findExtent(const std::string& className) const;
+  // NULL if the implementer is unknown or impl is NULL.
+  const ImmSnapshotImplementer* findImplementer(const void* impl) const;
+
+  // Calls visit for every object in DN order, the order of the ObjectMap
+  // of ImmModel, until visit returns false.
+  void forEach(const std::function<bool(const std::string&,
+                                        const ImmSnapshotObject&)>& visit)
+      const;
+
+  // Only used by the IMMND thread, before the snapshot is published.
+  void setObject(const std::string& dn,
+                 const std::shared_ptr<const ImmSnapshotObject>& obj);
+  void eraseObject(const std::string& dn);
+  const std::shared_ptr<const ImmSnapshotImplMap>& implementers() const {
+    return mImplementers;
+  }
+  void setImplementers(const std::shared_ptr<const ImmSnapshotImplMap>& im) {
+    mImplementers = im;
+  }
+
+ private:
+  static const size_t kShards = 256;
+
+  static size_t shardOf(const std::string& dn);
+  ObjectShard& writableShard(size_t shard);
+  Extent& writableExtent(const std::string& className);
+  ImmSnapshot& operator=(const ImmSnapshot&);
+
+  std::vector<std::shared_ptr<ObjectShard>> mShards;
+  std::vector<bool> mOwnedShards;  // Copied by this snapshot, writable
+  std::map<std::string, std::shared_ptr<Extent>> mExtents;
+  std::set<std::string> mOwnedExtents;
+  std::shared_ptr<const ImmSnapshotImplMap> mImplementers;
+};
+
+/* Threads running jobs, the searches of the snapshot readers. */
+class ImmReaderPool {
+ public:
+  explicit ImmReaderPool(unsigned int threads);
+  void submit(const std::function<void()>& job);
+
+ private:
+  static void* start(void* arg);
+  void run();
+
+  std::mutex mMutex;
+  std::condition_variable mCond;
+  std::deque<std::function<void()>> mJobs;
+};
+
+#endif  // IMM_IMMND_IMMSNAPSHOT_H_
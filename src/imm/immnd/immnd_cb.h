@@ -93,6 +93,25 @@ typedef struct immnd_fevs_msg_node {
   struct immnd_fevs_msg_node *next;
 } IMMND_FEVS_MSG_NODE;
 
+/******************************************************************************
+ Ccb operations streamed by the saImmOmCcbObject*Async functions. The batches
+ of a ccb are processed in order by all IMMNDs, see immnd_evt_proc_ccb_batch.
+*****************************************************************************/
+
+typedef struct immnd_ccb_batch {
+  struct immnd_ccb_batch *next;
+  SaUint32T ccbId;
+  SaUint32T nextBatch;   /* Number of the next batch expected */
+  SaAisErrorT error;     /* Error of the first failed operation */
+  char *ops;             /* Encoded operations not yet processed */
+  SaUint32T opsSize;
+  SaUint32T opsOffset;
+  bool waiting;          /* Waiting for implementer replies of an operation */
+  bool replyPending;     /* Client waits for the batches to be processed */
+  SaImmHandleT clnt_hdl; /* Only valid at the originating node */
+  SaAisErrorT lostError; /* Why a batch was not sent on from this node */
+} IMMND_CCB_BATCH;
+
 /*****************************************************************************
  * Data Structure used to hold IMMND control block
  *****************************************************************************/
@@ -209,6 +228,14 @@ typedef struct immnd_cb_tag {
   NCS_PATRICIA_TREE immnd_clm_list; /* IMMND_IMM_CLIENT_NODE - node */
   tmr_t splitbrain_tmr;
   bool splitbrain_tmr_run;
+
+  /* Local OM agents caching class descriptions, notified with
+     IMMA_EVT_ND2A_CLASS_CHANGED when a class is created or deleted. */
+  MDS_DEST *mClassCacheAgents;
+  uint32_t mClassCacheAgentCount;
+
+  /* Ccbs with operations streamed by saImmOmCcbObject*Async */
+  IMMND_CCB_BATCH *mCcbBatches;
 } IMMND_CB;
 
 /* CB prototypes */
@@ -246,7 +273,8 @@ void immnd_clm_node_destroy(IMMND_CB *cb);
 */
 
 /*30B Versioning Changes */
-#define IMMND_MDS_PVT_SUBPART_VERSION 1
+/* 2: IMMND_EVT_A2ND_CLASS_DESCR_GET_2 and IMMA_EVT_ND2A_CLASS_CHANGED */
+#define IMMND_MDS_PVT_SUBPART_VERSION 2
 
 /*IMMND - IMMA communication */
 #define IMMND_WRT_IMMA_SUBPART_VER_MIN 1
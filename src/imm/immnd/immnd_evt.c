@@ -171,20 +171,20 @@ static void immnd_evt_proc_class_delete(IMMND_CB *cb, IMMND_EVT *evt,
 					SaImmHandleT clnt_hdl,
 					MDS_DEST reply_dest);
 
-static void immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
-					 bool originatedAtThisNd,
-					 SaImmHandleT clnt_hdl,
-					 MDS_DEST reply_dest);
+static SaAisErrorT immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
+						bool originatedAtThisNd,
+						SaImmHandleT clnt_hdl,
+						MDS_DEST reply_dest);
 
 static void immnd_evt_proc_rt_object_create(IMMND_CB *cb, IMMND_EVT *evt,
 					    bool originatedAtThisNd,
 					    SaImmHandleT clnt_hdl,
 					    MDS_DEST reply_dest);
 
-static void immnd_evt_proc_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
-					 bool originatedAtThisNd,
-					 SaImmHandleT clnt_hdl,
-					 MDS_DEST reply_dest);
+static SaAisErrorT immnd_evt_proc_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
+						bool originatedAtThisNd,
+						SaImmHandleT clnt_hdl,
+						MDS_DEST reply_dest);
 
 static void immnd_evt_proc_rt_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
 					    bool originatedAtThisNd,
@@ -192,10 +192,10 @@ static void immnd_evt_proc_rt_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
 					    MDS_DEST reply_dest,
 					    SaUint64T msgNo);
 
-static void immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
-					 bool originatedAtThisNd,
-					 SaImmHandleT clnt_hdl,
-					 MDS_DEST reply_dest);
+static SaAisErrorT immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
+						bool originatedAtThisNd,
+						SaImmHandleT clnt_hdl,
+						MDS_DEST reply_dest);
 
 static void immnd_evt_proc_rt_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
 					    bool originatedAtThisNd,
@@ -255,7 +255,8 @@ static uint32_t immnd_evt_proc_pbe_prto_purge_mutations(IMMND_CB *cb,
 static uint32_t immnd_evt_proc_class_desc_get(IMMND_CB *cb, IMMND_EVT *evt,
 					      IMMSV_SEND_INFO *sinfo);
 static uint32_t immnd_evt_proc_search_init(IMMND_CB *cb, IMMND_EVT *evt,
-					   IMMSV_SEND_INFO *sinfo);
+					   IMMSV_SEND_INFO *sinfo,
+					   void *readerJob);
 static uint32_t immnd_evt_proc_search_next(IMMND_CB *cb, IMMND_EVT *evt,
 					   IMMSV_SEND_INFO *sinfo);
 
@@ -272,7 +273,10 @@ static uint32_t immnd_evt_proc_search_finalize(IMMND_CB *cb, IMMND_EVT *evt,
 					       IMMSV_SEND_INFO *sinfo);
 
 static uint32_t immnd_evt_proc_accessor_get(IMMND_CB *cb, IMMND_EVT *evt,
-					    IMMSV_SEND_INFO *sinfo);
+					    IMMSV_SEND_INFO *sinfo,
+					    void *readerJob);
+
+static uint32_t immnd_evt_proc_reader_done(IMMND_CB *cb, IMMND_EVT *evt);
 
 static uint32_t immnd_evt_proc_safe_read(IMMND_CB *cb, IMMND_EVT *evt,
 					 IMMSV_SEND_INFO *sinfo);
@@ -283,6 +287,19 @@ static void immnd_evt_ccb_abort(IMMND_CB *cb, SaUint32T ccbId,
 				SaUint32T **clientArr, SaUint32T *clArrSize,
 				SaUint32T *nodeId);
 
+static void immnd_evt_proc_ccb_batch(IMMND_CB *cb, IMMND_EVT *evt,
+				     bool originatedAtThisNd,
+				     SaImmHandleT clnt_hdl);
+
+static bool immnd_ccb_batch_resume(IMMND_CB *cb, SaUint32T ccbId,
+				   SaUint32T reqConn, SaAisErrorT result,
+				   const IMMSV_OCTET_STRING *errorString);
+
+static void immnd_ccb_batch_drop(IMMND_CB *cb, SaUint32T ccbId);
+
+static void immnd_fevs_ccb_batch_lost(IMMND_CB *cb, IMMSV_FEVS *fevsReq,
+				      SaAisErrorT err);
+
 static uint32_t immnd_evt_proc_reset(IMMND_CB *cb, IMMND_EVT *evt,
 				     IMMSV_SEND_INFO *sinfo);
 
@@ -493,6 +510,10 @@ uint32_t immnd_evt_destroy(IMMSV_EVT *evt, bool onheap, uint32_t line)
 		free(evt->info.immnd.info.objDelete.objectName.buf);
 		evt->info.immnd.info.objDelete.objectName.buf = NULL;
 		evt->info.immnd.info.objDelete.objectName.size = 0;
+	} else if (evt->info.immnd.type == IMMND_EVT_A2ND_CCB_BATCH) {
+		free(evt->info.immnd.info.ccbBatch.ops.buf);
+		evt->info.immnd.info.ccbBatch.ops.buf = NULL;
+		evt->info.immnd.info.ccbBatch.ops.size = 0;
 	} else if ((evt->info.immnd.type == IMMND_EVT_A2ND_OBJ_SYNC) ||
 		   (evt->info.immnd.type == IMMND_EVT_A2ND_OBJ_SYNC_2)) {
 		IMMSV_OM_OBJECT_SYNC *obj_sync =
@@ -529,6 +550,7 @@ uint32_t immnd_evt_destroy(IMMSV_EVT *evt, bool onheap, uint32_t line)
 
 	} else if ((evt->info.immnd.type == IMMND_EVT_A2ND_CLASS_CREATE) ||
 		   (evt->info.immnd.type == IMMND_EVT_A2ND_CLASS_DESCR_GET) ||
+		   (evt->info.immnd.type == IMMND_EVT_A2ND_CLASS_DESCR_GET_2) ||
 		   (evt->info.immnd.type == IMMND_EVT_A2ND_CLASS_DELETE)) {
 		free(evt->info.immnd.info.classDescr.className.buf);
 		evt->info.immnd.info.classDescr.className.buf = NULL;
@@ -739,13 +761,18 @@ void immnd_process_evt(void)
 		break;
 
 	case IMMND_EVT_A2ND_CLASS_DESCR_GET:
+	case IMMND_EVT_A2ND_CLASS_DESCR_GET_2:
 		rc = immnd_evt_proc_class_desc_get(cb, &evt->info.immnd,
 						   &evt->sinfo);
 		break;
 
 	case IMMND_EVT_A2ND_SEARCHINIT:
+		if (immModel_readerDispatch(cb, evt)) {
+			/* Destroyed when the snapshot reader is done */
+			return;
+		}
 		rc = immnd_evt_proc_search_init(cb, &evt->info.immnd,
-						&evt->sinfo);
+						&evt->sinfo, NULL);
 		break;
 
 	case IMMND_EVT_A2ND_SEARCHNEXT:
@@ -759,8 +786,16 @@ void immnd_process_evt(void)
 		break;
 
 	case IMMND_EVT_A2ND_ACCESSOR_GET:
+		if (immModel_readerDispatch(cb, evt)) {
+			/* Destroyed when the snapshot reader is done */
+			return;
+		}
 		rc = immnd_evt_proc_accessor_get(cb, &evt->info.immnd,
-						 &evt->sinfo);
+						 &evt->sinfo, NULL);
+		break;
+
+	case IMMND_EVT_READER_DONE:
+		rc = immnd_evt_proc_reader_done(cb, &evt->info.immnd);
 		break;
 
 	case IMMND_EVT_A2ND_RT_ATT_UPPD_RSP:
@@ -1051,13 +1086,16 @@ agent_rsp:
  * Arguments     : IMMND_CB *cb - IMMND CB pointer
  *                 IMMND_EVT *evt - Received Event structure
  *                 IMMSV_SEND_INFO *sinfo - sender info
+ *                 void *readerJob - snapshot reader that did the search,
+ *                                   or NULL
  *
  * Return Values : NCSCC_RC_SUCCESS/Error.
  *
  * Notes         : None.
  *****************************************************************************/
 static uint32_t immnd_evt_proc_search_init(IMMND_CB *cb, IMMND_EVT *evt,
-					   IMMSV_SEND_INFO *sinfo)
+					   IMMSV_SEND_INFO *sinfo,
+					   void *readerJob)
 {
 	IMMSV_EVT send_evt;
 	uint32_t rc = NCSCC_RC_SUCCESS;
@@ -1165,8 +1203,12 @@ static uint32_t immnd_evt_proc_search_init(IMMND_CB *cb, IMMND_EVT *evt,
 		goto agent_rsp;
 	}
 
-	error = immModel_searchInitialize(cb, &(evt->info.searchInit),
-					  &searchOp, isSync, false);
+	if (readerJob) {
+		error = immModel_readerResult(cb, readerJob, &searchOp);
+	} else {
+		error = immModel_searchInitialize(cb, &(evt->info.searchInit),
+						  &searchOp, isSync, false);
+	}
 
 	if ((error == SA_AIS_OK) && isSync) {
 		/* Special processing only for sync iterator. */
@@ -2216,7 +2258,7 @@ static uint32_t immnd_evt_proc_safe_read(IMMND_CB *cb, IMMND_EVT *evt,
 		goto error;
 	}
 
-	rc = immnd_evt_proc_accessor_get(cb, evt, sinfo);
+	rc = immnd_evt_proc_accessor_get(cb, evt, sinfo, NULL);
 	goto done;
 
 error:
@@ -2242,13 +2284,16 @@ done:
  * Arguments     : IMMND_CB *cb - IMMND CB pointer
  *                 IMMND_EVT *evt - Received Event structure
  *                 IMMSV_SEND_INFO *sinfo - sender info
+ *                 void *readerJob - snapshot reader that did the get,
+ *                                   or NULL
  *
  * Return Values : NCSCC_RC_SUCCESS/Error.
  *
  * Notes         : None.
  *****************************************************************************/
 static uint32_t immnd_evt_proc_accessor_get(IMMND_CB *cb, IMMND_EVT *evt,
-					    IMMSV_SEND_INFO *sinfo)
+					    IMMSV_SEND_INFO *sinfo,
+					    void *readerJob)
 {
 	IMMSV_EVT send_evt;
 	uint32_t rc = NCSCC_RC_SUCCESS;
@@ -2280,8 +2325,12 @@ static uint32_t immnd_evt_proc_accessor_get(IMMND_CB *cb, IMMND_EVT *evt,
 		goto search_init_err;
 	}
 
-	error = immModel_searchInitialize(cb, &(evt->info.searchInit),
-					  &searchOp, false, true);
+	if (readerJob) {
+		error = immModel_readerResult(cb, readerJob, &searchOp);
+	} else {
+		error = immModel_searchInitialize(cb, &(evt->info.searchInit),
+						  &searchOp, false, true);
+	}
 
 	if (error != SA_AIS_OK) {
 		goto search_init_err;
@@ -2330,12 +2379,52 @@ done:
 	return rc;
 }
 
+/****************************************************************************
+ * Name          : immnd_evt_proc_reader_done
+ *
+ * Description   : Function to answer a search init or accessor get that
+ *                 was served by a snapshot reader, see
+ *                 immModel_readerDispatch.
+ *
+ * Arguments     : IMMND_CB *cb - IMMND CB pointer
+ *                 IMMND_EVT *evt - Locally generated event
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : The request is destroyed here.
+ *****************************************************************************/
+static uint32_t immnd_evt_proc_reader_done(IMMND_CB *cb, IMMND_EVT *evt)
+{
+	uint32_t rc;
+	void *job = evt->info.readerJob;
+	IMMSV_EVT *req = immModel_readerRequest(cb, job);
+
+	if (req == NULL) {
+		LOG_ER("Unknown snapshot reader job %p", job);
+		return NCSCC_RC_FAILURE;
+	}
+
+	if (req->info.immnd.type == IMMND_EVT_A2ND_ACCESSOR_GET) {
+		rc = immnd_evt_proc_accessor_get(cb, &req->info.immnd,
+						 &req->sinfo, job);
+	} else {
+		rc = immnd_evt_proc_search_init(cb, &req->info.immnd,
+						&req->sinfo, job);
+	}
+
+	immModel_readerRelease(cb, job);
+	immnd_evt_destroy(req, true, __LINE__);
+	return rc;
+}
+
 /****************************************************************************
  * Name          : immnd_evt_proc_class_desc_get
  *
  * Description   : Function to process the SaImmOmClassDescriptionGet call.
  *                 Note that this is a read, local to the ND (does not go
- *                 over FEVS).
+ *                 over FEVS). With IMMND_EVT_A2ND_CLASS_DESCR_GET_2 the
+ *                 agent caches the description and is registered for
+ *                 class change notifications.
  *
  * Arguments     : IMMND_CB *cb - IMMND CB pointer
  *                 IMMND_EVT *evt - Received Event structure
@@ -2357,6 +2446,12 @@ static uint32_t immnd_evt_proc_class_desc_get(IMMND_CB *cb, IMMND_EVT *evt,
 	TRACE_2("className:%s", evt->info.classDescr.className.buf);
 	send_evt.type = IMMSV_EVT_TYPE_IMMA;
 
+	if (evt->type == IMMND_EVT_A2ND_CLASS_DESCR_GET_2) {
+		/* Registered before the reply is sent, so no change of the
+		   class can be missed by the agent. */
+		immnd_proc_class_cache_agent_add(cb, sinfo->dest);
+	}
+
 	error =
 	    immModel_classDescriptionGet(cb, &(evt->info.classDescr.className),
 					 &(send_evt.info.imma.info.classDescr));
@@ -3379,6 +3474,9 @@ static uint32_t immnd_evt_proc_fevs_forward(IMMND_CB *cb, IMMND_EVT *evt,
 			} else {
 				LOG_WA(
 				    "IMMND - Director Service Is Down. Dropping asyncronous FEVS request.");
+				immnd_fevs_ccb_batch_lost(
+				    cb, &(evt->info.fevsReq),
+				    SA_AIS_ERR_TRY_AGAIN);
 				return NCSCC_RC_FAILURE;
 			}
 		} else {
@@ -3436,6 +3534,8 @@ static uint32_t immnd_evt_proc_fevs_forward(IMMND_CB *cb, IMMND_EVT *evt,
 			if (asyncReq) {
 				LOG_WA(
 				    "Asyncronous FEVS message failed verification - dropping message!");
+				immnd_fevs_ccb_batch_lost(
+				    cb, &(evt->info.fevsReq), error);
 				return NCSCC_RC_FAILURE;
 			}
 			goto agent_rsp; // Fevs request is not forwarded to IMMD
@@ -3645,6 +3745,149 @@ static bool is_class_name_reserved(const IMMND_CB* cb, const char* name)
 	return false;
 }
 
+/* Modifications to IMM service objects are only allowed for root users and
+   same group as me. Except for access control settings which are only allowed
+   by root. attrMod is NULL for the create and delete of a ccb batch.
+*/
+static SaAisErrorT
+immnd_imm_service_object_check(const IMMSV_SEND_INFO *sinfo,
+			       const char *objectName,
+			       const IMMSV_ATTR_MODS_LIST *attrMod)
+{
+	if ((sinfo == NULL) || (objectName == NULL) ||
+	    ((strcmp(objectName, OPENSAF_IMM_OBJECT_DN) != 0) &&
+	     (strcmp(objectName,
+		     "safRdn=immManagement,safApp=safImmService") != 0))) {
+		return SA_AIS_OK;
+	}
+
+	if (sinfo->uid == 0) {
+		return SA_AIS_OK; // modifications by root are OK
+	}
+
+	if (sinfo->gid != getgid()) {
+		struct passwd *pwd = getpwuid(sinfo->uid);
+		if (pwd != NULL) {
+			syslog(
+			    LOG_AUTH,
+			    "Modifications to imm service objects denied for %s(uid=%d)",
+			    pwd->pw_name, sinfo->uid);
+		}
+		return SA_AIS_ERR_ACCESS_DENIED;
+	}
+
+	// non root and same group as me, disallow access control changes
+	while (attrMod != NULL) {
+		if ((strcmp(attrMod->attrValue.attrName.buf,
+			    OPENSAF_IMM_ACCESS_CONTROL_MODE) == 0) ||
+		    (strcmp(attrMod->attrValue.attrName.buf,
+			    OPENSAF_IMM_AUTHORIZED_GROUP) == 0)) {
+			struct passwd *pwd = getpwuid(sinfo->uid);
+			if (pwd != NULL)
+				syslog(LOG_AUTH,
+				       "change of %s denied for %s(uid=%d)",
+				       attrMod->attrValue.attrName.buf,
+				       pwd->pw_name, sinfo->uid);
+			return SA_AIS_ERR_ACCESS_DENIED;
+		}
+		attrMod = attrMod->next;
+	}
+
+	return SA_AIS_OK;
+}
+
+/* Decode the operations of a ccb batch and check the access to the object of
+   each modify and delete, and the parent of each create, as is done for the
+   operations sent one by one.
+*/
+static SaAisErrorT
+immnd_ccb_batch_local_checks(const IMMSV_SEND_INFO *sinfo,
+			     const IMMSV_OM_CCB_BATCH *req)
+{
+	SaAisErrorT error = SA_AIS_OK;
+	SaUint32T offset = 0;
+
+	while ((error == SA_AIS_OK) && (offset < req->ops.size)) {
+		uint8_t *p8 = (uint8_t *)req->ops.buf + offset;
+		SaUint32T left = req->ops.size - offset;
+		SaUint32T size = (left >= 4) ? ncs_decode_32bit(&p8) : 0;
+		IMMSV_EVT op_evt;
+		IMMSV_EVT_ARENA arena;
+		NCS_UBAID uba;
+		uba.start = NULL;
+
+		if (size == 0 || size > left - 4) {
+			LOG_WA("ERR_LIBRARY: Malformed batch of ccb %u",
+			       req->ccbId);
+			return SA_AIS_ERR_LIBRARY;
+		}
+		offset += 4 + size;
+
+		memset(&op_evt, '\0', sizeof(IMMSV_EVT));
+		immsv_evt_arena_init(&arena, (char *)p8, size);
+
+		if ((ncs_enc_init_space_pp(&uba, 0, 0) != NCSCC_RC_SUCCESS) ||
+		    (ncs_encode_n_octets_in_uba(&uba, p8, size) !=
+		     NCSCC_RC_SUCCESS)) {
+			LOG_ER("Failed buffer copy");
+			error = SA_AIS_ERR_NO_RESOURCES;
+			goto next;
+		}
+
+		ncs_dec_init_space(&uba, uba.start);
+		uba.bufp = NULL;
+
+		if (immsv_evt_dec_arena(&uba, &op_evt, &arena) !=
+			NCSCC_RC_SUCCESS ||
+		    op_evt.type != IMMSV_EVT_TYPE_IMMND) {
+			LOG_ER("Edu decode Failed");
+			error = SA_AIS_ERR_LIBRARY;
+			goto next;
+		}
+
+		switch (op_evt.info.immnd.type) {
+		case IMMND_EVT_A2ND_OBJ_CREATE:
+		case IMMND_EVT_A2ND_OBJ_CREATE_2:
+			error = immnd_imm_service_object_check(
+			    sinfo,
+			    op_evt.info.immnd.info.objCreate.parentOrObjectDn
+				.buf,
+			    NULL);
+			break;
+
+		case IMMND_EVT_A2ND_OBJ_MODIFY:
+			error = immnd_imm_service_object_check(
+			    sinfo,
+			    op_evt.info.immnd.info.objModify.objectName.buf,
+			    op_evt.info.immnd.info.objModify.attrMods);
+			break;
+
+		case IMMND_EVT_A2ND_OBJ_DELETE:
+			error = immnd_imm_service_object_check(
+			    sinfo,
+			    op_evt.info.immnd.info.objDelete.objectName.buf,
+			    NULL);
+			break;
+
+		default:
+			LOG_WA("ERR_LIBRARY: Unexpected message type %u in "
+			       "batch of ccb %u",
+			       op_evt.info.immnd.type, req->ccbId);
+			error = SA_AIS_ERR_LIBRARY;
+			break;
+		}
+
+	next:
+		if (uba.start) {
+			m_MMGR_FREE_BUFR_LIST(uba.start);
+		}
+		immnd_evt_destroy(&op_evt, false, __LINE__);
+		immsv_evt_arena_free(&arena);
+	}
+
+	return error;
+}
+
 /*
   Function for performing immnd local checks on fevs packed messages.
   Normally they pass the checks and are forwarded to the IMMD.
@@ -3679,6 +3922,8 @@ static SaAisErrorT immnd_fevs_local_checks(IMMND_CB *cb, IMMSV_FEVS *fevsReq,
 	uba.start = NULL;
 	IMMSV_EVT frwrd_evt;
 	memset(&frwrd_evt, '\0', sizeof(IMMSV_EVT));
+	IMMSV_EVT_ARENA arena;
+	immsv_evt_arena_init(&arena, msg->buf, msg->size);
 
 	immnd_client_node_get(cb, clnt_hdl, &cl_node);
 	if (cl_node == NULL || cl_node->mIsStale) {
@@ -3704,7 +3949,7 @@ static SaAisErrorT immnd_fevs_local_checks(IMMND_CB *cb, IMMSV_FEVS *fevsReq,
 	uba.bufp = NULL;
 
 	/* Decode non flat. */
-	if (immsv_evt_dec(&uba, &frwrd_evt) != NCSCC_RC_SUCCESS) {
+	if (immsv_evt_dec_arena(&uba, &frwrd_evt, &arena) != NCSCC_RC_SUCCESS) {
 		LOG_ER("Edu decode Failed");
 		error = SA_AIS_ERR_LIBRARY;
 		goto unpack_failure;
@@ -3719,67 +3964,11 @@ static SaAisErrorT immnd_fevs_local_checks(IMMND_CB *cb, IMMSV_FEVS *fevsReq,
 	switch (frwrd_evt.info.immnd.type) {
 
 	case IMMND_EVT_A2ND_OBJ_MODIFY:
-		if ((sinfo != NULL) &&
-		    ((strcmp(frwrd_evt.info.immnd.info.objModify.objectName.buf,
-			     OPENSAF_IMM_OBJECT_DN) == 0) ||
-		     (strcmp(frwrd_evt.info.immnd.info.objModify.objectName.buf,
-			     "safRdn=immManagement,safApp=safImmService") ==
-		      0))) {
-			/* Modifications to IMM service objects are only allowed
-			 * for root users and same group as me. Except for
-			 * access control settings which are only allowed by
-			 * root.
-			 */
-			if ((sinfo->uid > 0) && (sinfo->gid != getgid())) {
-				struct passwd *pwd = getpwuid(sinfo->uid);
-				if (pwd != NULL) {
-					syslog(
-					    LOG_AUTH,
-					    "Modifications to imm service objects denied for %s(uid=%d)",
-					    pwd->pw_name, sinfo->uid);
-				}
-				error = SA_AIS_ERR_ACCESS_DENIED;
-				break; /* out of switch */
-			} else if (sinfo->uid > 0) {
-				// non root and same group as me, disallow
-				// access control changes
-				bool ac_failed = false;
-				const IMMSV_ATTR_MODS_LIST *attrMod =
-				    frwrd_evt.info.immnd.info.objModify
-					.attrMods;
-				while (attrMod != NULL) {
-					if ((strcmp(
-						 attrMod->attrValue.attrName
-						     .buf,
-						 OPENSAF_IMM_ACCESS_CONTROL_MODE) ==
-					     0) ||
-					    (strcmp(
-						 attrMod->attrValue.attrName
-						     .buf,
-						 OPENSAF_IMM_AUTHORIZED_GROUP) ==
-					     0)) {
-						struct passwd *pwd =
-						    getpwuid(sinfo->uid);
-						if (pwd != NULL)
-							syslog(
-							    LOG_AUTH,
-							    "change of %s denied for %s(uid=%d)",
-							    attrMod->attrValue
-								.attrName.buf,
-							    pwd->pw_name,
-							    sinfo->uid);
-						error =
-						    SA_AIS_ERR_ACCESS_DENIED;
-						ac_failed = true;
-						break; /* out of while */
-					}
-					attrMod = attrMod->next;
-				}
-				if (ac_failed) {
-					break;
-				} /* out of switch */
-			} else
-				; // modifications by root are OK
+		error = immnd_imm_service_object_check(
+		    sinfo, frwrd_evt.info.immnd.info.objModify.objectName.buf,
+		    frwrd_evt.info.immnd.info.objModify.attrMods);
+		if (error != SA_AIS_OK) {
+			break; /* out of switch */
 		}
 	/* intentional fall through. */
 	case IMMND_EVT_A2ND_OBJ_CREATE:
@@ -3792,6 +3981,24 @@ static SaAisErrorT immnd_fevs_local_checks(IMMND_CB *cb, IMMSV_FEVS *fevsReq,
 		}
 		break;
 
+	case IMMND_EVT_A2ND_CCB_BATCH:
+		if ((sinfo != NULL) && (sinfo->uid > 0)) {
+			/* Root is allowed everything, no need to decode */
+			error = immnd_ccb_batch_local_checks(
+			    sinfo, &(frwrd_evt.info.immnd.info.ccbBatch));
+		}
+
+		if (error != SA_AIS_OK) {
+			; /* Access denied or malformed batch */
+		} else if (!immModel_protocol52103Allowed(cb)) {
+			LOG_NO(
+			    "Streamed ccb operations rejected during upgrade to 5.21.03 (OPENSAF_IMM_FLAG_PRT52103_ALLOW is false)");
+			error = SA_AIS_ERR_NO_RESOURCES;
+		} else if (immModel_pbeNotWritable(cb)) {
+			error = SA_AIS_ERR_TRY_AGAIN;
+		}
+		break;
+
 	case IMMND_EVT_A2ND_OBJ_SAFE_READ:
 		TRACE(
 		    "IMMND_EVT_A2ND_OBJ_SAFE_READ noted in fevs_local_checks");
@@ -4277,6 +4484,7 @@ unpack_failure:
 	immnd_evt_destroy(&frwrd_evt, false, __LINE__);
 
 client_down:
+	immsv_evt_arena_free(&arena);
 
 	TRACE_LEAVE();
 	return error;
@@ -4312,6 +4520,13 @@ static void immnd_evt_proc_ccb_obj_modify_rsp(IMMND_CB *cb, IMMND_EVT *evt,
 	    cb, evt->info.ccbUpcallRsp.ccbId, evt->info.ccbUpcallRsp.inv,
 	    evt->info.ccbUpcallRsp.result, &reqConn);
 
+	if (immnd_ccb_batch_resume(cb, evt->info.ccbUpcallRsp.ccbId, reqConn,
+				   evt->info.ccbUpcallRsp.result,
+				   &(evt->info.ccbUpcallRsp.errorString))) {
+		/* A streamed operation, the client is not waiting for it */
+		reqConn = 0;
+	}
+
 	if (reqConn) {
 		SaImmHandleT tmp_hdl =
 		    m_IMMSV_PACK_HANDLE(reqConn, cb->node_id);
@@ -4407,6 +4622,13 @@ static void immnd_evt_proc_ccb_obj_create_rsp(IMMND_CB *cb, IMMND_EVT *evt,
 	    cb, evt->info.ccbUpcallRsp.ccbId, evt->info.ccbUpcallRsp.inv,
 	    evt->info.ccbUpcallRsp.result, &reqConn);
 
+	if (immnd_ccb_batch_resume(cb, evt->info.ccbUpcallRsp.ccbId, reqConn,
+				   evt->info.ccbUpcallRsp.result,
+				   &(evt->info.ccbUpcallRsp.errorString))) {
+		/* A streamed operation, the client is not waiting for it */
+		reqConn = 0;
+	}
+
 	if (reqConn) {
 		SaImmHandleT tmp_hdl =
 		    m_IMMSV_PACK_HANDLE(reqConn, cb->node_id);
@@ -4503,10 +4725,17 @@ static void immnd_evt_proc_ccb_obj_delete_rsp(IMMND_CB *cb, IMMND_EVT *evt,
 				       &augDelete);
 
 	SaAisErrorT err = SA_AIS_OK;
+	bool waitForAck = immModel_ccbWaitForDeleteImplAck(
+	    cb, evt->info.ccbUpcallRsp.ccbId, &err, augDelete);
 
-	if (!immModel_ccbWaitForDeleteImplAck(cb, evt->info.ccbUpcallRsp.ccbId,
-					      &err, augDelete) &&
-	    reqConn) {
+	if (immnd_ccb_batch_resume(cb, evt->info.ccbUpcallRsp.ccbId, reqConn,
+				   evt->info.ccbUpcallRsp.result,
+				   &(evt->info.ccbUpcallRsp.errorString))) {
+		/* A streamed operation, the client is not waiting for it */
+		reqConn = 0;
+	}
+
+	if (!waitForAck && reqConn) {
 		SaImmHandleT tmp_hdl =
 		    m_IMMSV_PACK_HANDLE(reqConn, cb->node_id);
 
@@ -6380,6 +6609,11 @@ static void immnd_evt_proc_class_create(IMMND_CB *cb, IMMND_EVT *evt,
 				     originatedAtThisNd ? reqConn : 0, nodeId,
 				     &continuationId, &pbeConn, pbeNodeIdPtr);
 
+	if (error == SA_AIS_OK) {
+		immnd_proc_class_changed(cb,
+					 &(evt->info.classDescr.className));
+	}
+
 	if (pbeNodeId && error == SA_AIS_OK) {
 		/*The persistent back-end is present => wait for reply. */
 		delayedReply = true;
@@ -6542,6 +6776,11 @@ static void immnd_evt_proc_class_delete(IMMND_CB *cb, IMMND_EVT *evt,
 				     originatedAtThisNd ? reqConn : 0, nodeId,
 				     &continuationId, &pbeConn, pbeNodeIdPtr);
 
+	if (error == SA_AIS_OK) {
+		immnd_proc_class_changed(cb,
+					 &(evt->info.classDescr.className));
+	}
+
 	if (pbeNodeId && error == SA_AIS_OK) {
 		/*The persistent back-end is present => wait for reply. */
 		delayedReply = true;
@@ -7118,15 +7357,17 @@ static void immnd_evt_proc_rt_object_create(IMMND_CB *cb, IMMND_EVT *evt,
  *                 IMM_DEST reply_dest - The dest of the ND to where reply
  *                                         is to be sent (only relevant if
  *                                       originatedAtThisNode is false).
- * Return Values : None
+ * Return Values : The result of the operation in the model, which is the
+ *                 same at all nodes.
  *
  *****************************************************************************/
-static void immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
-					 bool originatedAtThisNd,
-					 SaImmHandleT clnt_hdl,
-					 MDS_DEST reply_dest)
+static SaAisErrorT immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
+						bool originatedAtThisNd,
+						SaImmHandleT clnt_hdl,
+						MDS_DEST reply_dest)
 {
 	SaAisErrorT err = SA_AIS_OK;
+	SaAisErrorT modelErr;
 	IMMSV_EVT send_evt;
 	IMMND_IMM_CLIENT_NODE *cl_node = NULL;
 
@@ -7174,6 +7415,7 @@ static void immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
 	    cb, &(evt->info.objCreate), &implConn, &implNodeId, &continuationId,
 	    &pbeConn, pbeNodeIdPtr, &objName, &dnOrRdnIsLong,
 	    evt->type == IMMND_EVT_A2ND_OBJ_CREATE_2);
+	modelErr = err;
 
 	if (pbeNodeIdPtr && pbeConn && err == SA_AIS_OK) {
 		/*The persistent back-end is present and executing at THIS node.
@@ -7346,7 +7588,7 @@ static void immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
 		if (cl_node == NULL || cl_node->mIsStale) {
 			LOG_WA("IMMND - Client went down so no response");
 			osaf_extended_name_free(&objName);
-			return;
+			return modelErr;
 		}
 
 		TRACE_2("send immediate reply to client/agent");
@@ -7371,6 +7613,7 @@ static void immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
 	}
 	osaf_extended_name_free(&objName);
 	TRACE_LEAVE();
+	return modelErr;
 }
 
 /****************************************************************************
@@ -7388,15 +7631,17 @@ static void immnd_evt_proc_object_create(IMMND_CB *cb, IMMND_EVT *evt,
  *                 IMM_DEST reply_dest - The dest of the ND to where reply
  *                                         is to be sent (only relevant if
  *                                       originatedAtThisNode is false).
- * Return Values : None
+ * Return Values : The result of the operation in the model, which is the
+ *                 same at all nodes.
  *
  *****************************************************************************/
-static void immnd_evt_proc_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
-					 bool originatedAtThisNd,
-					 SaImmHandleT clnt_hdl,
-					 MDS_DEST reply_dest)
+static SaAisErrorT immnd_evt_proc_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
+						bool originatedAtThisNd,
+						SaImmHandleT clnt_hdl,
+						MDS_DEST reply_dest)
 {
 	SaAisErrorT err = SA_AIS_OK;
+	SaAisErrorT modelErr;
 	IMMSV_EVT send_evt;
 	IMMND_IMM_CLIENT_NODE *cl_node = NULL;
 
@@ -7449,6 +7694,7 @@ static void immnd_evt_proc_object_modify(IMMND_CB *cb, IMMND_EVT *evt,
 	err = immModel_ccbObjectModify(cb, &(evt->info.objModify), &implConn,
 				       &implNodeId, &continuationId, &pbeConn,
 				       pbeNodeIdPtr, &objName, &hasLongDns);
+	modelErr = err;
 
 	/* If 'hasLongDns' is true, allWritableAttr will also contains long DN
 	 */
@@ -7750,6 +7996,7 @@ done:
 	allWritableAttr = NULL;
 	osaf_extended_name_free(&objName);
 	TRACE_LEAVE();
+	return modelErr;
 }
 
 /****************************************************************************
@@ -8122,6 +8369,8 @@ static void immnd_evt_ccb_abort(IMMND_CB *cb, SaUint32T ccbId,
 
 	TRACE_ENTER();
 
+	immnd_ccb_batch_drop(cb, ccbId);
+
 	if (cb->mPbeFile && (cb->mRim == SA_IMM_KEEP_REPOSITORY)) {
 		pbeNodeIdPtr = &pbeNodeId;
 		TRACE("We expect there to be a PBE");
@@ -8287,15 +8536,17 @@ done:
  *                 IMM_DEST reply_dest - The dest of the ND to where reply
  *                                       is to be sent (only relevant if
  *                                       originatedAtThisNode is false).
- * Return Values : None
+ * Return Values : The result of the operation in the model, which is the
+ *                 same at all nodes.
  *
  *****************************************************************************/
-static void immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
-					 bool originatedAtThisNd,
-					 SaImmHandleT clnt_hdl,
-					 MDS_DEST reply_dest)
+static SaAisErrorT immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
+						bool originatedAtThisNd,
+						SaImmHandleT clnt_hdl,
+						MDS_DEST reply_dest)
 {
 	SaAisErrorT err = SA_AIS_OK;
+	SaAisErrorT modelErr;
 	IMMSV_EVT send_evt;
 	IMMND_IMM_CLIENT_NODE *cl_node = NULL;
 
@@ -8332,6 +8583,7 @@ static void immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
 	    cb, &(evt->info.objDelete), originatedAtThisNd ? conn : 0, &arrSize,
 	    &implConnArr, &invocArr, &objNameArr, &pbeConn, pbeNodeIdPtr,
 	    &augDelete, &hasLongDn);
+	modelErr = err;
 
 	/* Before generating implementer upcalls for any local implementers,
 	   generate PBE upcalls for ALL deleted objects, if the PBE exists and
@@ -8667,7 +8919,7 @@ static void immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
 		immnd_client_node_get(cb, clnt_hdl, &cl_node);
 		if (cl_node == NULL || cl_node->mIsStale) {
 			LOG_WA("IMMND - OM Client went down so no response");
-			return;
+			return modelErr;
 		}
 
 		TRACE_2("Send immediate reply to OM client");
@@ -8690,6 +8942,408 @@ static void immnd_evt_proc_object_delete(IMMND_CB *cb, IMMND_EVT *evt,
 		immsv_evt_free_attrNames(
 		    send_evt.info.imma.info.errRsp.errStrings);
 	}
+	return modelErr;
+}
+
+static IMMND_CCB_BATCH *immnd_ccb_batch_find(IMMND_CB *cb, SaUint32T ccbId)
+{
+	IMMND_CCB_BATCH *batch = cb->mCcbBatches;
+
+	while (batch && batch->ccbId != ccbId) {
+		batch = batch->next;
+	}
+	return batch;
+}
+
+static IMMND_CCB_BATCH *immnd_ccb_batch_get(IMMND_CB *cb, SaUint32T ccbId)
+{
+	IMMND_CCB_BATCH *batch = immnd_ccb_batch_find(cb, ccbId);
+
+	if (batch == NULL) {
+		batch = calloc(1, sizeof(IMMND_CCB_BATCH));
+		osafassert(batch);
+		batch->ccbId = ccbId;
+		batch->nextBatch = 1;
+		batch->error = SA_AIS_OK;
+		batch->lostError = SA_AIS_OK;
+		batch->next = cb->mCcbBatches;
+		cb->mCcbBatches = batch;
+	}
+	return batch;
+}
+
+static void immnd_ccb_batch_free_ops(IMMND_CCB_BATCH *batch)
+{
+	free(batch->ops);
+	batch->ops = NULL;
+	batch->opsSize = 0;
+	batch->opsOffset = 0;
+}
+
+/* The first failed operation vetoes the ccb, the rest are dropped */
+static void immnd_ccb_batch_fail(IMMND_CB *cb, IMMND_CCB_BATCH *batch,
+				 SaAisErrorT err)
+{
+	if (batch->error == SA_AIS_OK) {
+		TRACE_2("Streamed operation in ccb %u failed, error:%u",
+			batch->ccbId, err);
+		/* The operations are consumed, they can not be retried */
+		if (err == SA_AIS_ERR_TRY_AGAIN ||
+		    err == SA_AIS_ERR_BAD_HANDLE) {
+			batch->error = SA_AIS_ERR_FAILED_OPERATION;
+		} else {
+			batch->error = err;
+		}
+		immModel_ccbVeto(cb, batch->ccbId, err);
+	}
+	immnd_ccb_batch_free_ops(batch);
+}
+
+static void immnd_ccb_batch_reply(IMMND_CB *cb, IMMND_CCB_BATCH *batch)
+{
+	IMMSV_EVT send_evt;
+	IMMND_IMM_CLIENT_NODE *cl_node = NULL;
+
+	batch->replyPending = false;
+	immnd_client_node_get(cb, batch->clnt_hdl, &cl_node);
+	if (cl_node == NULL || cl_node->mIsStale) {
+		LOG_WA("IMMND - Client went down so no response");
+		return;
+	}
+
+	TRACE_2("Send reply for streamed operations of ccb %u, error:%u",
+		batch->ccbId, batch->error);
+	memset(&send_evt, '\0', sizeof(IMMSV_EVT));
+	send_evt.type = IMMSV_EVT_TYPE_IMMA;
+	send_evt.info.imma.type = IMMA_EVT_ND2A_IMM_ERROR;
+	send_evt.info.imma.info.errRsp.error = batch->error;
+	if (batch->error != SA_AIS_OK) {
+		send_evt.info.imma.info.errRsp.errStrings =
+		    immModel_ccbGrabErrStrings(cb, batch->ccbId);
+		if (send_evt.info.imma.info.errRsp.errStrings) {
+			send_evt.info.imma.type = IMMA_EVT_ND2A_IMM_ERROR_2;
+		}
+	}
+
+	if (immnd_mds_send_rsp(cb, &(cl_node->tmpSinfo), &send_evt) !=
+	    NCSCC_RC_SUCCESS) {
+		LOG_WA("Failed to send result to Agent over MDS");
+	}
+	immsv_evt_free_attrNames(send_evt.info.imma.info.errRsp.errStrings);
+}
+
+/* A client waiting for the streamed operations of an aborted ccb gets
+   FAILED_OPERATION */
+static void immnd_ccb_batch_delete(IMMND_CB *cb, IMMND_CCB_BATCH *batch)
+{
+	if (batch->replyPending) {
+		if (batch->error == SA_AIS_OK) {
+			batch->error = SA_AIS_ERR_FAILED_OPERATION;
+		}
+		immnd_ccb_batch_reply(cb, batch);
+	}
+	immnd_ccb_batch_free_ops(batch);
+	free(batch);
+}
+
+static void immnd_ccb_batch_drop(IMMND_CB *cb, SaUint32T ccbId)
+{
+	IMMND_CCB_BATCH **pp = &(cb->mCcbBatches);
+
+	while (*pp) {
+		IMMND_CCB_BATCH *batch = *pp;
+		if (batch->ccbId == ccbId) {
+			TRACE("Dropping streamed operations of ccb %u", ccbId);
+			*pp = batch->next;
+			immnd_ccb_batch_delete(cb, batch);
+			return;
+		}
+		pp = &(batch->next);
+	}
+}
+
+void immnd_evt_ccb_batch_cleanup(IMMND_CB *cb)
+{
+	IMMND_CCB_BATCH **pp = &(cb->mCcbBatches);
+
+	while (*pp) {
+		IMMND_CCB_BATCH *batch = *pp;
+		if (immModel_ccbReadyForOp(cb, batch->ccbId) ==
+		    SA_AIS_ERR_BAD_HANDLE) {
+			TRACE("Dropping streamed operations of terminated "
+			      "ccb %u",
+			      batch->ccbId);
+			*pp = batch->next;
+			immnd_ccb_batch_delete(cb, batch);
+		} else {
+			pp = &(batch->next);
+		}
+	}
+}
+
+/* Decode and process one streamed operation, as if it had arrived over fevs
+   from another node. */
+static SaAisErrorT immnd_ccb_batch_op(IMMND_CB *cb, IMMND_CCB_BATCH *batch,
+				      char *buf, SaUint32T size)
+{
+	SaAisErrorT err = SA_AIS_ERR_LIBRARY;
+	IMMSV_EVT op_evt;
+	IMMSV_EVT_ARENA arena;
+	NCS_UBAID uba;
+	uba.start = NULL;
+
+	memset(&op_evt, '\0', sizeof(IMMSV_EVT));
+	immsv_evt_arena_init(&arena, buf, size);
+
+	if ((ncs_enc_init_space_pp(&uba, 0, 0) != NCSCC_RC_SUCCESS) ||
+	    (ncs_encode_n_octets_in_uba(&uba, (uint8_t *)buf, size) !=
+	     NCSCC_RC_SUCCESS)) {
+		LOG_ER("Failed buffer copy");
+		err = SA_AIS_ERR_NO_RESOURCES;
+		goto done;
+	}
+
+	ncs_dec_init_space(&uba, uba.start);
+	uba.bufp = NULL;
+
+	if (immsv_evt_dec_arena(&uba, &op_evt, &arena) != NCSCC_RC_SUCCESS ||
+	    op_evt.type != IMMSV_EVT_TYPE_IMMND) {
+		LOG_ER("Edu decode Failed");
+		goto done;
+	}
+
+	switch (op_evt.info.immnd.type) {
+	case IMMND_EVT_A2ND_OBJ_CREATE:
+	case IMMND_EVT_A2ND_OBJ_CREATE_2:
+		if (op_evt.info.immnd.info.objCreate.ccbId == batch->ccbId) {
+			err = immnd_evt_proc_object_create(
+			    cb, &op_evt.info.immnd, false, 0LL, 0LL);
+		}
+		break;
+
+	case IMMND_EVT_A2ND_OBJ_MODIFY:
+		if (op_evt.info.immnd.info.objModify.ccbId == batch->ccbId) {
+			err = immnd_evt_proc_object_modify(
+			    cb, &op_evt.info.immnd, false, 0LL, 0LL);
+		}
+		break;
+
+	case IMMND_EVT_A2ND_OBJ_DELETE:
+		if (op_evt.info.immnd.info.objDelete.ccbId == batch->ccbId) {
+			err = immnd_evt_proc_object_delete(
+			    cb, &op_evt.info.immnd, false, 0LL, 0LL);
+		}
+		break;
+
+	default:
+		LOG_ER("Unexpected message type %u in batch of ccb %u",
+		       op_evt.info.immnd.type, batch->ccbId);
+		break;
+	}
+
+done:
+	if (uba.start) {
+		m_MMGR_FREE_BUFR_LIST(uba.start);
+	}
+	immnd_evt_destroy(&op_evt, false, __LINE__);
+	immsv_evt_arena_free(&arena);
+	return err;
+}
+
+/* Process the streamed operations of a ccb until one of them has to wait for
+   implementers, then it is resumed by immnd_ccb_batch_resume. When all
+   operations are done the client gets the reply, if it asked for one. */
+static void immnd_ccb_batch_process(IMMND_CB *cb, IMMND_CCB_BATCH *batch)
+{
+	SaAisErrorT err;
+	TRACE_ENTER2("ccb:%u", batch->ccbId);
+
+	batch->waiting = false;
+	while (batch->error == SA_AIS_OK) {
+		err = immModel_ccbReadyForOp(cb, batch->ccbId);
+		if (err == SA_AIS_ERR_TRY_AGAIN) {
+			batch->waiting = true;
+			TRACE_LEAVE();
+			return;
+		} else if (err != SA_AIS_OK) {
+			immnd_ccb_batch_fail(cb, batch, err);
+			break;
+		}
+
+		if (batch->opsOffset == batch->opsSize) {
+			break;
+		}
+
+		uint8_t *p8 = (uint8_t *)batch->ops + batch->opsOffset;
+		SaUint32T left = batch->opsSize - batch->opsOffset;
+		SaUint32T size = (left >= 4) ? ncs_decode_32bit(&p8) : 0;
+		if (size == 0 || size > left - 4) {
+			LOG_ER("Malformed batch of ccb %u", batch->ccbId);
+			immnd_ccb_batch_fail(cb, batch, SA_AIS_ERR_LIBRARY);
+			break;
+		}
+		batch->opsOffset += 4 + size;
+
+		err = immnd_ccb_batch_op(cb, batch, (char *)p8, size);
+		if (err != SA_AIS_OK) {
+			immnd_ccb_batch_fail(cb, batch, err);
+		}
+	}
+
+	immnd_ccb_batch_free_ops(batch);
+	if (batch->replyPending) {
+		immnd_ccb_batch_reply(cb, batch);
+	}
+	TRACE_LEAVE();
+}
+
+/* Called when the implementers have replied on an operation of a ccb. Returns
+   true if the operation was streamed, the client is then not waiting for the
+   reply. */
+static bool immnd_ccb_batch_resume(IMMND_CB *cb, SaUint32T ccbId,
+				   SaUint32T reqConn, SaAisErrorT result,
+				   const IMMSV_OCTET_STRING *errorString)
+{
+	IMMND_CCB_BATCH *batch = immnd_ccb_batch_find(cb, ccbId);
+	bool streamed;
+
+	if (batch == NULL || !batch->waiting) {
+		return false;
+	}
+
+	/* Replies on operations of an augmentation go to the implementer */
+	streamed = reqConn &&
+		   (reqConn == m_IMMSV_UNPACK_HANDLE_HIGH(batch->clnt_hdl));
+	if (streamed && (result != SA_AIS_OK) && errorString->size) {
+		immModel_setCcbErrorString(cb, ccbId, "%.*s",
+					   (int)errorString->size,
+					   errorString->buf);
+	}
+
+	immnd_ccb_batch_process(cb, batch);
+	return streamed;
+}
+
+/****************************************************************************
+ * Name          : immnd_evt_proc_ccb_batch
+ *
+ * Description   : Function to process a batch of ccb operations streamed by
+ *                 the saImmOmCcbObject*Async functions. Arrives over FEVS.
+ *                 The operations are processed in order at all nodes, as if
+ *                 they had arrived one by one, but without replies. When an
+ *                 operation has implementers the rest of the batch waits
+ *                 for their replies. The first failed operation vetoes the
+ *                 ccb. If the client asked for a reply it gets it when all
+ *                 operations received so far are done, with the error of the
+ *                 first failed operation.
+ *
+ * Arguments     : IMMND_CB *cb - IMMND CB pointer
+ *                 IMMND_EVT *evt - Received Event structure
+ *                 bool originatedAtThisNode - Did it come from this node?
+ *                 SaImmHandleT clnt_hdl - The client handle (only relevant if
+ *                                         originatedAtThisNode is true).
+ * Return Values : None
+ *
+ *****************************************************************************/
+static void immnd_evt_proc_ccb_batch(IMMND_CB *cb, IMMND_EVT *evt,
+				     bool originatedAtThisNd,
+				     SaImmHandleT clnt_hdl)
+{
+	IMMSV_OM_CCB_BATCH *req = &(evt->info.ccbBatch);
+	IMMND_CCB_BATCH *batch = immnd_ccb_batch_get(cb, req->ccbId);
+	TRACE_ENTER2("ccb:%u batch:%u ops:%u", req->ccbId, req->batchNo,
+		     req->numOps);
+
+	if (originatedAtThisNd) {
+		batch->clnt_hdl = clnt_hdl;
+		if (req->replyWanted) {
+			batch->replyPending = true;
+		}
+	}
+
+	if (req->batchNo != batch->nextBatch) {
+		/* An asynchronous batch was discarded, e.g. IMMD was down */
+		LOG_WA("Ccb %u expected batch %u, received %u", req->ccbId,
+		       batch->nextBatch, req->batchNo);
+		if (originatedAtThisNd && batch->error == SA_AIS_OK &&
+		    batch->lostError != SA_AIS_OK) {
+			/* The batch was rejected here, tell the client why */
+			immModel_setCcbErrorString(
+			    cb, req->ccbId,
+			    IMM_RESOURCE_ABORT
+			    "Streamed operations rejected by IMMND, error:%u",
+			    batch->lostError);
+		}
+		immnd_ccb_batch_fail(cb, batch, SA_AIS_ERR_FAILED_OPERATION);
+	}
+	batch->nextBatch = req->batchNo + 1;
+
+	if (batch->error == SA_AIS_OK && req->ops.size) {
+		/* Append to the operations waiting, if any */
+		SaUint32T left = batch->opsSize - batch->opsOffset;
+		char *ops = malloc(left + req->ops.size);
+		osafassert(ops);
+		if (left) {
+			memcpy(ops, batch->ops + batch->opsOffset, left);
+		}
+		memcpy(ops + left, req->ops.buf, req->ops.size);
+		immnd_ccb_batch_free_ops(batch);
+		batch->ops = ops;
+		batch->opsSize = left + req->ops.size;
+	}
+
+	if (!batch->waiting) {
+		immnd_ccb_batch_process(cb, batch);
+	}
+	TRACE_LEAVE();
+}
+
+/* An asynchronous fevs message is dropped at the originating node. If it is
+   a batch of streamed ccb operations, the error is kept until the next batch
+   of the ccb, which finds the gap at all nodes and aborts the ccb. The client
+   gets the error when it syncs the ccb. */
+static void immnd_fevs_ccb_batch_lost(IMMND_CB *cb, IMMSV_FEVS *fevsReq,
+				      SaAisErrorT err)
+{
+	IMMSV_EVT frwrd_evt;
+	IMMSV_EVT_ARENA arena;
+	NCS_UBAID uba;
+	uba.start = NULL;
+
+	memset(&frwrd_evt, '\0', sizeof(IMMSV_EVT));
+	immsv_evt_arena_init(&arena, fevsReq->msg.buf, fevsReq->msg.size);
+
+	if ((ncs_enc_init_space_pp(&uba, 0, 0) != NCSCC_RC_SUCCESS) ||
+	    (ncs_encode_n_octets_in_uba(&uba, (uint8_t *)fevsReq->msg.buf,
+					fevsReq->msg.size) !=
+	     NCSCC_RC_SUCCESS)) {
+		LOG_ER("Failed buffer copy");
+		goto done;
+	}
+
+	ncs_dec_init_space(&uba, uba.start);
+	uba.bufp = NULL;
+
+	if ((immsv_evt_dec_arena(&uba, &frwrd_evt, &arena) ==
+	     NCSCC_RC_SUCCESS) &&
+	    (frwrd_evt.type == IMMSV_EVT_TYPE_IMMND) &&
+	    (frwrd_evt.info.immnd.type == IMMND_EVT_A2ND_CCB_BATCH)) {
+		IMMND_CCB_BATCH *batch = immnd_ccb_batch_get(
+		    cb, frwrd_evt.info.immnd.info.ccbBatch.ccbId);
+		LOG_WA("Batch %u of ccb %u dropped, error:%u",
+		       frwrd_evt.info.immnd.info.ccbBatch.batchNo,
+		       batch->ccbId, err);
+		if (batch->lostError == SA_AIS_OK) {
+			batch->lostError = err;
+		}
+	}
+
+done:
+	if (uba.start) {
+		m_MMGR_FREE_BUFR_LIST(uba.start);
+	}
+	immnd_evt_destroy(&frwrd_evt, false, __LINE__);
+	immsv_evt_arena_free(&arena);
 }
 
 /****************************************************************************
@@ -9656,10 +10310,13 @@ immnd_evt_proc_fevs_dispatch(IMMND_CB *cb, IMMSV_OCTET_STRING *msg,
 {
 	SaAisErrorT error = SA_AIS_OK;
 	IMMSV_EVT frwrd_evt;
+	IMMSV_EVT_ARENA arena;
 	NCS_UBAID uba;
 	uba.start = NULL;
 
 	memset(&frwrd_evt, '\0', sizeof(IMMSV_EVT));
+	/* The message is decoded into one arena, its strings point into msg */
+	immsv_evt_arena_init(&arena, msg->buf, msg->size);
 
 	/*Unpack the embedded message */
 	if (ncs_enc_init_space_pp(&uba, 0, 0) != NCSCC_RC_SUCCESS) {
@@ -9696,7 +10353,7 @@ immnd_evt_proc_fevs_dispatch(IMMND_CB *cb, IMMSV_OCTET_STRING *msg,
 	uba.bufp = NULL;
 
 	/* Decode non flat. */
-	if (immsv_evt_dec(&uba, &frwrd_evt) != NCSCC_RC_SUCCESS) {
+	if (immsv_evt_dec_arena(&uba, &frwrd_evt, &arena) != NCSCC_RC_SUCCESS) {
 		LOG_ER("Edu decode Failed");
 		error = SA_AIS_ERR_LIBRARY;
 		goto unpack_failure;
@@ -9757,6 +10414,11 @@ immnd_evt_proc_fevs_dispatch(IMMND_CB *cb, IMMSV_OCTET_STRING *msg,
 						reply_dest);
 		break;
 
+	case IMMND_EVT_A2ND_CCB_BATCH:
+		immnd_evt_proc_ccb_batch(cb, &frwrd_evt.info.immnd,
+					 originatedAtThisNd, clnt_hdl);
+		break;
+
 	case IMMND_EVT_A2ND_OBJ_SYNC:
 	case IMMND_EVT_A2ND_OBJ_SYNC_2:
 		immnd_evt_proc_object_sync(cb, &frwrd_evt.info.immnd,
@@ -10020,6 +10682,7 @@ unpack_failure:
 		m_MMGR_FREE_BUFR_LIST(uba.start);
 	}
 	immnd_evt_destroy(&frwrd_evt, false, __LINE__);
+	immsv_evt_arena_free(&arena);
 	if ((error != SA_AIS_OK) && (error != SA_AIS_ERR_ACCESS)) {
 		TRACE_2("Could not process FEVS message, ERROR:%u", error);
 	}
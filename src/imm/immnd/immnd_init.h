@@ -67,6 +67,9 @@ void immnd_ackToNid(uint32_t rc);
 bool immnd_syncComplete(IMMND_CB *cb, bool coordinator, SaUint32T step);
 
 void immnd_proc_global_abort_ccb(IMMND_CB *cb, SaUint32T ccbId);
+void immnd_proc_class_cache_agent_add(IMMND_CB *cb, MDS_DEST dest);
+void immnd_proc_class_changed(IMMND_CB *cb,
+                              const IMMSV_OCTET_STRING *className);
 void immnd_abortSync(IMMND_CB *cb);
 
 /* End immnd_proc.c */
@@ -213,6 +216,12 @@ SaAisErrorT immModel_searchInitialize(IMMND_CB *cb,
                                       void **searchOp, bool isSync,
                                       bool isAccessor);
 
+void immModel_startReaders(IMMND_CB *cb, unsigned int threads);
+bool immModel_readerDispatch(IMMND_CB *cb, IMMSV_EVT *evt);
+IMMSV_EVT *immModel_readerRequest(IMMND_CB *cb, void *job);
+SaAisErrorT immModel_readerResult(IMMND_CB *cb, void *job, void **searchOp);
+void immModel_readerRelease(IMMND_CB *cb, void *job);
+
 SaAisErrorT immModel_objectIsLockedByCcb(IMMND_CB *cb,
                                          struct ImmsvOmSearchInit *req);
 SaAisErrorT immModel_ccbReadLockObject(IMMND_CB *cb,
@@ -350,6 +359,7 @@ bool immModel_protocol46Allowed(IMMND_CB *cb);
 bool immModel_protocol47Allowed(IMMND_CB *cb);
 bool immModel_protocol50Allowed(IMMND_CB *cb);
 bool immModel_protocol51906Allowed(IMMND_CB *cb);
+bool immModel_protocol52103Allowed(IMMND_CB *cb);
 bool immModel_oneSafe2PBEAllowed(IMMND_CB *cb);
 OsafImmAccessControlModeT immModel_accessControlMode(IMMND_CB *cb);
 const char *immModel_authorizedGroup(IMMND_CB *cb);
@@ -480,6 +490,10 @@ SaAisErrorT immModel_resourceDisplay(
 void immModel_setCcbErrorString(IMMND_CB *cb, SaUint32T ccbId,
                                 const char *errorString, ...);
 
+SaAisErrorT immModel_ccbReadyForOp(IMMND_CB *cb, SaUint32T ccbId);
+
+void immModel_ccbVeto(IMMND_CB *cb, SaUint32T ccbId, SaAisErrorT err);
+
 void immModel_setScAbsenceAllowed(IMMND_CB *cb);
 
 void immmModel_getLocalImplementers(IMMND_CB *cb, SaUint32T *arrSize,
@@ -547,6 +561,7 @@ void immnd_evt_proc_admo_hard_finalize(IMMND_CB *cb, IMMND_EVT *evt,
                                        SaImmHandleT clnt_hdl,
                                        MDS_DEST reply_dest);
 void freeSearchNext(IMMSV_OM_RSP_SEARCH_NEXT *rsp, bool freeTop);
+void immnd_evt_ccb_batch_cleanup(IMMND_CB *cb);
 
 /* End : ----  immnd_evt.c  */
 
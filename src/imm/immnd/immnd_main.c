@@ -332,6 +332,19 @@ static uint32_t immnd_initialize(char *progname)
 		immnd_cb->mWaitSecs = waitSecs;
 	}
 
+	if ((envVar = getenv("IMMSV_READER_THREADS"))) {
+		int readers = atoi(envVar);
+		if (readers > 64) {
+			LOG_WA("IMMSV_READER_THREADS set to %u, must be "
+			       "at most 64. Setting to 64",
+			       readers);
+			readers = 64;
+		}
+		if (readers > 0) {
+			immModel_startReaders(immnd_cb, readers);
+		}
+	}
+
 	if ((immnd_cb->mPbeFile = getenv("IMMSV_PBE_FILE")) != NULL) {
 		LOG_NO(
 		    "Persistent Back-End capability configured, Pbe file:%s (suffix may get added)",
@@ -278,6 +278,96 @@ uint32_t immnd_proc_imma_discard_connection(IMMND_CB *cb,
 	return !(cl_node->mIsStale);
 }
 
+/****************************************************************************
+ * Name          : immnd_proc_class_cache_agent_add
+ *
+ * Description   : Function to register a local OM agent that caches class
+ *                 descriptions, see IMMND_EVT_A2ND_CLASS_DESCR_GET_2. The
+ *                 agent is notified of class changes until it goes down.
+ *
+ * Arguments     : IMMND_CB *cb - IMMND CB pointer
+ *                 MDS_DEST dest - Agent MDS_DEST
+ *
+ *****************************************************************************/
+void immnd_proc_class_cache_agent_add(IMMND_CB *cb, MDS_DEST dest)
+{
+	MDS_DEST *agents;
+	uint32_t ix;
+
+	for (ix = 0; ix < cb->mClassCacheAgentCount; ++ix) {
+		if (memcmp(&cb->mClassCacheAgents[ix], &dest,
+			   sizeof(MDS_DEST)) == 0) {
+			return;
+		}
+	}
+
+	agents = realloc(cb->mClassCacheAgents,
+			 (cb->mClassCacheAgentCount + 1) * sizeof(MDS_DEST));
+	if (agents == NULL) {
+		LOG_WA("Could not register class cache agent");
+		return;
+	}
+	agents[cb->mClassCacheAgentCount++] = dest;
+	cb->mClassCacheAgents = agents;
+	TRACE_5("Class cache agents:%u", cb->mClassCacheAgentCount);
+}
+
+static void immnd_proc_class_cache_agent_remove(IMMND_CB *cb, MDS_DEST dest)
+{
+	uint32_t ix;
+
+	for (ix = 0; ix < cb->mClassCacheAgentCount; ++ix) {
+		if (memcmp(&cb->mClassCacheAgents[ix], &dest,
+			   sizeof(MDS_DEST)) == 0) {
+			cb->mClassCacheAgents[ix] =
+			    cb->mClassCacheAgents[--cb->mClassCacheAgentCount];
+			TRACE_5("Class cache agents:%u",
+				cb->mClassCacheAgentCount);
+			return;
+		}
+	}
+}
+
+/****************************************************************************
+ * Name          : immnd_proc_class_changed
+ *
+ * Description   : Function to notify the local OM agents caching class
+ *                 descriptions that a class has been created, upgraded or
+ *                 deleted. Invoked at every node when the class change
+ *                 arrives over fevs, so the agents only need to listen to
+ *                 their local IMMND.
+ *
+ * Arguments     : IMMND_CB *cb - IMMND CB pointer
+ *                 IMMSV_OCTET_STRING *className - The class that changed
+ *
+ *****************************************************************************/
+void immnd_proc_class_changed(IMMND_CB *cb,
+			      const IMMSV_OCTET_STRING *className)
+{
+	IMMSV_EVT send_evt;
+	uint32_t ix;
+
+	if (cb->mClassCacheAgentCount == 0) {
+		return;
+	}
+
+	memset(&send_evt, '\0', sizeof(IMMSV_EVT));
+	send_evt.type = IMMSV_EVT_TYPE_IMMA;
+	send_evt.info.imma.type = IMMA_EVT_ND2A_CLASS_CHANGED;
+	send_evt.info.imma.info.classDescr.className = *className;
+
+	TRACE_5("Class %s changed, notifying %u agents", className->buf,
+		cb->mClassCacheAgentCount);
+	for (ix = 0; ix < cb->mClassCacheAgentCount; ++ix) {
+		if (immnd_mds_msg_send(cb, NCSMDS_SVC_ID_IMMA_OM,
+				       cb->mClassCacheAgents[ix],
+				       &send_evt) != NCSCC_RC_SUCCESS) {
+			LOG_WA("Failed to notify agent of change of class %s",
+			       className->buf);
+		}
+	}
+}
+
 /****************************************************************************
  * Name          : immnd_proc_imma_down
  *
@@ -296,6 +386,10 @@ void immnd_proc_imma_down(IMMND_CB *cb, MDS_DEST dest, NCSMDS_SVC_ID sv_id)
 	unsigned int count = 0;
 	unsigned int failed = 0;
 
+	if (sv_id == NCSMDS_SVC_ID_IMMA_OM) {
+		immnd_proc_class_cache_agent_remove(cb, dest);
+	}
+
 	/* go through the client tree  */
 	immnd_client_node_getnext(cb, 0, &cl_node);
 
@@ -1325,6 +1419,11 @@ static void immnd_cleanTheHouse(IMMND_CB *cb, bool iAmCoordNow)
 	}
 	ccbsStuckInCritical = stuck;
 
+	if (cb->mCcbBatches) {
+		/* Drop the streamed operations of terminated ccbs */
+		immnd_evt_ccb_batch_cleanup(cb);
+	}
+
 	if (admReqArrSize) {
 		/* TODO: Correct for explicit continuation handling in the
 		   new IMM standard. */
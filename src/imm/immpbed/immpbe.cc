@@ -26,6 +26,7 @@
 #include <assert.h>
 #include <libgen.h>
 #include <unistd.h>
+#include "base/getenv.h"
 #include "osaf/configmake.h"
 
 #define XML_VERSION "1.0"
@@ -117,6 +118,10 @@ int main(int argc, char* argv[]) {
   unsigned int tryCount = 0;
   const SaImmAdminOperationParamsT_2* params[] = {NULL};
   SaImmAdminOperationParamsT_2** retParams = NULL;
+  unsigned int groupCommitMax =
+      base::GetEnv("IMMSV_PBE_GROUP_COMMIT", 0u); /* 0 => per ccb commit */
+  unsigned int groupCommitLatency =
+      base::GetEnv("IMMSV_PBE_GROUP_COMMIT_LATENCY", 50u); /* msec */
 
   if ((logPath = getenv("IMMSV_TRACE_PATHNAME"))) {
     category_mask = 0xffffffff; /* TODO: set using -t flag ? */
@@ -174,6 +179,16 @@ int main(int argc, char* argv[]) {
 
   checkParentProcess();
 
+  if (groupCommitMax > 1) {
+    if (pbe2) {
+      LOG_NO("IMMSV_PBE_GROUP_COMMIT ignored with 2PBE");
+      groupCommitMax = 0;
+    } else {
+      /* Group commit uses WAL journal mode, set before re-attaching below. */
+      pbeSetWalJournalMode(true);
+    }
+  }
+
   if (pbeRecoverFile && argc == 4)
     filename.append(argv[3]);
   else if (!pbeRecoverFile && argc == 3)
@@ -340,7 +355,7 @@ re_open:
   /* If we allow pbe without prior dump we need to fix classIdMap. */
   assert(!classIdMap.empty());
   pbeDaemon(immHandle, dbHandle, ownerHandle, &classIdMap, objCount, pbe2,
-            pbe2BCase);
+            pbe2BCase, groupCommitMax, groupCommitLatency);
   TRACE("Exit from pbeDaemon");
 
   return 0;
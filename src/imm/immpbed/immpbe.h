@@ -22,6 +22,7 @@
 
 void pbeDaemon(SaImmHandleT immHandle, void* dbHandle,
                SaImmAdminOwnerHandleT ownerHandle, ClassMap* classIdMap,
-               int objCount, bool pbe2, bool pbe2B);
+               int objCount, bool pbe2, bool pbe2B,
+               unsigned int groupCommitMax, unsigned int groupCommitLatency);
 
 #endif  // IMM_IMMPBED_IMMPBE_H_
@@ -29,6 +29,7 @@
 
 #include <saAis.h>
 #include "base/osaf_extended_name.h"
+#include "base/osaf_time.h"
 
 #define FD_IMM_PBE_OI 0
 #define FD_IMM_PBE_OM 1
@@ -71,6 +72,18 @@ static SaTimeT sLastCcbCommitTime = 0LL;
 static const SaStringT ccb_id_string = (SaStringT) "ccbId";
 static const SaStringT num_ops_string = (SaStringT) "numOps";
 
+/* Group commit (1PBE only), see pbe_group_commit_ccb(). */
+static unsigned int sGroupCommitMax = 0;
+static unsigned int sGroupCommitLatency = 0; /* msec */
+static bool sGroupOpen = false;
+static unsigned int sGroupCount = 0;
+static SaUint64T sGroupSeq = 0LL;
+static SaUint64T sGroupCommittedSeq = 0LL;
+static SaAisErrorT sGroupResult = SA_AIS_OK;
+static struct timespec sGroupDeadline;
+static SaUint64T sGroupCommits = 0LL;
+static SaUint64T sGroupCcbs = 0LL;
+
 /*The following are only used by 2PBE logic. */
 static volatile SaUint64T s2PbeBCcbToCompleteAtB = 0LL;
 static volatile SaUint32T s2PbeBCcbOpCountToExpectAtB = 0;
@@ -208,6 +221,117 @@ ccb_abort:
   return rc;
 }
 
+/* Group commit.
+   Each CCB completed, PRTO create and PRTA update is normally persisted in its
+   own sqlite transaction before the callback returns, i.e. before the reply
+   that lets the IMMND continue (e.g. pbePrtAttrUpdateContinuation) is sent.
+   That costs at least one fsync per ccb.
+
+   With IMMSV_PBE_GROUP_COMMIT > 1 the PBE instead keeps the sqlite transaction
+   open and, while more OI callbacks are already queued, dispatches them from
+   within the current callback. Each dispatched ccb is added to the same
+   transaction (in its own savepoint). The innermost callback that finds no
+   more queued callbacks, or hits the count or latency bound, commits the
+   group. All the callbacks then return in turn, so every reply is still sent
+   only after the commit that covers it. A callback that needs a transaction of
+   its own (class create etc.) flushes the open group first.
+
+   Group commit is not used with 2PBE, where the slave PBE prepares each ccb
+   in step with the primary.
+*/
+static bool pbe_group_commit_enabled() {
+  return (sGroupCommitMax > 1) && !sPbe2;
+}
+
+static bool pbe_oi_callback_pending() {
+  struct pollfd pfd = {(int)immOiSelectionObject, POLLIN, 0};
+  return (poll(&pfd, 1, 0) > 0) && (pfd.revents & POLLIN);
+}
+
+static SaAisErrorT pbe_group_commit_flush() {
+  SaTimeT commitTime = 0LL;
+  SaAisErrorT rc = SA_AIS_OK;
+
+  if (!sGroupOpen) {
+    return SA_AIS_OK;
+  }
+
+  if (!pbeTransIsPrepared()) {
+    pbeClosePrepareTrans();
+  }
+  rc = pbeCommitTrans(sDbHandle, 0LL, sEpoch, &commitTime);
+  if (rc != SA_AIS_OK) {
+    LOG_WA("PBE failed to commit sqlite transaction for group of %u ccbs",
+           sGroupCount);
+  } else {
+    TRACE("Group commit of %u ccbs OK", sGroupCount);
+    ++sGroupCommits;
+    sGroupCcbs += sGroupCount;
+  }
+
+  sGroupOpen = false;
+  sGroupCount = 0;
+  sGroupCommittedSeq = sGroupSeq;
+  sGroupResult = rc;
+  return rc;
+}
+
+static SaAisErrorT pbe_group_commit_ccb(
+    SaImmOiHandleT immOiHandle, SaImmOiCcbIdT ccbId,
+    struct CcbUtilOperationData *ccbUtilOperationData) {
+  SaAisErrorT rc = SA_AIS_OK;
+  SaUint64T group = 0LL;
+  SaTimeT commitTime = 0LL;
+
+  if (!sGroupOpen) {
+    rc = pbeBeginTrans(sDbHandle);
+    if (rc != SA_AIS_OK) {
+      return rc;
+    }
+    sGroupOpen = true;
+    sGroupCount = 0;
+    ++sGroupSeq;
+    osaf_set_millis_timeout(sGroupCommitLatency, &sGroupDeadline);
+  }
+  group = sGroupSeq;
+
+  rc = pbeSavepointTrans(sDbHandle);
+  if (rc == SA_AIS_OK) {
+    rc = sqlite_prepare_ccb(immOiHandle, ccbId, ccbUtilOperationData);
+    if (rc == SA_AIS_OK) {
+      rc = pbeReleaseSavepointTrans(sDbHandle, ccbId, sEpoch, &commitTime);
+    } else {
+      pbeRollbackSavepointTrans(sDbHandle);
+    }
+  }
+
+  if (rc == SA_AIS_OK) {
+    ++sGroupCount;
+    while (sGroupOpen && (sGroupSeq == group) &&
+           (sGroupCount < sGroupCommitMax) &&
+           !osaf_is_timeout(&sGroupDeadline) && pbe_oi_callback_pending()) {
+      SaAisErrorT err = saImmOiDispatch(pbeOiHandle, SA_DISPATCH_ONE);
+      if (err != SA_AIS_OK) {
+        LOG_WA("saImmOiDispatch returned %u during group commit", err);
+        break;
+      }
+    }
+  }
+
+  if (sGroupOpen && (sGroupSeq == group)) {
+    pbe_group_commit_flush();
+  }
+
+  osafassert(sGroupCommittedSeq == group);
+  if (rc == SA_AIS_OK) {
+    rc = sGroupResult;
+    if (rc == SA_AIS_OK) {
+      sLastCcbCommitTime = commitTime;
+    }
+  }
+  return rc;
+}
+
 /* 2PBE: Note potential
    concurrency problem towards sqlite here, between the main thread and the
    runtime-object thread. Sqlite is supposed to be threadsafe, but we dont want
@@ -427,6 +551,9 @@ static void saImmOiAdminOperationCallback(
 
   TRACE_ENTER();
 
+  /* Class create/delete etc. use a transaction of their own. */
+  pbe_group_commit_flush();
+
   if (sPbe2B) {
     opensafObj.append(OPENSAF_IMM_OBJECT_DN);
   } else {
@@ -1406,6 +1533,17 @@ static SaAisErrorT saImmOiCcbObjectModifyCallback(
   TRACE("Update of PERSISTENT runtime attributes in object with DN: %s",
         osaf_extended_name_borrow(objectName));
 
+  if (pbe_group_commit_enabled()) {
+    rc = pbe_group_commit_ccb(immOiHandle, ccbId,
+                              ccbUtilCcbData->operationListHead);
+    if (rc != SA_AIS_OK) {
+      LOG_WA("PBE failed to group commit (ccb:%llx) for PRT attr update",
+             ccbId);
+      rc = SA_AIS_ERR_NO_RESOURCES;
+    }
+    goto done;
+  }
+
   rc = pbeBeginTrans(sDbHandle);
   if (rc != SA_AIS_OK) {
     LOG_WA(
@@ -1572,6 +1710,23 @@ static SaAisErrorT saImmOiCcbCompletedCallback(SaImmOiHandleT immOiHandle,
     }
   }
 
+  if (pbe_group_commit_enabled()) {
+    rc = pbe_group_commit_ccb(immOiHandle, ccbId,
+                              ccbUtilCcbData->operationListHead);
+    if (rc == SA_AIS_OK) {
+      TRACE("GROUP COMMIT PBE TRANSACTION for ccb %llu epoch:%u OK", ccbId,
+            sEpoch);
+      sLastCcbCommit = ccbId;
+    } else {
+      snprintf(buf, sBufsize,
+               "PBE GROUP COMMIT of sqlite transaction %llu epoch%u FAILED rc:%d",
+               ccbId, sEpoch, rc);
+      TRACE("%s", buf);
+      saImmOiCcbSetErrorString(immOiHandle, ccbId, buf);
+    }
+    goto done;
+  }
+
   if ((rc = pbeBeginTrans(sDbHandle)) != SA_AIS_OK) {
     LOG_WA("pbeBEginTrans returned error: %u", rc);
     goto done;
@@ -1891,6 +2046,16 @@ static SaAisErrorT saImmOiCcbObjectCreateCallback(
 
   TRACE("Create of PERSISTENT runtime object with DN: %s", objectDn.c_str());
 
+  if (pbe_group_commit_enabled()) {
+    rc = pbe_group_commit_ccb(immOiHandle, ccbId,
+                              ccbUtilCcbData->operationListHead);
+    if (rc != SA_AIS_OK) {
+      LOG_WA("PBE failed to group commit (ccbId:%llx) for PRTO create", ccbId);
+      rc = SA_AIS_ERR_NO_RESOURCES;
+    }
+    goto done;
+  }
+
   rc = pbeBeginTrans(sDbHandle);
   if (rc != SA_AIS_OK) {
     LOG_WA("PBE failed to start sqlite transaction (ccbId:%llx)for PRTO create",
@@ -2385,7 +2550,8 @@ void pbeRtObjThreadStart() {
 
 void pbeDaemon(SaImmHandleT immHandle, void *dbHandle,
                SaImmAdminOwnerHandleT ownerHandle, ClassMap *classIdMap,
-               int objCount, bool pbe2, bool pbe2B) {
+               int objCount, bool pbe2, bool pbe2B,
+               unsigned int groupCommitMax, unsigned int groupCommitLatency) {
   SaAisErrorT error = SA_AIS_OK;
   ClassMap::iterator ci;
 
@@ -2398,12 +2564,18 @@ void pbeDaemon(SaImmHandleT immHandle, void *dbHandle,
   sPbe2B = pbe2B;
   sPbe2 = pbe2;
   sOwnerHandle = ownerHandle;
+  sGroupCommitMax = groupCommitMax;
+  sGroupCommitLatency = groupCommitLatency;
   immutilWrapperProfile.errorsAreFatal = 0;
   immutilWrapperProfile.retryInterval = 400;
   immutilWrapperProfile.nTries = 5;
 
   TRACE_ENTER();
   LOG_NO("pbeDaemon starting with obj-count:%d", sObjCount);
+  if (pbe_group_commit_enabled()) {
+    LOG_NO("PBE group commit enabled, max %u ccbs or %u msec per transaction",
+           sGroupCommitMax, sGroupCommitLatency);
+  }
 
   /* Restore also sClassCount. */
   for (ci = sClassIdMap->begin(); ci != sClassIdMap->end(); ++ci) {
@@ -2520,6 +2692,10 @@ void pbeDaemon(SaImmHandleT immHandle, void *dbHandle,
     */
   }
 
+  if (sGroupCommits) {
+    LOG_IN("PBE group commit: %llu ccbs in %llu transactions", sGroupCcbs,
+           sGroupCommits);
+  }
   LOG_IN("IMM %s process EXITING...",
          sPbe2 ? (sPbe2B ? "PBE SLAVE" : "PBE PRIMARY") : "PBE");
   TRACE_LEAVE();
@@ -0,0 +1,192 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the rate of
+ * saLckResourceLock/saLckResourceUnlock pairs on one lock resource, by one
+ * process or by several processes contending for the resource.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <sys/wait.h>
+
+#include <saAis.h>
+#include <saLck.h>
+#include "base/osaf_time.h"
+#include "osaf/apitest/bench.h"
+
+#define BENCH_RESOURCE_NAME "safLock=lckbench"
+
+static SaVersionT lckVersion = {'B', 3, 1};
+static unsigned int numLocks = 10000;
+static unsigned int numProcs = 1;
+static SaLckLockModeT lockMode = SA_LCK_EX_LOCK_MODE;
+static const char *resourceName = BENCH_RESOURCE_NAME;
+
+static void usage(const char *progname)
+{
+	static const char *const options[] = {
+	    "-n, --locks <n>        number of lock/unlock pairs per process (default 10000)",
+	    "-p, --processes <n>    number of contending processes (default 1)",
+	    "-r, --resource <name>  lock resource (default " BENCH_RESOURCE_NAME
+	    ")",
+	    "-s, --shared           take PR locks instead of EX locks",
+	    NULL};
+
+	bench_usage(
+	    progname, "measure the LCK lock and unlock rate",
+	    "is a LCK test client locking and unlocking a lock resource in a\n"
+	    "\tloop, reporting the number of lock/unlock pairs per second. With\n"
+	    "\tmore than one process the processes contend for the resource.\n"
+	    "\tRunning it on several nodes at the same time with the same resource\n"
+	    "\tmeasures the contention between nodes, running it on a node that is\n"
+	    "\tnot the master of the resource measures the uncontended remote case.\n",
+	    options, "-n 100000 -p 4");
+}
+
+static void bench_run(void)
+{
+	SaLckHandleT lckHandle;
+	SaLckResourceHandleT resourceHandle;
+	SaLckLockIdT lockId;
+	SaLckLockStatusT lockStatus;
+	SaNameT name;
+	unsigned int i;
+	SaAisErrorT rc;
+
+	name.length = strlen(resourceName);
+	memcpy(name.value, resourceName, name.length);
+
+	rc = saLckInitialize(&lckHandle, NULL, &lckVersion);
+	if (rc != SA_AIS_OK)
+		bench_fail("saLckInitialize", rc);
+
+	rc = saLckResourceOpen(lckHandle, &name, SA_LCK_RESOURCE_CREATE,
+			       SA_TIME_ONE_SECOND * 10, &resourceHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saLckResourceOpen", rc);
+
+	for (i = 0; i < numLocks; ++i) {
+		rc = saLckResourceLock(resourceHandle, &lockId, lockMode, 0, 0,
+				       SA_TIME_ONE_SECOND * 60, &lockStatus);
+		if (rc != SA_AIS_OK)
+			bench_fail("saLckResourceLock", rc);
+		if (lockStatus != SA_LCK_LOCK_GRANTED) {
+			fprintf(stderr, "saLckResourceLock lock status %d\n",
+				lockStatus);
+			exit(EXIT_FAILURE);
+		}
+
+		rc = saLckResourceUnlock(lockId, SA_TIME_ONE_SECOND * 60);
+		if (rc != SA_AIS_OK)
+			bench_fail("saLckResourceUnlock", rc);
+	}
+
+	saLckResourceClose(resourceHandle);
+	saLckFinalize(lckHandle);
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"locks", required_argument, 0, 'n'},
+					{"processes", required_argument, 0, 'p'},
+					{"resource", required_argument, 0, 'r'},
+					{"shared", no_argument, 0, 's'},
+					{0, 0, 0, 0}};
+	struct timespec start, end, elapsed;
+	unsigned int i, failed = 0;
+	double secs;
+	int c, status;
+	pid_t pid;
+
+	while ((c = getopt_long(argc, argv, "hn:p:r:s", long_options, NULL)) !=
+	       -1) {
+		switch (c) {
+		case 'n':
+			numLocks = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			numProcs = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			resourceName = optarg;
+			break;
+		case 's':
+			lockMode = SA_LCK_PR_LOCK_MODE;
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numLocks == 0 || numProcs == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (strlen(resourceName) >= SA_MAX_NAME_LENGTH) {
+		fprintf(stderr, "Resource name too long\n");
+		exit(EXIT_FAILURE);
+	}
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+
+	if (numProcs == 1) {
+		bench_run();
+	} else {
+		for (i = 0; i < numProcs; ++i) {
+			pid = fork();
+			if (pid == -1) {
+				perror("fork");
+				exit(EXIT_FAILURE);
+			}
+			if (pid == 0) {
+				bench_run();
+				exit(EXIT_SUCCESS);
+			}
+		}
+		for (i = 0; i < numProcs; ++i) {
+			if (wait(&status) == -1 || !WIFEXITED(status) ||
+			    WEXITSTATUS(status) != EXIT_SUCCESS)
+				failed++;
+		}
+		if (failed != 0) {
+			fprintf(stderr, "%u of %u processes failed\n", failed,
+				numProcs);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+	osaf_timespec_subtract(&end, &start, &elapsed);
+	secs = osaf_timespec_to_double(&elapsed);
+
+	printf("%s processes:%u locks:%u time:%.3fs rate:%.1f locks/s\n",
+	       lockMode == SA_LCK_EX_LOCK_MODE ? "EX" : "PR", numProcs,
+	       numLocks * numProcs, secs, numLocks * numProcs / secs);
+
+	return EXIT_SUCCESS;
+}
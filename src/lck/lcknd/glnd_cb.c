@@ -49,6 +49,7 @@ GLND_CB *glnd_cb_create(uint32_t pool_id)
 	NCS_PATRICIA_PARAMS params = {0};
 	SaAmfHealthcheckKeyT healthy;
 	int8_t *health_key = NULL;
+	char *lock_cache;
 	SaAisErrorT amf_error;
 	TRACE_ENTER2("pool_id %u", pool_id);
 
@@ -63,6 +64,12 @@ GLND_CB *glnd_cb_create(uint32_t pool_id)
 	memset(glnd_cb, 0, sizeof(GLND_CB));
 	glnd_cb->pool_id = pool_id;
 
+	lock_cache = getenv("GLSV_ENV_LOCK_CACHE");
+	if (lock_cache != NULL && atoi(lock_cache) != 0) {
+		LOG_NO("Lock caching enabled");
+		glnd_cb->lock_cache = true;
+	}
+
 	/* create the handle */
 	glnd_cb->cb_hdl_id = ncshm_create_hdl(
 	    (uint8_t)pool_id, NCS_SERVICE_ID_GLND, (NCSCONTEXT)glnd_cb);
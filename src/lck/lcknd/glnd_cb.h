@@ -63,6 +63,11 @@ typedef struct glnd_res_lock_list_info_tag {
   GLSV_CALL_TYPE unlock_call_type;
   uint32_t non_master_status;
   uint32_t shm_index;
+  bool lck_cached;       /* unlocked by the client, still granted by the
+                            master (lock caching) */
+  bool lck_cache_reused; /* granted again from the cache, the lcl_lockid
+                            known to the master is not lock_info.lcl_lockid */
+  bool lck_cache_recall; /* the master has a waiter for this lock */
   struct glnd_resource_info_tag *res_info; /* back pointer */
   struct glnd_res_lock_list_info_tag *prev, *next;
 } GLND_RES_LOCK_LIST_INFO;
@@ -186,6 +191,7 @@ typedef struct glnd_cb_tag {
 
   /* GLND data */
   uint32_t numLocks;
+  bool lock_cache; /* cache granted locks of non-master resources */
   NCS_PATRICIA_TREE glnd_client_tree; /* GLND_CLIENT_INFO - node */
   NCS_PATRICIA_TREE glnd_res_tree;    /* GLND_RESOURCE_INFO - node */
   NCS_PATRICIA_TREE glnd_agent_tree;  /* GLND_AGENT_INFO - node */
@@ -444,6 +444,10 @@ static uint32_t glnd_client_node_resource_del(GLND_CB *glnd_cb,
 		;
 
 	if (resource_list) {
+		glnd_resource_lock_cache_flush(glnd_cb, res_info,
+					       client_info->app_handle_id, 0,
+					       true);
+
 		/* remove it from the list */
 		/* delete all the lock requests */
 		for (lock_req_list = resource_list->lck_list;
@@ -595,6 +599,10 @@ uint32_t glnd_client_node_lcl_resource_del(GLND_CB *glnd_cb,
 		;
 
 	if (resource_list) {
+		glnd_resource_lock_cache_flush(glnd_cb, res_info,
+					       client_info->app_handle_id,
+					       lcl_resource_id, true);
+
 		/* delete all the lock requests */
 		for (lock_req_list = resource_list->lck_list;
 		     lock_req_list != NULL;) {
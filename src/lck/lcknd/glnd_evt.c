@@ -1634,6 +1634,36 @@ static uint32_t glnd_process_gla_resource_lock(GLND_CB *glnd_cb,
 			    evt->mds_context;
 			break;
 		}
+	} else if ((lck_list_info = glnd_resource_lock_cache_get(
+			glnd_cb, res_node, &lck_info,
+			rsc_lock_info->lcl_resource_id)) != NULL) {
+		/* granted locally, the master still grants it to this node */
+		lck_list_info->glnd_res_lock_mds_ctxt = evt->mds_context;
+		glnd_client_node_resource_lock_req_add(client_info, res_node,
+						       lck_list_info);
+
+		if (lck_info.call_type == GLSV_SYNC_CALL) {
+			m_GLND_RESOURCE_SYNC_LCK_GRANT_FILL(
+			    gla_evt, SA_AIS_OK, lck_list_info->lock_info.lockid,
+			    SA_LCK_LOCK_GRANTED,
+			    lck_list_info->lock_info.handleId);
+			/* send the evt to GLA */
+			glnd_mds_msg_send_rsp_gla(glnd_cb, &gla_evt,
+						  rsc_lock_info->agent_mds_dest,
+						  &evt->mds_context);
+		} else {
+			m_GLND_RESOURCE_ASYNC_LCK_GRANT_FILL(
+			    gla_evt, SA_AIS_OK, lck_list_info->lock_info.lockid,
+			    rsc_lock_info->lcl_lockid,
+			    lck_list_info->lock_info.lock_type,
+			    rsc_lock_info->lcl_resource_id,
+			    lck_list_info->lock_info.invocation,
+			    SA_LCK_LOCK_GRANTED,
+			    lck_list_info->lock_info.handleId);
+			/* send the evt to GLA */
+			glnd_mds_msg_send_gla(glnd_cb, &gla_evt,
+					      rsc_lock_info->agent_mds_dest);
+		}
 	} else { /* non- master */
 
 		lck_list_info = glnd_resource_non_master_lock_req(
@@ -1942,6 +1972,39 @@ static uint32_t glnd_process_gla_resource_unlock(GLND_CB *glnd_cb,
 				goto err;
 			}
 		}
+	} else if ((m_info = glnd_resource_local_lock_req_find(
+			res_node, lck_info.lcl_lockid, lck_info.handleId,
+			rsc_unlock_info->lcl_resource_id)) != NULL &&
+		   glnd_resource_lock_cache_put(glnd_cb, res_node, m_info)) {
+		/* unlocked locally, the lock is cached or given back */
+		if (rsc_unlock_info->call_type == GLSV_SYNC_CALL) {
+			memset(&gla_evt, 0, sizeof(GLSV_GLA_EVT));
+			gla_evt.type = GLSV_GLA_API_RESP_EVT;
+			gla_evt.error = SA_AIS_OK;
+			gla_evt.info.gla_resp_info.type =
+			    GLSV_GLA_LOCK_SYNC_UNLOCK;
+			gla_evt.info.gla_resp_info.param.sync_unlock.dummy = 0;
+			/* send the evt to GLA */
+			glnd_mds_msg_send_rsp_gla(
+			    glnd_cb, &gla_evt, rsc_unlock_info->agent_mds_dest,
+			    &evt->mds_context);
+		} else {
+			m_GLND_RESOURCE_ASYNC_LCK_UNLOCK_FILL(
+			    gla_evt, SA_AIS_OK, rsc_unlock_info->invocation,
+			    m_info->lcl_resource_id,
+			    rsc_unlock_info->lcl_lockid,
+			    GLSV_LOCK_STATUS_RELEASED);
+			gla_evt.handle = rsc_unlock_info->client_handle_id;
+			/* send the evt to GLA */
+			glnd_mds_msg_send_gla(glnd_cb, &gla_evt,
+					      rsc_unlock_info->agent_mds_dest);
+		}
+		if (glnd_client_node_resource_lock_req_find_and_del(
+			client_info, res_node->resource_id,
+			m_info->lock_info.lockid,
+			m_info->lcl_resource_id) == NCSCC_RC_SUCCESS &&
+		    !m_info->lck_cached)
+			glnd_resource_lock_req_delete(res_node, m_info);
 	} else {
 		/* non-master stuff */
 		m_info = glnd_resource_non_master_unlock_req(
@@ -2828,6 +2891,18 @@ static uint32_t glnd_process_glnd_lck_waiter_clbk(GLND_CB *glnd_cb,
 
 	/* don't send the callback if we are not a cluster member */
 	if (!glnd_cb->isClusterMember) {
+		/* but still give a cached lock back to the master, or mark a
+		   lock granted from the cache to go back at unlock, so that
+		   the waiter is not blocked by it */
+		res_node = glnd_resource_node_find(glnd_cb,
+						   waiter_clbk->resource_id);
+		if (res_node && glnd_cb->lock_cache) {
+			lck_list_info = glnd_resource_lock_cache_find(
+			    res_node, waiter_clbk->lockid);
+			if (lck_list_info)
+				glnd_resource_lock_cache_recall(
+				    glnd_cb, res_node, lck_list_info);
+		}
 		TRACE(
 		    "not sending waiter callback because this node is not in the "
 		    "cluster");
@@ -2846,12 +2921,19 @@ static uint32_t glnd_process_glnd_lck_waiter_clbk(GLND_CB *glnd_cb,
 	lck_list_info = glnd_resource_local_lock_req_find(
 	    res_node, waiter_clbk->lcl_lockid, waiter_clbk->client_handle_id,
 	    waiter_clbk->lcl_resource_id);
+	if (!lck_list_info && glnd_cb->lock_cache)
+		lck_list_info =
+		    glnd_resource_lock_cache_find(res_node, waiter_clbk->lockid);
 	if (!lck_list_info) {
 		LOG_ER("GLND Rsc local req find failed");
 		rc = NCSCC_RC_FAILURE;
 		goto end;
 	}
 
+	/* a cached lock goes back to the master, nobody uses it */
+	if (glnd_resource_lock_cache_recall(glnd_cb, res_node, lck_list_info))
+		goto end;
+
 	client_info =
 	    glnd_client_node_find(glnd_cb, lck_list_info->lock_info.handleId);
 
@@ -1337,6 +1337,267 @@ done:
 	return lck_list_info;
 }
 
+/*****************************************************************************
+  PROCEDURE NAME : glnd_resource_lock_cache_release
+
+  DESCRIPTION    : Gives a cached lock back to the master. The lock is
+		   released with an orphan request, which the master handles
+		   like an unlock without response for locks without the
+		   orphan flag.
+
+  ARGUMENTS      :cb - pointer to the glnd control block
+		  res_info      - ptr to the Resource Node.
+		  lck_list_info - the cached lock
+
+  RETURNS        : None
+
+  NOTES         : The caller deletes the lock node.
+*****************************************************************************/
+static void
+glnd_resource_lock_cache_release(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+				 GLND_RES_LOCK_LIST_INFO *lck_list_info)
+{
+	GLSV_GLND_EVT evt;
+
+	TRACE("GLND Rsc cached lock release: resource_id %u, lockid %u",
+	      (uint32_t)res_info->resource_id,
+	      (uint32_t)lck_list_info->lock_info.lockid);
+
+	m_GLND_RESOURCE_NODE_LCK_INFO_FILL(
+	    evt, GLSV_GLND_EVT_LCK_REQ_ORPHAN, res_info->resource_id,
+	    lck_list_info->lcl_resource_id, lck_list_info->lock_info.handleId,
+	    lck_list_info->lock_info.lockid, lck_list_info->lock_info.lock_type,
+	    lck_list_info->lock_info.lockFlags, 0, 0, 0, 0,
+	    lck_list_info->lock_info.lcl_lockid, 0);
+	evt.info.node_lck_info.glnd_mds_dest = cb->glnd_mdest_id;
+
+	if (res_info->status != GLND_RESOURCE_ELECTION_IN_PROGESS)
+		glnd_mds_msg_send_glnd(cb, &evt, res_info->master_mds_dest);
+	else
+		glnd_evt_backup_queue_add(cb, &evt);
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : glnd_resource_lock_cache_get
+
+  DESCRIPTION    : Looks for a cached lock that can be granted locally for a
+		   lock request on a non-master resource, i.e. one of the
+		   same client, resource handle and mode. Cached locks that
+		   conflict with the request are given back to the master.
+
+  ARGUMENTS      :cb - pointer to the glnd control block
+		  res_info      - ptr to the Resource Node.
+		  lock_info     - the lock request
+		  lcl_resource_id - the resource handle of the client
+
+  RETURNS        : The granted lock node or NULL if the request has to go
+		   to the master.
+
+  NOTES         : None
+*****************************************************************************/
+GLND_RES_LOCK_LIST_INFO *
+glnd_resource_lock_cache_get(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+			     GLSV_LOCK_REQ_INFO *lock_info,
+			     SaLckResourceIdT lcl_resource_id)
+{
+	GLND_RES_LOCK_LIST_INFO *lck_list_info, *next;
+
+	if (!cb->lock_cache ||
+	    res_info->status != GLND_RESOURCE_ACTIVE_NON_MASTER ||
+	    (lock_info->lockFlags & SA_LCK_LOCK_ORPHAN) == SA_LCK_LOCK_ORPHAN)
+		return NULL;
+
+	for (lck_list_info = res_info->lcl_lck_req_info; lck_list_info != NULL;
+	     lck_list_info = lck_list_info->next) {
+		if (lck_list_info->lck_cached &&
+		    lck_list_info->lock_info.handleId == lock_info->handleId &&
+		    lck_list_info->lcl_resource_id == lcl_resource_id &&
+		    lck_list_info->lock_info.lock_type ==
+			lock_info->lock_type &&
+		    lck_list_info->lock_info.lockFlags ==
+			lock_info->lockFlags)
+			break;
+	}
+
+	if (lck_list_info == NULL) {
+		/* don't make the request wait for our own cached locks */
+		for (lck_list_info = res_info->lcl_lck_req_info;
+		     lck_list_info != NULL; lck_list_info = next) {
+			next = lck_list_info->next;
+			if (lck_list_info->lck_cached &&
+			    (lock_info->lock_type == SA_LCK_EX_LOCK_MODE ||
+			     lck_list_info->lock_info.lock_type ==
+				 SA_LCK_EX_LOCK_MODE)) {
+				glnd_resource_lock_cache_release(
+				    cb, res_info, lck_list_info);
+				glnd_resource_lock_req_delete(res_info,
+							      lck_list_info);
+			}
+		}
+		return NULL;
+	}
+
+	TRACE("GLND Rsc lock granted from cache: resource_id %u, lockid %u",
+	      (uint32_t)res_info->resource_id,
+	      (uint32_t)lck_list_info->lock_info.lockid);
+
+	/* the master still knows the lock by its first lcl_lockid */
+	if (lck_list_info->lock_info.lcl_lockid != lock_info->lcl_lockid)
+		lck_list_info->lck_cache_reused = true;
+	lck_list_info->lck_cached = false;
+	lck_list_info->lock_info.lcl_lockid = lock_info->lcl_lockid;
+	lck_list_info->lock_info.call_type = lock_info->call_type;
+	lck_list_info->lock_info.invocation = lock_info->invocation;
+	lck_list_info->lock_info.timeout = lock_info->timeout;
+	lck_list_info->lock_info.agent_mds_dest = lock_info->agent_mds_dest;
+	lck_list_info->lock_info.waiter_signal = lock_info->waiter_signal;
+
+	return lck_list_info;
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : glnd_resource_lock_cache_put
+
+  DESCRIPTION    : Handles the unlock of a granted lock on a non-master
+		   resource without the master. Unless the master has a
+		   waiter for it, the lock stays granted and is cached for
+		   the next request of the client. A lock granted from the
+		   cache with a waiter is given back to the master.
+
+  ARGUMENTS      :cb - pointer to the glnd control block
+		  res_info      - ptr to the Resource Node.
+		  lck_list_info - the lock to unlock
+
+  RETURNS        : true if the unlock is done, false if it has to go to the
+		   master.
+
+  NOTES         : The caller deletes the lock node unless it is cached.
+*****************************************************************************/
+bool glnd_resource_lock_cache_put(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+				  GLND_RES_LOCK_LIST_INFO *lck_list_info)
+{
+	if (lck_list_info->lck_cache_reused) {
+		/* the master does not know the lcl_lockid of the client */
+		if (!lck_list_info->lck_cache_recall &&
+		    res_info->status == GLND_RESOURCE_ACTIVE_NON_MASTER)
+			lck_list_info->lck_cached = true;
+		else
+			glnd_resource_lock_cache_release(cb, res_info,
+							 lck_list_info);
+		return true;
+	}
+
+	if (!cb->lock_cache ||
+	    res_info->status != GLND_RESOURCE_ACTIVE_NON_MASTER ||
+	    lck_list_info->lck_cache_recall ||
+	    lck_list_info->unlock_req_sent ||
+	    lck_list_info->lock_info.lockStatus != SA_LCK_LOCK_GRANTED ||
+	    (lck_list_info->lock_info.lockFlags & SA_LCK_LOCK_ORPHAN) ==
+		SA_LCK_LOCK_ORPHAN)
+		return false;
+
+	lck_list_info->lck_cached = true;
+	return true;
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : glnd_resource_lock_cache_recall
+
+  DESCRIPTION    : Handles a waiter callback from the master for a lock of
+		   this node. A cached lock is given back to the master, a
+		   lock in use is given back when the client unlocks it.
+
+  ARGUMENTS      :cb - pointer to the glnd control block
+		  res_info      - ptr to the Resource Node.
+		  lck_list_info - the lock with a waiter
+
+  RETURNS        : true if the lock was cached and is released.
+
+  NOTES         : None
+*****************************************************************************/
+bool glnd_resource_lock_cache_recall(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+				     GLND_RES_LOCK_LIST_INFO *lck_list_info)
+{
+	if (!cb->lock_cache)
+		return false;
+
+	if (lck_list_info->lck_cached) {
+		glnd_resource_lock_cache_release(cb, res_info, lck_list_info);
+		glnd_resource_lock_req_delete(res_info, lck_list_info);
+		return true;
+	}
+	lck_list_info->lck_cache_recall = true;
+	return false;
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : glnd_resource_lock_cache_find
+
+  DESCRIPTION    : Finds a cached lock, or a lock granted from the cache, by
+		   its lock id.
+
+  ARGUMENTS      :res_info      - ptr to the Resource Node.
+		  lockid        - the lock id of the lock node.
+
+  RETURNS        : Pointer to the lock node or NULL
+
+  NOTES         : None
+*****************************************************************************/
+GLND_RES_LOCK_LIST_INFO *
+glnd_resource_lock_cache_find(GLND_RESOURCE_INFO *res_info, SaLckLockIdT lockid)
+{
+	GLND_RES_LOCK_LIST_INFO *lck_list_info;
+
+	for (lck_list_info = res_info->lcl_lck_req_info; lck_list_info != NULL;
+	     lck_list_info = lck_list_info->next) {
+		if ((lck_list_info->lck_cached ||
+		     lck_list_info->lck_cache_reused) &&
+		    lck_list_info->lock_info.lockid == lockid)
+			return lck_list_info;
+	}
+	return NULL;
+}
+
+/*****************************************************************************
+  PROCEDURE NAME : glnd_resource_lock_cache_flush
+
+  DESCRIPTION    : Deletes the cached locks of a client resource handle or,
+		   with a zero handle, all cached locks of the resource.
+
+  ARGUMENTS      :cb - pointer to the glnd control block
+		  res_info      - ptr to the Resource Node.
+		  handleId      - the client handle or 0
+		  lcl_resource_id - the resource handle or 0 for all of them
+		  release       - give the locks back to the master, false if
+				  the master has gone.
+
+  RETURNS        : None
+
+  NOTES         : None
+*****************************************************************************/
+void glnd_resource_lock_cache_flush(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+				    SaLckHandleT handleId,
+				    SaLckResourceIdT lcl_resource_id,
+				    bool release)
+{
+	GLND_RES_LOCK_LIST_INFO *lck_list_info, *next;
+
+	for (lck_list_info = res_info->lcl_lck_req_info; lck_list_info != NULL;
+	     lck_list_info = next) {
+		next = lck_list_info->next;
+		if (!lck_list_info->lck_cached ||
+		    (handleId != 0 &&
+		     lck_list_info->lock_info.handleId != handleId) ||
+		    (lcl_resource_id != 0 &&
+		     lck_list_info->lcl_resource_id != lcl_resource_id))
+			continue;
+		if (release)
+			glnd_resource_lock_cache_release(cb, res_info,
+							 lck_list_info);
+		glnd_resource_lock_req_delete(res_info, lck_list_info);
+	}
+}
+
 /*****************************************************************************
   PROCEDURE NAME : glnd_resource_grant_list_orphan_locks
 
@@ -1794,6 +2055,9 @@ void glnd_resource_convert_nonmaster_to_master(GLND_CB *glnd_cb,
 
 	TRACE_ENTER();
 
+	/* the old master has gone with the grants of the cached locks */
+	glnd_resource_lock_cache_flush(glnd_cb, res_node, 0, 0, false);
+
 	for (lck_list_nm_info = res_node->lcl_lck_req_info;
 	     lck_list_nm_info != NULL;) {
 		TRACE(
@@ -1906,6 +2170,9 @@ void glnd_resource_resend_nonmaster_info_to_newmaster(
 
 	TRACE_ENTER();
 
+	/* the new master only learns about the locks in use */
+	glnd_resource_lock_cache_flush(glnd_cb, res_node, 0, 0, false);
+
 	for (lck_list_nm_info = res_node->lcl_lck_req_info;
 	     lck_list_nm_info != NULL;
 	     lck_list_nm_info = lck_list_nm_info->next) {
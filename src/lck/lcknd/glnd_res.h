@@ -93,6 +93,24 @@ GLND_RES_LOCK_LIST_INFO *glnd_resource_non_master_unlock_req(
     GLND_CB *cb, GLND_RESOURCE_INFO *res_info, GLSV_LOCK_REQ_INFO lock_info,
     SaLckResourceIdT lcl_resource_id, SaLckLockIdT lockid);
 
+GLND_RES_LOCK_LIST_INFO *glnd_resource_lock_cache_get(
+    GLND_CB *cb, GLND_RESOURCE_INFO *res_info, GLSV_LOCK_REQ_INFO *lock_info,
+    SaLckResourceIdT lcl_resource_id);
+
+bool glnd_resource_lock_cache_put(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+                                  GLND_RES_LOCK_LIST_INFO *lck_list_info);
+
+bool glnd_resource_lock_cache_recall(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+                                     GLND_RES_LOCK_LIST_INFO *lck_list_info);
+
+GLND_RES_LOCK_LIST_INFO *glnd_resource_lock_cache_find(
+    GLND_RESOURCE_INFO *res_info, SaLckLockIdT lockid);
+
+void glnd_resource_lock_cache_flush(GLND_CB *cb, GLND_RESOURCE_INFO *res_info,
+                                    SaLckHandleT handleId,
+                                    SaLckResourceIdT lcl_resource_id,
+                                    bool release);
+
 bool glnd_resource_grant_list_orphan_locks(GLND_RESOURCE_INFO *res_info,
                                            SaLckLockModeT *mode);
 
@@ -16,16 +16,19 @@
  */
 
 #include "log/agent/lga_agent.h"
+#include <errno.h>
 #include <string.h>
 #include <algorithm>
 #include "base/ncs_hdl_pub.h"
 #include "base/saf_error.h"
+#include "base/time.h"
 #include "log/agent/lga_mds.h"
 #include "log/agent/lga_state.h"
 #include "log/agent/lga_util.h"
 #include "base/osaf_extended_name.h"
 #include "log/agent/lga_client.h"
 #include "log/agent/lga_stream.h"
+#include "log/agent/lga_write_batch.h"
 
 //------------------------------------------------------------------------------
 // ScopeData
@@ -134,7 +137,7 @@ ScopeData::~ScopeData() {
 //------------------------------------------------------------------------------
 // LogAgent
 //------------------------------------------------------------------------------
-LogAgent::LogAgent() {
+LogAgent::LogAgent() : write_batch_thread_started_{false} {
   client_list_.clear();
   // There is high risk of calling one @LogClient method
   // in the body of other @LogClient methods, such case would cause deadlock
@@ -641,6 +644,9 @@ SaAisErrorT LogAgent::saLogFinalize(SaLogHandleT logHandle) {
     }
   }
 
+  // Send the queued write requests before the client is finalized
+  client->FlushWriteBatches();
+
   // Populate & send the finalize message and make sure the finalize
   // from the server end returned before deleting the local records.
   ais_rc = SendFinalizeMsg(client->GetClientId());
@@ -1292,6 +1298,12 @@ SaAisErrorT LogAgent::saLogWriteLogAsync(SaLogStreamHandleT logStreamHandle,
   write_param->client_id = client->GetClientId();
   write_param->lstr_id = stream->GetStreamId();
   write_param->logRecord = const_cast<SaLogRecordT*>(logRecord);
+
+  if (LogWriteBatch::enabled() && log_server_batches_writes()) {
+    ais_rc = QueueWriteLogAsync(client, stream, write_param);
+    return ais_rc;
+  }
+
   // Send the message out to the LGS
   if (NCSCC_RC_SUCCESS !=
       lga_mds_msg_async_send(&msg, MDS_SEND_PRIORITY_MEDIUM)) {
@@ -1303,6 +1315,159 @@ SaAisErrorT LogAgent::saLogWriteLogAsync(SaLogStreamHandleT logStreamHandle,
   return ais_rc;
 }
 
+SaAisErrorT LogAgent::QueueWriteLogAsync(
+    LogClient* client, LogStreamInfo* stream,
+    const lgsv_write_log_async_req_t* param) {
+  LogWriteBatch* batch = stream->GetWriteBatch();
+  base::Lock lock(batch->mutex());
+
+  if ((batch->empty() == false) && (batch->client_id() != param->client_id)) {
+    // Queued before the LOG server was lost and the client was recovered
+    std::vector<SaInvocationT> acked;
+    batch->Clear(&acked);
+    client->NotifyClientAboutLostInvocations(acked);
+  }
+
+  bool first = batch->empty();
+  if (batch->Add(param) == false) return SA_AIS_ERR_TRY_AGAIN;
+  client->KeepTrack(param->invocation, param->ack_flags);
+
+  if ((batch->full() == true) ||
+      (first == true && ScheduleWriteBatch(stream->GetHandle()) == false)) {
+    SendWriteBatch(client, batch);
+  }
+
+  return SA_AIS_OK;
+}
+
+void LogAgent::SendWriteBatch(LogClient* client, LogWriteBatch* batch) {
+  lgsv_msg_t msg;
+  lgsv_write_log_batch_req_t* batch_param;
+  std::vector<SaInvocationT> acked;
+
+  memset(&msg, 0, sizeof(lgsv_msg_t));
+  msg.type = LGSV_LGA_API_MSG;
+  msg.info.api_info.type = LGSV_WRITE_LOG_BATCH_ASYNC_REQ;
+  batch_param = &msg.info.api_info.param.write_log_batch;
+  batch->Take(batch_param, &acked);
+
+  TRACE("%s: %u records", __func__, batch_param->num_records);
+  if (NCSCC_RC_SUCCESS !=
+      lga_mds_msg_async_send(&msg, MDS_SEND_PRIORITY_MEDIUM)) {
+    TRACE("%s: lga_mds_msg_async_send FAILED", __func__);
+    client->NotifyClientAboutLostInvocations(acked);
+  }
+  LogWriteBatch::Free(batch_param);
+}
+
+void LogAgent::FlushWriteBatch(LogClient* client, LogStreamInfo* stream) {
+  LogWriteBatch* batch = stream->GetWriteBatch();
+  base::Lock lock(batch->mutex());
+
+  if (batch->empty() == true) return;
+
+  if ((batch->client_id() != client->GetClientId()) ||
+      (log_server_batches_writes() == false)) {
+    // The LOG server was lost, or replaced by one not supporting batches
+    std::vector<SaInvocationT> acked;
+    batch->Clear(&acked);
+    client->NotifyClientAboutLostInvocations(acked);
+    return;
+  }
+
+  if (no_active_log_server() == true) {
+    // Keep the requests until there is an active LOG server again
+    ScheduleWriteBatch(stream->GetHandle());
+    return;
+  }
+
+  SendWriteBatch(client, batch);
+}
+
+bool LogAgent::ScheduleWriteBatch(SaLogStreamHandleT handle) {
+  base::Lock lock(write_batch_mutex_);
+
+  if (write_batch_thread_started_ == false) {
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (pthread_create(&thread, &attr, WriteBatchThread, this) != 0) {
+      TRACE("%s: pthread_create FAILED: %s", __func__, strerror(errno));
+      pthread_attr_destroy(&attr);
+      return false;
+    }
+    pthread_attr_destroy(&attr);
+    write_batch_thread_started_ = true;
+  }
+
+  write_batch_streams_.insert(handle);
+  write_batch_cond_.NotifyOne();
+  return true;
+}
+
+void LogAgent::FlushWriteBatches() {
+  std::set<SaLogStreamHandleT> handles;
+
+  if (true) {
+    base::Lock lock(write_batch_mutex_);
+    handles.swap(write_batch_streams_);
+  }
+
+  for (const auto& handle : handles) {
+    LogStreamInfo* stream = nullptr;
+    LogClient* client = nullptr;
+    bool cUpdated = false, sUpdated = false;
+
+    // Restore the reference counters when running out of scope
+    ScopeData::LogClientData client_data{client, &cUpdated,
+          RefCounter::Degree::kIncOne, __func__};
+    ScopeData::LogStreamInfoData stream_data{stream, &sUpdated,
+          RefCounter::Degree::kIncOne, __func__};
+    ScopeData data{&client_data, &stream_data};
+
+    if (true) {
+      ScopeLock critical_section(get_delete_obj_sync_mutex_);
+
+      // The stream may have been closed since it was scheduled
+      stream = SearchLogStreamInfoByHandle(handle);
+      if (stream == nullptr) continue;
+
+      client = SearchClientByHandle(stream->GetMyClientHandle());
+      if (client == nullptr) continue;
+
+      if ((client->FetchAndIncreaseRefCounter(__func__, &cUpdated) == -1) ||
+          (stream->FetchAndIncreaseRefCounter(__func__, &sUpdated) == -1)) {
+        // Being deleted, the batch is sent before that
+        continue;
+      }
+    }  // end critical section
+
+    // Send without holding the critical section, as it is also entered by
+    // the MDS thread
+    FlushWriteBatch(client, stream);
+  }
+}
+
+void* LogAgent::WriteBatchThread(void* arg) {
+  LogAgent* agent = static_cast<LogAgent*>(arg);
+  const timespec delay = base::MillisToTimespec(LogWriteBatch::max_delay());
+
+  while (true) {
+    if (true) {
+      base::Lock lock(agent->write_batch_mutex_);
+      agent->write_batch_cond_.Wait(
+          &lock, [agent] { return !agent->write_batch_streams_.empty(); });
+    }
+
+    // Let the batches fill up during the max delay before sending them
+    base::Sleep(delay);
+    agent->FlushWriteBatches();
+  }
+
+  return nullptr;
+}
+
 SaAisErrorT LogAgent::saLogStreamClose(SaLogStreamHandleT logStreamHandle) {
   LogStreamInfo* stream = nullptr;
   LogClient* client = nullptr;
@@ -1412,6 +1577,9 @@ SaAisErrorT LogAgent::saLogStreamClose(SaLogStreamHandleT logStreamHandle) {
     }
   }
 
+  // Send the queued write requests before the stream is closed
+  FlushWriteBatch(client, stream);
+
   // Populate a MDS message to send to the LGS for a channel close operation.
   memset(&msg, 0, sizeof(lgsv_msg_t));
   msg.type = LGSV_LGA_API_MSG;
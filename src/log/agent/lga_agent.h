@@ -20,12 +20,15 @@
 
 #include <atomic>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 #include <saAis.h>
 #include <saLog.h>
 
+#include "base/condition_variable.h"
 #include "base/macros.h"
+#include "base/mutex.h"
 #include "mds/mds_papi.h"
 #include "log/common/lgsv_msg.h"
 #include "log/common/lgsv_defs.h"
@@ -34,6 +37,7 @@
 // Forward declarations
 class LogStreamInfo;
 class LogClient;
+class LogWriteBatch;
 
 //>
 // @LogAgent class - singleton
@@ -146,9 +150,14 @@ class LogAgent {
   // its clients and all log streams belong to each log client.
   void NoLogServer();
 
-  // Has active SC which having @lgs_dest address. Should only be called within
-  // MDS thread when getting @NCSMDS_NEW_ACTIVE/@NCSMDS_UP events.
-  void HasActiveLogServer(MDS_DEST lgs_dest);
+  // Has active SC which having @lgs_dest address and MDS sub-part version
+  // @lgs_ver. Should only be called within MDS thread when getting
+  // @NCSMDS_NEW_ACTIVE/@NCSMDS_UP events.
+  void HasActiveLogServer(MDS_DEST lgs_dest, MDS_SVC_PVT_SUB_PART_VER lgs_ver);
+
+  // Send the write requests queued in the batch of @stream owned by
+  // @client, see @LogWriteBatch.
+  void FlushWriteBatch(LogClient* client, LogStreamInfo* stream);
 
   // Help methods to get references to atomic attributes
   // This lazy/insecure form to let outer world updating
@@ -192,6 +201,28 @@ class LogAgent {
   // True if there is no LOG server at all (headless)
   bool is_no_log_server() const;
 
+  // True if the LOG server accepts batches of write requests
+  bool log_server_batches_writes() const;
+
+  // Queue write request @param in the batch of @stream. The batch is sent
+  // if it is full, else it is sent by the write batch thread.
+  SaAisErrorT QueueWriteLogAsync(LogClient* client, LogStreamInfo* stream,
+                                 const lgsv_write_log_async_req_t* param);
+
+  // Send the write batch @batch of @client. @batch mutex must be held.
+  void SendWriteBatch(LogClient* client, LogWriteBatch* batch);
+
+  // Let the write batch thread send the batch of log stream @handle,
+  // starting the thread if not yet done. Returns false if the thread could
+  // not be started.
+  bool ScheduleWriteBatch(SaLogStreamHandleT handle);
+
+  // Send the batches of all log streams scheduled by ScheduleWriteBatch()
+  void FlushWriteBatches();
+
+  // Thread sending write batches at the latest after the batch max delay
+  static void* WriteBatchThread(void*);
+
   // Form finalize Msg and send to MDS
   SaAisErrorT SendFinalizeMsg(uint32_t client_id);
 
@@ -246,6 +277,9 @@ class LogAgent {
     // Hold the MDS destination address of LOG server.
     std::atomic<MDS_DEST> lgs_mds_dest;
 
+    // Hold the MDS sub-part version of LOG server.
+    std::atomic<MDS_SVC_PVT_SUB_PART_VER> lgs_mds_svc_pvt_ver;
+
     // Reflects CLM status of this node (for future use)
     std::atomic<SaClmClusterChangesT> clm_node_state;
 
@@ -255,6 +289,7 @@ class LogAgent {
           waiting_log_server_up{false},
           mds_hdl{0},
           lgs_mds_dest{0},
+          lgs_mds_svc_pvt_ver{0},
           clm_node_state{SA_CLM_NODE_JOINED} {}
   };
 
@@ -284,14 +319,23 @@ class LogAgent {
   // LGS LGA sync params
   NCS_SEL_OBJ lgs_sync_sel_;
 
+  // Handles of the log streams having write requests to be sent by the write
+  // batch thread, protected by @write_batch_mutex_
+  std::set<SaLogStreamHandleT> write_batch_streams_;
+  bool write_batch_thread_started_;
+  base::Mutex write_batch_mutex_;
+  base::ConditionVariable write_batch_cond_;
+
   DELETE_COPY_AND_MOVE_OPERATORS(LogAgent);
 };
 
 //------------------------------------------------------------------------------
 // LogAgent inline methods
 //------------------------------------------------------------------------------
-inline void LogAgent::HasActiveLogServer(MDS_DEST lgs_dest) {
+inline void LogAgent::HasActiveLogServer(MDS_DEST lgs_dest,
+                                         MDS_SVC_PVT_SUB_PART_VER lgs_ver) {
   atomic_data_.lgs_mds_dest = lgs_dest;
+  atomic_data_.lgs_mds_svc_pvt_ver = lgs_ver;
   atomic_data_.log_server_state = LogServerState::kHasActiveLogServer;
 }
 
@@ -365,6 +409,11 @@ inline bool LogAgent::is_no_log_server() const {
   return (atomic_data_.log_server_state == LogServerState::kNoLogServer);
 }
 
+inline bool LogAgent::log_server_batches_writes() const {
+  // LGSV_WRITE_LOG_BATCH_ASYNC_REQ is supported from LGS sub-part version 2
+  return (atomic_data_.lgs_mds_svc_pvt_ver >= 2);
+}
+
 inline bool LogAgent::waiting_log_server_up() const {
   return atomic_data_.waiting_log_server_up.load();
 }
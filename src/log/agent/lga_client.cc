@@ -280,6 +280,33 @@ void LogClient::RemoveLogStreamInfo(LogStreamInfo** stream) {
   }
 }
 
+void LogClient::FlushWriteBatches() {
+  TRACE_ENTER();
+  auto agent = LogAgent::instance();
+  std::vector<LogStreamInfo*> streams;
+
+  // Take a reference to each stream, so that it is not deleted by a
+  // concurrent saLogStreamClose() while its batch is sent. A stream being
+  // closed (-1) is skipped, its batch is sent by the close.
+  agent->EnterCriticalSection();
+  if (true) {
+    ScopeLock scopeLock(mutex_);
+    for (const auto& s : stream_list_) {
+      bool updated = false;
+      if (s == nullptr) continue;
+      s->FetchAndIncreaseRefCounter(__func__, &updated);
+      if (updated == true) streams.push_back(s);
+    }
+  }
+  agent->LeaveCriticalSection();
+
+  // Do not hold @mutex_ while sending, it is also taken in the MDS thread
+  for (const auto& s : streams) {
+    agent->FlushWriteBatch(this, s);
+    s->RestoreRefCounter(__func__, RefCounter::Degree::kIncOne, true);
+  }
+}
+
 LogStreamInfo* LogClient::SearchLogStreamInfoById(uint32_t id) {
   TRACE_ENTER();
   ScopeLock scopeLock(mutex_);
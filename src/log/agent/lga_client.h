@@ -19,6 +19,7 @@
 #define SRC_LOG_AGENT_LGA_CLIENT_H_
 
 #include <stdint.h>
+#include <algorithm>
 #include <vector>
 #include <list>
 #include <atomic>
@@ -187,23 +188,29 @@ class LogClient {
   void NotifyClientAboutLostInvocations() {
     base::Lock scope_lock{mutex_unacked_list_};
     for (const auto& i : unacked_invocations_) {
-      TRACE("The write async with this invocation %lld has been lost", i);
-      // the below memory will be freed by lga_msg_destroy(cbk_msg)
-      // after done processing with this msg from the mailbox.
-      lgsv_msg_t* msg = static_cast<lgsv_msg_t*>(malloc(sizeof(lgsv_msg_t)));
-      assert(msg && "Failed to allocate memory for lgsv_msg_t");
-      memset(msg, 0, sizeof(lgsv_msg_t));
-      msg->type = LGSV_LGS_CBK_MSG;
-      msg->info.cbk_info.type = LGSV_WRITE_LOG_CALLBACK_IND;
-      msg->info.cbk_info.lgs_client_id = client_id_;
-      msg->info.cbk_info.write_cbk.error = SA_AIS_ERR_TRY_AGAIN;
-      msg->info.cbk_info.inv = i;
-
-      SendMsgToMbx(msg, MDS_SEND_PRIORITY_HIGH);
+      NotifyClientAboutLostInvocation(i);
     }
     unacked_invocations_.clear();
   }
 
+  // Sending the write requests with invocations @invs failed. Notify the
+  // ones still being tracked, the others have already been notified.
+  void NotifyClientAboutLostInvocations(
+      const std::vector<SaInvocationT>& invs) {
+    base::Lock scope_lock{mutex_unacked_list_};
+    for (const auto& i : invs) {
+      auto it = std::find(unacked_invocations_.begin(),
+                          unacked_invocations_.end(), i);
+      if (it == unacked_invocations_.end()) continue;
+      unacked_invocations_.erase(it);
+      NotifyClientAboutLostInvocation(i);
+    }
+  }
+
+  // Send the write requests queued in the batches of all log streams
+  // belonging to @this client. Called before the client is finalized.
+  void FlushWriteBatches();
+
   // true if the client is successfully done recovery.
   // or the client has just borned.
   // Introduce this method to avoid locking the successful recovered client
@@ -237,6 +244,23 @@ class LogClient {
   // Invoke the registered callback
   void InvokeCallback(const lgsv_msg_t* msg);
 
+  // Post a write callback with SA_AIS_ERR_TRY_AGAIN for invocation @inv
+  void NotifyClientAboutLostInvocation(SaInvocationT inv) {
+    TRACE("The write async with this invocation %lld has been lost", inv);
+    // the below memory will be freed by lga_msg_destroy(cbk_msg)
+    // after done processing with this msg from the mailbox.
+    lgsv_msg_t* msg = static_cast<lgsv_msg_t*>(malloc(sizeof(lgsv_msg_t)));
+    assert(msg && "Failed to allocate memory for lgsv_msg_t");
+    memset(msg, 0, sizeof(lgsv_msg_t));
+    msg->type = LGSV_LGS_CBK_MSG;
+    msg->info.cbk_info.type = LGSV_WRITE_LOG_CALLBACK_IND;
+    msg->info.cbk_info.lgs_client_id = client_id_;
+    msg->info.cbk_info.write_cbk.error = SA_AIS_ERR_TRY_AGAIN;
+    msg->info.cbk_info.inv = inv;
+
+    SendMsgToMbx(msg, MDS_SEND_PRIORITY_HIGH);
+  }
+
   void CleanUnackedList() {
     base::Lock scope_lock{mutex_unacked_list_};
     unacked_invocations_.clear();
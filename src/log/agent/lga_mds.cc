@@ -29,16 +29,17 @@
 #include "log/agent/lga_common.h"
 #include "log/common/lgsv_defs.h"
 
-#define LGA_SVC_PVT_SUBPART_VERSION 1
+#define LGA_SVC_PVT_SUBPART_VERSION 2
 #define LGA_WRT_LGS_SUBPART_VER_AT_MIN_MSG_FMT 1
-#define LGA_WRT_LGS_SUBPART_VER_AT_MAX_MSG_FMT 1
+#define LGA_WRT_LGS_SUBPART_VER_AT_MAX_MSG_FMT 2
 #define LGA_WRT_LGS_SUBPART_VER_RANGE       \
   (LGA_WRT_LGS_SUBPART_VER_AT_MAX_MSG_FMT - \
    LGA_WRT_LGS_SUBPART_VER_AT_MIN_MSG_FMT + 1)
 
-// msg format version for LGA subpart version 1
+// msg format version for LGS subpart version 1 and 2. Version 2 adds
+// LGSV_WRITE_LOG_BATCH_ASYNC_REQ.
 static MDS_CLIENT_MSG_FORMAT_VER
-    LGA_WRT_LGS_MSG_FMT_ARRAY[LGA_WRT_LGS_SUBPART_VER_RANGE] = {1};
+    LGA_WRT_LGS_MSG_FMT_ARRAY[LGA_WRT_LGS_SUBPART_VER_RANGE] = {1, 2};
 
 /****************************************************************************
   Name          : lga_enc_initialize_msg
@@ -402,21 +403,22 @@ static uint32_t lga_enc_write_gen_header(
 }
 
 /****************************************************************************
-  Name          : lga_enc_write_log_async_msg
+  Name          : lga_enc_write_log_async_req
 
-  Description   : This routine encodes a write log async API msg
+  Description   : This routine encodes a write log async request
 
   Arguments     : NCS_UBAID *msg,
-                  LGSV_MSG *msg
+                  lgsv_write_log_async_req_t *param
 
-  Return Values : uint32_t
+  Return Values : Number of encoded bytes, 0 if encoding failed
 
-  Notes         : None.
+  Notes         : Also used to encode the requests of a write batch, see
+                  LogWriteBatch.
 ******************************************************************************/
-static uint32_t lga_enc_write_log_async_msg(NCS_UBAID *uba, lgsv_msg_t *msg) {
+uint32_t lga_enc_write_log_async_req(NCS_UBAID *uba,
+                                     const lgsv_write_log_async_req_t *param) {
   uint8_t *p8;
   uint32_t total_bytes = 0;
-  lgsv_write_log_async_req_t *param = &msg->info.api_info.param.write_log_async;
   const SaLogNtfLogHeaderT *ntfLogH;
   const SaLogGenericLogHeaderT *genLogH;
 
@@ -494,6 +496,44 @@ static uint32_t lga_enc_write_log_async_msg(NCS_UBAID *uba, lgsv_msg_t *msg) {
   return total_bytes;
 }
 
+/****************************************************************************
+  Name          : lga_enc_write_log_batch_async_msg
+
+  Description   : This routine encodes a batch of write log async requests
+
+  Arguments     : NCS_UBAID *msg,
+                  LGSV_MSG *msg
+
+  Return Values : uint32_t
+
+  Notes         : The requests are already encoded in a USRBUF, which is
+                  appended to the message and thereby consumed.
+******************************************************************************/
+static uint32_t lga_enc_write_log_batch_async_msg(NCS_UBAID *uba,
+                                                  lgsv_msg_t *msg) {
+  uint8_t *p8;
+  uint32_t total_bytes = 0;
+  lgsv_write_log_batch_req_t *param = &msg->info.api_info.param.write_log_batch;
+  USRBUF *records = static_cast<USRBUF *>(param->encoded_records);
+
+  osafassert(uba != nullptr && records != nullptr);
+
+  p8 = ncs_enc_reserve_space(uba, 4);
+  if (!p8) {
+    TRACE("Could not reserve space");
+    return 0;
+  }
+  ncs_encode_32bit(&p8, param->num_records);
+  ncs_enc_claim_space(uba, 4);
+  total_bytes += 4;
+
+  int32_t ttl = uba->ttl;
+  ncs_enc_append_usrbuf(uba, records);
+  param->encoded_records = nullptr;
+  total_bytes += uba->ttl - ttl;
+  return total_bytes;
+}
+
 /****************************************************************************
   Name          : lga_lgs_msg_proc
 
@@ -672,7 +712,8 @@ static uint32_t lga_mds_svc_evt(struct ncsmds_callback_info *mds_cb_info) {
           // Inform to LOG agent that LOG server is up from headless
           // and provide it the LOG server destination address too.
           LogAgent::instance()->HasActiveLogServer(
-              mds_cb_info->info.svc_evt.i_dest);
+              mds_cb_info->info.svc_evt.i_dest,
+              mds_cb_info->info.svc_evt.i_rem_svc_pvt_ver);
           if (LogAgent::instance()->waiting_log_server_up() == true) {
             // Signal waiting thread
             m_NCS_SEL_OBJ_IND(LogAgent::instance()->get_lgs_sync_sel());
@@ -804,7 +845,12 @@ static uint32_t lga_mds_enc(struct ncsmds_callback_info *info) {
         break;
 
       case LGSV_WRITE_LOG_ASYNC_REQ:
-        total_bytes += lga_enc_write_log_async_msg(uba, msg);
+        total_bytes += lga_enc_write_log_async_req(
+            uba, &msg->info.api_info.param.write_log_async);
+        break;
+
+      case LGSV_WRITE_LOG_BATCH_ASYNC_REQ:
+        total_bytes += lga_enc_write_log_batch_async_msg(uba, msg);
         break;
 
       default:
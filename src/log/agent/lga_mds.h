@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 #include <saAis.h>
+#include "base/ncs_ubaid.h"
+#include "log/common/lgsv_msg.h"
 
 struct lga_cb_t;
 struct lgsv_msg_t;
@@ -30,5 +32,7 @@ void lga_msg_destroy(lgsv_msg_t *msg);
 uint32_t lga_mds_msg_sync_send(lgsv_msg_t *i_msg, lgsv_msg_t **o_msg,
                                SaTimeT timeout, uint32_t prio);
 uint32_t lga_mds_msg_async_send(lgsv_msg_t *i_msg, uint32_t prio);
+uint32_t lga_enc_write_log_async_req(NCS_UBAID *uba,
+                                     const lgsv_write_log_async_req_t *param);
 
 #endif  // SRC_LOG_AGENT_LGA_MDS_H_
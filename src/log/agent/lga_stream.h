@@ -24,6 +24,7 @@
 #include "base/mutex.h"
 #include "log/agent/lga_common.h"
 #include "log/agent/lga_ref_counter.h"
+#include "log/agent/lga_write_batch.h"
 
 //<
 // @LogStreamInfo class
@@ -87,6 +88,9 @@ class LogStreamInfo {
   // Get stream name @stream_name_ of this log stream
   const std::string& GetStreamName() const { return stream_name_; }
 
+  // Get the batch of write requests @write_batch_ not yet sent to LOG server
+  LogWriteBatch* GetWriteBatch() { return &write_batch_; }
+
   // Fetch and increase reference counter.
   int32_t FetchAndIncreaseRefCounter(const char* caller, bool* updated) {
     return ref_counter_object_.FetchAndIncreaseRefCounter(caller, updated);
@@ -150,6 +154,9 @@ class LogStreamInfo {
   // event occurs). It's not valid in LGA_NORMAL state.
   std::atomic<bool> recovered_flag_;
 
+  // Write requests queued to be sent in one message, if writes are batched
+  LogWriteBatch write_batch_;
+
   friend class LogClient;
   DELETE_COPY_AND_MOVE_OPERATORS(LogStreamInfo);
 };
@@ -0,0 +1,122 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#include "log/agent/lga_write_batch.h"
+#include <stdlib.h>
+#include <string.h>
+#include "base/logtrace.h"
+#include "base/ncssysf_mem.h"
+#include "log/agent/lga_mds.h"
+
+// Read an unsigned value from environment variable @name, or @default_value
+// if the variable is not set or not a number.
+static uint32_t GetEnvValue(const char* name, uint32_t default_value) {
+  const char* value = getenv(name);
+  char* end;
+
+  if (value == nullptr || *value == '\0') return default_value;
+  unsigned long result = strtoul(value, &end, 0);
+  if (*end != '\0' || result > UINT32_MAX) {
+    TRACE("Invalid %s: %s", name, value);
+    return default_value;
+  }
+  return result;
+}
+
+const LogWriteBatch::Config& LogWriteBatch::config() {
+  static const Config config = [] {
+    Config c;
+    c.max_records = GetEnvValue("LOGSV_WRITE_BATCH_RECORDS", 0);
+    if (c.max_records > LGSV_WRITE_LOG_BATCH_MAX)
+      c.max_records = LGSV_WRITE_LOG_BATCH_MAX;
+    c.max_bytes = GetEnvValue("LOGSV_WRITE_BATCH_BYTES", 32768);
+    c.max_delay = GetEnvValue("LOGSV_WRITE_BATCH_DELAY_MS", 10);
+    if (c.max_delay == 0) c.max_delay = 1;
+    TRACE("Write batch records: %u, bytes: %u, delay: %u ms", c.max_records,
+          c.max_bytes, c.max_delay);
+    return c;
+  }();
+  return config;
+}
+
+LogWriteBatch::LogWriteBatch() : num_records_{0}, client_id_{0} {
+  memset(&uba_, 0, sizeof(uba_));
+}
+
+LogWriteBatch::~LogWriteBatch() {
+  std::vector<SaInvocationT> acked;
+  Clear(&acked);
+}
+
+bool LogWriteBatch::Add(const lgsv_write_log_async_req_t* param) {
+  int32_t ttl = uba_.ttl;
+
+  if (num_records_ == 0) {
+    if (ncs_enc_init_space(&uba_) != NCSCC_RC_SUCCESS) {
+      TRACE("ncs_enc_init_space FAILED");
+      return false;
+    }
+    client_id_ = param->client_id;
+  }
+
+  if (lga_enc_write_log_async_req(&uba_, param) == 0) {
+    TRACE("Encoding write request FAILED");
+    if (num_records_ == 0) {
+      m_MMGR_FREE_BUFR_LIST(uba_.start);
+      memset(&uba_, 0, sizeof(uba_));
+    } else {
+      // Remove what was encoded of the request
+      m_MMGR_REMOVE_FROM_END(uba_.start, uba_.ttl - ttl);
+      uba_.ub = uba_.start;
+      uba_.ttl = ttl;
+    }
+    return false;
+  }
+
+  num_records_++;
+  if (param->ack_flags == SA_LOG_RECORD_WRITE_ACK) {
+    acked_.push_back(param->invocation);
+  }
+  return true;
+}
+
+void LogWriteBatch::Take(lgsv_write_log_batch_req_t* param,
+                         std::vector<SaInvocationT>* acked) {
+  param->num_records = num_records_;
+  param->encoded_records = uba_.start;
+  param->records = nullptr;
+  acked->swap(acked_);
+
+  acked_.clear();
+  memset(&uba_, 0, sizeof(uba_));
+  num_records_ = 0;
+}
+
+void LogWriteBatch::Clear(std::vector<SaInvocationT>* acked) {
+  if (num_records_ != 0) m_MMGR_FREE_BUFR_LIST(uba_.start);
+  acked->swap(acked_);
+
+  acked_.clear();
+  memset(&uba_, 0, sizeof(uba_));
+  num_records_ = 0;
+}
+
+void LogWriteBatch::Free(lgsv_write_log_batch_req_t* param) {
+  if (param->encoded_records != nullptr) {
+    USRBUF* records = static_cast<USRBUF*>(param->encoded_records);
+    m_MMGR_FREE_BUFR_LIST(records);
+    param->encoded_records = nullptr;
+  }
+}
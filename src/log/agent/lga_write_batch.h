@@ -0,0 +1,111 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#ifndef SRC_LOG_AGENT_LGA_WRITE_BATCH_H_
+#define SRC_LOG_AGENT_LGA_WRITE_BATCH_H_
+
+#include <stdint.h>
+#include <saLog.h>
+#include <vector>
+#include "base/macros.h"
+#include "base/mutex.h"
+#include "base/ncs_ubaid.h"
+#include "log/common/lgsv_msg.h"
+
+//<
+// @LogWriteBatch class
+//
+// Collects the saLogWriteLogAsync() requests of one log stream, encoded as
+// they are written, so that they are sent to the LOG server in one
+// LGSV_WRITE_LOG_BATCH_ASYNC_REQ message instead of one message each.
+//
+// Batching is disabled by default and is enabled per process by setting the
+// environment variable LOGSV_WRITE_BATCH_RECORDS to the max number of
+// records in a batch. A batch is also sent when its encoded records reach
+// LOGSV_WRITE_BATCH_BYTES bytes (default 32768), or at the latest
+// LOGSV_WRITE_BATCH_DELAY_MS milliseconds (default 10) after its first record
+// was written. Batching is only used if the LOG server supports it.
+//
+// The LOG server splits a batch into one write request per record, in the
+// order they were written. So each record requesting an ack is acknowledged
+// on its own, just as if the records had been sent one by one.
+//
+// Each @LogStreamInfo object owns one @LogWriteBatch object. @mutex() must be
+// held when accessing it, also while sending it to make sure that batches of
+// a log stream are sent in order.
+//>
+class LogWriteBatch {
+ public:
+  LogWriteBatch();
+  ~LogWriteBatch();
+
+  // True if write requests are to be batched in this process
+  static bool enabled() { return config().max_records > 1; }
+
+  // Max time in milliseconds from writing a record until it is sent
+  static uint32_t max_delay() { return config().max_delay; }
+
+  // Encode and add write request @param to the batch. Returns false if the
+  // request could not be encoded, leaving the batch unchanged.
+  bool Add(const lgsv_write_log_async_req_t* param);
+
+  // True if the batch has reached the max number of records or bytes
+  bool full() const {
+    return num_records_ >= config().max_records ||
+           static_cast<uint32_t>(uba_.ttl) >= config().max_bytes;
+  }
+
+  bool empty() const { return num_records_ == 0; }
+
+  // Client id of the queued records
+  uint32_t client_id() const { return client_id_; }
+
+  // Hand the encoded records over to @param to be sent, leaving the batch
+  // empty. The invocations of records requesting an ack are returned in
+  // @acked, since these must be reported lost if sending fails.
+  void Take(lgsv_write_log_batch_req_t* param,
+            std::vector<SaInvocationT>* acked);
+
+  // Drop the queued records. The invocations of records requesting an ack
+  // are returned in @acked.
+  void Clear(std::vector<SaInvocationT>* acked);
+
+  // Free the encoded records of @param not consumed by the MDS encoder
+  static void Free(lgsv_write_log_batch_req_t* param);
+
+  base::Mutex& mutex() { return mutex_; }
+
+ private:
+  struct Config {
+    uint32_t max_records;
+    uint32_t max_bytes;
+    uint32_t max_delay;
+  };
+
+  // Batch limits read from the environment once
+  static const Config& config();
+
+  base::Mutex mutex_;
+
+  // Encoded records, valid if @num_records_ > 0
+  NCS_UBAID uba_;
+  uint32_t num_records_;
+  uint32_t client_id_;
+  std::vector<SaInvocationT> acked_;
+
+  DELETE_COPY_AND_MOVE_OPERATORS(LogWriteBatch);
+};
+
+#endif  // SRC_LOG_AGENT_LGA_WRITE_BATCH_H_
@@ -41,6 +41,7 @@ typedef enum {
   LGSV_STREAM_OPEN_REQ = 2,
   LGSV_STREAM_CLOSE_REQ = 3,
   LGSV_WRITE_LOG_ASYNC_REQ = 4,
+  LGSV_WRITE_LOG_BATCH_ASYNC_REQ = 5,
   LGSV_API_MAX
 } lgsv_api_msg_type_t;
 
@@ -107,6 +108,20 @@ typedef struct {
   SaTimeT *logTimeStamp;
 } lgsv_write_log_async_req_t;
 
+/* Max number of write requests in one LGSV_WRITE_LOG_BATCH_ASYNC_REQ */
+#define LGSV_WRITE_LOG_BATCH_MAX 1024
+
+/*
+ * A batch of write requests to one or more log streams, sent if the log
+ * server supports message format version 2. The requests are encoded as
+ * LGSV_WRITE_LOG_ASYNC_REQ ones after the number of requests.
+ */
+typedef struct {
+  uint32_t num_records;
+  void *encoded_records;               /* USRBUF, only used by LGA */
+  lgsv_write_log_async_req_t *records; /* Only used by LGS */
+} lgsv_write_log_batch_req_t;
+
 /* API param definition */
 typedef struct {
   lgsv_api_msg_type_t type;       /* api type */
@@ -116,6 +131,7 @@ typedef struct {
     lgsv_stream_open_req_t lstr_open_sync;
     lgsv_stream_close_req_t lstr_close;
     lgsv_write_log_async_req_t write_log_async;
+    lgsv_write_log_batch_req_t write_log_batch;
   } param;
 } lgsv_api_info_t;
 
@@ -51,9 +51,12 @@ static const LGSV_LGS_EVT_HANDLER lgs_lgsv_top_level_evt_dispatch_tbl[] = {
     proc_mds_quiesced_ack_msg};
 
 /* Dispatch table for LGA_API realted messages */
-static const LGSV_LGS_LGA_API_MSG_HANDLER lgs_lga_api_msg_dispatcher[] = {
-    proc_initialize_msg,   proc_finalize_msg,        proc_stream_open_msg,
-    proc_stream_close_msg, proc_write_log_async_msg,
+/* LGSV_WRITE_LOG_BATCH_ASYNC_REQ is split into writes by mds_rcv() */
+static const LGSV_LGS_LGA_API_MSG_HANDLER
+    lgs_lga_api_msg_dispatcher[LGSV_API_MAX] = {
+        proc_initialize_msg,      proc_finalize_msg,
+        proc_stream_open_msg,     proc_stream_close_msg,
+        proc_write_log_async_msg, nullptr,
 };
 
 extern void rda_cb(uint32_t cb_hdl, PCS_RDA_CB_INFO *cb_info,
@@ -1344,9 +1347,9 @@ static uint32_t proc_write_log_async_msg(lgs_cb_t *cb, lgsv_lgs_evt_t *evt) {
   }
 
   if ((n = lgs_format_log_record(
-           param->logRecord, stream->logFileFormat, stream->maxLogFileSize,
-           stream->fixedLogRecordSize, buf_size, logOutputString,
-           ++stream->logRecordId, node_name)) == 0) {
+           &stream->fmtProgram, param->logRecord, stream->logFileFormat,
+           stream->maxLogFileSize, stream->fixedLogRecordSize, buf_size,
+           logOutputString, ++stream->logRecordId, node_name)) == 0) {
     AckToWriteAsync(param, evt->fr_dest, SA_AIS_ERR_INVALID_PARAM);
     free(logOutputString);
     return NCSCC_RC_SUCCESS;
@@ -1387,7 +1390,8 @@ static uint32_t process_api_evt(lgsv_lgs_evt_t *evt) {
 
   api_type = evt->info.msg.info.api_info.type;
 
-  if (api_type >= LGSV_API_MAX) {
+  if ((api_type >= LGSV_API_MAX) ||
+      (lgs_lga_api_msg_dispatcher[api_type] == nullptr)) {
     LOG_ER("Invalid msg type %d", api_type);
     goto done;
   }
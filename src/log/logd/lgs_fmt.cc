@@ -532,215 +532,232 @@ static SaBoolT validateSysToken(SaStringT fmtExpPtr, SaUint16T *fmtExpPtrOffset,
   return tokenOk;
 }
 
+/* The time fields, formatted as the time stamp tokens */
+typedef enum {
+  TIME_HOUR,
+  TIME_MINUTE,
+  TIME_SECOND,
+  TIME_12_24_MODE,
+  TIME_MONTH,
+  TIME_MON,
+  TIME_DAY,
+  TIME_DAYN,
+  TIME_YEAR,
+  TIME_FULL_YEAR,
+  TIME_NTF_YEAR,
+  TIME_NTF_FULL_YEAR,
+  TIME_TIMEZONE,
+  TIME_NUMBER_OF_FIELDS
+} timeFieldT;
+
+typedef struct {
+  bool valid;
+  SaTimeT seconds;
+  char field[TIME_NUMBER_OF_FIELDS][24];
+  size_t length[TIME_NUMBER_OF_FIELDS];
+} timeFieldsT;
+
+/*
+ * Time fields of the last second seen in a log time stamp and in a
+ * notification event time. Log records are only formatted by the main thread.
+ */
+static timeFieldsT logTimeStampFields;
+static timeFieldsT eventTimeFields;
+
 /**
+ * Get the time fields of a time. The time is split with localtime_r() and
+ * the fields are formatted only when the second differs from the cached one,
+ * otherwise the cached fields are returned.
  *
- * @param fmtExpPtr
- * @param fmtExpPtrOffset
+ * @param cache
+ * @param time
+ *
+ * @return const timeFieldsT *
+ */
+static const timeFieldsT *getTimeFields(timeFieldsT *cache, SaTimeT time) {
+  static const char *const monthName[] = {"Jan", "Feb", "Mar", "Apr",
+                                          "May", "Jun", "Jul", "Aug",
+                                          "Sep", "Oct", "Nov", "Dec"};
+  static const char *const dayName[] = {"Sun", "Mon", "Tue", "Wed",
+                                        "Thu", "Fri", "Sat"};
+  const size_t size = sizeof(cache->field[0]);
+  SaTimeT totalTime = time / (SaTimeT)SA_TIME_ONE_SECOND;
+  struct tm tm_info;
+  struct tm *timeData;
+  long gmtOffset = 0, uGmtOffset = 0;
+
+  if (cache->valid && cache->seconds == totalTime) return cache;
+
+  /* Split timestamp in timeData */
+  timeData = localtime_r((const time_t *)&totalTime, &tm_info);
+  osafassert(timeData);
+
+  snprintf(cache->field[TIME_HOUR], size, "%02d", timeData->tm_hour);
+  snprintf(cache->field[TIME_MINUTE], size, "%02d", timeData->tm_min);
+  snprintf(cache->field[TIME_SECOND], size, "%02d", timeData->tm_sec);
+  snprintf(cache->field[TIME_12_24_MODE], size, "%s",
+           timeData->tm_hour < 12 ? "am" : "pm");
+  snprintf(cache->field[TIME_MONTH], size, "%02d", timeData->tm_mon + 1);
+  snprintf(cache->field[TIME_MON], size, "%s",
+           monthName[timeData->tm_mon]);
+  snprintf(cache->field[TIME_DAY], size, "%02d", timeData->tm_mday);
+  snprintf(cache->field[TIME_DAYN], size, "%s", dayName[timeData->tm_wday]);
+  strftime(cache->field[TIME_YEAR], size, "%y", timeData);
+  strftime(cache->field[TIME_FULL_YEAR], size, "%Y", timeData);
+  snprintf(cache->field[TIME_NTF_YEAR], size, "%02d",
+           timeData->tm_year - (YEAR_2000 - START_YEAR));
+  snprintf(cache->field[TIME_NTF_FULL_YEAR], size, "%d",
+           timeData->tm_year + START_YEAR);
+
+  /* Get timezone offset from localtime to UTC time */
+  gmtOffset = (timeData->tm_gmtoff / SECOND_PER_HOUR) * 100 +
+              (timeData->tm_gmtoff % SECOND_PER_HOUR) / SECOND_PER_MINUTE;
+  uGmtOffset = (gmtOffset >= 0) ? (gmtOffset) : (gmtOffset * -1);
+  snprintf(cache->field[TIME_TIMEZONE], size, "%c%04ld",
+           gmtOffset >= 0 ? '+' : '-', uGmtOffset);
+
+  for (int i = 0; i < TIME_NUMBER_OF_FIELDS; i++) {
+    cache->length[i] = strlen(cache->field[i]);
+  }
+  cache->seconds = totalTime;
+  cache->valid = true;
+  return cache;
+}
+
+/**
+ * Copy a string of known length to dest. Gives the same result as
+ * snprintf(dest, dest_size, "%s", src), dest_size must not be 0.
+ *
+ * @param dest
+ * @param dest_size
+ * @param src
+ * @param length
+ *
+ * @return int number of characters src needs
+ */
+static int copyField(char *dest, size_t dest_size, const char *src,
+                     size_t length) {
+  size_t n = (length < dest_size) ? length : dest_size - 1;
+
+  memcpy(dest, src, n);
+  dest[n] = '\0';
+  return length;
+}
+
+static int copyTimeField(char *dest, size_t dest_size,
+                         const timeFieldsT *timeFields, timeFieldT field) {
+  return copyField(dest, dest_size, timeFields->field[field],
+                   timeFields->length[field]);
+}
+
+/**
+ * Write the milliseconds of a time as three digits
+ *
+ * @param dest
+ * @param dest_size
+ * @param time
+ *
+ * @return int number of characters needed
+ */
+static int copyMilliseconds(char *dest, size_t dest_size, SaTimeT time) {
+  SaTimeT ms = (time / SA_TIME_ONE_MILLISECOND) % SA_TIME_OFFSET;
+  char digits[3];
+
+  if (ms < 0) return snprintf(dest, dest_size, "%03lld", ms);
+
+  digits[0] = '0' + ms / 100;
+  digits[1] = '0' + (ms / 10) % 10;
+  digits[2] = '0' + ms % 10;
+  return copyField(dest, dest_size, digits, sizeof(digits));
+}
+
+/**
+ *
+ * @param op
  * @param truncationLetterPos
  * @param inputPos
- * @param twelveHourModeFlag
- * @param timeStampData
+ * @param timeStamp
  * @param commonData
  * @param genHeader
  *
  * @return SaStringT
  */
-static int extractCommonField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
-                              SaUint16T *fmtExpPtrOffset,
+static int extractCommonField(char *dest, size_t dest_size,
+                              const lgs_fmt_op_t *op,
                               SaInt32T *truncationLetterPos, SaInt32T inputPos,
                               SaUint32T logRecordIdCounter,
-                              const SaBoolT *twelveHourModeFlag,
-                              const struct tm *timeStampData,
+                              const timeFieldsT *timeStamp,
                               const SaLogRecordT *logRecord, SaUint16T rec_size,
                               char *node_name) {
-  SaInt32T fieldSize;
+  SaInt32T fieldSize = op->fieldSize;
   size_t stringSize, i;
-  SaUint16T fieldSizeOffset = 0;
   int characters = 0;
   char *hex_string = NULL, *hex_string_ptr = NULL;
-  SaTimeT ms;
-  long gmtOffset = 0, uGmtOffset = 0;
 
-  *fmtExpPtrOffset = DEFAULT_FMT_EXP_PTR_OFFSET;
-
-  switch (*fmtExpPtr++) { /* input points to a possible field size */
+  switch (op->tokenLetter) {
     case C_LR_ID_LETTER:
-      stringSize = 11 * sizeof(char);
       characters = snprintf(dest, dest_size, "% 10d", (int)logRecordIdCounter);
       break;
 
     case C_LR_TIME_STAMP_LETTER:
-      stringSize = 19 * sizeof(char);
       characters =
           snprintf(dest, dest_size, "%#016llx", logRecord->logTimeStamp);
       break;
 
     case C_TIME_STAMP_HOUR_LETTER:
-      stringSize = 3 * sizeof(char);
-      if (*twelveHourModeFlag == SA_TRUE) {
-        characters =
-            snprintf(dest, dest_size, "%02d", (timeStampData->tm_hour % 12));
-      } else {
-        characters = snprintf(dest, dest_size, "%02d", timeStampData->tm_hour);
-      }
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_HOUR);
       break;
 
     case C_TIME_STAMP_MINUTE_LETTER:
-      stringSize = 3 * sizeof(char);
-      characters = snprintf(dest, dest_size, "%02d", timeStampData->tm_min);
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_MINUTE);
       break;
 
     case C_TIME_STAMP_SECOND_LETTER:
-      stringSize = 3 * sizeof(char);
-      characters = snprintf(dest, dest_size, "%02d", timeStampData->tm_sec);
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_SECOND);
       break;
 
     case C_TIME_STAMP_12_24_MODE_LETTER:
-      stringSize = 3 * sizeof(char);
-      if (timeStampData->tm_hour >= 00 && timeStampData->tm_hour < 12) {
-        characters = snprintf(dest, dest_size, "am");
-      } else {
-        characters = snprintf(dest, dest_size, "pm");
-      }
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_12_24_MODE);
       break;
 
     case C_TIME_STAMP_MONTH_LETTER:
-      stringSize = 3 * sizeof(char);
-      characters =
-          snprintf(dest, dest_size, "%02d", (timeStampData->tm_mon + 1));
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_MONTH);
       break;
 
     case C_TIME_STAMP_MON_LETTER:
-      stringSize = 4 * sizeof(char);
-      switch (timeStampData->tm_mon) {
-        case MONTH_JANUARY:
-          characters = snprintf(dest, dest_size, "Jan");
-          break;
-
-        case MONTH_FEBRUARY:
-          characters = snprintf(dest, dest_size, "Feb");
-          break;
-
-        case MONTH_MARCH:
-          characters = snprintf(dest, dest_size, "Mar");
-          break;
-
-        case MONTH_APRIL:
-          characters = snprintf(dest, dest_size, "Apr");
-          break;
-
-        case MONTH_MAY:
-          characters = snprintf(dest, dest_size, "May");
-          break;
-
-        case MONTH_JUNE:
-          characters = snprintf(dest, dest_size, "Jun");
-          break;
-
-        case MONTH_JULY:
-          characters = snprintf(dest, dest_size, "Jul");
-          break;
-
-        case MONTH_AUGUST:
-          characters = snprintf(dest, dest_size, "Aug");
-          break;
-
-        case MONTH_SEPTEMBER:
-          characters = snprintf(dest, dest_size, "Sep");
-          break;
-
-        case MONTH_OCTOBER:
-          characters = snprintf(dest, dest_size, "Oct");
-          break;
-
-        case MONTH_NOVEMBER:
-          characters = snprintf(dest, dest_size, "Nov");
-          break;
-
-        case MONTH_DECEMBER:
-          characters = snprintf(dest, dest_size, "Dec");
-          break;
-
-        default:
-          (void)strcpy(dest, "");
-          break;
-      }
-
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_MON);
       break;
 
     case C_TIME_STAMP_DAY_LETTER:
-      stringSize = 3 * sizeof(char);
-      characters = snprintf(dest, dest_size, "%02d", (timeStampData->tm_mday));
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_DAY);
       break;
 
     case C_TIME_STAMP_DAYN_LETTER:
-      stringSize = 3 * sizeof(char);
-      switch (timeStampData->tm_wday) {
-        case DAY_SUNDAY:
-          characters = snprintf(dest, dest_size, "Sun");
-          break;
-
-        case DAY_MONDAY:
-          characters = snprintf(dest, dest_size, "Mon");
-          break;
-
-        case DAY_TUESDAY:
-          characters = snprintf(dest, dest_size, "Tue");
-          break;
-
-        case DAY_WEDNESDAY:
-          characters = snprintf(dest, dest_size, "Wed");
-          break;
-
-        case DAY_THURSDAY:
-          characters = snprintf(dest, dest_size, "Thu");
-          break;
-
-        case DAY_FRIDAY:
-          characters = snprintf(dest, dest_size, "Fri");
-          break;
-
-        case DAY_SATURDAY:
-          characters = snprintf(dest, dest_size, "Sat");
-          break;
-
-        default:
-          (void)strcpy(dest, "");
-          break;
-      }
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_DAYN);
       break;
 
     case C_TIME_STAMP_YEAR_LETTER:
-      stringSize = 3 * sizeof(char);
-      characters = strftime(dest, dest_size, "%y", timeStampData);
+      /* Like strftime(), nothing is written if the year does not fit */
+      if (timeStamp->length[TIME_YEAR] < dest_size)
+        characters = copyTimeField(dest, dest_size, timeStamp, TIME_YEAR);
       break;
 
     case C_TIME_STAMP_FULL_YEAR_LETTER:
-      stringSize = 5 * sizeof(char);
-      characters = strftime(dest, dest_size, "%Y", timeStampData);
+      if (timeStamp->length[TIME_FULL_YEAR] < dest_size)
+        characters =
+            copyTimeField(dest, dest_size, timeStamp, TIME_FULL_YEAR);
       break;
 
     case C_TIME_MILLISECOND_LETTER:
-      stringSize = 4 * sizeof(char);
       /* Extract millisecond from logTimestamp */
-      ms = (logRecord->logTimeStamp / SA_TIME_ONE_MILLISECOND) % SA_TIME_OFFSET;
-      characters = snprintf(dest, dest_size, "%03lld", ms);
+      characters = copyMilliseconds(dest, dest_size, logRecord->logTimeStamp);
       break;
 
     case C_TIME_TIMEZONE_LETTER:
-      stringSize = 6 * sizeof(char);
-      /* Get timezone offset from localtime to UTC time */
-      gmtOffset =
-          (timeStampData->tm_gmtoff / SECOND_PER_HOUR) * 100 +
-          (timeStampData->tm_gmtoff % SECOND_PER_HOUR) / SECOND_PER_MINUTE;
-
-      uGmtOffset = (gmtOffset >= 0) ? (gmtOffset) : (gmtOffset * -1);
-      characters = snprintf(dest, dest_size, "%c%04ld",
-                            gmtOffset >= 0 ? '+' : '-', uGmtOffset);
+      characters = copyTimeField(dest, dest_size, timeStamp, TIME_TIMEZONE);
       break;
 
     case C_NOTIFICATION_CLASS_ID_LETTER:
-      stringSize = 30 * sizeof(char);
       if (logRecord->logHdrType == SA_LOG_GENERIC_HEADER) {
         characters = snprintf(
             dest, dest_size, "NCI[0x%#08x,0x%#04x,0x%#04x]",
@@ -759,7 +776,6 @@ static int extractCommonField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
       break;
 
     case C_LR_TRUNCATION_INFO_LETTER:
-      stringSize = 2 * sizeof(char);
       /* A space inserted at the truncationCharacter:s position */
       characters = snprintf(dest, dest_size, " ");
       if ((inputPos + 1) == rec_size)
@@ -770,7 +786,6 @@ static int extractCommonField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
       break;
 
     case C_LR_STRING_BODY_LETTER:
-      fieldSize = checkFieldSize(fmtExpPtr, &fieldSizeOffset);
       stringSize = logRecord->logBuffer->logBufSize + 1;
       if (fieldSize == 0) { /* Copy whole body */
         if (stringSize > dest_size) stringSize = dest_size;
@@ -781,13 +796,10 @@ static int extractCommonField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
             snprintf(dest, dest_size, "%*.*s", (int)-fieldSize, (int)fieldSize,
                      (SaStringT)logRecord->logBuffer->logBuf);
       }
-
-      *fmtExpPtrOffset = *fmtExpPtrOffset + fieldSizeOffset;
       break;
 
     case C_LR_HEX_CHAR_BODY_LETTER:
       stringSize = logRecord->logBuffer->logBufSize;
-      fieldSize = checkFieldSize(fmtExpPtr, &fieldSizeOffset);
       hex_string = static_cast<char *>(malloc(2 * stringSize + 1));
 
       if (hex_string == NULL) {
@@ -809,19 +821,16 @@ static int extractCommonField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
         characters = snprintf(dest, dest_size, "%*.*s", (int)fieldSize,
                               (int)fieldSize, hex_string);
       }
-      *fmtExpPtrOffset = *fmtExpPtrOffset + fieldSizeOffset;
       free(hex_string);
       break;
 
     case C_NETWORK_NAME_LETTER:
       characters =
           snprintf(dest, dest_size, "%s", lgs_get_networkname().c_str());
-      stringSize = characters;
       break;
 
     case C_NODE_NAME_LETTER:
       characters = snprintf(dest, dest_size, "%s", node_name);
-      stringSize = characters;
       break;
 
     default:
@@ -839,38 +848,24 @@ static int extractCommonField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
 
 /**
  *
- * @param fmtExpPtr
- * @param fmtExpPtrOffset
- * @param twelveHourModeFlag
+ * @param op
  * @param commonData
  * @param ntfHeader
  *
  * @return SaStringT
  */
 static int extractNotificationField(char *dest, size_t dest_size,
-                                    SaStringT fmtExpPtr,
-                                    SaUint16T *fmtExpPtrOffset,
-                                    const SaBoolT *twelveHourModeFlag,
+                                    const lgs_fmt_op_t *op,
                                     const SaLogRecordT *logRecord) {
-  struct tm *eventTimeData;
-  SaTimeT totalTime, ms;
-  SaInt32T fieldSize;
+  const timeFieldsT *eventTime;
+  SaInt32T fieldSize = op->fieldSize;
   SaInt32T characters = 0;
-  SaUint16T fieldSizeOffset = 0;
-  long gmtOffset = 0, uGmtOffset = 0;
 
-  *fmtExpPtrOffset = DEFAULT_FMT_EXP_PTR_OFFSET;
-
-  /* Convert event time into */
-  totalTime =
-      (logRecord->logHeader.ntfHdr.eventTime / (SaTimeT)SA_TIME_ONE_SECOND);
-
-  /* Split timestamp in timeStampData */
-  struct tm tm_info;
-  eventTimeData = localtime_r((const time_t *)&totalTime, &tm_info);
-  osafassert(eventTimeData);
+  /* Split event time in eventTime */
+  eventTime =
+      getTimeFields(&eventTimeFields, logRecord->logHeader.ntfHdr.eventTime);
 
-  switch (*fmtExpPtr++) {
+  switch (op->tokenLetter) {
     case N_NOTIFICATION_ID_LETTER:
       characters = snprintf(dest, dest_size, "0x%#016llx",
                             logRecord->logHeader.ntfHdr.notificationId);
@@ -882,162 +877,57 @@ static int extractNotificationField(char *dest, size_t dest_size,
       break;
 
     case N_EVENT_TIME_HOUR_LETTER:
-      if (*twelveHourModeFlag == SA_TRUE) {
-        characters =
-            snprintf(dest, dest_size, "%02d", (eventTimeData->tm_hour % 12));
-      } else {
-        characters = snprintf(dest, dest_size, "%02d", eventTimeData->tm_hour);
-      }
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_HOUR);
       break;
 
     case N_EVENT_TIME_MINUTE_LETTER:
-      characters = snprintf(dest, dest_size, "%02d", eventTimeData->tm_min);
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_MINUTE);
       break;
 
     case N_EVENT_TIME_SECOND_LETTER:
-      characters = snprintf(dest, dest_size, "%02d", eventTimeData->tm_sec);
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_SECOND);
       break;
 
     case N_EVENT_TIME_12_24_MODE_LETTER:
-      if (eventTimeData->tm_hour >= 00 && eventTimeData->tm_hour < 12) {
-        characters = snprintf(dest, dest_size, "am");
-      } else {
-        characters = snprintf(dest, dest_size, "pm");
-      }
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_12_24_MODE);
       break;
 
     case N_EVENT_TIME_MONTH_LETTER:
-      characters =
-          snprintf(dest, dest_size, "%02d", (eventTimeData->tm_mon + 1));
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_MONTH);
       break;
 
     case N_EVENT_TIME_MON_LETTER:
-      switch (eventTimeData->tm_mon) {
-        case MONTH_JANUARY:
-          characters = snprintf(dest, dest_size, "Jan");
-          break;
-
-        case MONTH_FEBRUARY:
-          characters = snprintf(dest, dest_size, "Feb");
-          break;
-
-        case MONTH_MARCH:
-          characters = snprintf(dest, dest_size, "Mar");
-          break;
-
-        case MONTH_APRIL:
-          characters = snprintf(dest, dest_size, "Apr");
-          break;
-
-        case MONTH_MAY:
-          characters = snprintf(dest, dest_size, "May");
-          break;
-
-        case MONTH_JUNE:
-          characters = snprintf(dest, dest_size, "Jun");
-          break;
-
-        case MONTH_JULY:
-          characters = snprintf(dest, dest_size, "Jul");
-          break;
-
-        case MONTH_AUGUST:
-          characters = snprintf(dest, dest_size, "Aug");
-          break;
-
-        case MONTH_SEPTEMBER:
-          characters = snprintf(dest, dest_size, "Sep");
-          break;
-
-        case MONTH_OCTOBER:
-          characters = snprintf(dest, dest_size, "Oct");
-          break;
-
-        case MONTH_NOVEMBER:
-          characters = snprintf(dest, dest_size, "Nov");
-          break;
-
-        case MONTH_DECEMBER:
-          characters = snprintf(dest, dest_size, "Dec");
-          break;
-
-        default:
-          (void)strcpy(dest, "");
-          break;
-      }
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_MON);
       break;
 
     case N_EVENT_TIME_DAY_LETTER:
-      characters = snprintf(dest, dest_size, "%02d", (eventTimeData->tm_mday));
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_DAY);
       break;
 
     case N_EVENT_TIME_DAYN_LETTER:
-      switch (eventTimeData->tm_wday) {
-        case DAY_SUNDAY:
-          characters = snprintf(dest, dest_size, "Sun");
-          break;
-
-        case DAY_MONDAY:
-          characters = snprintf(dest, dest_size, "Mon");
-          break;
-
-        case DAY_TUESDAY:
-          characters = snprintf(dest, dest_size, "Tue");
-          break;
-
-        case DAY_WEDNESDAY:
-          characters = snprintf(dest, dest_size, "Wed");
-          break;
-
-        case DAY_THURSDAY:
-          characters = snprintf(dest, dest_size, "Thu");
-          break;
-
-        case DAY_FRIDAY:
-          characters = snprintf(dest, dest_size, "Fri");
-          break;
-
-        case DAY_SATURDAY:
-          characters = snprintf(dest, dest_size, "Sat");
-          break;
-
-        default:
-          (void)strcpy(dest, "");
-          break;
-      }
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_DAYN);
       break;
 
     case N_EVENT_TIME_YEAR_LETTER:
-      characters = snprintf(dest, dest_size, "%02d",
-                            eventTimeData->tm_year - (YEAR_2000 - START_YEAR));
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_NTF_YEAR);
       break;
 
     case N_EVENT_TIME_FULL_YEAR_LETTER:
-      characters = snprintf(dest, dest_size, "%d",
-                            (eventTimeData->tm_year + START_YEAR));
+      characters =
+          copyTimeField(dest, dest_size, eventTime, TIME_NTF_FULL_YEAR);
       break;
 
     case N_EVENT_TIME_MILLISECOND_LETTER:
       /* Extract millisecond from logTimestamp */
-      ms = (logRecord->logHeader.ntfHdr.eventTime / SA_TIME_ONE_MILLISECOND) %
-           SA_TIME_OFFSET;
-      characters = snprintf(dest, dest_size, "%03lld", ms);
+      characters = copyMilliseconds(dest, dest_size,
+                                    logRecord->logHeader.ntfHdr.eventTime);
       break;
 
     case N_EVENT_TIME_TIMEZONE_LETTER:
-      /* Get time offset from localtime to UTC */
-      gmtOffset =
-          (eventTimeData->tm_gmtoff / SECOND_PER_HOUR) * 100 +
-          (eventTimeData->tm_gmtoff % SECOND_PER_HOUR) / SECOND_PER_MINUTE;
-
-      uGmtOffset = (gmtOffset >= 0) ? (gmtOffset) : (gmtOffset * -1);
-      characters = snprintf(dest, dest_size, "%c%04ld",
-                            gmtOffset >= 0 ? '+' : '-', uGmtOffset);
+      characters = copyTimeField(dest, dest_size, eventTime, TIME_TIMEZONE);
       break;
 
     case N_EVENT_TYPE_LETTER:
-      /* Check field size */
-      fieldSize = checkFieldSize(fmtExpPtr, &fieldSizeOffset);
       if (fieldSize == 0) {
         characters = snprintf(dest, dest_size, "%#x",
                               logRecord->logHeader.ntfHdr.eventType);
@@ -1049,13 +939,10 @@ static int extractNotificationField(char *dest, size_t dest_size,
         characters = snprintf(dest, dest_size, "%#.*x", fieldSize,
                               logRecord->logHeader.ntfHdr.eventType);
       }
-
-      *fmtExpPtrOffset = *fmtExpPtrOffset + fieldSizeOffset;
       break;
 
     case N_NOTIFICATION_OBJECT_LETTER:
-      /* Check field size and trunkate alternative pad with blanks */
-      fieldSize = checkFieldSize(fmtExpPtr, &fieldSizeOffset);
+      /* Trunkate alternative pad with blanks */
       if (fieldSize == 0) {
         characters =
             snprintf(dest, dest_size, "%s",
@@ -1067,13 +954,10 @@ static int extractNotificationField(char *dest, size_t dest_size,
                      osaf_extended_name_borrow(
                          logRecord->logHeader.ntfHdr.notificationObject));
       }
-
-      *fmtExpPtrOffset = *fmtExpPtrOffset + fieldSizeOffset;
       break;
 
     case N_NOTIFYING_OBJECT_LETTER:
-      /* Check field size and trunkate alternative pad with blanks */
-      fieldSize = checkFieldSize(fmtExpPtr, &fieldSizeOffset);
+      /* Trunkate alternative pad with blanks */
       if (fieldSize == 0) {
         characters = snprintf(dest, dest_size, "%s",
                               osaf_extended_name_borrow(
@@ -1084,8 +968,6 @@ static int extractNotificationField(char *dest, size_t dest_size,
                      osaf_extended_name_borrow(
                          logRecord->logHeader.ntfHdr.notifyingObject));
       }
-
-      *fmtExpPtrOffset = *fmtExpPtrOffset + fieldSizeOffset;
       break;
 
     default:
@@ -1103,24 +985,20 @@ static int extractNotificationField(char *dest, size_t dest_size,
 
 /**
  *
- * @param fmtExpPtr
- * @param fmtExpPtrOffset
+ * @param op
  * @param commonData
  * @param genHeader
  *
  * @return SaStringT
  */
-static int extractSystemField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
-                              SaUint16T *fmtExpPtrOffset,
+static int extractSystemField(char *dest, size_t dest_size,
+                              const lgs_fmt_op_t *op,
                               const SaLogRecordT *logRecord) {
-  SaInt32T fieldSize;
+  SaInt32T fieldSize = op->fieldSize;
   SaInt32T characters = 0;
-  SaUint16T fieldSizeOffset = 0;
-  *fmtExpPtrOffset = DEFAULT_FMT_EXP_PTR_OFFSET;
 
-  switch (*fmtExpPtr++) { /* input points to a possible field size */
+  switch (op->tokenLetter) {
     case S_LOGGER_NAME_LETTER:
-      fieldSize = checkFieldSize(fmtExpPtr, &fieldSizeOffset);
       if (fieldSize != 0) {
         characters =
             snprintf(dest, dest_size, "%*.*s", (int)-fieldSize, (int)fieldSize,
@@ -1132,7 +1010,6 @@ static int extractSystemField(char *dest, size_t dest_size, SaStringT fmtExpPtr,
                      osaf_extended_name_borrow(
                          logRecord->logHeader.genericHdr.logSvcUsrName));
       }
-      *fmtExpPtrOffset = *fmtExpPtrOffset + fieldSizeOffset;
       break;
 
     case S_SEVERITY_ID_LETTER:
@@ -1262,6 +1139,87 @@ SaBoolT lgs_is_valid_format_expression(const SaStringT formatExpression,
   return formatExpressionOk;
 }
 
+/**
+ * Compile a format expression into the operations emitting a log record.
+ * Literal characters between tokens are collected into one operation and the
+ * field size of a token is parsed once, so that a log record is formatted
+ * without scanning the format expression again.
+ *
+ * @param formatExpression a format expression, validated by
+ *        lgs_is_valid_format_expression()
+ * @param program[out] the compiled format expression
+ *
+ * @return false if the format expression contains an invalid field type
+ */
+bool lgs_compile_format_expression(const char *formatExpression,
+                                   lgs_fmt_program_t *program) {
+  const char *fmtExpPtr = formatExpression;
+  lgs_fmt_op_t op;
+
+  program->expression = formatExpression;
+  program->ops.clear();
+  program->valid = true;
+
+  while (*fmtExpPtr != STRING_END_CHARACTER) {
+    if ((*fmtExpPtr == TOKEN_START_SYMBOL) &&
+        (fmtExpPtr[1] != STRING_END_CHARACTER)) {
+      SaUint16T fieldSizeOffset = 0;
+
+      op.fieldType = fmtExpPtr[1];
+      op.tokenLetter = fmtExpPtr[2];
+      op.last = false;
+      op.fieldSize = 0;
+      op.offset = fmtExpPtr - formatExpression;
+      op.length = 0;
+
+      if ((op.fieldType != COMMON_LOG_RECORD_FIELD_TYPE) &&
+          (op.fieldType != NOTIFICATION_LOG_RECORD_FIELD_TYPE) &&
+          (op.fieldType != SYSTEM_LOG_RECORD_FIELD_TYPE)) {
+        TRACE("Invalid token %u", op.fieldType);
+        program->valid = false;
+        break;
+      }
+      if (op.tokenLetter == STRING_END_CHARACTER) break;
+
+      /* Tokens having a field size */
+      if (((op.fieldType == COMMON_LOG_RECORD_FIELD_TYPE) &&
+           ((op.tokenLetter == C_LR_STRING_BODY_LETTER) ||
+            (op.tokenLetter == C_LR_HEX_CHAR_BODY_LETTER))) ||
+          ((op.fieldType == NOTIFICATION_LOG_RECORD_FIELD_TYPE) &&
+           ((op.tokenLetter == N_EVENT_TYPE_LETTER) ||
+            (op.tokenLetter == N_NOTIFICATION_OBJECT_LETTER) ||
+            (op.tokenLetter == N_NOTIFYING_OBJECT_LETTER))) ||
+          ((op.fieldType == SYSTEM_LOG_RECORD_FIELD_TYPE) &&
+           (op.tokenLetter == S_LOGGER_NAME_LETTER))) {
+        op.fieldSize = checkFieldSize(
+            const_cast<SaStringT>(&fmtExpPtr[DEFAULT_FMT_EXP_PTR_OFFSET]),
+            &fieldSizeOffset);
+      }
+
+      program->ops.push_back(op);
+      fmtExpPtr += DEFAULT_FMT_EXP_PTR_OFFSET + fieldSizeOffset;
+    } else { /* All chars between tokens */
+      if (program->ops.empty() || (program->ops.back().fieldType != '\0')) {
+        op.fieldType = '\0';
+        op.tokenLetter = '\0';
+        op.last = false;
+        op.fieldSize = 0;
+        op.offset = fmtExpPtr - formatExpression;
+        op.length = 0;
+        program->ops.push_back(op);
+      }
+      program->ops.back().length++;
+
+      if (fmtExpPtr[1] == STRING_END_CHARACTER) {
+        program->ops.back().last = true;
+      }
+      fmtExpPtr += LITTERAL_CHAR_OFFSET;
+    }
+  }
+
+  return program->valid;
+}
+
 /**
  * Format a log record
  *
@@ -1279,15 +1237,37 @@ int lgs_format_log_record(SaLogRecordT *logRecord,
                           SaUint64T logFileSize, SaUint16T fixedLogRecordSize,
                           size_t dest_size, char *dest,
                           SaUint32T logRecordIdCounter, char *node_name) {
-  SaStringT fmtExpPtr = &formatExpression[0];
-  SaStringT fmtExpPtrSnabel = &formatExpression[1];
-  SaTimeT totalTime;
+  /* Compiled format of the last caller not having a program of its own */
+  static lgs_fmt_program_t program;
+
+  return lgs_format_log_record(&program, logRecord, formatExpression,
+                               logFileSize, fixedLogRecordSize, dest_size,
+                               dest, logRecordIdCounter, node_name);
+}
+
+/**
+ * Format a log record using a compiled format expression. The format
+ * expression is compiled into program if program was compiled from another
+ * expression, e.g. when the format of the stream has been changed.
+ *
+ * @param program compiled format expression, kept by the caller
+ * @param logRecord
+ * @param formatExpression format string
+ * @param fixedLogRecordSize if 0 do not pad
+ * @param dest_size size of dest
+ * @param dest write at most dest_size bytes to dest
+ * @param logRecordIdCounter
+ *
+ * @return int number of bytes written to dest
+ */
+int lgs_format_log_record(lgs_fmt_program_t *program, SaLogRecordT *logRecord,
+                          const SaStringT formatExpression,
+                          SaUint64T logFileSize, SaUint16T fixedLogRecordSize,
+                          size_t dest_size, char *dest,
+                          SaUint32T logRecordIdCounter, char *node_name) {
   SaInt8T truncationCharacter = (SaInt8T)COMPLETED_LOG_RECORD;
-  SaUint16T fmtExpTokenOffset = 1;
   SaInt32T truncationLetterPos = -1;
-  struct tm *timeStampData;
-  SaBoolT _twelveHourModeFlag = SA_FALSE;
-  const SaBoolT *twelveHourModeFlag = &_twelveHourModeFlag;
+  const timeFieldsT *timeStamp;
   size_t i = 0;
   SaUint16T rec_size = dest_size;
 
@@ -1295,57 +1275,47 @@ int lgs_format_log_record(SaLogRecordT *logRecord,
     goto error_exit;
   }
 
+  if (program->expression != formatExpression) {
+    lgs_compile_format_expression(formatExpression, program);
+  }
+  if (!program->valid) {
+    goto error_exit;
+  }
+
   /* Init output vector with a '\0' */
   (void)strcpy(dest, "");
 
-  totalTime = (logRecord->logTimeStamp / (SaTimeT)SA_TIME_ONE_SECOND);
-
-  /* Split timestamp in timeStampData */
-  struct tm tm_info;
-  timeStampData = localtime_r((const time_t *)&totalTime, &tm_info);
-  osafassert(timeStampData);
+  timeStamp = getTimeFields(&logTimeStampFields, logRecord->logTimeStamp);
 
   /* Main formatting loop */
-  for (;;) {
-    /* Scan the Format Expression */
-    if ((*fmtExpPtr == TOKEN_START_SYMBOL) &&
-        (*fmtExpPtrSnabel != STRING_END_CHARACTER)) {
-      switch (*fmtExpPtrSnabel++) {
-        /* Check log record field types if a new token is present */
-        case COMMON_LOG_RECORD_FIELD_TYPE:
-          i += extractCommonField(&dest[i], dest_size - i, fmtExpPtrSnabel,
-                                  &fmtExpTokenOffset, &truncationLetterPos,
-                                  (SaInt32T)strlen(dest), logRecordIdCounter,
-                                  twelveHourModeFlag, timeStampData, logRecord,
-                                  rec_size, node_name);
-          break;
-
-        case NOTIFICATION_LOG_RECORD_FIELD_TYPE:
-          i += extractNotificationField(&dest[i], dest_size - i,
-                                        fmtExpPtrSnabel, &fmtExpTokenOffset,
-                                        twelveHourModeFlag, logRecord);
-          break;
-
-        case SYSTEM_LOG_RECORD_FIELD_TYPE:
-          i += extractSystemField(&dest[i], dest_size - i, fmtExpPtrSnabel,
-                                  &fmtExpTokenOffset, logRecord);
-          break;
-
-        default:
-          TRACE("Invalid token %u", *(fmtExpPtrSnabel - 1));
-          i = 0;
-          goto error_exit;
-      }
-
-    } else { /* All chars between tokens */
-      fmtExpTokenOffset = 1;
-      /* Insert litteral chars i.e. [:, ,/ and "] */
-      if (i < dest_size) {
-        dest[i++] = *fmtExpPtr;
+  for (const lgs_fmt_op_t &op : program->ops) {
+    switch (op.fieldType) {
+      case COMMON_LOG_RECORD_FIELD_TYPE:
+        i += extractCommonField(&dest[i], dest_size - i, &op,
+                                &truncationLetterPos, (SaInt32T)i,
+                                logRecordIdCounter, timeStamp, logRecord,
+                                rec_size, node_name);
+        break;
+
+      case NOTIFICATION_LOG_RECORD_FIELD_TYPE:
+        i += extractNotificationField(&dest[i], dest_size - i, &op, logRecord);
+        break;
+
+      case SYSTEM_LOG_RECORD_FIELD_TYPE:
+        i += extractSystemField(&dest[i], dest_size - i, &op, logRecord);
+        break;
+
+      default: { /* Insert litteral chars i.e. [:, ,/ and "] */
+        size_t length = op.length;
+
+        if (length > dest_size - i) length = dest_size - i;
+        memcpy(&dest[i], &program->expression[op.offset], length);
+        i += length;
+
+        /* The last character of the format expression fits */
+        if (op.last && (length == op.length)) goto format_done;
+        break;
       }
-
-      if (*fmtExpPtrSnabel == STRING_END_CHARACTER)
-        break; /* End of formatExpression */
     }
 
     if (i >= dest_size) {
@@ -1353,14 +1323,9 @@ int lgs_format_log_record(SaLogRecordT *logRecord,
       truncationCharacter = (SaInt8T)TRUNCATED_LOG_RECORD;
       break;
     }
+  }
 
-    /* Step forward */
-    fmtExpPtr += fmtExpTokenOffset;
-    if (*fmtExpPtr == STRING_END_CHARACTER) break; /* End of formatExpression */
-
-    fmtExpPtrSnabel = (fmtExpPtr + 1);
-  } /* for ( ; ; ) */
-
+format_done:
   /* Pad log record to fixed log record fieldSize */
   if ((fixedLogRecordSize > 0) && (i < fixedLogRecordSize)) {
     memset(&dest[i], ' ', fixedLogRecordSize - i);
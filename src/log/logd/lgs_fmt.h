@@ -20,6 +20,8 @@
 
 #include <saAis.h>
 #include <saLog.h>
+#include <string>
+#include <vector>
 
 #define TOKEN_START_SYMBOL '@'
 #define STRING_END_CHARACTER '\0'
@@ -181,11 +183,40 @@ typedef enum {
   STREAM_TYPE_APPLICATION_CFG = 5
 } logStreamTypeT;
 
+/**
+ * One operation of a compiled format expression. A literal operation copies
+ * the characters between two tokens, a field operation emits one token.
+ */
+typedef struct {
+  char fieldType;     /* C, N or S for a field, '\0' for a literal */
+  char tokenLetter;   /* Token letter of a field */
+  bool last;          /* Literal ends the format expression */
+  SaInt32T fieldSize; /* Field size of a field, 0 if not given */
+  SaUint16T offset;   /* Position of a literal in the format expression */
+  SaUint16T length;   /* Number of characters of a literal */
+} lgs_fmt_op_t;
+
+/**
+ * A format expression compiled into the operations emitting a log record.
+ * The expression is kept to detect when the format of a stream is changed.
+ */
+typedef struct {
+  std::string expression;
+  bool valid;
+  std::vector<lgs_fmt_op_t> ops;
+} lgs_fmt_program_t;
+
 extern SaBoolT lgs_is_valid_format_expression(const SaStringT, logStreamTypeT,
                                               SaBoolT *);
+extern bool lgs_compile_format_expression(const char *formatExpression,
+                                          lgs_fmt_program_t *program);
 extern int lgs_format_log_record(SaLogRecordT *, const SaStringT,
                                  SaUint64T logFileSize,
                                  SaUint16T fixedLogRecordSize, size_t dest_size,
                                  char *dest, SaUint32T, char *node_name);
+extern int lgs_format_log_record(lgs_fmt_program_t *program, SaLogRecordT *,
+                                 const SaStringT, SaUint64T logFileSize,
+                                 SaUint16T fixedLogRecordSize, size_t dest_size,
+                                 char *dest, SaUint32T, char *node_name);
 
 #endif  // LOG_LOGD_LGS_FMT_H_
@@ -46,6 +46,7 @@
 #include "log/logd/lgs_oi_admin.h"
 #include "log/logd/lgs_imm.h"
 #include "log/logd/lgs_cache.h"
+#include "log/logd/lgs_mbcsv_v10.h"
 
 /* ========================================================================
  *   DEFINITIONS
@@ -549,6 +550,10 @@ int main(int argc, char *argv[]) {
 
 
     int timeout = Cache::instance()->GeneratePollTimeout(last);
+    int ckpt_timeout = CkptWritePollTimeout();
+    if (ckpt_timeout != -1 && (timeout == -1 || ckpt_timeout < timeout)) {
+      timeout = ckpt_timeout;
+    }
     int ret = poll(fds, nfds, timeout);
 
     if (ret == -1) {
@@ -558,9 +563,14 @@ int main(int argc, char *argv[]) {
       break;
     }
 
+    /* Send the write checkpoints that have been queued long enough */
+    if (CkptWritePollTimeout() == 0) CkptWriteFlush();
+
     if (ret == 0) {
-      Cache::instance()->PeriodicCheck();
-      last = base::ReadMonotonicClock();
+      if (Cache::instance()->GeneratePollTimeout(last) == 0) {
+        Cache::instance()->PeriodicCheck();
+        last = base::ReadMonotonicClock();
+      }
       num_events = 0;
       continue;
     }
@@ -23,6 +23,7 @@
 
 #include "osaf/immutil/immutil.h"
 #include "log/logd/lgs_dest.h"
+#include "log/logd/lgs_mbcsv_v10.h"
 #include "log/logd/lgs_mbcsv_v9.h"
 #include "log/logd/lgs_mbcsv_v8.h"
 #include "log/logd/lgs_mbcsv_v6.h"
@@ -113,7 +114,9 @@ static LGS_CKPT_HDLR ckpt_data_handler[] = {
     ckpt_proc_lgs_cfg_v5,
     ckpt_proc_push_async,
     ckpt_proc_pop_async,
-    ckpt_proc_pop_write_async
+    ckpt_proc_pop_write_async,
+    ckpt_proc_write_marks,
+    ckpt_proc_write_batch
 };
 
 /****************************************************************************
@@ -451,6 +454,9 @@ uint32_t lgs_mbcsv_change_HA_state(lgs_cb_t *cb, SaAmfHAStateT ha_state) {
   TRACE_ENTER();
   NCS_MBCSV_ARG mbcsv_arg;
 
+  /* Write checkpoints queued as active are sent before changing role */
+  CkptWriteFlush();
+
   memset(&mbcsv_arg, '\0', sizeof(NCS_MBCSV_ARG));
 
   /* Set the mbcsv args */
@@ -589,6 +595,14 @@ bool lgs_is_peer_v9() {
   return (lgs_cb->mbcsv_peer_version >= LGS_MBCSV_VERSION_9);
 }
 
+/**
+ * Check if peer is version 10 (or later)
+ * @return bool
+ */
+bool lgs_is_peer_v10() {
+  return (lgs_cb->mbcsv_peer_version >= LGS_MBCSV_VERSION_10);
+}
+
 /**
  * Check if configured for split file system.
  * If other node is version 1 split file system mode is not applicable.
@@ -1621,6 +1635,20 @@ static uint32_t ckpt_decode_async_update(lgs_cb_t *cb,
         goto done;
       }
       break;
+    case LGS_CKPT_WRITE_MARKS:
+      TRACE("LGS_CKPT_WRITE_MARKS");
+      rc = DecodeWriteMarks(cb, ckpt_msg, cbk_arg);
+      if (rc != NCSCC_RC_SUCCESS) {
+        goto done;
+      }
+      break;
+    case LGS_CKPT_WRITE_BATCH:
+      TRACE("LGS_CKPT_WRITE_BATCH");
+      rc = DecodeWriteBatch(cb, ckpt_msg, cbk_arg);
+      if (rc != NCSCC_RC_SUCCESS) {
+        goto done;
+      }
+      break;
     default:
       rc = NCSCC_RC_FAILURE;
       TRACE("\tFAILED Unknown ckpt record type");
@@ -2086,9 +2114,9 @@ static void insert_localmsg_in_stream(log_stream_t *stream, char *message) {
 
   /* Format the log record */
   if ((n = lgs_format_log_record(
-           &log_record, stream->logFileFormat, stream->maxLogFileSize,
-           stream->fixedLogRecordSize, buf_size, logOutputString, LOG_REC_ID,
-           host_name)) == 0) {
+           &stream->fmtProgram, &log_record, stream->logFileFormat,
+           stream->maxLogFileSize, stream->fixedLogRecordSize, buf_size,
+           logOutputString, LOG_REC_ID, host_name)) == 0) {
     LOG_ER("%s - Could not format internal log record", __FUNCTION__);
     goto done;
   }
@@ -2113,9 +2141,9 @@ static void insert_localmsg_in_stream(log_stream_t *stream, char *message) {
 
       /* Format the log record */
       if ((n = lgs_format_log_record(
-               &log_record, stream->logFileFormat, stream->maxLogFileSize,
-               stream->fixedLogRecordSize, buf_size, logOutputString,
-               LOG_REC_ID, host_name)) == 0) {
+               &stream->fmtProgram, &log_record, stream->logFileFormat,
+               stream->maxLogFileSize, stream->fixedLogRecordSize, buf_size,
+               logOutputString, LOG_REC_ID, host_name)) == 0) {
         LOG_ER("%s - Could not format internal log record", __FUNCTION__);
       }
     }
@@ -2852,6 +2880,11 @@ uint32_t lgs_ckpt_send_async(lgs_cb_t *cb, void *ckpt_rec, uint32_t action) {
     lgsv_ckpt_msg_v9_t *ckpt_rec_v9 =
         static_cast<lgsv_ckpt_msg_v9_t *>(ckpt_rec);
     ckpt_rec_type = ckpt_rec_v9->header.ckpt_rec_type;
+    /* Keep the order between queued write checkpoints and this one */
+    if ((ckpt_rec_type != LGS_CKPT_WRITE_MARKS) &&
+        (ckpt_rec_type != LGS_CKPT_WRITE_BATCH)) {
+      CkptWriteFlush();
+    }
   } else if (lgs_is_peer_v8()) {
     lgsv_ckpt_msg_v8_t *ckpt_rec_v8 =
         static_cast<lgsv_ckpt_msg_v8_t *>(ckpt_rec);
@@ -3163,7 +3196,9 @@ int32_t ckpt_msg_test_type(NCSCONTEXT arg) {
     LCL_TEST_JUMP_OFFSET_LGS_CKPT_LGS_CFG,
     LCL_TEST_JUMP_OFFSET_LGS_CKPT_PUSH_ASYNC,
     LCL_TEST_JUMP_OFFSET_LGS_CKPT_POP_ASYNC,
-    LCL_TEST_JUMP_OFFSET_LGS_CKPT_POP_WRITE_ASYNC
+    LCL_TEST_JUMP_OFFSET_LGS_CKPT_POP_WRITE_ASYNC,
+    LCL_TEST_JUMP_OFFSET_LGS_CKPT_WRITE_MARKS,
+    LCL_TEST_JUMP_OFFSET_LGS_CKPT_WRITE_BATCH
   };
   lgsv_ckpt_msg_type_t ckpt_rec_type;
 
@@ -3195,6 +3230,10 @@ int32_t ckpt_msg_test_type(NCSCONTEXT arg) {
       return LCL_TEST_JUMP_OFFSET_LGS_CKPT_POP_ASYNC;
     case LGS_CKPT_POP_WRITE_ASYNC:
       return LCL_TEST_JUMP_OFFSET_LGS_CKPT_POP_WRITE_ASYNC;
+    case LGS_CKPT_WRITE_MARKS:
+      return LCL_TEST_JUMP_OFFSET_LGS_CKPT_WRITE_MARKS;
+    case LGS_CKPT_WRITE_BATCH:
+      return LCL_TEST_JUMP_OFFSET_LGS_CKPT_WRITE_BATCH;
     default:
       return EDU_EXIT;
       break;
@@ -3268,7 +3307,10 @@ uint32_t dec_ckpt_header(NCS_UBAID *uba, lgsv_ckpt_header_t *header) {
 
 void lgs_ckpt_log_async(log_stream_t* stream, char* record) {
   void *ckpt_ptr = nullptr;
-  if (lgs_cb->ha_state == SA_AMF_HA_ACTIVE) {
+  if (lgs_cb->ha_state == SA_AMF_HA_ACTIVE && lgs_is_peer_v10()) {
+    /* Sent in batches, see lgs_mbcsv_v10.h */
+    CkptWriteQueue(stream, record);
+  } else if (lgs_cb->ha_state == SA_AMF_HA_ACTIVE) {
     lgsv_ckpt_msg_v1_t ckpt_v1;
     lgsv_ckpt_msg_v2_t ckpt_v2;
     lgsv_ckpt_msg_v8_t ckpt_v8;
@@ -35,6 +35,9 @@
  *            supported on both nodes. For the moment check-pointing is not
  *            changed from version 2. Instead the configuration object is always
  *            read when changing from standby to active.
+ * Version 10: Log writes are check-pointed in batches, LGS_CKPT_WRITE_MARKS
+ *            and LGS_CKPT_WRITE_BATCH. The version 9 message structure is
+ *            used for all other check-point messages.
  */
 #define LGS_MBCSV_VERSION_1 1
 #define LGS_MBCSV_VERSION_2 2
@@ -44,9 +47,10 @@
 #define LGS_MBCSV_VERSION_7 7
 #define LGS_MBCSV_VERSION_8 8
 #define LGS_MBCSV_VERSION_9 9
+#define LGS_MBCSV_VERSION_10 10
 
 /* Current version */
-#define LGS_MBCSV_VERSION 9
+#define LGS_MBCSV_VERSION 10
 #define LGS_MBCSV_VERSION_MIN 1
 
 /* Checkpoint message types(Used as 'reotype' w.r.t mbcsv)  */
@@ -70,6 +74,8 @@ typedef enum {
   LGS_CKPT_PUSH_ASYNC,
   LGS_CKPT_POP_ASYNC,
   LGS_CKPT_POP_WRITE_ASYNC,
+  LGS_CKPT_WRITE_MARKS,
+  LGS_CKPT_WRITE_BATCH,
   LGS_CKPT_MSG_MAX
 } lgsv_ckpt_msg_type_t;
 
@@ -124,6 +130,7 @@ bool lgs_is_peer_v6();
 bool lgs_is_peer_v7();
 bool lgs_is_peer_v8();
 bool lgs_is_peer_v9();
+bool lgs_is_peer_v10();
 
 bool lgs_is_split_file_system();
 uint32_t lgs_mbcsv_dispatch(NCS_MBCSV_HDL mbcsv_hdl);
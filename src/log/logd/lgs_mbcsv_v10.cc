@@ -0,0 +1,474 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#include "log/logd/lgs_mbcsv_v10.h"
+#include <unistd.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "base/logtrace.h"
+#include "base/osaf_time.h"
+#include "base/time.h"
+#include "log/logd/lgs_mbcsv_v9.h"
+
+namespace {
+
+// Max time a write checkpoint is queued before it is sent to the standby
+const int kFlushIntervalMs = 20;
+// A batch of log records is sent when reaching any of these limits
+const size_t kMaxBatchRecords = 256;
+const size_t kMaxBatchBytes = 64 * 1024;
+
+struct PendingMark {
+  uint32_t record_id;
+  uint32_t file_size;
+  std::string log_file;
+};
+
+// Write checkpoints queued by the active, see CkptWriteQueue()
+std::map<uint32_t, PendingMark> pending_marks;
+CkptWriteRecord* pending_head = nullptr;
+CkptWriteRecord* pending_tail = nullptr;
+size_t pending_records = 0;
+size_t pending_bytes = 0;
+// Time when the oldest pending write checkpoint was queued
+timespec pending_since;
+
+bool IsPending() {
+  return pending_head != nullptr || pending_marks.empty() == false;
+}
+
+void FreeRecords(CkptWriteRecord* record) {
+  while (record != nullptr) {
+    CkptWriteRecord* next = record->next;
+    free(record->log_file);
+    free(record->log_record);
+    free(record);
+    record = next;
+  }
+}
+
+void SendMarks() {
+  std::vector<CkptWriteMark> marks(pending_marks.size());
+  lgsv_ckpt_msg_v9_t ckpt_v9;
+  size_t i = 0;
+
+  for (auto& pending : pending_marks) {
+    CkptWriteMark* mark = &marks[i++];
+    mark->stream_id = pending.first;
+    mark->record_id = pending.second.record_id;
+    mark->file_size = pending.second.file_size;
+    mark->log_file = const_cast<char*>(pending.second.log_file.c_str());
+    mark->next = i < marks.size() ? &marks[i] : nullptr;
+  }
+
+  memset(&ckpt_v9, 0, sizeof(ckpt_v9));
+  ckpt_v9.header.ckpt_rec_type = LGS_CKPT_WRITE_MARKS;
+  ckpt_v9.header.num_ckpt_records = 1;
+  ckpt_v9.header.data_len = 1;
+  ckpt_v9.ckpt_rec.write_marks.marks = &marks[0];
+  TRACE("Send write marks of %zu streams", marks.size());
+  (void)lgs_ckpt_send_async(lgs_cb, &ckpt_v9, NCS_MBCSV_ACT_ADD);
+}
+
+void SendBatch(CkptWriteRecord* records, size_t count) {
+  lgsv_ckpt_msg_v9_t ckpt_v9;
+
+  memset(&ckpt_v9, 0, sizeof(ckpt_v9));
+  ckpt_v9.header.ckpt_rec_type = LGS_CKPT_WRITE_BATCH;
+  ckpt_v9.header.num_ckpt_records = 1;
+  ckpt_v9.header.data_len = 1;
+  ckpt_v9.ckpt_rec.write_batch.records = records;
+  TRACE("Send write batch of %zu records", count);
+  (void)lgs_ckpt_send_async(lgs_cb, &ckpt_v9, NCS_MBCSV_ACT_ADD);
+}
+
+}  // namespace
+
+/****************************************************************************
+ * Name          : EncodeDecodeWriteMark
+ *
+ * Description   : This function is an EDU program for encoding/decoding
+ *                 the linked list of write marks in a LGS_CKPT_WRITE_MARKS
+ *                 checkpoint. At decode the list elements are allocated.
+ *
+ * Arguments     : EDU_HDL - pointer to edu handle,
+ *                 EDU_TKN - internal edu token to help encode/decode,
+ *                 POINTER to the structure to encode/decode from/to,
+ *                 data length specifying number of structures,
+ *                 EDU_BUF_ENV - pointer to buffer for encoding/decoding.
+ *                 op - operation type being encode/decode.
+ *                 EDU_ERR - out param to indicate errors in processing.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ *****************************************************************************/
+
+static uint32_t EncodeDecodeWriteMark(EDU_HDL* edu_hdl, EDU_TKN* edu_tkn,
+                                      NCSCONTEXT ptr, uint32_t* ptr_data_len,
+                                      EDU_BUF_ENV* buf_env, EDP_OP_TYPE op,
+                                      EDU_ERR* o_err) {
+  CkptWriteMark* mark = nullptr;
+  CkptWriteMark** mark_dec_ptr;
+  EDU_INST_SET ckpt_write_mark_ed_rules[] = {
+    {EDU_START, EncodeDecodeWriteMark, EDQ_LNKLIST, 0, 0,
+     sizeof(CkptWriteMark), 0, nullptr},
+
+    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+     (long)&((CkptWriteMark*)0)->stream_id, 0, nullptr},
+    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+     (long)&((CkptWriteMark*)0)->record_id, 0, nullptr},
+    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+     (long)&((CkptWriteMark*)0)->file_size, 0, nullptr},
+    {EDU_EXEC, ncs_edp_string, 0, 0, 0,
+     (long)&((CkptWriteMark*)0)->log_file, 0, nullptr},
+    {EDU_TEST_LL_PTR, EncodeDecodeWriteMark, 0, 0, 0,
+     (long)&((CkptWriteMark*)0)->next, 0, nullptr},
+
+    {EDU_END, 0, 0, 0, 0, 0, 0, nullptr},
+  };
+
+  if (op == EDP_OP_TYPE_ENC) {
+    mark = static_cast<CkptWriteMark*>(ptr);
+  } else if (op == EDP_OP_TYPE_DEC) {
+    mark_dec_ptr = static_cast<CkptWriteMark**>(ptr);
+    if (*mark_dec_ptr == nullptr) {
+      *mark_dec_ptr =
+          static_cast<CkptWriteMark*>(calloc(1, sizeof(CkptWriteMark)));
+      if (*mark_dec_ptr == nullptr) {
+        LOG_WA("calloc FAILED");
+        *o_err = EDU_ERR_MEM_FAIL;
+        return NCSCC_RC_FAILURE;
+      }
+    }
+    memset(*mark_dec_ptr, 0, sizeof(CkptWriteMark));
+    mark = *mark_dec_ptr;
+  } else {
+    mark = static_cast<CkptWriteMark*>(ptr);
+  }
+
+  return m_NCS_EDU_RUN_RULES(edu_hdl, edu_tkn, ckpt_write_mark_ed_rules, mark,
+                             ptr_data_len, buf_env, op, o_err);
+}
+
+uint32_t EncodeDecodeWriteMarks(EDU_HDL* edu_hdl, EDU_TKN* edu_tkn,
+                                NCSCONTEXT ptr, uint32_t* ptr_data_len,
+                                EDU_BUF_ENV* buf_env, EDP_OP_TYPE op,
+                                EDU_ERR* o_err) {
+  TRACE_ENTER();
+  CkptWriteMarks* write_marks = nullptr;
+  CkptWriteMarks** write_marks_dec_ptr;
+  EDU_INST_SET ckpt_write_marks_ed_rules[] = {
+    {EDU_START, EncodeDecodeWriteMarks, 0, 0, 0,
+     sizeof(CkptWriteMarks), 0, nullptr},
+
+    {EDU_EXEC, EncodeDecodeWriteMark, EDQ_POINTER, 0, 0,
+     (long)&((CkptWriteMarks*)0)->marks, 0, nullptr},
+
+    {EDU_END, 0, 0, 0, 0, 0, 0, nullptr},
+  };
+
+  if (op == EDP_OP_TYPE_ENC) {
+    write_marks = static_cast<CkptWriteMarks*>(ptr);
+  } else if (op == EDP_OP_TYPE_DEC) {
+    write_marks_dec_ptr = static_cast<CkptWriteMarks**>(ptr);
+    if (*write_marks_dec_ptr == nullptr) {
+      *o_err = EDU_ERR_MEM_FAIL;
+      return NCSCC_RC_FAILURE;
+    }
+    memset(*write_marks_dec_ptr, 0, sizeof(CkptWriteMarks));
+    write_marks = *write_marks_dec_ptr;
+  } else {
+    write_marks = static_cast<CkptWriteMarks*>(ptr);
+  }
+
+  return m_NCS_EDU_RUN_RULES(edu_hdl, edu_tkn, ckpt_write_marks_ed_rules,
+                             write_marks, ptr_data_len, buf_env, op, o_err);
+}
+
+/****************************************************************************
+ * Name          : EncodeDecodeWriteRecord
+ *
+ * Description   : This function is an EDU program for encoding/decoding
+ *                 the linked list of log records in a LGS_CKPT_WRITE_BATCH
+ *                 checkpoint. At decode the list elements are allocated.
+ *
+ * Arguments     : EDU_HDL - pointer to edu handle,
+ *                 EDU_TKN - internal edu token to help encode/decode,
+ *                 POINTER to the structure to encode/decode from/to,
+ *                 data length specifying number of structures,
+ *                 EDU_BUF_ENV - pointer to buffer for encoding/decoding.
+ *                 op - operation type being encode/decode.
+ *                 EDU_ERR - out param to indicate errors in processing.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ *****************************************************************************/
+
+static uint32_t EncodeDecodeWriteRecord(EDU_HDL* edu_hdl, EDU_TKN* edu_tkn,
+                                        NCSCONTEXT ptr, uint32_t* ptr_data_len,
+                                        EDU_BUF_ENV* buf_env, EDP_OP_TYPE op,
+                                        EDU_ERR* o_err) {
+  CkptWriteRecord* record = nullptr;
+  CkptWriteRecord** record_dec_ptr;
+  EDU_INST_SET ckpt_write_record_ed_rules[] = {
+    {EDU_START, EncodeDecodeWriteRecord, EDQ_LNKLIST, 0, 0,
+     sizeof(CkptWriteRecord), 0, nullptr},
+
+    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->stream_id, 0, nullptr},
+    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->record_id, 0, nullptr},
+    {EDU_EXEC, ncs_edp_uns32, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->file_size, 0, nullptr},
+    {EDU_EXEC, ncs_edp_string, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->log_file, 0, nullptr},
+    {EDU_EXEC, ncs_edp_string, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->log_record, 0, nullptr},
+    {EDU_EXEC, ncs_edp_uns64, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->timestamp, 0, nullptr},
+    {EDU_TEST_LL_PTR, EncodeDecodeWriteRecord, 0, 0, 0,
+     (long)&((CkptWriteRecord*)0)->next, 0, nullptr},
+
+    {EDU_END, 0, 0, 0, 0, 0, 0, nullptr},
+  };
+
+  if (op == EDP_OP_TYPE_ENC) {
+    record = static_cast<CkptWriteRecord*>(ptr);
+  } else if (op == EDP_OP_TYPE_DEC) {
+    record_dec_ptr = static_cast<CkptWriteRecord**>(ptr);
+    if (*record_dec_ptr == nullptr) {
+      *record_dec_ptr =
+          static_cast<CkptWriteRecord*>(calloc(1, sizeof(CkptWriteRecord)));
+      if (*record_dec_ptr == nullptr) {
+        LOG_WA("calloc FAILED");
+        *o_err = EDU_ERR_MEM_FAIL;
+        return NCSCC_RC_FAILURE;
+      }
+    }
+    memset(*record_dec_ptr, 0, sizeof(CkptWriteRecord));
+    record = *record_dec_ptr;
+  } else {
+    record = static_cast<CkptWriteRecord*>(ptr);
+  }
+
+  return m_NCS_EDU_RUN_RULES(edu_hdl, edu_tkn, ckpt_write_record_ed_rules,
+                             record, ptr_data_len, buf_env, op, o_err);
+}
+
+uint32_t EncodeDecodeWriteBatch(EDU_HDL* edu_hdl, EDU_TKN* edu_tkn,
+                                NCSCONTEXT ptr, uint32_t* ptr_data_len,
+                                EDU_BUF_ENV* buf_env, EDP_OP_TYPE op,
+                                EDU_ERR* o_err) {
+  TRACE_ENTER();
+  CkptWriteBatch* write_batch = nullptr;
+  CkptWriteBatch** write_batch_dec_ptr;
+  EDU_INST_SET ckpt_write_batch_ed_rules[] = {
+    {EDU_START, EncodeDecodeWriteBatch, 0, 0, 0,
+     sizeof(CkptWriteBatch), 0, nullptr},
+
+    {EDU_EXEC, EncodeDecodeWriteRecord, EDQ_POINTER, 0, 0,
+     (long)&((CkptWriteBatch*)0)->records, 0, nullptr},
+
+    {EDU_END, 0, 0, 0, 0, 0, 0, nullptr},
+  };
+
+  if (op == EDP_OP_TYPE_ENC) {
+    write_batch = static_cast<CkptWriteBatch*>(ptr);
+  } else if (op == EDP_OP_TYPE_DEC) {
+    write_batch_dec_ptr = static_cast<CkptWriteBatch**>(ptr);
+    if (*write_batch_dec_ptr == nullptr) {
+      *o_err = EDU_ERR_MEM_FAIL;
+      return NCSCC_RC_FAILURE;
+    }
+    memset(*write_batch_dec_ptr, 0, sizeof(CkptWriteBatch));
+    write_batch = *write_batch_dec_ptr;
+  } else {
+    write_batch = static_cast<CkptWriteBatch*>(ptr);
+  }
+
+  return m_NCS_EDU_RUN_RULES(edu_hdl, edu_tkn, ckpt_write_batch_ed_rules,
+                             write_batch, ptr_data_len, buf_env, op, o_err);
+}
+
+uint32_t DecodeWriteMarks(lgs_cb_t* cb, void* ckpt_msg,
+                          NCS_MBCSV_CB_ARG* cbk_arg) {
+  assert(lgs_is_peer_v10());
+  TRACE_ENTER();
+  auto ckpt_msg_v9 = static_cast<lgsv_ckpt_msg_v9_t*>(ckpt_msg);
+  auto data = &ckpt_msg_v9->ckpt_rec.write_marks;
+  return ckpt_decode_log_struct(cb, cbk_arg, ckpt_msg, data,
+                                EncodeDecodeWriteMarks);
+}
+
+uint32_t DecodeWriteBatch(lgs_cb_t* cb, void* ckpt_msg,
+                          NCS_MBCSV_CB_ARG* cbk_arg) {
+  assert(lgs_is_peer_v10());
+  TRACE_ENTER();
+  auto ckpt_msg_v9 = static_cast<lgsv_ckpt_msg_v9_t*>(ckpt_msg);
+  auto data = &ckpt_msg_v9->ckpt_rec.write_batch;
+  return ckpt_decode_log_struct(cb, cbk_arg, ckpt_msg, data,
+                                EncodeDecodeWriteBatch);
+}
+
+uint32_t ckpt_proc_write_marks(lgs_cb_t* cb, void* data) {
+  TRACE_ENTER();
+  assert(lgs_is_peer_v10() && "The peer should run with V10 or beyond!");
+  auto data_v9 = static_cast<lgsv_ckpt_msg_v9_t*>(data);
+  CkptWriteMark* mark = data_v9->ckpt_rec.write_marks.marks;
+
+  while (mark != nullptr) {
+    CkptWriteMark* next = mark->next;
+    log_stream_t* stream = log_stream_get_by_id(mark->stream_id);
+    if (stream != nullptr) {
+      stream->logRecordId = mark->record_id;
+      stream->curFileSize = mark->file_size;
+      if (mark->log_file != nullptr) stream->logFileCurrent = mark->log_file;
+    } else {
+      TRACE("Could not lookup stream: %u", mark->stream_id);
+    }
+    lgs_free_edu_mem(mark->log_file);
+    free(mark);
+    mark = next;
+  }
+
+  return NCSCC_RC_SUCCESS;
+}
+
+uint32_t ckpt_proc_write_batch(lgs_cb_t* cb, void* data) {
+  TRACE_ENTER();
+  assert(lgs_is_peer_v10() && "The peer should run with V10 or beyond!");
+  auto data_v9 = static_cast<lgsv_ckpt_msg_v9_t*>(data);
+  CkptWriteRecord* record = data_v9->ckpt_rec.write_batch.records;
+  const int sleep_delay_ms = 10;
+  const int max_waiting_time_ms = 100;
+
+  while (record != nullptr) {
+    CkptWriteRecord* next = record->next;
+    log_stream_t* stream = log_stream_get_by_id(record->stream_id);
+    if (stream != nullptr) {
+      stream->logRecordId = record->record_id;
+      stream->curFileSize = record->file_size;
+      if (record->log_file != nullptr) {
+        stream->logFileCurrent = record->log_file;
+      }
+
+      /* The log record memory is taken over by the log handler thread if the
+       * write times out, so each attempt is made with a copy of it. See
+       * ckpt_decode_log_write().
+       */
+      int msecs_waited = 0;
+      uint32_t rc;
+      while (((rc = WriteOnStandby(
+                   stream, record->timestamp, nullptr,
+                   record->log_record != nullptr ? strdup(record->log_record)
+                                                 : nullptr)) ==
+              NCSCC_RC_REQ_TIMOUT) &&
+             (msecs_waited < max_waiting_time_ms)) {
+        usleep(sleep_delay_ms * 1000);
+        msecs_waited += sleep_delay_ms;
+      }
+      if (rc != NCSCC_RC_SUCCESS) {
+        TRACE("Write of record %u failed", record->record_id);
+      }
+    } else {
+      TRACE("Could not lookup stream: %u", record->stream_id);
+    }
+    lgs_free_edu_mem(record->log_file);
+    lgs_free_edu_mem(record->log_record);
+    free(record);
+    record = next;
+  }
+
+  return NCSCC_RC_SUCCESS;
+}
+
+/**
+ * Queue the checkpoint of a log record written to a stream. If the file
+ * system is shared only the latest record id, file size and current file of
+ * the stream are kept. Otherwise a copy of the log record is added to the
+ * batch sent to the standby.
+ *
+ * @param stream the stream the log record has been written to
+ * @param log_record the formatted log record
+ */
+void CkptWriteQueue(log_stream_t* stream, const char* log_record) {
+  if (IsPending() == false) pending_since = base::ReadMonotonicClock();
+
+  if (lgs_is_split_file_system() == false) {
+    PendingMark& mark = pending_marks[stream->streamId];
+    mark.record_id = stream->logRecordId;
+    mark.file_size = stream->curFileSize;
+    mark.log_file = stream->logFileCurrent;
+    return;
+  }
+
+  auto record =
+      static_cast<CkptWriteRecord*>(calloc(1, sizeof(CkptWriteRecord)));
+  if (record == nullptr) {
+    LOG_WA("calloc FAILED");
+    return;
+  }
+  record->stream_id = stream->streamId;
+  record->record_id = stream->logRecordId;
+  record->file_size = stream->curFileSize;
+  record->log_file = strdup(stream->logFileCurrent.c_str());
+  record->log_record = strdup(log_record);
+  record->timestamp = stream->act_last_close_timestamp;
+
+  if (pending_tail != nullptr) {
+    pending_tail->next = record;
+  } else {
+    pending_head = record;
+  }
+  pending_tail = record;
+  pending_records++;
+  pending_bytes += strlen(log_record) + stream->logFileCurrent.size();
+
+  if (pending_records >= kMaxBatchRecords || pending_bytes >= kMaxBatchBytes) {
+    CkptWriteFlush();
+  }
+}
+
+/**
+ * Send the queued write checkpoints. If the peer no longer runs with version
+ * 10 or beyond they are dropped, a new standby is cold synchronized.
+ */
+void CkptWriteFlush() {
+  if (IsPending() == false) return;
+
+  if (lgs_is_peer_v10()) {
+    if (pending_marks.empty() == false) SendMarks();
+    if (pending_head != nullptr) SendBatch(pending_head, pending_records);
+  } else {
+    TRACE("Drop write checkpoints, peer version %u",
+          lgs_cb->mbcsv_peer_version);
+  }
+
+  pending_marks.clear();
+  FreeRecords(pending_head);
+  pending_head = nullptr;
+  pending_tail = nullptr;
+  pending_records = 0;
+  pending_bytes = 0;
+}
+
+int CkptWritePollTimeout() {
+  if (IsPending() == false) return -1;
+  struct timespec passed_time;
+  struct timespec current = base::ReadMonotonicClock();
+  osaf_timespec_subtract(&current, &pending_since, &passed_time);
+  auto passed_time_ms = osaf_timespec_to_millis(&passed_time);
+  return (passed_time_ms < kFlushIntervalMs) ?
+      (kFlushIntervalMs - passed_time_ms) : 0;
+}
@@ -0,0 +1,91 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#ifndef LOG_LOGD_LGS_MBCSV_V10_H_
+#define LOG_LOGD_LGS_MBCSV_V10_H_
+
+#include "log/logd/lgs.h"
+#include "log/logd/lgs_mbcsv.h"
+
+#include "base/ncs_edu_pub.h"
+#include "base/ncsencdec_pub.h"
+
+/*
+ * Batched checkpointing of log writes, used if the peer runs with version 10
+ * or beyond. Instead of one LGS_CKPT_LOG_WRITE per log record the active
+ * collects the writes and sends them as one message:
+ *
+ * - LGS_CKPT_WRITE_MARKS if the file system is shared. The standby only needs
+ *   the latest record id, file size and current file of each written stream.
+ * - LGS_CKPT_WRITE_BATCH if the file system is split. All records are sent,
+ *   since the standby writes them to its own log files.
+ *
+ * Pending writes are sent when a batch is full, when the flush interval has
+ * expired, before any other checkpoint message and at HA state change.
+ */
+
+/* Latest write of a stream, used in LGS_CKPT_WRITE_MARKS */
+struct CkptWriteMark {
+  uint32_t stream_id;
+  uint32_t record_id;
+  uint32_t file_size;
+  char* log_file;
+  CkptWriteMark* next;
+};
+
+struct CkptWriteMarks {
+  CkptWriteMark* marks;
+};
+
+/* One written log record, used in LGS_CKPT_WRITE_BATCH */
+struct CkptWriteRecord {
+  uint32_t stream_id;
+  uint32_t record_id;
+  uint32_t file_size;
+  char* log_file;
+  char* log_record;
+  uint64_t timestamp;
+  CkptWriteRecord* next;
+};
+
+struct CkptWriteBatch {
+  CkptWriteRecord* records;
+};
+
+uint32_t EncodeDecodeWriteMarks(EDU_HDL* edu_hdl, EDU_TKN* edu_tkn,
+                                NCSCONTEXT ptr, uint32_t* ptr_data_len,
+                                EDU_BUF_ENV* buf_env, EDP_OP_TYPE op,
+                                EDU_ERR* o_err);
+uint32_t EncodeDecodeWriteBatch(EDU_HDL* edu_hdl, EDU_TKN* edu_tkn,
+                                NCSCONTEXT ptr, uint32_t* ptr_data_len,
+                                EDU_BUF_ENV* buf_env, EDP_OP_TYPE op,
+                                EDU_ERR* o_err);
+uint32_t DecodeWriteMarks(lgs_cb_t* cb, void* ckpt_msg,
+                          NCS_MBCSV_CB_ARG* cbk_arg);
+uint32_t DecodeWriteBatch(lgs_cb_t* cb, void* ckpt_msg,
+                          NCS_MBCSV_CB_ARG* cbk_arg);
+
+uint32_t ckpt_proc_write_marks(lgs_cb_t* cb, void* data);
+uint32_t ckpt_proc_write_batch(lgs_cb_t* cb, void* data);
+
+// Queue the checkpoint of a log record written to stream by the active
+void CkptWriteQueue(log_stream_t* stream, const char* log_record);
+// Send the queued write checkpoints to the standby
+void CkptWriteFlush();
+// Milliseconds until the queued write checkpoints are to be sent, or -1 if
+// there are none
+int CkptWritePollTimeout();
+
+#endif  // LOG_LOGD_LGS_MBCSV_V10_H_
@@ -24,6 +24,7 @@
 #include "log/logd/lgs_mbcsv_v5.h"
 #include "log/logd/lgs_mbcsv_v6.h"
 #include "log/logd/lgs_mbcsv_v8.h"
+#include "log/logd/lgs_mbcsv_v10.h"
 
 typedef struct {
   char *name;
@@ -57,6 +58,8 @@ typedef struct {
     CkptPushAsync push_async;
     CkptPopAsync pop_async;
     CkptPopAndWriteAsync pop_and_write_async;
+    CkptWriteMarks write_marks; /* Version 10 */
+    CkptWriteBatch write_batch; /* Version 10 */
   } ckpt_rec;
 } lgsv_ckpt_msg_v9_t;
 
@@ -23,16 +23,18 @@
 #include "base/osaf_time.h"
 #include "base/osaf_extended_name.h"
 
-#define LGS_SVC_PVT_SUBPART_VERSION 1
+#define LGS_SVC_PVT_SUBPART_VERSION 2
 #define LGS_WRT_LGA_SUBPART_VER_AT_MIN_MSG_FMT 1
-#define LGS_WRT_LGA_SUBPART_VER_AT_MAX_MSG_FMT 1
+#define LGS_WRT_LGA_SUBPART_VER_AT_MAX_MSG_FMT 2
 #define LGS_WRT_LGA_SUBPART_VER_RANGE       \
   (LGS_WRT_LGA_SUBPART_VER_AT_MAX_MSG_FMT - \
    LGS_WRT_LGA_SUBPART_VER_AT_MIN_MSG_FMT + 1)
 
 static MDS_CLIENT_MSG_FORMAT_VER
     LGS_WRT_LGA_MSG_FMT_ARRAY[LGS_WRT_LGA_SUBPART_VER_RANGE] = {
-        1 /*msg format version for LGA subpart version 1 */
+        1, /*msg format version for LGA subpart version 1 */
+        2  /*msg format version for LGA subpart version 2, adds
+              LGSV_WRITE_LOG_BATCH_ASYNC_REQ */
 };
 
 /****************************************************************************
@@ -409,16 +411,16 @@ done:
   Description   : This routine decodes a write async log API msg
 
   Arguments     : NCS_UBAID *msg,
-                  LGSV_MSG *msg
+                  lgsv_write_log_async_req_t *param
 
   Return Values : uint32_t
 
   Notes         : None.
 ******************************************************************************/
-static uint32_t dec_write_log_async_msg(NCS_UBAID *uba, lgsv_msg_t *msg) {
+static uint32_t dec_write_log_async_msg(NCS_UBAID *uba,
+                                        lgsv_write_log_async_req_t *param) {
   uint8_t *p8;
   uint32_t rc = NCSCC_RC_SUCCESS;
-  lgsv_write_log_async_req_t *param = &msg->info.api_info.param.write_log_async;
   uint8_t local_data[1024];
   /* Initiate pointers that will point to allocated memory. Needed for
    * for handling free if decoding is stopped because of corrupt message
@@ -545,6 +547,61 @@ err_done:
   return rc;
 }
 
+/****************************************************************************
+  Name          : dec_write_log_batch_async_msg
+
+  Description   : This routine decodes a batch of write async log requests
+
+  Arguments     : NCS_UBAID *msg,
+                  LGSV_MSG *msg
+
+  Return Values : uint32_t
+
+  Notes         : The requests are decoded into an array, which is split into
+                  one write event per request by mds_rcv().
+******************************************************************************/
+static uint32_t dec_write_log_batch_async_msg(NCS_UBAID *uba,
+                                              lgsv_msg_t *msg) {
+  uint8_t *p8;
+  uint32_t rc = NCSCC_RC_SUCCESS;
+  lgsv_write_log_batch_req_t *param = &msg->info.api_info.param.write_log_batch;
+  uint8_t local_data[4];
+  uint32_t i;
+
+  param->records = NULL;
+  p8 = ncs_dec_flatten_space(uba, local_data, 4);
+  param->num_records = ncs_decode_32bit(&p8);
+  ncs_dec_skip_space(uba, 4);
+
+  if ((param->num_records == 0) ||
+      (param->num_records > LGSV_WRITE_LOG_BATCH_MAX)) {
+    LOG_WA("Invalid number of records in batch: %u", param->num_records);
+    return NCSCC_RC_FAILURE;
+  }
+
+  param->records = static_cast<lgsv_write_log_async_req_t *>(
+      calloc(param->num_records, sizeof(lgsv_write_log_async_req_t)));
+  if (param->records == NULL) {
+    LOG_WA("calloc FAILED");
+    return NCSCC_RC_FAILURE;
+  }
+
+  for (i = 0; i < param->num_records; i++) {
+    rc = dec_write_log_async_msg(uba, &param->records[i]);
+    if (rc != NCSCC_RC_SUCCESS) break;
+  }
+
+  if (rc != NCSCC_RC_SUCCESS) {
+    /* Free the requests decoded so far */
+    while (i > 0) lgs_free_write_log(&param->records[--i]);
+    free(param->records);
+    param->records = NULL;
+  }
+
+  TRACE_8("LGSV_WRITE_LOG_BATCH_ASYNC_REQ, %u records", param->num_records);
+  return rc;
+}
+
 /****************************************************************************
   Name          : enc_initialize_rsp_msg
 
@@ -902,7 +959,11 @@ static uint32_t mds_dec(struct ncsmds_callback_info *info) {
         rc = dec_lstr_close_msg(uba, &evt->info.msg);
         break;
       case LGSV_WRITE_LOG_ASYNC_REQ:
-        rc = dec_write_log_async_msg(uba, &evt->info.msg);
+        rc = dec_write_log_async_msg(
+            uba, &evt->info.msg.info.api_info.param.write_log_async);
+        break;
+      case LGSV_WRITE_LOG_BATCH_ASYNC_REQ:
+        rc = dec_write_log_batch_async_msg(uba, &evt->info.msg);
         break;
       default:
         break;
@@ -1009,6 +1070,108 @@ static NCS_IPC_PRIORITY getmboxprio(const lgsv_api_info_t *api_info) {
     return LGS_IPC_PRIO_APP_STREAM;
 }
 
+/* Number of writes discarded per mailbox priority since the mailbox got full
+ */
+static unsigned long silently_discarded[NCS_IPC_PRIORITY_MAX];
+
+/****************************************************************************
+ * Name          : mds_rcv_write
+ *
+ * Description   : Queue a received write request in the mailbox, or nack or
+ *                 discard it if the mailbox is full.
+ *
+ * Arguments     : evt - LGSV_WRITE_LOG_ASYNC_REQ event
+ *
+ * Return Values : None
+ *
+ * Notes         : Called with lgs_mbox_init_mutex locked.
+ *****************************************************************************/
+
+static void mds_rcv_write(lgsv_lgs_evt_t *evt) {
+  const lgsv_api_info_t *api_info = &evt->info.msg.info.api_info;
+  NCS_IPC_PRIORITY prio = getmboxprio(api_info);
+
+  /* Can we leave the mbox FULL state? */
+  if (mbox_full[prio] && (mbox_msgs[prio] <= mbox_low[prio])) {
+    mbox_full[prio] = false;
+    LOG_NO("discarded %lu writes, stream type: %s", silently_discarded[prio],
+           (prio == LGS_IPC_PRIO_APP_STREAM) ? "app" : "sys/not");
+    silently_discarded[prio] = 0;
+  }
+
+  /* If the mailbox is full, nack or silently drop */
+  if (mbox_full[prio]) {
+    /* If logger has requested an ack, send one with error code TRYAGAIN */
+    if (api_info->param.write_log_async.ack_flags & SA_LOG_RECORD_WRITE_ACK) {
+      lgs_send_write_log_ack(api_info->param.write_log_async.client_id,
+                             api_info->param.write_log_async.invocation,
+                             SA_AIS_ERR_TRY_AGAIN, evt->fr_dest);
+    } else
+      silently_discarded[prio]++;
+
+    goto donefree;
+  }
+
+  if (m_NCS_IPC_SEND(&lgs_mbx, evt, prio) == NCSCC_RC_SUCCESS) return;
+
+  mbox_full[prio] = true;
+  TRACE("FULL, msgs: %u, low: %u, high: %u", mbox_msgs[prio], mbox_low[prio],
+        mbox_high[prio]);
+
+  /* If logger has requested an ack, send one with error code TRYAGAIN */
+  if (api_info->param.write_log_async.ack_flags & SA_LOG_RECORD_WRITE_ACK) {
+    lgs_send_write_log_ack(api_info->param.write_log_async.client_id,
+                           api_info->param.write_log_async.invocation,
+                           SA_AIS_ERR_TRY_AGAIN, evt->fr_dest);
+  } else
+    silently_discarded[prio]++;
+
+donefree:
+  lgs_free_write_log(&api_info->param.write_log_async);
+  free(evt);
+}
+
+/****************************************************************************
+ * Name          : mds_rcv_write_batch
+ *
+ * Description   : Split a received batch of write requests into one write
+ *                 event per request, queued in order as if each request had
+ *                 been received on its own. Each request is acked, nacked or
+ *                 discarded according to its own ack flags.
+ *
+ * Arguments     : evt - LGSV_WRITE_LOG_BATCH_ASYNC_REQ event
+ *
+ * Return Values : None
+ *
+ * Notes         : Called with lgs_mbox_init_mutex locked.
+ *****************************************************************************/
+
+static void mds_rcv_write_batch(lgsv_lgs_evt_t *evt) {
+  lgsv_write_log_batch_req_t *batch =
+      &evt->info.msg.info.api_info.param.write_log_batch;
+  lgsv_write_log_async_req_t *records = batch->records;
+  uint32_t num_records = batch->num_records;
+  uint32_t i;
+
+  for (i = 0; i < num_records; i++) {
+    lgsv_lgs_evt_t *write_evt =
+        static_cast<lgsv_lgs_evt_t *>(malloc(sizeof(lgsv_lgs_evt_t)));
+    if (write_evt == NULL) {
+      LOG_WA("malloc FAILED, discarded %u writes", num_records - i);
+      break;
+    }
+
+    memcpy(write_evt, evt, sizeof(lgsv_lgs_evt_t));
+    write_evt->info.msg.info.api_info.type = LGSV_WRITE_LOG_ASYNC_REQ;
+    write_evt->info.msg.info.api_info.param.write_log_async = records[i];
+    mds_rcv_write(write_evt);
+  }
+
+  for (; i < num_records; i++) lgs_free_write_log(&records[i]);
+  free(records);
+  free(evt);
+}
+
 /****************************************************************************
  * Name          : mds_rcv
  *
@@ -1028,7 +1191,6 @@ static uint32_t mds_rcv(struct ncsmds_callback_info *mds_info) {
   lgsv_api_msg_type_t type = api_info->type;
   NCS_IPC_PRIORITY prio = NCS_IPC_PRIORITY_LOW;
   uint32_t rc = NCSCC_RC_SUCCESS;
-  static unsigned long silently_discarded[NCS_IPC_PRIORITY_MAX];
 
   /* Wait if the mailbox is being reinitialized in the main thread.
    */
@@ -1054,9 +1216,8 @@ static uint32_t mds_rcv(struct ncsmds_callback_info *mds_info) {
     goto done;
   }
 
-  prio = getmboxprio(api_info);
-
   if ((type == LGSV_FINALIZE_REQ) || (type == LGSV_STREAM_CLOSE_REQ)) {
+    prio = getmboxprio(api_info);
     osaf_clock_gettime(CLOCK_MONOTONIC, &evt->entered_at);
     rc = m_NCS_IPC_SEND(&lgs_mbx, evt, prio);
     if (rc != NCSCC_RC_SUCCESS) {
@@ -1067,51 +1228,14 @@ static uint32_t mds_rcv(struct ncsmds_callback_info *mds_info) {
     goto done;
   }
 
-  /* LGSV_WRITE_LOG_ASYNC_REQ
-   */
-  /* Can we leave the mbox FULL state? */
-  if (mbox_full[prio] && (mbox_msgs[prio] <= mbox_low[prio])) {
-    mbox_full[prio] = false;
-    LOG_NO("discarded %lu writes, stream type: %s", silently_discarded[prio],
-           (prio == LGS_IPC_PRIO_APP_STREAM) ? "app" : "sys/not");
-    silently_discarded[prio] = 0;
-  }
-
-  /* If the mailbox is full, nack or silently drop */
-  if (mbox_full[prio]) {
-    /* If logger has requested an ack, send one with error code TRYAGAIN */
-    if (api_info->param.write_log_async.ack_flags & SA_LOG_RECORD_WRITE_ACK) {
-      lgs_send_write_log_ack(api_info->param.write_log_async.client_id,
-                             api_info->param.write_log_async.invocation,
-                             SA_AIS_ERR_TRY_AGAIN, evt->fr_dest);
-    } else
-      silently_discarded[prio]++;
-
-    goto donefree;
-  }
-
-  /* Can only get here for writes */
-  osafassert(api_info->type == LGSV_WRITE_LOG_ASYNC_REQ);
-
-  if (m_NCS_IPC_SEND(&lgs_mbx, evt, prio) == NCSCC_RC_SUCCESS) {
+  if (type == LGSV_WRITE_LOG_BATCH_ASYNC_REQ) {
+    mds_rcv_write_batch(evt);
     goto done;
-  } else {
-    mbox_full[prio] = true;
-    TRACE("FULL, msgs: %u, low: %u, high: %u", mbox_msgs[prio], mbox_low[prio],
-          mbox_high[prio]);
-
-    /* If logger has requested an ack, send one with error code TRYAGAIN */
-    if (api_info->param.write_log_async.ack_flags & SA_LOG_RECORD_WRITE_ACK) {
-      lgs_send_write_log_ack(api_info->param.write_log_async.client_id,
-                             api_info->param.write_log_async.invocation,
-                             SA_AIS_ERR_TRY_AGAIN, evt->fr_dest);
-    } else
-      silently_discarded[prio]++;
   }
 
-donefree:
-  lgs_free_write_log(&api_info->param.write_log_async);
-  free(evt);
+  /* Can only get here for writes */
+  osafassert(type == LGSV_WRITE_LOG_ASYNC_REQ);
+  mds_rcv_write(evt);
 
 done:
   osaf_mutex_unlock_ordie(&lgs_mbox_init_mutex);
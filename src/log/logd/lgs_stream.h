@@ -64,6 +64,7 @@ typedef struct log_stream {
   uint32_t curFileSize;       /* Bytes written to current log file */
   uint32_t logRecordId; /* log record indentifier increased for each record */
   SaBoolT twelveHourModeFlag; /* Not used. Can be removed? */
+  lgs_fmt_program_t fmtProgram; /* logFileFormat compiled when first used */
   logStreamTypeT streamType;
   /**
    * This info is cached locally at SCs node when stream is opened.
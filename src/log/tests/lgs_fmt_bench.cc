@@ -0,0 +1,208 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the rate of log records
+ * formatted by the log server formatter, lgs_format_log_record(), without any
+ * client, message or file handling.
+ */
+
+#include <getopt.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include "base/osaf_extended_name.h"
+#include "base/osaf_time.h"
+#include "log/logd/lgs_fmt.h"
+
+//==============================================================================
+// Dummy functions
+//==============================================================================
+std::string lgs_get_networkname() { return "network"; }
+
+static unsigned int numRecords = 1000000;
+static unsigned int bodySize = 80;
+static unsigned int fixedSize = 0;
+static unsigned int stepMillis = 1;
+static bool ntfHeader = false;
+static const char *formatExpression = nullptr;
+
+static void usage(const char *progname) {
+  printf("\nNAME\n");
+  printf("\t%s - measure the log record formatting rate\n", progname);
+
+  printf("\nSYNOPSIS\n");
+  printf("\t%s [options]\n", progname);
+
+  printf("\nDESCRIPTION\n");
+  printf(
+      "\t%s formats log records with the log server formatter in a loop,\n"
+      "\treporting the number of records formatted per second. The time\n"
+      "\tstamp of each record is stepped forward so that the time fields\n"
+      "\tchange as when records are written over time.\n",
+      progname);
+
+  printf("\nOPTIONS\n");
+  printf("\t-h, --help             this help\n");
+  printf("\t-n, --records <n>      number of records (default 1000000)\n");
+  printf("\t-f, --format <exp>     format expression (default the system\n"
+         "\t                       stream format, or the alarm stream\n"
+         "\t                       format with --notification)\n");
+  printf("\t-b, --body <n>         size of the log record body (default 80)\n");
+  printf("\t-s, --fixed <n>        fixed log record size (default 0)\n");
+  printf("\t-t, --step <ms>        time between records (default 1)\n");
+  printf("\t-N, --notification     format notification records\n");
+
+  printf("\nEXAMPLE\n");
+  printf("\t%s -n 5000000 -f '@Cr @Ch:@Cn:@Cs.@Ck @Sv \"@Cb\"'\n", progname);
+}
+
+int main(int argc, char *argv[]) {
+  struct option long_options[] = {{"help", no_argument, 0, 'h'},
+                                  {"records", required_argument, 0, 'n'},
+                                  {"format", required_argument, 0, 'f'},
+                                  {"body", required_argument, 0, 'b'},
+                                  {"fixed", required_argument, 0, 's'},
+                                  {"step", required_argument, 0, 't'},
+                                  {"notification", no_argument, 0, 'N'},
+                                  {0, 0, 0, 0}};
+  SaNtfClassIdT classId = {18568, 1, 1};
+  SaNameT userName, object, notifyingObject;
+  SaLogBufferT logBuffer;
+  SaLogRecordT logRecord;
+  struct timespec start, end, diff;
+  SaBoolT twelveHourModeFlag = SA_FALSE;
+  size_t destSize;
+  char nodeName[] = "SC-1";
+  char *body, *dest;
+  uint64_t bytes = 0;
+  double seconds;
+  int n = 0;
+  int c;
+
+  while ((c = getopt_long(argc, argv, "hn:f:b:s:t:N", long_options,
+                          nullptr)) != -1) {
+    switch (c) {
+      case 'n':
+        numRecords = strtoul(optarg, nullptr, 0);
+        break;
+      case 'f':
+        formatExpression = optarg;
+        break;
+      case 'b':
+        bodySize = strtoul(optarg, nullptr, 0);
+        break;
+      case 's':
+        fixedSize = strtoul(optarg, nullptr, 0);
+        break;
+      case 't':
+        stepMillis = strtoul(optarg, nullptr, 0);
+        break;
+      case 'N':
+        ntfHeader = true;
+        break;
+      case 'h':
+        usage(basename(argv[0]));
+        exit(EXIT_SUCCESS);
+      default:
+        fprintf(stderr, "Try '%s --help' for more information\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+  }
+
+  if (numRecords == 0 || fixedSize > UINT16_MAX) {
+    fprintf(stderr, "Invalid arguments\n");
+    exit(EXIT_FAILURE);
+  }
+
+  if (formatExpression == nullptr) {
+    formatExpression =
+        ntfHeader ? DEFAULT_ALM_NOT_FORMAT_EXP : DEFAULT_APP_SYS_FORMAT_EXP;
+  }
+  if (!lgs_is_valid_format_expression(
+          const_cast<SaStringT>(formatExpression),
+          ntfHeader ? STREAM_TYPE_ALARM : STREAM_TYPE_SYSTEM,
+          &twelveHourModeFlag)) {
+    fprintf(stderr, "Invalid format expression: %s\n", formatExpression);
+    exit(EXIT_FAILURE);
+  }
+
+  body = static_cast<char *>(malloc(bodySize + 1));
+  destSize = fixedSize == 0 ? SA_LOG_MAX_RECORD_SIZE : fixedSize;
+  dest = static_cast<char *>(calloc(1, destSize + 1));
+  if (body == nullptr || dest == nullptr) {
+    fprintf(stderr, "malloc FAILED\n");
+    exit(EXIT_FAILURE);
+  }
+  memset(body, 'x', bodySize);
+  body[bodySize] = '\0';
+
+  osaf_extended_name_lend("safApp=logfmtbench", &userName);
+  osaf_extended_name_lend("safSu=SU1,safSg=SG1,safApp=logfmtbench", &object);
+  osaf_extended_name_lend("safApp=logfmtbench", &notifyingObject);
+
+  logBuffer.logBuf = reinterpret_cast<SaUint8T *>(body);
+  logBuffer.logBufSize = bodySize;
+  memset(&logRecord, 0, sizeof(logRecord));
+  logRecord.logBuffer = &logBuffer;
+  if (ntfHeader) {
+    logRecord.logHdrType = SA_LOG_NTF_HEADER;
+    logRecord.logHeader.ntfHdr.notificationId = 1;
+    logRecord.logHeader.ntfHdr.eventType = SA_NTF_ALARM_COMMUNICATION;
+    logRecord.logHeader.ntfHdr.notificationObject = &object;
+    logRecord.logHeader.ntfHdr.notifyingObject = &notifyingObject;
+    logRecord.logHeader.ntfHdr.notificationClassId = &classId;
+  } else {
+    logRecord.logHdrType = SA_LOG_GENERIC_HEADER;
+    logRecord.logHeader.genericHdr.notificationClassId = &classId;
+    logRecord.logHeader.genericHdr.logSvcUsrName = &userName;
+    logRecord.logHeader.genericHdr.logSeverity = SA_LOG_SEV_INFO;
+  }
+
+  osaf_clock_gettime(CLOCK_REALTIME, &start);
+  logRecord.logTimeStamp = osaf_timespec_to_nanos(&start);
+
+  osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+  for (unsigned int i = 0; i < numRecords; ++i) {
+    logRecord.logTimeStamp += stepMillis * SA_TIME_ONE_MILLISECOND;
+    if (ntfHeader) {
+      logRecord.logHeader.ntfHdr.eventTime = logRecord.logTimeStamp;
+    }
+    n = lgs_format_log_record(
+        &logRecord, const_cast<SaStringT>(formatExpression), UINT64_MAX,
+        fixedSize, destSize, dest, i + 1, nodeName);
+    if (n == 0) {
+      fprintf(stderr, "lgs_format_log_record FAILED\n");
+      exit(EXIT_FAILURE);
+    }
+    bytes += n;
+  }
+  osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+
+  osaf_timespec_subtract(&end, &start, &diff);
+  seconds = osaf_timespec_to_double(&diff);
+  printf("Format: %s\n", formatExpression);
+  printf("Last record: %.*s", n, dest);
+  printf("%u records in %.3f s: %.0f records/s, %.1f ns/record, %.1f MB/s\n",
+         numRecords, seconds, numRecords / seconds,
+         seconds * 1e9 / numRecords, bytes / seconds / 1e6);
+
+  free(dest);
+  free(body);
+  return EXIT_SUCCESS;
+}
@@ -51,6 +51,7 @@ client requests. mbcsv_process_initialize_request - Process Initialize request.
 */
 #include "mbcsv.h"
 #include "base/ncssysf_mem.h"
+#include "base/osaf_failover_timeline.h"
 
 static const MBCSV_PROCESS_REQ_FUNC_PTR
     mbcsv_init_process_req_func[NCS_MBCSV_OP_OBJ_SET + 1] = {
@@ -734,6 +735,10 @@ uint32_t mbcsv_process_chg_role_request(NCS_MBCSV_ARG *arg)
 		goto err2;
 	}
 
+	if (SA_AMF_HA_STANDBY == ckpt_inst->my_role &&
+	    SA_AMF_HA_ACTIVE == arg->info.chg_role.i_ha_state)
+		osaf_failover_timeline_mark("checkpoint role active");
+
 	/*
 	 * Send change role event to the mailbox.
 	 */
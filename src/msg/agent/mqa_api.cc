@@ -42,7 +42,8 @@ static SaAisErrorT mqa_send_to_destination(MQA_CB *mqa_cb,
                                            MDS_DEST *mqnd_mds_dest,
                                            MQSV_DSEND_EVT *qsend_evt,
                                            SaMsgAckFlagsT ackFlags,
-                                           SaTimeT timeout, uint32_t length);
+                                           SaTimeT timeout, uint32_t length,
+                                           uint32_t *num_msgs);
 static SaAisErrorT mqa_send_to_destination_async(MQA_CB *mqa_cb,
                                                  MDS_DEST *mqnd_mds_dest,
                                                  MQSV_DSEND_EVT *qsend_evt,
@@ -1693,6 +1694,8 @@ MQSV_DSEND_EVT to the queue denoted by destination and waits for ack.
                   MDS_DEST *mqnd_mds_dest - mds destination of mqnd.
                   MQSV_DSEND_EVT *qsend_evt - event structure containing the
 message. SaTimeT timeout - time wait for ack.
+                  uint32_t *num_msgs - if not NULL, the number of messages of a
+                  batch put in the queue.
 
   Return Values : SaAisErrorT
 
@@ -1702,7 +1705,7 @@ message. SaTimeT timeout - time wait for ack.
 SaAisErrorT mqa_send_to_destination(MQA_CB *mqa_cb, MDS_DEST *mqnd_mds_dest,
                                     MQSV_DSEND_EVT *qsend_evt,
                                     SaMsgAckFlagsT ackFlags, SaTimeT timeout,
-                                    uint32_t length) {
+                                    uint32_t length, uint32_t *num_msgs) {
   int64_t mqa_timeout;
   SaAisErrorT rc = SA_AIS_OK;
   MQSV_DSEND_EVT *out_evt = NULL;
@@ -1738,9 +1741,10 @@ SaAisErrorT mqa_send_to_destination(MQA_CB *mqa_cb, MDS_DEST *mqnd_mds_dest,
   }
 
   /* got the reply... do the needful. */
-  if (out_evt)
+  if (out_evt) {
     rc = out_evt->info.sendMsgRsp.error;
-  else {
+    if (num_msgs) *num_msgs = out_evt->info.sendMsgRsp.num_msgs;
+  } else {
     TRACE_4("ERR_RESOURCES: Response not received from MQND");
     rc = SA_AIS_ERR_NO_RESOURCES;
   }
@@ -1861,7 +1865,8 @@ SaAisErrorT mqa_send_to_group(MQA_CB *mqa_cb, ASAPi_OPR_INFO *asapi_or,
       qsend_evt->info.snd_msg.destination =
           asapi_or->info.dest.o_cache->info.ginfo.pQueue->param.name;
       rc = mqa_send_to_destination(mqa_cb, &destination_mqnd, qsend_evt,
-                                   ackFlags, param->info.timeout, length);
+                                   ackFlags, param->info.timeout, length,
+                                   NULL);
       if (rc != NCSCC_RC_SUCCESS) TRACE_2("Message Send through MDS Failure");
     } else {
       qsend_evt->info.sndMsgAsync.SendMsg.queueHandle =
@@ -1938,7 +1943,8 @@ SaAisErrorT mqa_send_to_group(MQA_CB *mqa_cb, ASAPi_OPR_INFO *asapi_or,
 
       if (!param->async_flag)
         status = mqa_send_to_destination(mqa_cb, &destination_mqnd, qsend_evt,
-                                         ackFlags, param->info.timeout, length);
+                                         ackFlags, param->info.timeout, length,
+                                         NULL);
       else
         status = mqa_send_to_destination_async(mqa_cb, &destination_mqnd,
                                                qsend_evt, length);
@@ -1986,6 +1992,81 @@ SaAisErrorT mqa_send_to_group(MQA_CB *mqa_cb, ASAPi_OPR_INFO *asapi_or,
   return rc;
 }
 
+/****************************************************************************
+  Name          : mqa_send_direct
+
+  Description   : This routine puts a message directly in the shared memory
+                  queue of a queue residing on this node and tells MQND to
+                  check the queue capacity.
+
+  Arguments     : MQA_CB *mqa_cb - MQA control block
+                  MDS_DEST *mqnd_mds_dest - MQND of the queue
+                  SaMsgQueueHandleT queueHandle - the queue
+                  const SaMsgMessageT *message - The message to be sent.
+                  uint32_t msg_fmt_ver - message format version
+
+  Return Values : SaAisErrorT, SA_AIS_ERR_NOT_SUPPORTED if the message must
+                  be sent through MQND.
+
+  Notes         : None
+******************************************************************************/
+static SaAisErrorT mqa_send_direct(MQA_CB *mqa_cb, MDS_DEST *mqnd_mds_dest,
+                                   SaMsgQueueHandleT queueHandle,
+                                   const SaMsgMessageT *message,
+                                   uint32_t msg_fmt_ver) {
+  NCS_OS_MQ_MSG mq_msg;
+  MQSV_MESSAGE *mqsv_message = (MQSV_MESSAGE *)mq_msg.data;
+  MQSV_DSEND_EVT *stats;
+  uint32_t size = sizeof(MQSV_MESSAGE) + message->size;
+  SaAisErrorT rc;
+
+  if (size > NCS_OS_MQ_MAX_PAYLOAD) return SA_AIS_ERR_NOT_SUPPORTED;
+
+  memset(mqsv_message, 0, sizeof(MQSV_MESSAGE));
+  mqsv_message->type = MQP_EVT_GET_REQ;
+  mqsv_message->mqsv_version = MQSV_MSG_VERSION;
+  mqsv_message->info.msg.message_info.sender.senderId = 0;
+  mqsv_message->info.msg.message_info.sendReceive = SA_FALSE;
+  m_GET_TIME_STAMP(mqsv_message->info.msg.message_info.sendTime);
+
+  mqsv_message->info.msg.message.type = message->type;
+  mqsv_message->info.msg.message.version = message->version;
+  mqsv_message->info.msg.message.size = message->size;
+  mqsv_message->info.msg.message.priority = message->priority;
+  if (message->senderName)
+    mqsv_message->info.msg.message.senderName = *message->senderName;
+  if (message->data)
+    memcpy(mqsv_message->info.msg.message.data, message->data, message->size);
+
+  rc = mqsv_shmq_direct_send(queueHandle, mqsv_message, size);
+  if (rc != SA_AIS_OK) return rc;
+
+  /* The message is in the queue and accounted for in it. MQND takes the
+   * queue status from there, a lost update only delays the capacity check */
+  stats = (MQSV_DSEND_EVT *)mds_alloc_direct_buff(sizeof(MQSV_DSEND_EVT));
+  if (!stats) {
+    TRACE_4("MQSV_DSEND_EVT Memory allocation failed");
+    return SA_AIS_OK;
+  }
+
+  memset(stats, 0, sizeof(MQSV_DSEND_EVT));
+  stats->evt_type = MQSV_DSEND_EVENT;
+  stats->endianness = machineEndianness();
+  stats->msg_fmt_version = msg_fmt_ver;
+  stats->src_dest_version = MQA_PVT_SUBPART_VERSION;
+  stats->type.req_type = MQP_EVT_SEND_STAT_UPD_REQ;
+  stats->agent_mds_dest = mqa_cb->mqa_mds_dest;
+  stats->info.statsReq.qhdl = queueHandle;
+  stats->info.statsReq.priority = message->priority;
+  stats->info.statsReq.size = message->size;
+
+  if (mqa_send_to_destination_async(mqa_cb, mqnd_mds_dest, stats,
+                                    sizeof(MQSV_DSEND_EVT)) != SA_AIS_OK)
+    TRACE_2("Queue status update through MDS Failure");
+
+  return SA_AIS_OK;
+}
+
 /****************************************************************************
   Name          : mqa_send_message
 
@@ -2131,6 +2212,17 @@ SaAisErrorT mqa_send_message(SaMsgHandleT msgHandle, const SaNameT *destination,
       rc = SA_AIS_ERR_LIBRARY;
       goto done;
     }
+
+    /* Queues on this node may be written directly, unless the sender
+     * waits for a delivered callback which only MQND can give */
+    if ((mqsv_get_node_id(destination_mqnd) == m_NCS_GET_NODE_ID) &&
+        !(param->async_flag && (ackFlags & SA_MSG_MESSAGE_DELIVERED_ACK))) {
+      rc = mqa_send_direct(mqa_cb, &destination_mqnd,
+                           asapi_or.info.dest.o_cache->info.qinfo.param.hdl,
+                           message, o_msg_fmt_ver);
+      if (rc != SA_AIS_ERR_NOT_SUPPORTED) goto done;
+      rc = SA_AIS_OK;
+    }
   }
 
   /* Allocate memory for the MQSV_DSEND_EVENT structure + data */
@@ -2212,7 +2304,7 @@ SaAisErrorT mqa_send_message(SaMsgHandleT msgHandle, const SaNameT *destination,
       if (!param->async_flag) {
         timeout = param->info.timeout;
         rc = mqa_send_to_destination(mqa_cb, &destination_mqnd, qsend_evt,
-                                     ackFlags, timeout, length);
+                                     ackFlags, timeout, length, NULL);
       } else {
         rc = mqa_send_to_destination_async(mqa_cb, &destination_mqnd, qsend_evt,
                                            length);
@@ -2420,6 +2512,291 @@ done:
   return rc;
 }
 
+/****************************************************************************
+  Name          : mqa_send_message_batch
+
+  Description   : This routine sends a batch of messages to the queue denoted
+                  by destination in one request to MQND and waits for ack.
+                  Messages to a queue group are sent one by one.
+
+  Arguments     : SaMsgHandleT msgHandle - The message handle
+                  const SaNameT *destination - destination queue name to send
+                  to. const SaMsgMessageT *messages - The messages to be sent.
+                  SaUint32T numberOfMessages - number of messages.
+                  SaUint32T *num_sent - number of messages put in the queue.
+                  SaTimeT timeout - time to wait for acknowledgement.
+                  MQA_CB *mqa_cb - MQA control block
+
+  Return Values : SaAisErrorT
+
+  Notes         : None
+******************************************************************************/
+
+static SaAisErrorT mqa_send_message_batch(SaMsgHandleT msgHandle,
+                                          const SaNameT *destination,
+                                          const SaMsgMessageT *messages,
+                                          SaUint32T numberOfMessages,
+                                          SaUint32T *num_sent, SaTimeT timeout,
+                                          MQA_CB *mqa_cb) {
+  MQA_CLIENT_INFO *client_info;
+  SaAisErrorT rc = SA_AIS_OK;
+  ASAPi_OPR_INFO asapi_or;
+  MQA_SEND_MESSAGE_PARAM param;
+  MQSV_DSEND_EVT *qsend_evt = NULL;
+  MDS_DEST destination_mqnd;
+  QUEUE_MESSAGE *qmsg;
+  bool lock_taken = false;
+  uint32_t i, o_msg_fmt_ver, to_dest_ver;
+  size_t length = sizeof(MQSV_DSEND_EVT);
+
+  TRACE_ENTER2(" SaMsgHandle %llu", msgHandle);
+
+  if ((destination == NULL) || (messages == NULL) || (numberOfMessages == 0)) {
+    TRACE_2("ERR_INVALID_PARAM: destination or messages is NULL");
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  if (destination->length > SA_MAX_NAME_LENGTH) {
+    TRACE_2("ERR_INVALID_PARAM: destinationName exceeds character 256");
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  for (i = 0; i < numberOfMessages; i++) {
+    if (messages[i].priority > SA_MSG_MESSAGE_LOWEST_PRIORITY) {
+      TRACE_2("ERR_INVALID_PARAM: priority of message should not exceed 3");
+      return SA_AIS_ERR_INVALID_PARAM;
+    }
+    length += m_MQSV_BATCH_MSG_LEN(messages[i].size);
+    if (length > MDS_DIRECT_BUF_MAXSIZE) {
+      TRACE_2("ERR_TOO_BIG: The batch does not fit a MDS direct buffer");
+      return SA_AIS_ERR_TOO_BIG;
+    }
+  }
+
+  if (m_NCS_LOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
+    TRACE_4("ERR_LIBRARY: Lock failed for control block write");
+    return SA_AIS_ERR_LIBRARY;
+  }
+  lock_taken = true;
+
+  if (!mqa_cb->is_mqd_up) {
+    TRACE_2("ERR_TRY_AGAIN: MQD is down");
+    rc = SA_AIS_ERR_TRY_AGAIN;
+    goto done;
+  }
+
+  client_info = mqa_client_tree_find_and_add(mqa_cb, msgHandle, false);
+  if (!client_info) {
+    TRACE_2("ERR_BAD_HANDLE: Client Database Find Failed");
+    rc = SA_AIS_ERR_BAD_HANDLE;
+    goto done;
+  }
+
+  /* Get the destination MQND from ASAPi */
+  memset(&asapi_or, 0, sizeof(asapi_or));
+  asapi_or.type = ASAPi_OPR_GET_DEST;
+  asapi_or.info.dest.i_object = *destination;
+  m_ASAPi_TRACK_ENABLE_SET(asapi_or.info.dest.i_track);
+  asapi_or.info.dest.i_sinfo.to_svc = NCSMDS_SVC_ID_MQD;
+  asapi_or.info.dest.i_sinfo.dest = mqa_cb->mqd_mds_dest;
+  asapi_or.info.dest.i_sinfo.stype = MDS_SENDTYPE_SNDRSP;
+
+  m_NCS_UNLOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE);
+  lock_taken = false;
+
+  if ((rc = asapi_opr_hdlr(&asapi_or)) != SA_AIS_OK) {
+    TRACE_2("The ASAPi Get Dest Operation Failed");
+    goto done;
+  }
+
+  if (m_NCS_LOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
+    TRACE_4("ERR_LIBRARY: Lock failed for control block write");
+    rc = SA_AIS_ERR_LIBRARY;
+    goto done;
+  }
+  lock_taken = true;
+
+  if (!asapi_or.info.dest.o_cache) {
+    TRACE_2(
+        "ERR_EXIST: The ASAPi Get Dest Operation's result Cache does not exist");
+    rc = SA_AIS_ERR_NOT_EXIST;
+    goto done;
+  }
+
+  if (asapi_or.info.dest.o_cache->objtype != ASAPi_OBJ_QUEUE) {
+    /* The group policy picks the queue per message */
+    m_NCS_UNLOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE);
+    lock_taken = false;
+
+    param.async_flag = false;
+    param.info.timeout = timeout;
+    for (i = 0; i < numberOfMessages; i++) {
+      rc = mqa_send_message(msgHandle, destination, &messages[i],
+                            SA_MSG_MESSAGE_DELIVERED_ACK, &param, mqa_cb);
+      if (rc != SA_AIS_OK) break;
+      (*num_sent)++;
+    }
+    goto done;
+  }
+
+  destination_mqnd = asapi_or.info.dest.o_cache->info.qinfo.param.addr;
+
+  to_dest_ver = mqa_cb->ver_mqnd[mqsv_get_node_id(destination_mqnd)];
+
+  /* MQND HAS GONE DOWN OR NOT YET UP */
+  if (to_dest_ver == 0) {
+    TRACE_2("ERR_TRY_AGAIN: MQND HAS GONE DOWN");
+    rc = SA_AIS_ERR_TRY_AGAIN;
+    goto done;
+  }
+
+  o_msg_fmt_ver = m_NCS_ENC_MSG_FMT_GET(
+      to_dest_ver, MQA_WRT_MQND_SUBPART_VER_AT_MIN_MSG_FMT,
+      MQA_WRT_MQND_SUBPART_VER_AT_MAX_MSG_FMT, mqa_mqnd_msg_fmt_table);
+  if (!o_msg_fmt_ver) {
+    /* Drop The Message */
+    TRACE_4("ERR_LIBRARY: Message Format version Invalid %u", o_msg_fmt_ver);
+    rc = SA_AIS_ERR_LIBRARY;
+    goto done;
+  }
+
+  qsend_evt = (MQSV_DSEND_EVT *)mds_alloc_direct_buff(length);
+  if (!qsend_evt) {
+    rc = SA_AIS_ERR_NO_MEMORY;
+    goto done;
+  }
+
+  memset(qsend_evt, 0, length);
+  qsend_evt->evt_type = MQSV_DSEND_EVENT;
+  qsend_evt->endianness = machineEndianness();
+  qsend_evt->agent_mds_dest = mqa_cb->mqa_mds_dest;
+  qsend_evt->msg_fmt_version = o_msg_fmt_ver;
+  qsend_evt->src_dest_version = MQA_PVT_SUBPART_VERSION;
+  qsend_evt->type.req_type = MQP_EVT_SEND_MSG_BATCH;
+
+  qsend_evt->info.sndMsgBatch.msgHandle = msgHandle;
+  qsend_evt->info.sndMsgBatch.queueHandle =
+      asapi_or.info.dest.o_cache->info.qinfo.param.hdl;
+  qsend_evt->info.sndMsgBatch.destination = *destination;
+  qsend_evt->info.sndMsgBatch.num_msgs = numberOfMessages;
+
+  qmsg = (QUEUE_MESSAGE *)(qsend_evt + 1);
+  for (i = 0; i < numberOfMessages; i++) {
+    qmsg->type = messages[i].type;
+    qmsg->version = messages[i].version;
+    qmsg->size = messages[i].size;
+    qmsg->priority = messages[i].priority;
+    if (messages[i].senderName) qmsg->senderName = *messages[i].senderName;
+    if (messages[i].data)
+      memcpy(qmsg->data, messages[i].data, messages[i].size);
+    qmsg = (QUEUE_MESSAGE *)((char *)qmsg +
+                             m_MQSV_BATCH_MSG_LEN(messages[i].size));
+  }
+
+  rc = mqa_send_to_destination(mqa_cb, &destination_mqnd, qsend_evt,
+                               SA_MSG_MESSAGE_DELIVERED_ACK, timeout, length,
+                               num_sent);
+  if (rc == SA_AIS_OK)
+    *num_sent = numberOfMessages;
+  else
+    TRACE_2("Message batch Send through MDS Failure");
+
+done:
+  if (lock_taken) m_NCS_UNLOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE);
+
+  TRACE_LEAVE2("return code %d", rc);
+  return rc;
+}
+
+/****************************************************************************
+  Name          : saMsgMessageSendBatch
+
+  Description   : This routine sends a batch of messages to the queue denoted
+                  by destination and waits until they are put in the queue,
+                  in order, up to the first one that fails.
+
+  Arguments     : SaMsgHandleT msgHandle - The message handle
+                  const SaNameT *destination - destination queue name to send
+                  to. const SaMsgMessageT *messages - The messages to be sent.
+                  SaUint32T *numberOfMessages - in: number of messages, out:
+                  number of messages put in the queue.
+                  SaTimeT timeout - time to wait for acknowledgement.
+
+  Return Values : SaAisErrorT
+
+  Notes         : None
+******************************************************************************/
+
+SaAisErrorT saMsgMessageSendBatch(SaMsgHandleT msgHandle,
+                                  const SaNameT *destination,
+                                  const SaMsgMessageT *messages,
+                                  SaUint32T *numberOfMessages,
+                                  SaTimeT timeout) {
+  MQA_CB *mqa_cb;
+  SaAisErrorT rc;
+  MQA_CLIENT_INFO *client_info = NULL;
+  SaUint32T num_msgs;
+
+  TRACE_ENTER2(" SaMsgHandle %llu", msgHandle);
+
+  if (!numberOfMessages) {
+    TRACE_2("ERR_INVALID_PARAM: numberOfMessages is NULL");
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+  num_msgs = *numberOfMessages;
+  *numberOfMessages = 0;
+
+  /* retrieve MQA CB */
+  mqa_cb = (MQA_CB *)m_MQSV_MQA_RETRIEVE_MQA_CB;
+  if (!mqa_cb) {
+    TRACE_2("ERR_BAD_HANDLE: Control block retrieval failed");
+    return SA_AIS_ERR_BAD_HANDLE;
+  }
+
+  client_info = mqa_client_tree_find_and_add(mqa_cb, msgHandle, false);
+
+  if (!client_info) {
+    TRACE_2("ERR_BAD_HANDLE: Client Database Find Failed");
+    rc = SA_AIS_ERR_BAD_HANDLE;
+    goto done;
+  }
+
+  if (client_info->version.majorVersion == MQA_MAJOR_VERSION) {
+    if (!mqa_cb->clm_node_joined || client_info->isStale) {
+      TRACE_2("ERR_UNAVAILABLE: node is not cluster member");
+      rc = SA_AIS_ERR_UNAVAILABLE;
+      goto done;
+    }
+  }
+
+  if (m_NCS_SA_IS_VALID_TIME_DURATION(timeout) == false) {
+    TRACE_2("ERR_INVALID_PARAM: Invalid Parameter as input");
+    rc = SA_AIS_ERR_INVALID_PARAM;
+    goto done;
+  }
+
+  if (m_MQSV_CONVERT_SATIME_TEN_MILLI_SEC(timeout) < NCS_SAF_MIN_ACCEPT_TIME) {
+    TRACE_2("ERR_TIMEOUT: Invalid Parameter as input");
+    rc = SA_AIS_ERR_TIMEOUT;
+    goto done;
+  }
+
+  rc = mqa_send_message_batch(msgHandle, destination, messages, num_msgs,
+                              numberOfMessages, timeout, mqa_cb);
+
+done:
+  /* return MQA CB */
+  m_MQSV_MQA_GIVEUP_MQA_CB;
+
+  if (rc == SA_AIS_OK) {
+    TRACE_LEAVE2(" Success ");
+  } else {
+    if (rc == SA_AIS_ERR_TRY_AGAIN) MQA_TRY_AGAIN_WAIT;
+    TRACE_LEAVE2(" Failed with return code %d", rc);
+  }
+  return rc;
+}
+
 /****************************************************************************
   Name          : mqa_receive_message
 
@@ -2572,7 +2949,7 @@ SaAisErrorT mqa_receive_message(SaMsgQueueHandleT queueHandle,
 again:
   posix_mq_get_failure = false;
 
-  if (ncs_os_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
+  if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
     if (timeout == 0) {
       TRACE_2("ERR_TIMEOUT: Message get failed ");
       rc = SA_AIS_ERR_TIMEOUT;
@@ -2636,7 +3013,7 @@ again:
         mq_req_snd.info.send.i_msg = &mq_msg;
         mq_req_snd.info.send.i_mtype = 2;
 
-        if (ncs_os_posix_mq(&mq_req_snd) != NCSCC_RC_SUCCESS) {
+        if (mqsv_posix_mq(&mq_req_snd) != NCSCC_RC_SUCCESS) {
           TRACE_4(
               "ERR_RESOURCES: Unable to put back the genuine message in msgget call");
           rc = SA_AIS_ERR_NO_RESOURCES;
@@ -2686,7 +3063,7 @@ again:
       mq_req_snd.info.send.i_msg = &mq_msg;
       mq_req_snd.info.send.i_mtype = 1;
 
-      if (ncs_os_posix_mq(&mq_req_snd) != NCSCC_RC_SUCCESS) {
+      if (mqsv_posix_mq(&mq_req_snd) != NCSCC_RC_SUCCESS) {
         TRACE_4(
             "ERR_RESOURCES: Unable to put back the stop Tmr message"
             " which is meant for a different msgget");
@@ -2788,7 +3165,7 @@ again:
       mq_req.info.send.i_msg = &mq_msg;
       mq_req.info.send.i_mtype = 2;
 
-      if (ncs_os_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
+      if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
         TRACE_4("Unable to put back the genuine message in msgget call");
         /* TBD: Don't know what to do */
       }
@@ -2910,7 +3287,7 @@ check:
     mq_req.info.send.i_msg = &mq_msg;
     mq_req.info.send.i_mtype = 2;
 
-    if (ncs_os_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
+    if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
       TRACE_4("Unable to put back the genuine message in msgget call");
       /* TBD: Don't know what to do */
     }
@@ -3042,6 +3419,249 @@ SaAisErrorT saMsgMessageGet(SaMsgQueueHandleT queueHandle,
   return rc;
 }
 
+/****************************************************************************
+  Name          : mqa_receive_message_batch
+
+  Description   : This routine receives, without waiting, the messages that
+                  are in the queue pointed by queuehandle and updates the
+                  queue stats for all of them with one message to MQND. It
+                  stops at a message that needs the handling of
+                  mqa_receive_message(), i.e. a cancel or timer message, a
+                  message sent by saMsgMessageSendReceive or a message that
+                  does not fit its buffer, and leaves it in the queue.
+
+  Arguments     : MQA_CB *mqa_cb - MQA control block
+                  SaMsgQueueHandleT queueHandle - queue handle to get messages
+                  from. SaMsgMessageBatchEntryT *entries - Buffers to receive
+                  the messages. uint32_t max_msgs - number of entries.
+
+  Return Values : Number of messages received
+
+  Notes         : None
+******************************************************************************/
+
+static uint32_t mqa_receive_message_batch(MQA_CB *mqa_cb,
+                                          SaMsgQueueHandleT queueHandle,
+                                          SaMsgMessageBatchEntryT *entries,
+                                          uint32_t max_msgs) {
+  NCS_OS_POSIX_MQ_REQ_INFO mq_req;
+  NCS_OS_MQ_MSG mq_msg;
+  MQSV_MESSAGE *mqsv_message = (MQSV_MESSAGE *)mq_msg.data;
+  MQSV_DSEND_EVT *stats;
+  SaMsgMessageT *message;
+  void *data;
+  bool take;
+  uint32_t count = 0, to_dest_ver = 0, o_msg_fmt_ver;
+
+  TRACE_ENTER2(" SaMsgQueueHandle %llu ", queueHandle);
+
+  if ((stats = (MQSV_DSEND_EVT *)mds_alloc_direct_buff(
+           sizeof(MQSV_DSEND_EVT))) == NULL) {
+    TRACE_4("ERR_MEMORY: MQSV_DSEND_EVT Memory allocation failed");
+    return 0;
+  }
+  memset(stats, 0, sizeof(MQSV_DSEND_EVT));
+
+  while (count < max_msgs) {
+    memset(&mq_req, 0, sizeof(NCS_OS_POSIX_MQ_REQ_INFO));
+    mq_req.req = NCS_OS_POSIX_MQ_REQ_MSG_RECV_ASYNC;
+    mq_req.info.recv.mqd = queueHandle;
+    mq_req.info.recv.i_msg = &mq_msg;
+    mq_req.info.recv.datalen = NCS_OS_MQ_MAX_PAYLOAD;
+    mq_req.info.recv.i_mtype = -7;
+
+    if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) break;
+
+    message = &entries[count].message;
+    data = message->data;
+    take = false;
+
+    if ((mqsv_message->type == MQP_EVT_GET_REQ) &&
+        (mqsv_message->info.msg.message_info.sendReceive == SA_FALSE)) {
+      if (!data) {
+        /* This memory allocated has to be freed by the application */
+        if (mqsv_message->info.msg.message.size != 0)
+          data = malloc((uint32_t)mqsv_message->info.msg.message.size);
+        take = (data || mqsv_message->info.msg.message.size == 0);
+      } else {
+        take = (mqsv_message->info.msg.message.size <= message->size);
+      }
+    }
+
+    if (!take) {
+      /* Post the message back to Queue, a cancel or stop timer message
+         with the highest priority and any other message with the second
+         highest priority */
+      memset(&mq_req, 0, sizeof(NCS_OS_POSIX_MQ_REQ_INFO));
+      mq_req.req = NCS_OS_POSIX_MQ_REQ_MSG_SEND_ASYNC;
+      mq_req.info.send.mqd = queueHandle;
+      mq_req.info.send.i_msg = &mq_msg;
+      if (mqsv_message->type == MQP_EVT_GET_REQ) {
+        mq_req.info.send.datalen =
+            sizeof(MQSV_MESSAGE) + mqsv_message->info.msg.message.size;
+        mq_req.info.send.i_mtype = 2;
+      } else {
+        mq_req.info.send.datalen = sizeof(MQSV_MESSAGE);
+        mq_req.info.send.i_mtype = 1;
+      }
+
+      if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS)
+        TRACE_4("Unable to put back the message in msgget batch call");
+      break;
+    }
+
+    message->data = data;
+    memcpy(message->data, mqsv_message->info.msg.message.data,
+           mqsv_message->info.msg.message.size);
+    message->priority = mqsv_message->info.msg.message.priority;
+    message->size = mqsv_message->info.msg.message.size;
+    message->type = mqsv_message->info.msg.message.type;
+    message->version = mqsv_message->info.msg.message.version;
+    if (message->senderName)
+      *message->senderName = mqsv_message->info.msg.message.senderName;
+    entries[count].senderId =
+        mqsv_message->info.msg.message_info.sender.senderId;
+    entries[count].sendTime = mqsv_message->info.msg.message_info.sendTime;
+
+    stats->info.statsBatchReq.num_msgs[message->priority]++;
+    stats->info.statsBatchReq.size[message->priority] += message->size;
+    count++;
+  }
+
+  if (count == 0) {
+    mds_free_direct_buff((MDS_DIRECT_BUFF)stats);
+    TRACE_LEAVE();
+    return 0;
+  }
+
+  if (m_NCS_LOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE) == NCSCC_RC_SUCCESS) {
+    to_dest_ver = mqa_cb->ver_mqnd[mqsv_get_node_id(mqa_cb->mqnd_mds_dest)];
+    m_NCS_UNLOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE);
+  }
+
+  o_msg_fmt_ver = m_NCS_ENC_MSG_FMT_GET(
+      to_dest_ver, MQA_WRT_MQND_SUBPART_VER_AT_MIN_MSG_FMT,
+      MQA_WRT_MQND_SUBPART_VER_AT_MAX_MSG_FMT, mqa_mqnd_msg_fmt_table);
+
+  /* The messages are received, the queue stats are updated by MQND as
+     soon as it gets to it */
+  stats->evt_type = MQSV_DSEND_EVENT;
+  stats->endianness = machineEndianness();
+  stats->msg_fmt_version = o_msg_fmt_ver;
+  stats->src_dest_version = MQA_PVT_SUBPART_VERSION;
+  stats->type.req_type = MQP_EVT_STAT_UPD_BATCH_REQ;
+  stats->agent_mds_dest = mqa_cb->mqa_mds_dest;
+  stats->info.statsBatchReq.qhdl = queueHandle;
+
+  if (!o_msg_fmt_ver) {
+    TRACE_2("Message Format version Invalid %u", o_msg_fmt_ver);
+    mds_free_direct_buff((MDS_DIRECT_BUFF)stats);
+  } else if (mqa_send_to_destination_async(mqa_cb, &mqa_cb->mqnd_mds_dest,
+                                           stats, sizeof(MQSV_DSEND_EVT)) !=
+             SA_AIS_OK) {
+    TRACE_2("Queue status update through MDS Failure");
+  }
+
+  TRACE_LEAVE2(" %u messages", count);
+  return count;
+}
+
+/****************************************************************************
+  Name          : saMsgMessageGetBatch
+
+  Description   : This routine receives up to *numberOfMessages messages from
+                  the queue pointed by queuehandle. Only the first message is
+                  waited for.
+
+  Arguments     : SaMsgQueueHandleT queueHandle - queue handle to get messages
+                  from. SaMsgMessageBatchEntryT *entries - Buffers to receive
+                  the messages, see saMsgMessageGet.
+                  SaUint32T *numberOfMessages - number of entries, returns
+                  the number of messages received.
+                  SaTimeT timeout - Time to wait for the first message.
+
+  Return Values : SaAisErrorT
+
+  Notes         : None
+******************************************************************************/
+
+SaAisErrorT saMsgMessageGetBatch(SaMsgQueueHandleT queueHandle,
+                                 SaMsgMessageBatchEntryT *entries,
+                                 SaUint32T *numberOfMessages,
+                                 SaTimeT timeout) {
+  SaAisErrorT rc = SA_AIS_OK;
+  MQA_QUEUE_INFO *queue_node;
+  MQA_CB *mqa_cb;
+  uint32_t count = 0;
+
+  TRACE_ENTER2(" SaMsgQueueHandle %llu ", queueHandle);
+
+  if (m_NCS_SA_IS_VALID_TIME_DURATION(timeout) == false) {
+    TRACE_2("ERR_INVALID_PARAM: Invalid Parameter as input");
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  if (!entries || !numberOfMessages || (*numberOfMessages == 0)) {
+    TRACE_2("ERR_INVALID_PARAM: entries is NULL or empty");
+    return SA_AIS_ERR_INVALID_PARAM;
+  }
+
+  /* retrieve MQA CB */
+  mqa_cb = (MQA_CB *)m_MQSV_MQA_RETRIEVE_MQA_CB;
+  if (!mqa_cb) {
+    TRACE_2("ERR_BAD_HANDLE: Control block retrieval failed");
+    return SA_AIS_ERR_BAD_HANDLE;
+  }
+
+  if (m_NCS_LOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE) != NCSCC_RC_SUCCESS) {
+    m_MQSV_MQA_GIVEUP_MQA_CB;
+    TRACE_4("ERR_LIBRARY: Lock failed for control block write");
+    return SA_AIS_ERR_LIBRARY;
+  }
+
+  if (!mqa_cb->is_mqnd_up) {
+    TRACE_2("ERR_TRY_AGAIN: MQND is down");
+    rc = SA_AIS_ERR_TRY_AGAIN;
+  } else if ((queue_node = mqa_queue_tree_find_and_add(
+                  mqa_cb, queueHandle, false, NULL, 0)) == NULL) {
+    TRACE_2("ERR_BAD_HANDLE: Queue Database Find Failed");
+    rc = SA_AIS_ERR_BAD_HANDLE;
+  } else if ((queue_node->client_info->version.majorVersion ==
+              MQA_MAJOR_VERSION) &&
+             (!mqa_cb->clm_node_joined || queue_node->client_info->isStale)) {
+    TRACE_2("ERR_UNAVAILABLE: MQD or MQND is down");
+    rc = SA_AIS_ERR_UNAVAILABLE;
+  }
+
+  m_NCS_UNLOCK(&mqa_cb->cb_lock, NCS_LOCK_WRITE);
+
+  if (rc != SA_AIS_OK) goto done;
+
+  count = mqa_receive_message_batch(mqa_cb, queueHandle, entries,
+                                    *numberOfMessages);
+  if (count == 0) {
+    /* Wait for the first message, or get the one left in the queue */
+    rc = mqa_receive_message(queueHandle, &entries[0].message,
+                             &entries[0].sendTime, &entries[0].senderId,
+                             timeout);
+    if (rc != SA_AIS_OK) goto done;
+
+    count = 1 + mqa_receive_message_batch(mqa_cb, queueHandle, entries + 1,
+                                          *numberOfMessages - 1);
+  }
+
+  *numberOfMessages = count;
+
+done:
+  m_MQSV_MQA_GIVEUP_MQA_CB;
+
+  if (rc == SA_AIS_OK)
+    TRACE_LEAVE2(" Success, %u messages ", count);
+  else
+    TRACE_LEAVE2(" Failed with return code %d", rc);
+  return rc;
+}
+
 /****************************************************************************
   Name          : saMsgMessageCancel
 
@@ -3130,7 +3750,7 @@ SaAisErrorT saMsgMessageCancel(SaMsgQueueHandleT queueHandle) {
   /* Send the message from the Queue using the OS call ->ncs_os_mq() */
 
   for (i = 0; i < cancel_message_count; i++) {
-    if (m_NCS_OS_POSIX_MQ(&mq_req) != NCSCC_RC_SUCCESS) {
+    if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
       TRACE_2("ERR_TRY_AGAIN: Unable to put the cancel message in the queue");
       rc = SA_AIS_ERR_TRY_AGAIN;
     }
@@ -5859,7 +6479,7 @@ static void msgget_timer_expired(void *arg) {
   mq_req.info.send.mqd = (*cancel_req)->queueHandle;
   mq_req.info.send.i_mtype = 1;
 
-  if ((rc = m_NCS_OS_POSIX_MQ(&mq_req)) != NCSCC_RC_SUCCESS) {
+  if ((rc = mqsv_posix_mq(&mq_req)) != NCSCC_RC_SUCCESS) {
     TRACE_4("Unable to put the cancel message in the queue");
   }
 
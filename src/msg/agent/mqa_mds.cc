@@ -912,6 +912,8 @@ uint32_t mqa_mds_msg_sync_send_direct(uint32_t mqa_mds_hdl,
         /* saMsgMessageSend response from MQND */
         pEvt->info.sendMsgRsp.error = static_cast<SaAisErrorT>(
             m_MQSV_REVERSE_ENDIAN_L(&pEvt->info.sendMsgRsp.error, endianness));
+        pEvt->info.sendMsgRsp.num_msgs = m_MQSV_REVERSE_ENDIAN_L(
+            &pEvt->info.sendMsgRsp.num_msgs, endianness);
         pEvt->info.sendMsgRsp.msgHandle = m_MQSV_REVERSE_ENDIAN_LL(
             &pEvt->info.sendMsgRsp.msgHandle, endianness);
       } else {
@@ -0,0 +1,209 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility measuring the rate of message
+ * sends and gets on a message queue, one message per call with
+ * saMsgMessageSend/saMsgMessageGet and a batch per call with
+ * saMsgMessageSendBatch/saMsgMessageGetBatch.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <libgen.h>
+
+#include <saAis.h>
+#include <saMsg.h>
+#include <saMsg_B_03_02.h>
+#include "base/osaf_time.h"
+#include "osaf/apitest/bench.h"
+
+#define BENCH_QUEUE_NAME "safMq=msgbench"
+
+static SaVersionT msgVersion = {'B', 3, 1};
+static unsigned int numMsgs = 10000;
+static unsigned int batchSize = 32;
+static unsigned int msgSize = 64;
+
+static void usage(const char *progname)
+{
+	static const char *const options[] = {
+	    "-n, --messages <n>     number of messages per run (default 10000)",
+	    "-b, --batch <n>        number of messages per batch (default 32)",
+	    "-s, --size <n>         message size in bytes (default 64)",
+	    NULL};
+
+	bench_usage(
+	    progname, "measure the MSG send and get rate",
+	    "is a MSG test client sending messages to a queue of its own and\n"
+	    "\tgetting them back, first one message per call and then a batch of\n"
+	    "\tmessages per call, reporting the number of messages per second.\n"
+	    "\tThe queue " BENCH_QUEUE_NAME " is created and removed.\n",
+	    options, "-n 100000 -b 64");
+}
+
+static double bench_elapsed(const struct timespec *start)
+{
+	struct timespec end, elapsed;
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &end);
+	osaf_timespec_subtract(&end, start, &elapsed);
+	return osaf_timespec_to_double(&elapsed);
+}
+
+static void bench_report(const char *what, unsigned int msgs, double secs)
+{
+	printf("%-6s messages:%u size:%u time:%.3fs rate:%.1f msgs/s\n", what,
+	       msgs, msgSize, secs, msgs / secs);
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"messages", required_argument, 0, 'n'},
+					{"batch", required_argument, 0, 'b'},
+					{"size", required_argument, 0, 's'},
+					{0, 0, 0, 0}};
+	SaMsgHandleT msgHandle;
+	SaMsgQueueHandleT queueHandle;
+	SaMsgQueueCreationAttributesT attr;
+	SaNameT queueName;
+	SaMsgMessageT *msgs;
+	SaMsgMessageBatchEntryT *entries;
+	SaMsgSenderIdT senderId;
+	SaTimeT sendTime;
+	struct timespec start;
+	unsigned int i, n, count, p;
+	char *data;
+	SaAisErrorT rc;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "hn:b:s:", long_options, NULL)) !=
+	       -1) {
+		switch (c) {
+		case 'n':
+			numMsgs = strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			batchSize = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			msgSize = strtoul(optarg, NULL, 0);
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numMsgs == 0 || batchSize == 0 || msgSize == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	msgs = calloc(batchSize, sizeof(SaMsgMessageT));
+	entries = calloc(batchSize, sizeof(SaMsgMessageBatchEntryT));
+	data = calloc(batchSize, msgSize);
+	if (msgs == NULL || entries == NULL || data == NULL) {
+		fprintf(stderr, "calloc FAILED\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < batchSize; ++i) {
+		msgs[i].size = msgSize;
+		msgs[i].data = data + i * msgSize;
+		msgs[i].priority = SA_MSG_MESSAGE_LOWEST_PRIORITY;
+		entries[i].message.size = msgSize;
+		entries[i].message.data = data + i * msgSize;
+	}
+
+	queueName.length = strlen(BENCH_QUEUE_NAME);
+	memcpy(queueName.value, BENCH_QUEUE_NAME, queueName.length);
+
+	rc = saMsgInitialize(&msgHandle, NULL, &msgVersion);
+	if (rc != SA_AIS_OK)
+		bench_fail("saMsgInitialize", rc);
+
+	/* Room for all messages of a run */
+	memset(&attr, 0, sizeof(attr));
+	attr.creationFlags = 0;
+	attr.retentionTime = 0;
+	for (p = 0; p <= SA_MSG_MESSAGE_LOWEST_PRIORITY; ++p)
+		attr.size[p] = (SaSizeT)numMsgs * msgSize;
+
+	rc = saMsgQueueOpen(msgHandle, &queueName, &attr, SA_MSG_QUEUE_CREATE,
+			    SA_TIME_ONE_SECOND * 10, &queueHandle);
+	if (rc != SA_AIS_OK)
+		bench_fail("saMsgQueueOpen", rc);
+
+	/* One message per call */
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numMsgs; ++i) {
+		rc = saMsgMessageSend(msgHandle, &queueName, &msgs[0],
+				      SA_TIME_ONE_SECOND * 10);
+		if (rc != SA_AIS_OK)
+			bench_fail("saMsgMessageSend", rc);
+	}
+	bench_report("send", numMsgs, bench_elapsed(&start));
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numMsgs; ++i) {
+		entries[0].message.size = msgSize;
+		rc = saMsgMessageGet(queueHandle, &entries[0].message,
+				     &sendTime, &senderId,
+				     SA_TIME_ONE_SECOND * 10);
+		if (rc != SA_AIS_OK)
+			bench_fail("saMsgMessageGet", rc);
+	}
+	bench_report("get", numMsgs, bench_elapsed(&start));
+
+	/* A batch per call */
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numMsgs; i += n) {
+		n = numMsgs - i < batchSize ? numMsgs - i : batchSize;
+		rc = saMsgMessageSendBatch(msgHandle, &queueName, msgs, &n,
+					   SA_TIME_ONE_SECOND * 10);
+		if (rc != SA_AIS_OK)
+			bench_fail("saMsgMessageSendBatch", rc);
+	}
+	bench_report("sendB", numMsgs, bench_elapsed(&start));
+
+	osaf_clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < numMsgs; i += count) {
+		for (n = 0; n < batchSize; ++n)
+			entries[n].message.size = msgSize;
+		count = numMsgs - i < batchSize ? numMsgs - i : batchSize;
+		rc = saMsgMessageGetBatch(queueHandle, entries, &count,
+					  SA_TIME_ONE_SECOND * 10);
+		if (rc != SA_AIS_OK)
+			bench_fail("saMsgMessageGetBatch", rc);
+	}
+	bench_report("getB", numMsgs, bench_elapsed(&start));
+
+	saMsgQueueClose(queueHandle);
+	saMsgQueueUnlink(msgHandle, &queueName);
+	saMsgFinalize(msgHandle);
+	free(data);
+	free(entries);
+	free(msgs);
+	return EXIT_SUCCESS;
+}
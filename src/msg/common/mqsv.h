@@ -58,6 +58,7 @@
 /* SAF defines. */
 #include <saAis.h>
 #include <saMsg.h>
+#include <saMsg_B_03_02.h>
 #include "base/saf_def.h"
 
 /* Common MQSv defines */
@@ -73,6 +74,7 @@
 
 /* From /leap/os_svcs/leap_basic/inc */
 #include "msg/common/mqsv_common.h"
+#include "msg/common/mqsv_shmq.h"
 #include "base/ncs_util.h"
 
 #endif  // MSG_COMMON_MQSV_H_
@@ -66,7 +66,10 @@ typedef enum mqp_req_type {
   MQP_EVT_CAP_SET_REQ,
   MQP_EVT_CAP_GET_REQ,
   MQP_EVT_MDATA_GET_REQ,
-  MQP_EVT_LIMIT_GET_REQ
+  MQP_EVT_LIMIT_GET_REQ,
+  MQP_EVT_SEND_STAT_UPD_REQ, /* Message put directly in a shared memory queue */
+  MQP_EVT_SEND_MSG_BATCH,
+  MQP_EVT_STAT_UPD_BATCH_REQ
 } MQP_REQ_TYPE;
 
 /* Enums for MQP Message Types */
@@ -340,11 +343,25 @@ typedef struct mqp_send_msg_async {
   MQP_SEND_MSG SendMsg;
 } MQP_SEND_MSG_ASYNC;
 
+/* Structure used by MQA to send a batch of messages to a Queue sitting on
+ * MQND. The messages follow the event, each one a QUEUE_MESSAGE with its
+ * data occupying m_MQSV_BATCH_MSG_LEN(size) bytes */
+typedef struct mqp_send_msg_batch {
+  SaMsgHandleT msgHandle; /* Application Hdl */
+  SaMsgQueueHandleT queueHandle;
+  SaNameT destination; /* Queue Name */
+  uint8_t padding[2];
+  uint32_t num_msgs;
+} MQP_SEND_MSG_BATCH;
+
+#define m_MQSV_BATCH_MSG_LEN(size) \
+  ((offsetof(QUEUE_MESSAGE, data) + (size) + 7) & ~(size_t)7)
+
 /* Structure used by MQSV to ack the delivery of the sent message to MQA in Sync
  * send */
 typedef struct mqsv_send_msg_rsp {
   SaAisErrorT error;
-  uint32_t padding;
+  uint32_t num_msgs; /* Messages of a batch put in the queue */
   SaMsgHandleT msgHandle;
 } MQP_SEND_MSG_RSP;
 
@@ -372,6 +389,14 @@ typedef struct mqp_update_stats {
   uint32_t size;
 } MQP_UPDATE_STATS;
 
+/* Structure used by MQA to update the queue stats for a batch of received
+ * messages, per priority */
+typedef struct mqp_update_stats_batch {
+  SaMsgQueueHandleT qhdl;
+  uint32_t num_msgs[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+  uint32_t size[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+} MQP_UPDATE_STATS_BATCH;
+
 typedef struct mqp_stats_rsp {
   uint32_t dummy;
 } MQP_STATS_RSP;
@@ -638,6 +663,8 @@ typedef struct mqsv_direct_send_event {
     MQP_QUEUE_REPLY_MSG_ASYNC replyAsyncMsg;
     MQP_UPDATE_STATS statsReq;
     MQP_SEND_MSG_RSP sendMsgRsp;
+    MQP_SEND_MSG_BATCH sndMsgBatch;
+    MQP_UPDATE_STATS_BATCH statsBatchReq;
   } info;
 } MQSV_DSEND_EVT;
 
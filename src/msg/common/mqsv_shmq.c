@@ -0,0 +1,785 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*****************************************************************************
+  DESCRIPTION: Shared memory queue backend, see mqsv_shmq.h.
+******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "base/logtrace.h"
+#include "base/osaf_time.h"
+#include "msg/common/mqsv.h"
+
+#define MQSV_SHMQ_MAGIC 0x4d515348 /* "MQSH" */
+#define MQSV_SHMQ_VERSION 2
+
+/* Message types 1 to 6, see mqnd_mq_msg_send() */
+#define MQSV_SHMQ_NUM_RINGS 6
+#define MQSV_SHMQ_CTRL_RING_SIZE (16 * 1024)
+#define MQSV_SHMQ_PUTBACK_RING_SIZE (64 * 1024)
+
+/* Mappings of queues without a segment are looked up again after this */
+#define MQSV_SHMQ_NEGATIVE_TIMEOUT 1000 /* in ms */
+
+#define MQSV_SHMQ_MAP_BUCKETS 64
+
+/* A record in a ring is this header followed by the data, padded to the
+ * alignment. A record with mtype 0 marks that the next record starts at the
+ * beginning of the ring. */
+typedef struct mqsv_shmq_rec {
+	uint32_t len;
+	uint32_t mtype;
+} MQSV_SHMQ_REC;
+
+#define MQSV_SHMQ_ALIGN(len) (((len) + 7) & ~(uint64_t)7)
+
+typedef struct mqsv_shmq_ring {
+	uint64_t head;   /* read position, advanced by the consumer */
+	uint64_t tail;   /* write position, advanced by the producer */
+	uint64_t offset; /* of the ring from the start of the segment */
+	uint64_t size;   /* a power of two */
+	uint32_t count;  /* number of messages */
+	uint32_t padding;
+} MQSV_SHMQ_RING;
+
+typedef struct mqsv_shmq_hdr {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t seg_size;
+	SaMsgQueueHandleT qhdl;
+	SaMsgQueueHandleT listener;
+	uint32_t valid;   /* cleared when the queue is destroyed */
+	uint32_t direct;  /* senders on this node may enqueue directly */
+	uint32_t futex;   /* bumped on every enqueue */
+	uint32_t waiters; /* number of blocked receivers */
+	pthread_mutex_t prod_lock;
+	pthread_mutex_t cons_lock;
+	SaSizeT limit[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+	SaSizeT used[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+	SaUint32T msgs[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+	MQSV_SHMQ_RING ring[MQSV_SHMQ_NUM_RINGS];
+} MQSV_SHMQ_HDR;
+
+/* Process local mapping of a segment. hdr is NULL if the queue has no
+ * segment, or denied is set if this process may not access it. */
+typedef struct mqsv_shmq_map {
+	struct mqsv_shmq_map *next;
+	SaMsgQueueHandleT qhdl;
+	MQSV_SHMQ_HDR *hdr;
+	uint64_t size;
+	uint32_t refcount;
+	bool stale;
+	bool denied;
+	struct timespec lookup_time;
+} MQSV_SHMQ_MAP;
+
+static pthread_mutex_t shmq_map_lock = PTHREAD_MUTEX_INITIALIZER;
+static MQSV_SHMQ_MAP *shmq_maps[MQSV_SHMQ_MAP_BUCKETS];
+
+static void shmq_name(SaMsgQueueHandleT qhdl, char *name, size_t len)
+{
+	snprintf(name, len, "/opensaf_mqsv_shmq_%x_%llu", m_NCS_GET_NODE_ID,
+		 qhdl);
+}
+
+static uint64_t shmq_pow2(uint64_t size)
+{
+	uint64_t pow2 = 1024;
+
+	while (pow2 < size)
+		pow2 <<= 1;
+	return pow2;
+}
+
+static int futex(uint32_t *uaddr, int op, uint32_t val)
+{
+	return syscall(SYS_futex, uaddr, op, val, NULL, NULL, 0);
+}
+
+static void shmq_lock(pthread_mutex_t *lock)
+{
+	/* the state of the rings is only published after a record is
+	 * complete, so it is consistent even if the owner died */
+	if (pthread_mutex_lock(lock) == EOWNERDEAD)
+		pthread_mutex_consistent(lock);
+}
+
+static void shmq_unlock(pthread_mutex_t *lock) { pthread_mutex_unlock(lock); }
+
+static void shmq_init_lock(pthread_mutex_t *lock)
+{
+	pthread_mutexattr_t attr;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+	pthread_mutex_init(lock, &attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+static MQSV_SHMQ_HDR *shmq_attach(SaMsgQueueHandleT qhdl, uint64_t *size,
+				  bool *denied)
+{
+	char name[NAME_MAX];
+	struct stat st;
+	MQSV_SHMQ_HDR *hdr;
+	int fd;
+
+	shmq_name(qhdl, name, sizeof(name));
+	fd = shm_open(name, O_RDWR, 0);
+	if (fd < 0) {
+		*denied = (errno == EACCES);
+		return NULL;
+	}
+
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(MQSV_SHMQ_HDR)) {
+		close(fd);
+		return NULL;
+	}
+
+	hdr = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (hdr == MAP_FAILED)
+		return NULL;
+
+	if (hdr->magic != MQSV_SHMQ_MAGIC || hdr->version != MQSV_SHMQ_VERSION ||
+	    hdr->qhdl != qhdl ||
+	    __atomic_load_n(&hdr->valid, __ATOMIC_ACQUIRE) == 0) {
+		munmap(hdr, st.st_size);
+		return NULL;
+	}
+
+	*size = st.st_size;
+	return hdr;
+}
+
+static void shmq_map_free(MQSV_SHMQ_MAP *map)
+{
+	if (map->hdr != NULL)
+		munmap(map->hdr, map->size);
+	free(map);
+}
+
+/* Remove the mapping of qhdl from the table, it is freed when it is no
+ * longer used. Called with shmq_map_lock held. */
+static void shmq_map_unlink(SaMsgQueueHandleT qhdl)
+{
+	MQSV_SHMQ_MAP **prev = &shmq_maps[qhdl % MQSV_SHMQ_MAP_BUCKETS];
+	MQSV_SHMQ_MAP *map;
+
+	for (map = *prev; map != NULL; prev = &map->next, map = map->next) {
+		if (map->qhdl == qhdl) {
+			*prev = map->next;
+			map->stale = true;
+			if (map->refcount == 0)
+				shmq_map_free(map);
+			return;
+		}
+	}
+}
+
+/* Returns the mapping of the segment of qhdl, or NULL if the queue has none
+ * or denied is set. The mapping must be released with shmq_put(). */
+static MQSV_SHMQ_MAP *shmq_lookup(SaMsgQueueHandleT qhdl, bool *denied)
+{
+	MQSV_SHMQ_MAP *map;
+	struct timespec now;
+
+	*denied = false;
+	if (qhdl == 0)
+		return NULL;
+
+	osaf_clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+	pthread_mutex_lock(&shmq_map_lock);
+	for (map = shmq_maps[qhdl % MQSV_SHMQ_MAP_BUCKETS]; map != NULL;
+	     map = map->next) {
+		if (map->qhdl == qhdl)
+			break;
+	}
+
+	if (map != NULL) {
+		if (map->hdr != NULL) {
+			if (__atomic_load_n(&map->hdr->valid,
+					    __ATOMIC_ACQUIRE) != 0)
+				goto found;
+		} else {
+			struct timespec elapsed;
+
+			osaf_timespec_subtract(&now, &map->lookup_time,
+					       &elapsed);
+			if (osaf_timespec_to_millis(&elapsed) <
+			    MQSV_SHMQ_NEGATIVE_TIMEOUT)
+				goto found;
+		}
+		/* the queue was destroyed, or may have got a segment since
+		 * the last lookup */
+		shmq_map_unlink(qhdl);
+	}
+
+	map = calloc(1, sizeof(MQSV_SHMQ_MAP));
+	if (map == NULL) {
+		pthread_mutex_unlock(&shmq_map_lock);
+		return NULL;
+	}
+	map->qhdl = qhdl;
+	map->hdr = shmq_attach(qhdl, &map->size, &map->denied);
+	map->lookup_time = now;
+	map->next = shmq_maps[qhdl % MQSV_SHMQ_MAP_BUCKETS];
+	shmq_maps[qhdl % MQSV_SHMQ_MAP_BUCKETS] = map;
+	if (map->hdr != NULL)
+		TRACE("Attached shared memory queue %llu", qhdl);
+	else if (map->denied)
+		LOG_ER("No access to shared memory queue %llu, the process is "
+		       "not in the group of msgnd", qhdl);
+
+found:
+	if (map->hdr == NULL) {
+		*denied = map->denied;
+		pthread_mutex_unlock(&shmq_map_lock);
+		return NULL;
+	}
+	map->refcount++;
+	pthread_mutex_unlock(&shmq_map_lock);
+	return map;
+}
+
+static MQSV_SHMQ_MAP *shmq_get(SaMsgQueueHandleT qhdl)
+{
+	bool denied;
+
+	return shmq_lookup(qhdl, &denied);
+}
+
+static void shmq_put(MQSV_SHMQ_MAP *map)
+{
+	pthread_mutex_lock(&shmq_map_lock);
+	if (--map->refcount == 0 && map->stale)
+		shmq_map_free(map);
+	pthread_mutex_unlock(&shmq_map_lock);
+}
+
+static void shmq_wake(MQSV_SHMQ_HDR *hdr)
+{
+	__atomic_add_fetch(&hdr->futex, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&hdr->waiters, __ATOMIC_SEQ_CST) != 0)
+		futex(&hdr->futex, FUTEX_WAKE, INT_MAX);
+}
+
+/* Called with the producer lock held */
+static bool ring_put(MQSV_SHMQ_HDR *hdr, MQSV_SHMQ_RING *ring, uint32_t mtype,
+		     const void *data, uint32_t len)
+{
+	uint8_t *base = (uint8_t *)hdr + ring->offset;
+	uint64_t need = MQSV_SHMQ_ALIGN(sizeof(MQSV_SHMQ_REC) + len);
+	uint64_t tail = ring->tail;
+	uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	uint64_t pos = tail & (ring->size - 1);
+	uint64_t contig = ring->size - pos;
+	MQSV_SHMQ_REC *rec;
+
+	if (ring->size - (tail - head) < (contig < need ? contig + need : need))
+		return false;
+
+	if (contig < need) {
+		rec = (MQSV_SHMQ_REC *)(base + pos);
+		rec->len = 0;
+		rec->mtype = 0;
+		tail += contig;
+		pos = 0;
+	}
+
+	rec = (MQSV_SHMQ_REC *)(base + pos);
+	rec->len = len;
+	rec->mtype = mtype;
+	memcpy(rec + 1, data, len);
+
+	__atomic_add_fetch(&ring->count, 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&ring->tail, tail + need, __ATOMIC_RELEASE);
+	return true;
+}
+
+/* Called with the consumer lock held. Returns 1 if a message was read, 0 if
+ * the ring is empty and -1 if the message does not fit in the buffer. */
+static int ring_get(MQSV_SHMQ_HDR *hdr, MQSV_SHMQ_RING *ring, void *data,
+		    uint32_t max_len)
+{
+	uint8_t *base = (uint8_t *)hdr + ring->offset;
+	uint64_t head = ring->head;
+	uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+	MQSV_SHMQ_REC *rec;
+
+	if (head == tail)
+		return 0;
+
+	rec = (MQSV_SHMQ_REC *)(base + (head & (ring->size - 1)));
+	if (rec->mtype == 0) {
+		head += ring->size - (head & (ring->size - 1));
+		rec = (MQSV_SHMQ_REC *)base;
+	}
+
+	if (rec->len > max_len) {
+		__atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+		return -1;
+	}
+
+	memcpy(data, rec + 1, rec->len);
+	__atomic_sub_fetch(&ring->count, 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&ring->head,
+			 head + MQSV_SHMQ_ALIGN(sizeof(MQSV_SHMQ_REC) + rec->len),
+			 __ATOMIC_RELEASE);
+	return 1;
+}
+
+/* Queue usage of a genuine message, which the direct senders check against
+ * the queue size and MQND reports as the queue status. A message is added
+ * before it is published to the consumer, so the usage never underflows. */
+static void shmq_account(MQSV_SHMQ_HDR *hdr, const void *data, uint32_t len,
+			 bool add)
+{
+	const MQSV_MESSAGE *mqsv_msg = data;
+	uint8_t priority;
+
+	if (len < sizeof(MQSV_MESSAGE) || mqsv_msg->type != MQP_EVT_GET_REQ)
+		return;
+
+	priority = mqsv_msg->info.msg.message.priority;
+	if (priority > SA_MSG_MESSAGE_LOWEST_PRIORITY)
+		return;
+
+	if (add) {
+		__atomic_add_fetch(&hdr->used[priority],
+				   mqsv_msg->info.msg.message.size,
+				   __ATOMIC_RELAXED);
+		__atomic_add_fetch(&hdr->msgs[priority], 1, __ATOMIC_RELAXED);
+	} else {
+		__atomic_sub_fetch(&hdr->used[priority],
+				   mqsv_msg->info.msg.message.size,
+				   __ATOMIC_RELAXED);
+		__atomic_sub_fetch(&hdr->msgs[priority], 1, __ATOMIC_RELAXED);
+	}
+}
+
+static uint32_t shmq_send(MQSV_SHMQ_HDR *hdr, NCS_OS_POSIX_MQ_REQ_INFO *req)
+{
+	uint32_t mtype = req->info.send.i_mtype;
+	bool sent;
+
+	if (mtype < 1 || mtype > MQSV_SHMQ_NUM_RINGS)
+		return NCSCC_RC_FAILURE;
+
+	shmq_lock(&hdr->prod_lock);
+	shmq_account(hdr, req->info.send.i_msg->data, req->info.send.datalen,
+		     true);
+	sent = ring_put(hdr, &hdr->ring[mtype - 1], mtype,
+			req->info.send.i_msg->data, req->info.send.datalen);
+	if (!sent)
+		shmq_account(hdr, req->info.send.i_msg->data,
+			     req->info.send.datalen, false);
+	shmq_unlock(&hdr->prod_lock);
+
+	if (!sent) {
+		TRACE("Shared memory queue %llu is full for type %u", hdr->qhdl,
+		      mtype);
+		return NCSCC_RC_FAILURE;
+	}
+
+	shmq_wake(hdr);
+	return NCSCC_RC_SUCCESS;
+}
+
+static uint32_t shmq_recv(MQSV_SHMQ_HDR *hdr, NCS_OS_POSIX_MQ_REQ_INFO *req)
+{
+	int32_t mtype = req->info.recv.i_mtype;
+	uint32_t first, last, i;
+	int rc = 0;
+
+	/* same selection as msgrcv(): a negative type reads the lowest type
+	 * up to its absolute value, a positive type reads exactly that type */
+	if (mtype < 0) {
+		first = 1;
+		last = -mtype < MQSV_SHMQ_NUM_RINGS ? -mtype
+						     : MQSV_SHMQ_NUM_RINGS;
+	} else {
+		first = last = mtype;
+	}
+	if (first < 1 || last > MQSV_SHMQ_NUM_RINGS)
+		return NCSCC_RC_FAILURE;
+
+	for (;;) {
+		uint32_t seq = __atomic_load_n(&hdr->futex, __ATOMIC_SEQ_CST);
+
+		if (__atomic_load_n(&hdr->valid, __ATOMIC_ACQUIRE) == 0)
+			return NCSCC_RC_FAILURE;
+
+		shmq_lock(&hdr->cons_lock);
+		for (i = first; i <= last && rc == 0; i++) {
+			rc = ring_get(hdr, &hdr->ring[i - 1],
+				      req->info.recv.i_msg->data,
+				      req->info.recv.datalen);
+			if (rc > 0) {
+				req->info.recv.i_msg->ll_hdr = i;
+				shmq_account(hdr, req->info.recv.i_msg->data,
+					     req->info.recv.datalen, false);
+			}
+		}
+		shmq_unlock(&hdr->cons_lock);
+
+		if (rc > 0)
+			return NCSCC_RC_SUCCESS;
+		if (rc < 0 || req->req == NCS_OS_POSIX_MQ_REQ_MSG_RECV_ASYNC)
+			return NCSCC_RC_FAILURE;
+
+		__atomic_add_fetch(&hdr->waiters, 1, __ATOMIC_SEQ_CST);
+		futex(&hdr->futex, FUTEX_WAIT, seq);
+		__atomic_sub_fetch(&hdr->waiters, 1, __ATOMIC_SEQ_CST);
+	}
+}
+
+static void shmq_get_attr(MQSV_SHMQ_HDR *hdr, NCS_OS_POSIX_MQ_REQ_INFO *req)
+{
+	uint32_t count = 0, used = 0, i;
+
+	for (i = 0; i < MQSV_SHMQ_NUM_RINGS; i++) {
+		MQSV_SHMQ_RING *ring = &hdr->ring[i];
+
+		count += __atomic_load_n(&ring->count, __ATOMIC_RELAXED);
+		used += __atomic_load_n(&ring->tail, __ATOMIC_RELAXED) -
+			__atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+	}
+
+	/* the rings are not resized, report enough space for any message */
+	req->info.attr.o_attr.mq_curmsgs = count;
+	req->info.attr.o_attr.mq_msgsize = used;
+	req->info.attr.o_attr.mq_maxmsg = UINT32_MAX;
+	req->info.attr.o_attr.mq_stime = 0;
+}
+
+/****************************************************************************
+ * Function Name: mqsv_posix_mq
+ * Purpose: Operate on the data of a message queue, in its shared memory
+ *          segment if it has one, else in its SysV queue
+ * Return Value:  NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ ****************************************************************************/
+uint32_t mqsv_posix_mq(NCS_OS_POSIX_MQ_REQ_INFO *req)
+{
+	MQSV_SHMQ_MAP *map;
+	bool denied = false;
+	uint32_t rc = NCSCC_RC_SUCCESS;
+
+	switch (req->req) {
+	case NCS_OS_POSIX_MQ_REQ_MSG_SEND:
+	case NCS_OS_POSIX_MQ_REQ_MSG_SEND_ASYNC:
+		map = shmq_lookup(req->info.send.mqd, &denied);
+		break;
+	case NCS_OS_POSIX_MQ_REQ_MSG_RECV:
+	case NCS_OS_POSIX_MQ_REQ_MSG_RECV_ASYNC:
+		map = shmq_lookup(req->info.recv.mqd, &denied);
+		break;
+	case NCS_OS_POSIX_MQ_REQ_GET_ATTR:
+		map = shmq_lookup(req->info.attr.i_mqd, &denied);
+		break;
+	case NCS_OS_POSIX_MQ_REQ_RESIZE:
+		map = shmq_lookup(req->info.resize.mqd, &denied);
+		break;
+	default:
+		map = NULL;
+		break;
+	}
+
+	/* the messages are in a segment this process may not access, not in
+	 * the SysV queue */
+	if (denied)
+		return NCSCC_RC_FAILURE;
+
+	if (map == NULL)
+		return ncs_os_posix_mq(req);
+
+	switch (req->req) {
+	case NCS_OS_POSIX_MQ_REQ_MSG_SEND:
+	case NCS_OS_POSIX_MQ_REQ_MSG_SEND_ASYNC:
+		rc = shmq_send(map->hdr, req);
+		break;
+	case NCS_OS_POSIX_MQ_REQ_MSG_RECV:
+	case NCS_OS_POSIX_MQ_REQ_MSG_RECV_ASYNC:
+		rc = shmq_recv(map->hdr, req);
+		break;
+	case NCS_OS_POSIX_MQ_REQ_GET_ATTR:
+		shmq_get_attr(map->hdr, req);
+		break;
+	default:
+		/* the rings are sized at creation */
+		break;
+	}
+
+	shmq_put(map);
+	return rc;
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_create
+ * Purpose: Create the shared memory segment of a queue, size holds the queue
+ *          size per priority
+ * Return Value:  NCSCC_RC_SUCCESS/NCSCC_RC_FAILURE
+ ****************************************************************************/
+uint32_t mqsv_shmq_create(SaMsgQueueHandleT qhdl, const SaSizeT *size)
+{
+	char name[NAME_MAX];
+	uint64_t ring_size[MQSV_SHMQ_NUM_RINGS];
+	uint64_t seg_size = MQSV_SHMQ_ALIGN(sizeof(MQSV_SHMQ_HDR));
+	MQSV_SHMQ_HDR *hdr;
+	uint32_t i;
+	int fd;
+	TRACE_ENTER2("qhdl %llu", qhdl);
+
+	ring_size[0] = MQSV_SHMQ_CTRL_RING_SIZE;
+	ring_size[1] = MQSV_SHMQ_PUTBACK_RING_SIZE;
+	for (i = SA_MSG_MESSAGE_HIGHEST_PRIORITY;
+	     i <= SA_MSG_MESSAGE_LOWEST_PRIORITY; i++) {
+		if (size[i] > MQSV_SHMQ_MAX_RING_SIZE) {
+			TRACE_LEAVE2("Queue size %llu too large", size[i]);
+			return NCSCC_RC_FAILURE;
+		}
+		ring_size[i + 2] = shmq_pow2(
+		    size[i] + MQSV_SHMQ_MSG_RESERVE *
+				  MQSV_SHMQ_ALIGN(sizeof(MQSV_SHMQ_REC) +
+						  sizeof(MQSV_MESSAGE)));
+	}
+	for (i = 0; i < MQSV_SHMQ_NUM_RINGS; i++)
+		seg_size += ring_size[i];
+
+	shmq_name(qhdl, name, sizeof(name));
+	/* left behind if the queue was not destroyed */
+	shm_unlink(name);
+	fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0660);
+	if (fd < 0) {
+		LOG_ER("shm_open %s failed: %s", name, strerror(errno));
+		return NCSCC_RC_FAILURE;
+	}
+
+	/* Only msgnd's user and group may access the queue, the mode is set
+	 * explicitly since the umask may drop the group write permission */
+	if (fchown(fd, geteuid(), getegid()) != 0 || fchmod(fd, 0660) != 0) {
+		LOG_ER("Setting the owner of %s failed: %s", name,
+		       strerror(errno));
+		close(fd);
+		shm_unlink(name);
+		return NCSCC_RC_FAILURE;
+	}
+
+	/* the rings are sparse, pages are allocated as they are used */
+	if (ftruncate(fd, seg_size) != 0) {
+		LOG_ER("ftruncate %s failed: %s", name, strerror(errno));
+		close(fd);
+		shm_unlink(name);
+		return NCSCC_RC_FAILURE;
+	}
+
+	hdr = mmap(NULL, seg_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (hdr == MAP_FAILED) {
+		LOG_ER("mmap %s failed: %s", name, strerror(errno));
+		shm_unlink(name);
+		return NCSCC_RC_FAILURE;
+	}
+
+	hdr->version = MQSV_SHMQ_VERSION;
+	hdr->seg_size = seg_size;
+	hdr->qhdl = qhdl;
+	hdr->direct = 1;
+	shmq_init_lock(&hdr->prod_lock);
+	shmq_init_lock(&hdr->cons_lock);
+	for (i = SA_MSG_MESSAGE_HIGHEST_PRIORITY;
+	     i <= SA_MSG_MESSAGE_LOWEST_PRIORITY; i++)
+		hdr->limit[i] = size[i];
+	seg_size = MQSV_SHMQ_ALIGN(sizeof(MQSV_SHMQ_HDR));
+	for (i = 0; i < MQSV_SHMQ_NUM_RINGS; i++) {
+		hdr->ring[i].offset = seg_size;
+		hdr->ring[i].size = ring_size[i];
+		seg_size += ring_size[i];
+	}
+	hdr->magic = MQSV_SHMQ_MAGIC;
+	__atomic_store_n(&hdr->valid, 1, __ATOMIC_RELEASE);
+	munmap(hdr, seg_size);
+
+	TRACE_LEAVE2("Created %s, %llu bytes", name,
+		     (unsigned long long)seg_size);
+	return NCSCC_RC_SUCCESS;
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_destroy
+ * Purpose: Destroy the shared memory segment of a queue, if any. Receivers
+ *          blocked on the queue return with failure.
+ ****************************************************************************/
+void mqsv_shmq_destroy(SaMsgQueueHandleT qhdl)
+{
+	char name[NAME_MAX];
+	MQSV_SHMQ_MAP *map = shmq_get(qhdl);
+
+	if (map != NULL) {
+		__atomic_store_n(&map->hdr->valid, 0, __ATOMIC_RELEASE);
+		shmq_wake(map->hdr);
+		shmq_put(map);
+	}
+
+	pthread_mutex_lock(&shmq_map_lock);
+	shmq_map_unlink(qhdl);
+	pthread_mutex_unlock(&shmq_map_lock);
+
+	shmq_name(qhdl, name, sizeof(name));
+	if (shm_unlink(name) == 0)
+		TRACE("Destroyed %s", name);
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_exists
+ * Purpose: Check if the queue has a shared memory segment
+ ****************************************************************************/
+bool mqsv_shmq_exists(SaMsgQueueHandleT qhdl)
+{
+	MQSV_SHMQ_MAP *map = shmq_get(qhdl);
+
+	if (map == NULL)
+		return false;
+	shmq_put(map);
+	return true;
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_usage
+ * Purpose: Get the queue usage and number of messages per priority of a queue
+ *          with a shared memory segment. Direct senders and receivers update
+ *          them as they enqueue and dequeue, so they are always current.
+ * Return Value:  false if the queue has no segment
+ ****************************************************************************/
+bool mqsv_shmq_usage(SaMsgQueueHandleT qhdl, SaSizeT *used, SaUint32T *msgs)
+{
+	MQSV_SHMQ_MAP *map = shmq_get(qhdl);
+	uint32_t i;
+
+	if (map == NULL)
+		return false;
+	for (i = SA_MSG_MESSAGE_HIGHEST_PRIORITY;
+	     i <= SA_MSG_MESSAGE_LOWEST_PRIORITY; i++) {
+		used[i] = __atomic_load_n(&map->hdr->used[i], __ATOMIC_RELAXED);
+		msgs[i] = __atomic_load_n(&map->hdr->msgs[i], __ATOMIC_RELAXED);
+	}
+	shmq_put(map);
+	return true;
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_set_listener
+ * Purpose: Publish the listener queue that direct senders notify. When this
+ *          returns, no direct sender uses the previous listener queue.
+ ****************************************************************************/
+void mqsv_shmq_set_listener(SaMsgQueueHandleT qhdl,
+			    SaMsgQueueHandleT listenerHandle)
+{
+	MQSV_SHMQ_MAP *map = shmq_get(qhdl);
+
+	if (map == NULL)
+		return;
+	shmq_lock(&map->hdr->prod_lock);
+	map->hdr->listener = listenerHandle;
+	shmq_unlock(&map->hdr->prod_lock);
+	shmq_put(map);
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_set_direct
+ * Purpose: Allow or stop direct sends. When this returns with enable false,
+ *          no direct send is in progress.
+ ****************************************************************************/
+void mqsv_shmq_set_direct(SaMsgQueueHandleT qhdl, bool enable)
+{
+	MQSV_SHMQ_MAP *map = shmq_get(qhdl);
+
+	if (map == NULL)
+		return;
+	shmq_lock(&map->hdr->prod_lock);
+	map->hdr->direct = enable ? 1 : 0;
+	shmq_unlock(&map->hdr->prod_lock);
+	shmq_put(map);
+	TRACE("Direct sends to queue %llu %s", qhdl,
+	      enable ? "enabled" : "disabled");
+}
+
+/****************************************************************************
+ * Function Name: mqsv_shmq_direct_send
+ * Purpose: Enqueue a message without involving MQND. The queue usage in the
+ *          segment is updated before the message is visible to receivers,
+ *          and the caller informs MQND afterwards, so that it checks the
+ *          queue capacity thresholds.
+ * Return Value:  SA_AIS_OK, SA_AIS_ERR_QUEUE_FULL, or SA_AIS_ERR_NOT_SUPPORTED
+ *                if the message must be sent through MQND
+ ****************************************************************************/
+SaAisErrorT mqsv_shmq_direct_send(SaMsgQueueHandleT qhdl,
+				  MQSV_MESSAGE *mqsv_msg, uint32_t size)
+{
+	MQSV_SHMQ_MAP *map;
+	MQSV_SHMQ_HDR *hdr;
+	uint8_t priority = mqsv_msg->info.msg.message.priority;
+	uint32_t mtype = priority + 3;
+	SaAisErrorT rc = SA_AIS_OK;
+
+	if (size > NCS_OS_MQ_MAX_PAYLOAD ||
+	    priority > SA_MSG_MESSAGE_LOWEST_PRIORITY)
+		return SA_AIS_ERR_NOT_SUPPORTED;
+
+	map = shmq_get(qhdl);
+	if (map == NULL)
+		return SA_AIS_ERR_NOT_SUPPORTED;
+	hdr = map->hdr;
+
+	/* the listener queue is notified under the lock, so that it can not be
+	 * destroyed meanwhile, see mqsv_shmq_set_listener() */
+	shmq_lock(&hdr->prod_lock);
+	if (hdr->direct == 0) {
+		rc = SA_AIS_ERR_NOT_SUPPORTED;
+	} else if (__atomic_load_n(&hdr->used[priority], __ATOMIC_RELAXED) +
+		       mqsv_msg->info.msg.message.size >
+		   hdr->limit[priority]) {
+		rc = SA_AIS_ERR_QUEUE_FULL;
+	} else {
+		shmq_account(hdr, mqsv_msg, size, true);
+		if (!ring_put(hdr, &hdr->ring[mtype - 1], mtype, mqsv_msg,
+			      size)) {
+			shmq_account(hdr, mqsv_msg, size, false);
+			rc = SA_AIS_ERR_QUEUE_FULL;
+		}
+	}
+	if (rc == SA_AIS_OK) {
+		shmq_wake(hdr);
+		if (mqsv_listenerq_msg_send(hdr->listener) !=
+		    NCSCC_RC_SUCCESS) {
+			/* the message is queued, it is only not signalled */
+			TRACE("Unable to send to listener queue %llu",
+			      hdr->listener);
+		}
+	}
+	shmq_unlock(&hdr->prod_lock);
+
+	shmq_put(map);
+	return rc;
+}
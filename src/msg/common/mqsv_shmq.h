@@ -0,0 +1,67 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*****************************************************************************
+  DESCRIPTION:
+
+  Shared memory queue backend. When enabled in MQND, the contents of a
+  message queue are kept in a POSIX shared memory segment instead of the
+  SysV message queue identified by the queue handle. The segment holds one
+  ring buffer per message type used on the queue (1 for cancel and stop
+  timer messages, 2 for messages put back, 3 to 6 for the SAF priorities
+  0 to 3). Producers and consumers of a queue are each serialized by a
+  process shared lock, so every ring has a single producer and a single
+  consumer at a time. Blocked receivers wait on a futex.
+
+  mqsv_posix_mq() is a drop-in replacement for ncs_os_posix_mq() for the
+  data of a queue. It operates on the ring buffers if the queue has a
+  segment and falls back to the SysV queue otherwise.
+
+  Senders on the node where the queue resides enqueue directly with
+  mqsv_shmq_direct_send() while MQND allows it, i.e. while the queue is not
+  being transferred to another node.
+******************************************************************************/
+
+#ifndef MSG_COMMON_MQSV_SHMQ_H_
+#define MSG_COMMON_MQSV_SHMQ_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Rings larger than this are not created, the queue stays on SysV */
+#define MQSV_SHMQ_MAX_RING_SIZE (64 * 1024 * 1024)
+
+/* Each priority ring has room for the queue size plus the headers of this
+ * many messages */
+#define MQSV_SHMQ_MSG_RESERVE 256
+
+uint32_t mqsv_posix_mq(NCS_OS_POSIX_MQ_REQ_INFO *req);
+
+uint32_t mqsv_shmq_create(SaMsgQueueHandleT qhdl, const SaSizeT *size);
+void mqsv_shmq_destroy(SaMsgQueueHandleT qhdl);
+bool mqsv_shmq_exists(SaMsgQueueHandleT qhdl);
+bool mqsv_shmq_usage(SaMsgQueueHandleT qhdl, SaSizeT *used, SaUint32T *msgs);
+void mqsv_shmq_set_listener(SaMsgQueueHandleT qhdl,
+                            SaMsgQueueHandleT listenerHandle);
+void mqsv_shmq_set_direct(SaMsgQueueHandleT qhdl, bool enable);
+SaAisErrorT mqsv_shmq_direct_send(SaMsgQueueHandleT qhdl,
+                                  MQSV_MESSAGE *mqsv_msg, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MSG_COMMON_MQSV_SHMQ_H_
@@ -213,6 +213,7 @@ typedef struct mqnd_cb {
   SaImmOiHandleT immOiHandle;
   SaSelectionObjectT imm_sel_obj;
   SaSelectionObjectT clm_sel_obj;
+  bool shm_queues; /* keep queue contents in shared memory */
 } MQND_CB;
 
 #define MQND_QUEUE_INFO_NULL ((MQND_QUEUE_INFO *)0)
@@ -244,7 +245,7 @@ uint32_t mqnd_proc_mqa_down(MQND_CB *cb, MDS_DEST *mqa);
 uint32_t mqnd_proc_mqa_down(MQND_CB *cb, MDS_DEST *mqa);
 
 /* Functions from mqnd_mq.c */
-uint32_t mqnd_mq_create(MQND_QUEUE_INFO *q_info);
+uint32_t mqnd_mq_create(MQND_CB *cb, MQND_QUEUE_INFO *q_info);
 uint32_t mqnd_mq_open(MQND_QUEUE_INFO *q_info);
 uint32_t mqnd_mq_destroy(MQND_QUEUE_INFO *q_info);
 uint32_t mqnd_mq_msg_send(uint32_t qhdl, MQSV_MESSAGE *i_msg, uint32_t i_len);
@@ -40,6 +40,12 @@ static uint32_t mqnd_evt_proc_send_msg(MQND_CB *cb, MQSV_DSEND_EVT *evt);
 static uint32_t mqnd_evt_proc_qattr_get(MQND_CB *cb, MQSV_EVT *evt);
 static uint32_t mqnd_evt_proc_update_stats_shm(MQND_CB *cb,
 					       MQSV_DSEND_EVT *evt);
+static uint32_t mqnd_evt_proc_send_stats_shm(MQND_CB *cb,
+					     MQSV_DSEND_EVT *evt);
+static uint32_t mqnd_evt_proc_send_msg_batch(MQND_CB *cb,
+					     MQSV_DSEND_EVT *evt);
+static uint32_t mqnd_evt_proc_update_stats_batch(MQND_CB *cb,
+						 MQSV_DSEND_EVT *evt);
 static uint32_t mqnd_evt_proc_cb_dump(void);
 static uint32_t mqnd_evt_proc_ret_time_set(MQND_CB *cb, MQSV_EVT *evt);
 static uint32_t mqnd_evt_proc_cap_set(MQND_CB *, MQSV_EVT *);
@@ -126,6 +132,18 @@ void mqnd_process_dsend_evt(MQSV_DSEND_EVT *evt)
 		(void)mqnd_evt_proc_update_stats_shm(cb, evt);
 		break;
 
+	case MQP_EVT_SEND_STAT_UPD_REQ:
+		(void)mqnd_evt_proc_send_stats_shm(cb, evt);
+		break;
+
+	case MQP_EVT_SEND_MSG_BATCH:
+		(void)mqnd_evt_proc_send_msg_batch(cb, evt);
+		break;
+
+	case MQP_EVT_STAT_UPD_BATCH_REQ:
+		(void)mqnd_evt_proc_update_stats_batch(cb, evt);
+		break;
+
 	default:
 		/* Log the error */
 		/* m_LOG_MQND_EVT(evt->type, NCSFL_SEV_ERROR); */
@@ -140,7 +158,10 @@ void mqnd_process_dsend_evt(MQSV_DSEND_EVT *evt)
 	/* Free the Event */
 	if ((evt->type.req_type == MQP_EVT_SEND_MSG_ASYNC) ||
 	    (evt->type.req_type == MQP_EVT_SEND_MSG) ||
-	    (evt->type.req_type == MQP_EVT_STAT_UPD_REQ))
+	    (evt->type.req_type == MQP_EVT_STAT_UPD_REQ) ||
+	    (evt->type.req_type == MQP_EVT_SEND_STAT_UPD_REQ) ||
+	    (evt->type.req_type == MQP_EVT_SEND_MSG_BATCH) ||
+	    (evt->type.req_type == MQP_EVT_STAT_UPD_BATCH_REQ))
 		mds_free_direct_buff((MDS_DIRECT_BUFF)evt);
 
 	TRACE_LEAVE();
@@ -1224,15 +1245,21 @@ static uint32_t mqnd_evt_proc_update_stats_shm(MQND_CB *cb, MQSV_DSEND_EVT *evt)
 	offset = qnode->qinfo.shm_queue_index;
 
 	if (shm_base_addr[offset].valid == SHM_QUEUE_INFO_VALID) {
-		shm_base_addr[offset]
-		    .QueueStatsShm.saMsgQueueUsage[statsReq->priority]
-		    .queueUsed -= statsReq->size;
-		shm_base_addr[offset]
-		    .QueueStatsShm.saMsgQueueUsage[statsReq->priority]
-		    .numberOfMessages--;
-		shm_base_addr[offset].QueueStatsShm.totalQueueUsed -=
-		    statsReq->size;
-		shm_base_addr[offset].QueueStatsShm.totalNumberOfMessages--;
+		/* The stats of a shared memory queue are taken from it, since
+		 * direct sends are reported to MQND asynchronously */
+		if (mqnd_shmq_update_stats_shm(cb, qnode) !=
+		    NCSCC_RC_SUCCESS) {
+			shm_base_addr[offset]
+			    .QueueStatsShm.saMsgQueueUsage[statsReq->priority]
+			    .queueUsed -= statsReq->size;
+			shm_base_addr[offset]
+			    .QueueStatsShm.saMsgQueueUsage[statsReq->priority]
+			    .numberOfMessages--;
+			shm_base_addr[offset].QueueStatsShm.totalQueueUsed -=
+			    statsReq->size;
+			shm_base_addr[offset]
+			    .QueueStatsShm.totalNumberOfMessages--;
+		}
 	} else {
 		LOG_ER("ERR_LIBRARY: Queue info is invalid");
 		err = SA_AIS_ERR_LIBRARY;
@@ -1270,6 +1297,73 @@ done:
 	return rc;
 }
 
+/****************************************************************************
+ * Name          : mqnd_evt_proc_send_stats_shm
+ *
+ * Description   : Function to update the queue stats for a message that a
+ *                 sender on this node put directly in the shared memory
+ *                 queue, and check the capacity thresholds. No response is
+ *                 sent.
+ *
+ * Arguments     : MQND_CB *cb - MQND CB pointer
+ *                 MQSV_DSEND_EVT *evt - Received Event structure
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static uint32_t mqnd_evt_proc_send_stats_shm(MQND_CB *cb, MQSV_DSEND_EVT *evt)
+{
+	MQND_QUEUE_NODE *qnode = NULL;
+	MQP_UPDATE_STATS *statsReq = &evt->info.statsReq;
+	bool is_valid_msg_fmt = false;
+	TRACE_ENTER();
+
+	is_valid_msg_fmt = m_NCS_MSG_FORMAT_IS_VALID(
+	    evt->msg_fmt_version, MQND_WRT_MQA_SUBPART_VER_AT_MIN_MSG_FMT,
+	    MQND_WRT_MQA_SUBPART_VER_AT_MAX_MSG_FMT, mqnd_mqa_msg_fmt_table);
+
+	/*Drop the messages with msg_fmt_version=1 as earlier versions are non
+	 * backward compatible */
+	if (!is_valid_msg_fmt || (evt->msg_fmt_version == 1)) {
+		LOG_ER("ERR_VERSION: Message Format Version Invalid");
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	if (!cb->clm_node_joined || !cb->is_restart_done) {
+		TRACE_2("MQND is not available or not completely Initialized");
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	if (statsReq->priority > SA_MSG_MESSAGE_LOWEST_PRIORITY) {
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	mqnd_queue_node_get(cb, statsReq->qhdl, &qnode);
+	if (!qnode) {
+		TRACE_2("Queue %llu not found", statsReq->qhdl);
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	/* The sender accounted for the message in the shared memory queue
+	 * before the receiver could see it, take the stats from there */
+	if (mqnd_shmq_update_stats_shm(cb, qnode) != NCSCC_RC_SUCCESS) {
+		TRACE_2("Queue %llu has no shared memory queue",
+			statsReq->qhdl);
+		TRACE_LEAVE();
+		return NCSCC_RC_FAILURE;
+	}
+
+	checkCapacity(cb, &qnode->qinfo);
+
+	TRACE_LEAVE();
+	return NCSCC_RC_SUCCESS;
+}
+
 /****************************************************************************
  * Name          : mqnd_evt_proc_send_msg
  *
@@ -1395,7 +1489,7 @@ static uint32_t mqnd_evt_proc_send_msg(MQND_CB *cb, MQSV_DSEND_EVT *evt)
 	info.req = NCS_OS_POSIX_MQ_REQ_GET_ATTR;
 	info.info.attr.i_mqd = qnode->qinfo.queueHandle;
 
-	if (m_NCS_OS_POSIX_MQ(&info) != NCSCC_RC_SUCCESS) {
+	if (mqsv_posix_mq(&info) != NCSCC_RC_SUCCESS) {
 		err = SA_AIS_ERR_BAD_HANDLE;
 		LOG_ER("Unable to get the queue attributes from the queue");
 		rc = NCSCC_RC_FAILURE;
@@ -1422,7 +1516,7 @@ static uint32_t mqnd_evt_proc_send_msg(MQND_CB *cb, MQSV_DSEND_EVT *evt)
 		    (5 * (snd_msg->message.size + sizeof(MQSV_MESSAGE) +
 			  sizeof(NCS_OS_MQ_MSG_LL_HDR)));
 
-		if (m_NCS_OS_POSIX_MQ(&info) != NCSCC_RC_SUCCESS) {
+		if (mqsv_posix_mq(&info) != NCSCC_RC_SUCCESS) {
 			LOG_ER("Unable to resize the queue to the given size");
 			err = SA_AIS_ERR_NO_RESOURCES;
 			rc = NCSCC_RC_FAILURE;
@@ -1571,6 +1665,283 @@ send_resp:
 	return rc;
 }
 
+/****************************************************************************
+ * Name          : mqnd_evt_proc_send_msg_batch
+ *
+ * Description   : Function to process a batch of sent messages. None is put
+ *                 in the queue unless the queue can hold all of them, then
+ *                 they are put in order up to the first one that fails. The
+ *                 response tells how many were put.
+ *
+ * Arguments     : MQND_CB *cb - MQND CB pointer
+ *                 MQSV_DSEND_EVT *evt - Received Event structure
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : The messages have been checked to lie within the event by
+ *                 mqnd_mds_direct_rcv().
+ *****************************************************************************/
+static uint32_t mqnd_evt_proc_send_msg_batch(MQND_CB *cb, MQSV_DSEND_EVT *evt)
+{
+	uint32_t rc = NCSCC_RC_SUCCESS, msg_fmt_ver, i, prio, num_sent = 0;
+	MQP_SEND_MSG_BATCH *batch = &evt->info.sndMsgBatch;
+	MQND_QUEUE_NODE *qnode = NULL;
+	SaAisErrorT err = SA_AIS_OK;
+	MQSV_DSEND_EVT *direct_rsp_evt = NULL;
+	MQSV_MESSAGE *mqsv_msg = NULL;
+	QUEUE_MESSAGE *qmsg;
+	SaSizeT need[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1] = {0};
+	SaSizeT qused, total = 0, max_size = 0;
+	uint32_t actual_qsize, actual_qused;
+	NCS_OS_POSIX_MQ_REQ_INFO info;
+	MQND_QUEUE_CKPT_INFO *shm_base_addr;
+	MQND_QUEUE_CKPT_INFO queue_ckpt_node;
+	bool is_valid_msg_fmt = false;
+	TRACE_ENTER();
+
+	is_valid_msg_fmt = m_NCS_MSG_FORMAT_IS_VALID(
+	    evt->msg_fmt_version, MQND_WRT_MQA_SUBPART_VER_AT_MIN_MSG_FMT,
+	    MQND_WRT_MQA_SUBPART_VER_AT_MAX_MSG_FMT, mqnd_mqa_msg_fmt_table);
+
+	msg_fmt_ver = m_NCS_ENC_MSG_FMT_GET(
+	    evt->src_dest_version, MQND_WRT_MQA_SUBPART_VER_AT_MIN_MSG_FMT,
+	    MQND_WRT_MQA_SUBPART_VER_AT_MAX_MSG_FMT, mqnd_mqa_msg_fmt_table);
+
+	if (!is_valid_msg_fmt || !msg_fmt_ver || (evt->msg_fmt_version == 1)) {
+		LOG_ER("ERR_VERSION: Message Format Version Invalid");
+		err = SA_AIS_ERR_VERSION;
+		goto send_resp;
+	}
+
+	if (!cb->clm_node_joined) {
+		TRACE("node is not cluster member");
+		err = SA_AIS_ERR_UNAVAILABLE;
+		goto send_resp;
+	} else if (!cb->is_restart_done) {
+		LOG_ER(
+		    "%s:%u: ERR_TRY_AGAIN: MQND is not completely Initialized",
+		    __FILE__, __LINE__);
+		err = SA_AIS_ERR_TRY_AGAIN;
+		goto send_resp;
+	}
+
+	mqnd_queue_node_get(cb, batch->queueHandle, &qnode);
+
+	/* If queue not found */
+	if (!qnode) {
+		LOG_ER("ERR_BAD_HANDLE: Get queue node Failed");
+		err = SA_AIS_ERR_BAD_HANDLE;
+		goto send_resp;
+	}
+
+	if (qnode->qinfo.owner_flag == MQSV_QUEUE_OWN_STATE_PROGRESS) {
+		LOG_ER("ERR_TRY_AGAIN: The queue is under transfer Process");
+		err = SA_AIS_ERR_TRY_AGAIN;
+		goto send_resp;
+	}
+
+	/* Sum up what the batch needs per priority */
+	qmsg = (QUEUE_MESSAGE *)(evt + 1);
+	for (i = 0; i < batch->num_msgs; i++) {
+		if (qmsg->size > cb->gl_msg_max_msg_size) {
+			LOG_ER(
+			    "ERR_TOO_BIG: message size is less than system defined msg size");
+			err = SA_AIS_ERR_TOO_BIG;
+			goto send_resp;
+		}
+		need[qmsg->priority] += qmsg->size;
+		total += qmsg->size + sizeof(MQSV_MESSAGE) +
+			 sizeof(NCS_OS_MQ_MSG_LL_HDR);
+		if (qmsg->size > max_size)
+			max_size = qmsg->size;
+		qmsg = (QUEUE_MESSAGE *)((char *)qmsg +
+					 m_MQSV_BATCH_MSG_LEN(qmsg->size));
+	}
+
+	shm_base_addr = cb->mqnd_shm.shm_base_addr;
+
+	/* Check to see if the messages fit into the queue as per user defined
+	 * statistics */
+	for (prio = 0; prio <= SA_MSG_MESSAGE_LOWEST_PRIORITY; prio++) {
+		qused = shm_base_addr[qnode->qinfo.shm_queue_index]
+			    .QueueStatsShm.saMsgQueueUsage[prio]
+			    .queueUsed;
+		if (need[prio] && (qused + need[prio] > qnode->qinfo.size[prio])) {
+			qnode->qinfo.numberOfFullErrors[prio]++;
+			err = SA_AIS_ERR_QUEUE_FULL;
+			memset(&queue_ckpt_node, 0,
+			       sizeof(MQND_QUEUE_CKPT_INFO));
+			mqnd_cpy_qnodeinfo_to_ckptinfo(cb, qnode,
+						       &queue_ckpt_node);
+			mqnd_ckpt_queue_info_write(
+			    cb, &queue_ckpt_node, qnode->qinfo.shm_queue_index);
+			LOG_ER("The queue is full");
+			goto send_resp;
+		}
+	}
+
+	/* Get actual queue size and usage stats */
+	info.req = NCS_OS_POSIX_MQ_REQ_GET_ATTR;
+	info.info.attr.i_mqd = qnode->qinfo.queueHandle;
+
+	if (mqsv_posix_mq(&info) != NCSCC_RC_SUCCESS) {
+		err = SA_AIS_ERR_BAD_HANDLE;
+		LOG_ER("Unable to get the queue attributes from the queue");
+		goto send_resp;
+	}
+
+	actual_qsize = info.info.attr.o_attr.mq_maxmsg;
+	actual_qused = info.info.attr.o_attr.mq_msgsize;
+
+	/* Resize the actual queue once for the whole batch */
+	if (total > (actual_qsize - actual_qused)) {
+		info.req = NCS_OS_POSIX_MQ_REQ_RESIZE;
+		info.info.resize.mqd = qnode->qinfo.queueHandle;
+		info.info.resize.i_newqsize = actual_qsize + 2 * total;
+
+		if (mqsv_posix_mq(&info) != NCSCC_RC_SUCCESS) {
+			LOG_ER("Unable to resize the queue to the given size");
+			err = SA_AIS_ERR_NO_RESOURCES;
+			goto send_resp;
+		}
+	}
+
+	mqsv_msg = (MQSV_MESSAGE *)m_MMGR_ALLOC_MQND_DEFAULT(
+	    sizeof(MQSV_MESSAGE) + max_size);
+	if (!mqsv_msg) {
+		LOG_CR("ERR_MEMORY: Memory Allocation Failed");
+		err = SA_AIS_ERR_NO_MEMORY;
+		goto send_resp;
+	}
+
+	memset(mqsv_msg, 0, sizeof(MQSV_MESSAGE));
+	mqsv_msg->type = MQP_EVT_GET_REQ;
+	mqsv_msg->mqsv_version = MQSV_MSG_VERSION;
+	mqsv_msg->info.msg.message_info.sendReceive = SA_FALSE;
+	m_GET_TIME_STAMP(mqsv_msg->info.msg.message_info.sendTime);
+
+	qmsg = (QUEUE_MESSAGE *)(evt + 1);
+	for (i = 0; i < batch->num_msgs; i++) {
+		memcpy(mqsv_msg->info.msg.message.data, qmsg->data,
+		       (uint32_t)qmsg->size);
+		mqsv_msg->info.msg.message.priority = qmsg->priority;
+		mqsv_msg->info.msg.message.size = qmsg->size;
+		mqsv_msg->info.msg.message.type = qmsg->type;
+		mqsv_msg->info.msg.message.version = qmsg->version;
+		mqsv_msg->info.msg.message.senderName = qmsg->senderName;
+
+		if (mqnd_mq_msg_send(qnode->qinfo.queueHandle, mqsv_msg,
+				     sizeof(MQSV_MESSAGE) + qmsg->size) !=
+		    NCSCC_RC_SUCCESS) {
+			LOG_ER(
+			    "ERR_RESOURCES: Unable to send the message to the Queue");
+			err = SA_AIS_ERR_NO_RESOURCES;
+			break;
+		}
+
+		if (mqsv_listenerq_msg_send(qnode->qinfo.listenerHandle) !=
+		    NCSCC_RC_SUCCESS)
+			LOG_ER("Unable to send the message to the listener Queue");
+
+		mqnd_send_msg_update_stats_shm(cb, qnode, qmsg->size,
+					       qmsg->priority);
+		num_sent++;
+		qmsg = (QUEUE_MESSAGE *)((char *)qmsg +
+					 m_MQSV_BATCH_MSG_LEN(qmsg->size));
+	}
+
+	m_MMGR_FREE_MQND_DEFAULT(mqsv_msg);
+
+	checkCapacity(cb, &qnode->qinfo);
+
+send_resp:
+	direct_rsp_evt =
+	    (MQSV_DSEND_EVT *)mds_alloc_direct_buff(sizeof(MQSV_DSEND_EVT));
+	if (!direct_rsp_evt) {
+		LOG_CR("Memory Allocation Failed");
+		return NCSCC_RC_FAILURE;
+	}
+
+	memset(direct_rsp_evt, 0, sizeof(MQSV_DSEND_EVT));
+	direct_rsp_evt->evt_type = MQSV_DSEND_EVENT;
+	direct_rsp_evt->endianness = machineEndianness();
+	direct_rsp_evt->msg_fmt_version = msg_fmt_ver;
+	direct_rsp_evt->src_dest_version = MQND_PVT_SUBPART_VERSION;
+	direct_rsp_evt->type.rsp_type = MQP_EVT_SEND_MSG_RSP;
+	direct_rsp_evt->info.sendMsgRsp.error = err;
+	direct_rsp_evt->info.sendMsgRsp.num_msgs = num_sent;
+	direct_rsp_evt->info.sendMsgRsp.msgHandle = batch->msgHandle;
+
+	rc = mqnd_mds_send_rsp_direct(cb, &evt->sinfo, direct_rsp_evt);
+	if (rc != NCSCC_RC_SUCCESS)
+		TRACE_2("Mds Send Response Direct Failed");
+
+	TRACE_LEAVE2("Returned with return code %u", rc);
+	return rc;
+}
+
+/****************************************************************************
+ * Name          : mqnd_evt_proc_update_stats_batch
+ *
+ * Description   : Function to update stats of queue in shm when a batch of
+ *                 messages is received. No response is sent.
+ *
+ * Arguments     : MQND_CB *cb - MQND CB pointer
+ *                 MQSV_DSEND_EVT *evt - Received Event structure
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static uint32_t mqnd_evt_proc_update_stats_batch(MQND_CB *cb,
+						 MQSV_DSEND_EVT *evt)
+{
+	MQND_QUEUE_NODE *qnode = NULL;
+	MQP_UPDATE_STATS_BATCH *statsReq = &evt->info.statsBatchReq;
+	MQND_QUEUE_CKPT_INFO *shm_base_addr;
+	uint32_t offset, prio;
+	TRACE_ENTER();
+
+	mqnd_queue_node_get(cb, statsReq->qhdl, &qnode);
+	if (!qnode) {
+		TRACE_2("Queue %llu not found", statsReq->qhdl);
+		return NCSCC_RC_FAILURE;
+	}
+
+	shm_base_addr = cb->mqnd_shm.shm_base_addr;
+	offset = qnode->qinfo.shm_queue_index;
+
+	if (shm_base_addr[offset].valid != SHM_QUEUE_INFO_VALID) {
+		LOG_ER("ERR_LIBRARY: Queue info is invalid");
+		return NCSCC_RC_FAILURE;
+	}
+
+	/* The stats of a shared memory queue are taken from it */
+	if (mqnd_shmq_update_stats_shm(cb, qnode) == NCSCC_RC_SUCCESS) {
+		checkCapacity(cb, &qnode->qinfo);
+		TRACE_LEAVE();
+		return NCSCC_RC_SUCCESS;
+	}
+
+	for (prio = 0; prio <= SA_MSG_MESSAGE_LOWEST_PRIORITY; prio++) {
+		shm_base_addr[offset]
+		    .QueueStatsShm.saMsgQueueUsage[prio]
+		    .queueUsed -= statsReq->size[prio];
+		shm_base_addr[offset]
+		    .QueueStatsShm.saMsgQueueUsage[prio]
+		    .numberOfMessages -= statsReq->num_msgs[prio];
+		shm_base_addr[offset].QueueStatsShm.totalQueueUsed -=
+		    statsReq->size[prio];
+		shm_base_addr[offset].QueueStatsShm.totalNumberOfMessages -=
+		    statsReq->num_msgs[prio];
+	}
+
+	checkCapacity(cb, &qnode->qinfo);
+
+	TRACE_LEAVE();
+	return NCSCC_RC_SUCCESS;
+}
+
 /****************************************************************************
  * Name          : mqnd_evt_proc_tmr_expiry
  *
@@ -284,6 +284,7 @@ static uint32_t mqnd_lib_init(MQSV_CREATE_INFO *info)
 	uint32_t rc = NCSCC_RC_SUCCESS;
 	SaAmfHealthcheckKeyT healthy;
 	char *health_key = NULL;
+	char *str;
 	SaAisErrorT amf_error;
 	char str_vector[10] = "";
 	int fd;
@@ -360,6 +361,11 @@ static uint32_t mqnd_lib_init(MQSV_CREATE_INFO *info)
 
 	/* END: Set attributes of queue in global variable */
 
+	if ((str = getenv("MQSV_SHM_QUEUES")) != NULL && atoi(str) == 1) {
+		cb->shm_queues = true;
+		LOG_NO("Queue contents are kept in shared memory");
+	}
+
 	/* Init the EDU Handle */
 	m_NCS_EDU_HDL_INIT(&cb->edu_hdl);
 
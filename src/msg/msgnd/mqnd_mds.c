@@ -44,6 +44,8 @@ mqnd_mds_direct_rcv(MQND_CB *cb,
 static uint32_t mqnd_mds_svc_evt(MQND_CB *cb,
 				 MDS_CALLBACK_SVC_EVENT_INFO *svc_evt);
 static uint32_t mqnd_mds_get_handle(MQND_CB *cb);
+static uint32_t mqnd_mds_dec_msg_batch(MQSV_DSEND_EVT *pEvt, uint32_t len,
+				       bool swap, bool endianness);
 
 /*To store the message format versions*/
 MSG_FRMT_VER mqnd_mqa_msg_fmt_table[MQND_WRT_MQA_SUBPART_VER_RANGE] = {
@@ -470,6 +472,56 @@ static uint32_t mqnd_mds_rcv(MQND_CB *pMqnd,
 	return rc;
 }
 
+/****************************************************************************
+ * Name          : mqnd_mds_dec_msg_batch
+ *
+ * Description   : Checks that the messages of a MQP_EVT_SEND_MSG_BATCH
+ *                 event lie within the received buffer, decoding them to
+ *                 host order if the endianess of the source is different.
+ *
+ * Arguments     : pEvt - The received event, header in host order.
+ *                 len - Length of the received buffer.
+ *                 swap - true if the messages are to be decoded.
+ *                 endianness - endianness of this machine.
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error Code.
+ *
+ * Notes         : None.
+ *****************************************************************************/
+static uint32_t mqnd_mds_dec_msg_batch(MQSV_DSEND_EVT *pEvt, uint32_t len,
+				       bool swap, bool endianness)
+{
+	size_t offset = sizeof(MQSV_DSEND_EVT);
+	QUEUE_MESSAGE *qmsg;
+	uint32_t i;
+
+	for (i = 0; i < pEvt->info.sndMsgBatch.num_msgs; i++) {
+		if (offset + offsetof(QUEUE_MESSAGE, data) > len)
+			return NCSCC_RC_FAILURE;
+
+		qmsg = (QUEUE_MESSAGE *)((char *)pEvt + offset);
+		if (swap) {
+			qmsg->type =
+			    m_MQSV_REVERSE_ENDIAN_L(&qmsg->type, endianness);
+			qmsg->version =
+			    m_MQSV_REVERSE_ENDIAN_L(&qmsg->version, endianness);
+			qmsg->size =
+			    m_MQSV_REVERSE_ENDIAN_LL(&qmsg->size, endianness);
+			qmsg->senderName.length = m_MQSV_REVERSE_ENDIAN_S(
+			    &qmsg->senderName.length, endianness);
+		}
+
+		if ((qmsg->priority > SA_MSG_MESSAGE_LOWEST_PRIORITY) ||
+		    (qmsg->size > len) ||
+		    (offset + m_MQSV_BATCH_MSG_LEN(qmsg->size) > len))
+			return NCSCC_RC_FAILURE;
+
+		offset += m_MQSV_BATCH_MSG_LEN(qmsg->size);
+	}
+
+	return NCSCC_RC_SUCCESS;
+}
+
 /****************************************************************************
  * Name          : mqnd_mds_direct_rcv
  *
@@ -658,7 +710,52 @@ mqnd_mds_direct_rcv(MQND_CB *pMqnd,
 				&pEvt->info.sndMsgAsync.invocation, endianness);
 		} break;
 
-		case MQP_EVT_STAT_UPD_REQ: {
+		case MQP_EVT_SEND_MSG_BATCH: {
+			pEvt->agent_mds_dest = m_MQSV_REVERSE_ENDIAN_LL(
+			    &pEvt->agent_mds_dest, endianness);
+
+			pEvt->info.sndMsgBatch.msgHandle =
+			    m_MQSV_REVERSE_ENDIAN_LL(
+				&pEvt->info.sndMsgBatch.msgHandle, endianness);
+
+			pEvt->info.sndMsgBatch.queueHandle =
+			    m_MQSV_REVERSE_ENDIAN_LL(
+				&pEvt->info.sndMsgBatch.queueHandle,
+				endianness);
+
+			pEvt->info.sndMsgBatch.destination.length =
+			    m_MQSV_REVERSE_ENDIAN_S(
+				&pEvt->info.sndMsgBatch.destination.length,
+				endianness);
+
+			pEvt->info.sndMsgBatch.num_msgs =
+			    m_MQSV_REVERSE_ENDIAN_L(
+				&pEvt->info.sndMsgBatch.num_msgs, endianness);
+		} break;
+
+		case MQP_EVT_STAT_UPD_BATCH_REQ: {
+			uint32_t prio;
+
+			pEvt->info.statsBatchReq.qhdl =
+			    m_MQSV_REVERSE_ENDIAN_LL(
+				&pEvt->info.statsBatchReq.qhdl, endianness);
+
+			for (prio = 0; prio <= SA_MSG_MESSAGE_LOWEST_PRIORITY;
+			     prio++) {
+				pEvt->info.statsBatchReq.num_msgs[prio] =
+				    m_MQSV_REVERSE_ENDIAN_L(
+					&pEvt->info.statsBatchReq
+					     .num_msgs[prio],
+					endianness);
+				pEvt->info.statsBatchReq.size[prio] =
+				    m_MQSV_REVERSE_ENDIAN_L(
+					&pEvt->info.statsBatchReq.size[prio],
+					endianness);
+			}
+		} break;
+
+		case MQP_EVT_STAT_UPD_REQ:
+		case MQP_EVT_SEND_STAT_UPD_REQ: {
 			pEvt->info.statsReq.qhdl = m_MQSV_REVERSE_ENDIAN_LL(
 			    &pEvt->info.statsReq.qhdl, endianness);
 
@@ -672,6 +769,14 @@ mqnd_mds_direct_rcv(MQND_CB *pMqnd,
 		}
 	}
 
+	if ((pEvt->type.req_type == MQP_EVT_SEND_MSG_BATCH) &&
+	    (mqnd_mds_dec_msg_batch(pEvt, direct_rcv_info->i_direct_buff_len,
+				    pEvt->endianness != endianness,
+				    endianness) != NCSCC_RC_SUCCESS)) {
+		LOG_ER("mqnd_mds_direct_rcv: Invalid message batch");
+		return NCSCC_RC_FAILURE;
+	}
+
 	/* Put it in MQND's Event Queue */
 	rc = m_NCS_IPC_SEND(&pMqnd->mbx, (NCSCONTEXT)pEvt,
 			    NCS_IPC_PRIORITY_NORMAL);
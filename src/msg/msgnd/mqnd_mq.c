@@ -44,7 +44,7 @@ NCS_OS_MQ_MSG transfer_mq_msg; /* used in queue owner ship */
  * Purpose: Used to create the new physical message queue
  * Return Value:  NCSCC_RC_SUCCESS
  ****************************************************************************/
-uint32_t mqnd_mq_create(MQND_QUEUE_INFO *q_info)
+uint32_t mqnd_mq_create(MQND_CB *cb, MQND_QUEUE_INFO *q_info)
 {
 	NCS_OS_POSIX_MQ_REQ_INFO info;
 	char queue_name[SA_MAX_NAME_LENGTH];
@@ -91,6 +91,13 @@ uint32_t mqnd_mq_create(MQND_QUEUE_INFO *q_info)
 	if (rc == NCSCC_RC_SUCCESS)
 		q_info->queueHandle = info.info.open.o_mqd;
 
+	/* Keep the queue contents in shared memory. The SysV queue is kept,
+	   its handle identifies the queue. */
+	if (rc == NCSCC_RC_SUCCESS && cb->shm_queues &&
+	    mqsv_shmq_create(q_info->queueHandle, q_info->size) !=
+		NCSCC_RC_SUCCESS)
+		LOG_NO("Queue %s is not kept in shared memory", queue_name);
+
 	TRACE_LEAVE();
 	return rc;
 }
@@ -139,6 +146,8 @@ uint32_t mqnd_mq_destroy(MQND_QUEUE_INFO *q_info)
 	if (q_info->queueHandle == 0)
 		return NCSCC_RC_SUCCESS;
 
+	mqsv_shmq_destroy(q_info->queueHandle);
+
 	memset(&info, 0, sizeof(NCS_OS_POSIX_MQ_REQ_INFO));
 	info.req = NCS_OS_POSIX_MQ_REQ_CLOSE;
 	info.info.close.mqd = q_info->queueHandle;
@@ -190,7 +199,7 @@ uint32_t mqnd_mq_msg_send(uint32_t qhdl, MQSV_MESSAGE *mqsv_msg, uint32_t size)
 
 	info.info.send.i_mtype = mqsv_msg->info.msg.message.priority + 3;
 
-	if (m_NCS_OS_POSIX_MQ(&info) != NCSCC_RC_SUCCESS) {
+	if (mqsv_posix_mq(&info) != NCSCC_RC_SUCCESS) {
 		LOG_ER("Sending the message to message queue failed");
 		return (NCSCC_RC_FAILURE);
 	}
@@ -215,7 +224,7 @@ uint32_t mqnd_mq_empty(SaMsgQueueHandleT handle)
 
 	mq_req.req = NCS_OS_POSIX_MQ_REQ_GET_ATTR;
 	mq_req.info.attr.i_mqd = handle;
-	if (m_NCS_OS_POSIX_MQ(&mq_req) != NCSCC_RC_SUCCESS) {
+	if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
 		LOG_ER("Empty the message in message queue failed");
 		return NCSCC_RC_FAILURE;
 	}
@@ -239,7 +248,7 @@ uint32_t mqnd_mq_empty(SaMsgQueueHandleT handle)
 	mq_req.info.recv.i_mtype = -7;
 
 	for (count = 0; count < num_messages; count++)
-		m_NCS_OS_POSIX_MQ(&mq_req);
+		mqsv_posix_mq(&mq_req);
 
 	return NCSCC_RC_SUCCESS;
 }
@@ -275,7 +284,7 @@ uint32_t mqnd_mq_rcv(SaMsgQueueHandleT handle)
 	    -7; /* Read only the priorities brtween 1 and 6,
 		   with 1 as highest priority */
 
-	if (m_NCS_OS_POSIX_MQ(&mq_req) != NCSCC_RC_SUCCESS) {
+	if (mqsv_posix_mq(&mq_req) != NCSCC_RC_SUCCESS) {
 		LOG_ER("Receiving the message from message queue failed");
 		return NCSCC_RC_FAILURE;
 	}
@@ -323,8 +332,11 @@ uint32_t mqnd_listenerq_create(MQND_QUEUE_INFO *q_info)
 		mqnd_listenerq_destroy(&zero_q);
 	}
 
-	if (rc == NCSCC_RC_SUCCESS)
+	if (rc == NCSCC_RC_SUCCESS) {
 		q_info->listenerHandle = info.info.open.o_mqd;
+		mqsv_shmq_set_listener(q_info->queueHandle,
+				       q_info->listenerHandle);
+	}
 
 	return rc;
 }
@@ -343,6 +355,8 @@ uint32_t mqnd_listenerq_destroy(MQND_QUEUE_INFO *q_info)
 	if (!q_info->listenerHandle)
 		return NCSCC_RC_SUCCESS;
 
+	mqsv_shmq_set_listener(q_info->queueHandle, 0);
+
 	memset(&info, 0, sizeof(NCS_OS_POSIX_MQ_REQ_INFO));
 	info.req = NCS_OS_POSIX_MQ_REQ_CLOSE;
 	info.info.close.mqd = q_info->listenerHandle;
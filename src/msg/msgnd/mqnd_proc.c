@@ -73,6 +73,7 @@ uint32_t mqnd_evt_proc_mqp_qtransfer_complete(MQND_CB *cb, MQSV_EVT *req)
 	if (req->msg.mqp_req.info.transferComplete.error == NCSCC_RC_SUCCESS) {
 
 		/* Delete the native message queue */
+		mqsv_shmq_destroy(qhdl);
 		memset(&info, 0, sizeof(NCS_OS_MQ_REQ_INFO));
 		info.req = NCS_OS_MQ_REQ_DESTROY;
 		info.info.destroy.i_hdl = qhdl;
@@ -187,6 +188,7 @@ uint32_t mqnd_evt_proc_mqp_qtransfer_complete(MQND_CB *cb, MQSV_EVT *req)
 
 		if (rc == SA_AIS_OK) {
 			qnode->qinfo.owner_flag = MQSV_QUEUE_OWN_STATE_ORPHAN;
+			mqsv_shmq_set_direct(qhdl, true);
 			memset(&queue_ckpt_node, 0,
 			       sizeof(MQND_QUEUE_CKPT_INFO));
 			mqnd_cpy_qnodeinfo_to_ckptinfo(cb, qnode,
@@ -269,10 +271,14 @@ uint32_t mqnd_evt_proc_mqp_qtransfer(MQND_CB *cb, MQSV_EVT *req)
 		goto send_rsp;
 	}
 
+	/* Senders on this node must go through MQND from now on, so that no
+	 * message is added after the queue is read */
+	mqsv_shmq_set_direct(qhdl, false);
+
 	/* Read all the messages from the queue and pack it into buffer */
 	qreq.req = NCS_OS_POSIX_MQ_REQ_GET_ATTR;
 	qreq.info.attr.i_mqd = qhdl;
-	if (m_NCS_OS_POSIX_MQ(&qreq) != NCSCC_RC_SUCCESS) {
+	if (mqsv_posix_mq(&qreq) != NCSCC_RC_SUCCESS) {
 		LOG_ER(
 		    "ERR_RESOURCES: Unable to get the queue attributes from the queue");
 		err = SA_AIS_ERR_NO_RESOURCES;
@@ -469,6 +475,10 @@ reg_req:
 		asapi_msg_free(&opr.info.msg.resp);
 
 send_rsp:
+	if (qnode &&
+	    qnode->qinfo.owner_flag != MQSV_QUEUE_OWN_STATE_PROGRESS)
+		mqsv_shmq_set_direct(qhdl, true);
+
 	/*
 	 * Delete the runtime object before responding, otherwise the other side
 	 * might create it before we have removed it
@@ -749,7 +759,7 @@ uint32_t mqnd_fill_queue_from_transfered_buffer(MQND_CB *cb,
 	    (transfer_rsp->msg_count *
 	     (sizeof(MQSV_MESSAGE) + sizeof(NCS_OS_MQ_MSG_LL_HDR)));
 
-	if (m_NCS_OS_POSIX_MQ(&info) != NCSCC_RC_SUCCESS) {
+	if (mqsv_posix_mq(&info) != NCSCC_RC_SUCCESS) {
 		LOG_ER("Unable to resize the queue to the given size");
 		rc = NCSCC_RC_FAILURE;
 		return rc;
@@ -767,11 +777,6 @@ uint32_t mqnd_fill_queue_from_transfered_buffer(MQND_CB *cb,
 				  mqsv_message->info.msg.message.size);
 		offset += size;
 
-		/* Update the stats */
-		mqnd_send_msg_update_stats_shm(
-		    cb, qnode, mqsv_message->info.msg.message.size,
-		    mqsv_message->info.msg.message.priority);
-
 		rc = mqnd_mq_msg_send(qnode->qinfo.queueHandle, mqsv_message,
 				      (uint32_t)size);
 
@@ -779,6 +784,12 @@ uint32_t mqnd_fill_queue_from_transfered_buffer(MQND_CB *cb,
 			TRACE_2("Unable to send the message to the Queue");
 			return rc;
 		}
+
+		/* Update the stats, a shared memory queue already accounts
+		 * for the message */
+		mqnd_send_msg_update_stats_shm(
+		    cb, qnode, mqsv_message->info.msg.message.size,
+		    mqsv_message->info.msg.message.priority);
 	}
 
 	return NCSCC_RC_SUCCESS;
@@ -30,6 +30,7 @@
     mqnd_reset_queue_stats
     mqnd_find_shm_ckpt_empty_section
     mqnd_send_msg_update_stats_shm
+    mqnd_shmq_update_stats_shm
     mqnd_shm_queue_ckpt_section_invalidate
 
 ******************************************************************************/
@@ -227,6 +228,9 @@ uint32_t mqnd_send_msg_update_stats_shm(MQND_CB *cb, MQND_QUEUE_NODE *qnode,
 
 	MQND_QUEUE_CKPT_INFO *shm_base_addr;
 
+	if (mqnd_shmq_update_stats_shm(cb, qnode) == NCSCC_RC_SUCCESS)
+		return NCSCC_RC_SUCCESS;
+
 	shm_base_addr = cb->mqnd_shm.shm_base_addr;
 
 	offset = qnode->qinfo.shm_queue_index;
@@ -246,6 +250,52 @@ uint32_t mqnd_send_msg_update_stats_shm(MQND_CB *cb, MQND_QUEUE_NODE *qnode,
 	return NCSCC_RC_SUCCESS;
 }
 
+/****************************************************************************
+ * Name          : mqnd_shmq_update_stats_shm
+ *
+ * Description   : Function to take the stats of a queue in shm from the
+ *                 shared memory queue segment of the queue.
+ *
+ * Arguments     : MQND_QUEUE_NODE *qnode
+ *
+ * Return Values : NCSCC_RC_SUCCESS/Error, error if the queue has no segment.
+ *
+ * Notes         : Direct senders and receivers account for each message in
+ *                 the segment before it is visible to the other side, so
+ *                 the stats taken from it never underflow.
+ *****************************************************************************/
+uint32_t mqnd_shmq_update_stats_shm(MQND_CB *cb, MQND_QUEUE_NODE *qnode)
+{
+	uint32_t offset, prio;
+	SaSizeT used[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+	SaUint32T msgs[SA_MSG_MESSAGE_LOWEST_PRIORITY + 1];
+	MQND_QUEUE_CKPT_INFO *shm_base_addr;
+	SaMsgQueueUsageT *usage;
+
+	if (!mqsv_shmq_usage(qnode->qinfo.queueHandle, used, msgs))
+		return NCSCC_RC_FAILURE;
+
+	shm_base_addr = cb->mqnd_shm.shm_base_addr;
+	offset = qnode->qinfo.shm_queue_index;
+	if (shm_base_addr[offset].valid != SHM_QUEUE_INFO_VALID)
+		return NCSCC_RC_FAILURE;
+
+	shm_base_addr[offset].QueueStatsShm.totalQueueUsed = 0;
+	shm_base_addr[offset].QueueStatsShm.totalNumberOfMessages = 0;
+	for (prio = SA_MSG_MESSAGE_HIGHEST_PRIORITY;
+	     prio <= SA_MSG_MESSAGE_LOWEST_PRIORITY; prio++) {
+		usage = &shm_base_addr[offset]
+			     .QueueStatsShm.saMsgQueueUsage[prio];
+		usage->queueUsed = used[prio];
+		usage->numberOfMessages = msgs[prio];
+		shm_base_addr[offset].QueueStatsShm.totalQueueUsed +=
+		    used[prio];
+		shm_base_addr[offset].QueueStatsShm.totalNumberOfMessages +=
+		    msgs[prio];
+	}
+	return NCSCC_RC_SUCCESS;
+}
+
 /****************************************************************************
  * Name          : mqnd_shm_queue_ckpt_section_invalidate
  *
@@ -0,0 +1,71 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains the helpers shared by the command line bench tools of
+ * the services.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "osaf/apitest/bench.h"
+#include "base/saf_error.h"
+
+void bench_usage(const char *progname, const char *summary,
+		 const char *description, const char *const *options,
+		 const char *example)
+{
+	printf("\nNAME\n");
+	printf("\t%s - %s\n", progname, summary);
+
+	printf("\nSYNOPSIS\n");
+	printf("\t%s [options]\n", progname);
+
+	printf("\nDESCRIPTION\n");
+	printf("\t%s %s", progname, description);
+
+	printf("\nOPTIONS\n");
+	printf("\t-h, --help             this help\n");
+	for (; *options != NULL; ++options)
+		printf("\t%s\n", *options);
+
+	printf("\nEXAMPLE\n");
+	printf("\t%s %s\n", progname, example);
+}
+
+void bench_fail(const char *api, SaAisErrorT rc)
+{
+	fprintf(stderr, "%s FAILED: %s\n", api, saf_error(rc));
+	exit(EXIT_FAILURE);
+}
+
+unsigned int bench_parse_counts(char *list, unsigned int *counts,
+				const char *what)
+{
+	char *token, *saveptr = NULL;
+	unsigned int numCounts = 0;
+
+	for (token = strtok_r(list, ",", &saveptr); token != NULL;
+	     token = strtok_r(NULL, ",", &saveptr)) {
+		if (numCounts == BENCH_MAX_COUNTS) {
+			fprintf(stderr, "Too many %s counts\n", what);
+			exit(EXIT_FAILURE);
+		}
+		counts[numCounts++] = strtoul(token, NULL, 0);
+	}
+
+	return numCounts;
+}
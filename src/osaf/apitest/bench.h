@@ -0,0 +1,65 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+#ifndef OSAF_APITEST_BENCH_H_
+#define OSAF_APITEST_BENCH_H_
+
+#include <saAis.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum number of entries in a comma separated list of counts */
+#define BENCH_MAX_COUNTS 32
+
+/**
+ * Print the help text of a bench tool. The description continues the
+ * sentence starting with the program name, the options are printed one per
+ * line after the help option and the example is printed after the program
+ * name.
+ * @param progname
+ * @param summary
+ * @param description
+ * @param options NULL terminated array of option lines
+ * @param example
+ */
+extern void bench_usage(const char* progname, const char* summary,
+                        const char* description, const char* const* options,
+                        const char* example);
+
+/**
+ * Print the failed API call and terminate the program.
+ * @param api
+ * @param rc
+ */
+extern void bench_fail(const char* api, SaAisErrorT rc);
+
+/**
+ * Parse a comma separated list of counts into at most BENCH_MAX_COUNTS
+ * entries of counts. Terminates the program if the list is too long.
+ * @param list modified by the parsing
+ * @param counts
+ * @param what name of the counts, used in the error message
+ * @return number of counts parsed
+ */
+extern unsigned int bench_parse_counts(char* list, unsigned int* counts,
+                                       const char* what);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // OSAF_APITEST_BENCH_H_
@@ -254,6 +254,8 @@ Consensus::~Consensus() {}
 void Consensus::ProcessEnvironmentSettings() {
   uint32_t split_brain_enable = base::GetEnv("FMS_SPLIT_BRAIN_PREVENTION", 0);
   plugin_path_ = base::GetEnv("FMS_KEYVALUE_STORE_PLUGIN_CMD", "");
+  uint32_t use_plugin_coprocess =
+    base::GetEnv("FMS_KEYVALUE_STORE_PLUGIN_COPROCESS", 0);
   uint32_t use_remote_fencing = base::GetEnv("FMS_USE_REMOTE_FENCING", 0);
   uint32_t prioritise_partition_size =
     base::GetEnv("FMS_TAKEOVER_PRIORITISE_PARTITION_SIZE", 1);
@@ -276,6 +278,8 @@ void Consensus::ProcessEnvironmentSettings() {
     use_consensus_ = false;
   }
 
+  use_plugin_coprocess_ = (use_plugin_coprocess == 1);
+
   if (use_remote_fencing == 1) {
     use_remote_fencing_ = true;
   }
@@ -322,6 +326,10 @@ std::string Consensus::PluginPath() const {
   return plugin_path_;
 }
 
+bool Consensus::UsePluginCoprocess() const {
+  return use_plugin_coprocess_;
+}
+
 bool Consensus::FenceNode(const std::string& node) {
   if (use_remote_fencing_ == true) {
     LOG_WA("Fencing remote node %s", node.c_str());
@@ -72,6 +72,9 @@ class Consensus {
   bool ReloadConfiguration();
   std::string PluginPath() const;
 
+  // Should the plugin be run as a long-lived co-process?
+  bool UsePluginCoprocess() const;
+
   Consensus();
   virtual ~Consensus();
 
@@ -107,6 +110,7 @@ class Consensus {
   uint32_t max_takeover_retry_{0};
   std::string config_file_{};
   std::string plugin_path_{};
+  bool use_plugin_coprocess_{false};
 
   const std::string kTestKeyname = "opensaf_write_test";
   const std::string kFmsEnvPrefix = "FMS";
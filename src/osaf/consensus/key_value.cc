@@ -14,10 +14,12 @@
  */
 #include "osaf/consensus/key_value.h"
 #include <sys/wait.h>
+#include <array>
 #include "base/conf.h"
 #include "base/getenv.h"
 #include "base/logtrace.h"
 #include "osaf/consensus/consensus.h"
+#include "osaf/consensus/plugin_coprocess.h"
 
 int KeyValue::Execute(const std::string& command, std::string& output) {
   TRACE_ENTER();
@@ -43,13 +45,36 @@ int KeyValue::Execute(const std::string& command, std::string& output) {
   return exit_code;
 }
 
+int KeyValue::Invoke(const std::vector<std::string>& args,
+                     std::string& output) {
+  Consensus consensus_service;
+  const std::string kv_store_cmd = consensus_service.PluginPath();
+
+  if (consensus_service.UsePluginCoprocess() == true) {
+    // a watch is answered when the key changes, other operations are
+    // bounded by the validity time of a takeover request
+    const unsigned int timeout =
+        args.front().compare(0, 5, "watch") == 0
+            ? 0
+            : consensus_service.TakeoverValidTime();
+    int exit_code;
+    if (PluginCoprocess::Instance()->Execute(kv_store_cmd, args, timeout,
+                                             exit_code, output) == true) {
+      return exit_code;
+    }
+  }
+
+  std::string command(kv_store_cmd + " " + args.front());
+  for (auto arg = args.begin() + 1; arg != args.end(); ++arg) {
+    command += " \"" + *arg + "\"";
+  }
+  return KeyValue::Execute(command, output);
+}
+
 SaAisErrorT KeyValue::Get(const std::string& key, std::string& value) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " get \"" + key + "\"");
-  int rc = KeyValue::Execute(command, value);
+  int rc = KeyValue::Invoke({"get", key}, value);
   TRACE("Read '%s'", value.c_str());
 
   if (rc == 0) {
@@ -65,12 +90,9 @@ SaAisErrorT KeyValue::Set(const std::string& key, const std::string& value,
                           const unsigned int timeout) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " set \"" + key + "\" \"" + value +
-                            "\" " + std::to_string(timeout));
   std::string output;
-  int rc = KeyValue::Execute(command, output);
+  int rc = KeyValue::Invoke({"set", key, value, std::to_string(timeout)},
+                            output);
 
   if (rc == 0) {
     return SA_AIS_OK;
@@ -82,13 +104,10 @@ SaAisErrorT KeyValue::Set(const std::string& key, const std::string& value,
 SaAisErrorT KeyValue::Set(const std::string& key, const std::string& value,
                           const std::string& prev_value,
                           const unsigned int timeout) {
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " set_if_prev \"" + key + "\" \"" +
-                            value + "\" \"" + prev_value +
-                            "\" " + std::to_string(timeout));
   std::string output;
-  int rc = KeyValue::Execute(command, output);
+  int rc = KeyValue::Invoke(
+      {"set_if_prev", key, value, prev_value, std::to_string(timeout)},
+      output);
 
   if (rc == 0) {
     return SA_AIS_OK;
@@ -101,12 +120,9 @@ SaAisErrorT KeyValue::Create(const std::string& key, const std::string& value,
                              const unsigned int timeout) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " create \"" + key + "\" \"" +
-                            value + "\" " + std::to_string(timeout));
   std::string output;
-  int rc = KeyValue::Execute(command, output);
+  int rc = KeyValue::Invoke({"create", key, value, std::to_string(timeout)},
+                            output);
 
   if (rc == 0) {
     return SA_AIS_OK;
@@ -122,11 +138,8 @@ SaAisErrorT KeyValue::Create(const std::string& key, const std::string& value,
 SaAisErrorT KeyValue::Erase(const std::string& key) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " erase \"" + key + "\"");
   std::string output;
-  int rc = KeyValue::Execute(command, output);
+  int rc = KeyValue::Invoke({"erase", key}, output);
 
   if (rc == 0) {
     return SA_AIS_OK;
@@ -139,12 +152,8 @@ SaAisErrorT KeyValue::Lock(const std::string& owner,
                            const unsigned int timeout) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " lock \"" + owner + "\" " +
-                            std::to_string(timeout));
   std::string output;
-  int rc = KeyValue::Execute(command, output);
+  int rc = KeyValue::Invoke({"lock", owner, std::to_string(timeout)}, output);
 
   if (rc == 0) {
     return SA_AIS_OK;
@@ -161,11 +170,8 @@ SaAisErrorT KeyValue::Lock(const std::string& owner,
 SaAisErrorT KeyValue::Unlock(const std::string& owner) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " unlock \"" + owner + "\"");
   std::string output;
-  int rc = Execute(command, output);
+  int rc = Invoke({"unlock", owner}, output);
 
   if (rc == 0) {
     return SA_AIS_OK;
@@ -181,11 +187,8 @@ SaAisErrorT KeyValue::Unlock(const std::string& owner) {
 SaAisErrorT KeyValue::LockOwner(std::string& owner) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " lock_owner");
   std::string output;
-  int rc = KeyValue::Execute(command, output);
+  int rc = KeyValue::Invoke({"lock_owner"}, output);
 
   if (rc == 0) {
     TRACE("Lock owner is %s", output.c_str());
@@ -208,18 +211,16 @@ void WatchKeyFunction(const std::string& key, const ConsensusCallback& callback,
                       const uint32_t user_defined) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " watch \"" + key + "\"");
+  const std::vector<std::string> args{"watch", key};
   std::string value;
   uint32_t retries = 0;
   int rc;
 
-  rc = KeyValue::Execute(command, value);
+  rc = KeyValue::Invoke(args, value);
   while (rc != 0 && rc < 126 && retries < kMaxRetry) {
     ++retries;
     std::this_thread::sleep_for(kSleepInterval);
-    rc = KeyValue::Execute(command, value);
+    rc = KeyValue::Invoke(args, value);
   }
 
   if (rc == 0) {
@@ -235,18 +236,16 @@ void WatchLockFunction(const ConsensusCallback& callback,
                        const uint32_t user_defined) {
   TRACE_ENTER();
 
-  Consensus consensus_service;
-  const std::string kv_store_cmd = consensus_service.PluginPath();
-  const std::string command(kv_store_cmd + " watch_lock");
+  const std::vector<std::string> args{"watch_lock"};
   std::string value;
   uint32_t retries = 0;
   int rc;
 
-  rc = KeyValue::Execute(command, value);
+  rc = KeyValue::Invoke(args, value);
   while (rc != 0 && rc < 126 && retries < kMaxRetry) {
     ++retries;
     std::this_thread::sleep_for(kSleepInterval);
-    rc = KeyValue::Execute(command, value);
+    rc = KeyValue::Invoke(args, value);
   }
 
   if (rc == 0) {
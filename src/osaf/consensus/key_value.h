@@ -18,6 +18,7 @@
 #include <functional>
 #include <string>
 #include <thread>
+#include <vector>
 #include "saAis.h"
 
 typedef std::function<void(const std::string& key, const std::string& new_value,
@@ -66,6 +67,11 @@ class KeyValue {
 
   // internal use
   static int Execute(const std::string& command, std::string& output);
+
+  // Run plugin operation args[0] with the remaining args as parameters,
+  // through the plugin co-process if enabled, otherwise by executing the
+  // plugin. Returns the exit code of the operation.
+  static int Invoke(const std::vector<std::string>& args, std::string& output);
 };
 
 #endif  // OSAF_CONSENSUS_KEY_VALUE_H_
@@ -0,0 +1,319 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+#include "osaf/consensus/plugin_coprocess.h"
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include "base/logtrace.h"
+
+namespace {
+
+const char kHandshake[] = "serve 2";
+
+}  // namespace
+
+PluginCoprocess* PluginCoprocess::Instance() {
+  // Never destroyed, detached reader threads may outlive static destructors
+  static PluginCoprocess* instance = new PluginCoprocess();
+  return instance;
+}
+
+bool PluginCoprocess::Execute(const std::string& plugin,
+                              const std::vector<std::string>& args,
+                              unsigned int timeout, int& exit_code,
+                              std::string& output) {
+  TRACE_ENTER();
+  for (const auto& arg : args) {
+    // cannot be represented in the line protocol
+    if (arg.find_first_of("\t\n") != std::string::npos) return false;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (plugin != plugin_) {
+    // configuration reloaded
+    Stop();
+    plugin_ = plugin;
+    retry_time_ = {};
+    retry_delay_ = kMinRetryDelay;
+  }
+  if (fd_ < 0) {
+    // requests are not held up by a start in progress or backing off, they
+    // execute the plugin instead
+    if (starting_ == true) return false;
+    const auto now = std::chrono::steady_clock::now();
+    if (now < retry_time_) return false;
+
+    starting_ = true;
+    int fd;
+    pid_t pid;
+    lock.unlock();
+    bool started = Start(plugin, fd, pid);
+    lock.lock();
+    starting_ = false;
+
+    if (started == true && plugin != plugin_) {
+      // configuration reloaded during the start
+      close(fd);
+      kill(pid, SIGTERM);
+      waitpid(pid, nullptr, 0);
+      return false;
+    }
+    if (started == false) {
+      if (retry_delay_ == kMinRetryDelay) {
+        LOG_NO("Plugin co-process not available, executing '%s' per request",
+               plugin_.c_str());
+      }
+      retry_time_ = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(retry_delay_);
+      retry_delay_ = 2 * retry_delay_ < kMaxRetryDelay ? 2 * retry_delay_
+                                                       : kMaxRetryDelay;
+      return false;
+    }
+
+    fd_ = fd;
+    pid_ = pid;
+    ++generation_;
+    retry_delay_ = kMinRetryDelay;
+    std::thread reader(&PluginCoprocess::ReadResponses, this, fd_, pid_,
+                       generation_);
+    reader.detach();
+    LOG_NO("Started plugin co-process '%s', pid %d", plugin_.c_str(), pid_);
+  }
+
+  const uint64_t id = next_id_++;
+  std::string line = std::to_string(id);
+  for (const auto& arg : args) {
+    line += '\t';
+    line += arg;
+  }
+  line += '\n';
+
+  Request request{generation_, false, false, 0, {}};
+  pending_[id] = &request;
+  const int fd = fd_;
+  lock.unlock();
+  bool sent = Send(fd, request.generation, line);
+  lock.lock();
+  if (sent == false) {
+    pending_.erase(id);
+    if (request.generation == generation_) Stop();
+    return false;
+  }
+  if (timeout == 0) {
+    cv_.wait(lock, [&request] { return request.done; });
+  } else if (cv_.wait_for(lock, std::chrono::seconds(timeout),
+                          [&request] { return request.done; }) == false) {
+    LOG_WA("Plugin co-process did not answer '%s' within %u seconds",
+           args.front().c_str(), timeout);
+    pending_.erase(id);
+    if (request.generation == generation_) Stop();
+    return false;
+  }
+  if (request.failed == true) return false;
+
+  exit_code = request.exit_code;
+  output = std::move(request.output);
+  TRACE("Requested '%s', returning %d", args.front().c_str(), exit_code);
+  return true;
+}
+
+bool PluginCoprocess::Start(const std::string& plugin, int& fd, pid_t& pid) {
+  TRACE_ENTER();
+  int sv[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) != 0) {
+    LOG_ER("socketpair failed: %s", strerror(errno));
+    return false;
+  }
+
+  // built before fork, only async-signal-safe calls are allowed in the child
+  const std::string command("exec " + plugin + " serve");
+  pid = fork();
+  if (pid < 0) {
+    LOG_ER("fork failed: %s", strerror(errno));
+    close(sv[0]);
+    close(sv[1]);
+    return false;
+  }
+  if (pid == 0) {
+    if (dup2(sv[1], STDIN_FILENO) < 0 || dup2(sv[1], STDOUT_FILENO) < 0) {
+      _exit(127);
+    }
+    execl("/bin/sh", "sh", "-c", command.c_str(), nullptr);
+    _exit(127);
+  }
+  close(sv[1]);
+
+  // read the handshake one character at a time, so that nothing beyond it
+  // is consumed before the reader thread takes over
+  std::string line;
+  char c = '\0';
+  while (c != '\n' && line.size() < sizeof(kHandshake)) {
+    struct pollfd fds = {sv[0], POLLIN, 0};
+    int rc = poll(&fds, 1, kHandshakeTimeout);
+    if (rc < 0 && errno == EINTR) continue;
+    if (rc <= 0) break;
+    ssize_t n = read(sv[0], &c, 1);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    if (c != '\n') line += c;
+  }
+  if (c != '\n' || line != kHandshake) {
+    TRACE("Unexpected handshake '%s'", line.c_str());
+    close(sv[0]);
+    kill(pid, SIGTERM);
+    waitpid(pid, nullptr, 0);
+    return false;
+  }
+
+  fd = sv[0];
+  return true;
+}
+
+void PluginCoprocess::Stop() {
+  if (fd_ < 0) return;
+  // the reader thread sees end of file, fails outstanding requests and
+  // reaps the co-process
+  shutdown(fd_, SHUT_RDWR);
+  kill(pid_, SIGTERM);
+  fd_ = -1;
+  pid_ = -1;
+  ++generation_;
+}
+
+bool PluginCoprocess::Send(int fd, uint64_t generation,
+                          const std::string& line) {
+  std::lock_guard<std::mutex> send_lock(send_mutex_);
+  {
+    // fd is closed by the reader thread once the co-process is gone
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_) return false;
+  }
+  size_t sent = 0;
+  while (sent < line.size()) {
+    ssize_t n = send(fd, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      LOG_WA("Failed to send to plugin co-process: %s", strerror(errno));
+      return false;
+    }
+    sent += n;
+  }
+  return true;
+}
+
+void PluginCoprocess::ReadResponses(int fd, pid_t pid, uint64_t generation) {
+  TRACE_ENTER();
+  constexpr size_t buf_size = 4096;
+  char buffer[buf_size];
+  std::string data;
+  bool malformed = false;
+
+  while (malformed == false) {
+    ssize_t n = read(fd, buffer, buf_size);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    data.append(buffer, n);
+    // each response is a header line "<id> TAB <exit code> TAB <length>",
+    // followed by <length> bytes of output
+    size_t start = 0;
+    size_t end;
+    while ((end = data.find('\n', start)) != std::string::npos) {
+      const std::string header = data.substr(start, end - start);
+      char* field_end;
+      uint64_t id = strtoull(header.c_str(), &field_end, 10);
+      int exit_code = 0;
+      unsigned long length = 0;  // NOLINT(runtime/int)
+      if (*field_end == '\t') {
+        exit_code = strtol(field_end + 1, &field_end, 10);
+      }
+      if (*field_end == '\t') {
+        length = strtoul(field_end + 1, &field_end, 10);
+      }
+      if (header.size() > kMaxHeaderSize ||
+          field_end != header.c_str() + header.size() ||
+          length > kMaxOutputSize) {
+        LOG_WA("Malformed response from plugin co-process: '%s'",
+               header.c_str());
+        malformed = true;
+        break;
+      }
+      if (data.size() - (end + 1) < length) break;
+      HandleResponse(id, exit_code, data.substr(end + 1, length));
+      start = end + 1 + length;
+    }
+    if (malformed == false && data.find('\n', start) == std::string::npos &&
+        data.size() - start > kMaxHeaderSize) {
+      LOG_WA("Malformed response from plugin co-process");
+      malformed = true;
+    }
+    data.erase(0, start);
+  }
+
+  {
+    // senders use fd while holding send_mutex_
+    std::lock_guard<std::mutex> send_lock(send_mutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation == generation_) {
+      if (malformed == true) {
+        Stop();
+      } else {
+        LOG_WA("Plugin co-process %d exited", pid);
+        fd_ = -1;
+        pid_ = -1;
+        ++generation_;
+      }
+    }
+    close(fd);
+  }
+  waitpid(pid, nullptr, 0);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // outstanding requests are retried by executing the plugin
+  for (auto it = pending_.begin(); it != pending_.end();) {
+    Request* request = it->second;
+    if (request->generation == generation) {
+      request->done = true;
+      request->failed = true;
+      it = pending_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  cv_.notify_all();
+}
+
+void PluginCoprocess::HandleResponse(uint64_t id, int exit_code,
+                                     std::string&& output) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = pending_.find(id);
+  if (it == pending_.end()) {
+    // e.g. the request timed out
+    LOG_WA("Unexpected response %" PRIu64 " from plugin co-process", id);
+    return;
+  }
+  Request* request = it->second;
+  request->exit_code = exit_code;
+  request->output = std::move(output);
+  request->done = true;
+  pending_.erase(it);
+  cv_.notify_all();
+}
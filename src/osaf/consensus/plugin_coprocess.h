@@ -0,0 +1,102 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+#ifndef OSAF_CONSENSUS_PLUGIN_COPROCESS_H_
+#define OSAF_CONSENSUS_PLUGIN_COPROCESS_H_
+
+#include <sys/types.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "base/macros.h"
+
+// Runs the key-value store plugin as a long-lived co-process, started as
+// "<plugin> serve", and multiplexes requests from any number of threads over
+// its stdin/stdout. The plugin first announces itself with the line
+// "serve 2". Each request is then one line
+//
+//   <id> TAB <operation> [TAB <argument>]...
+//
+// which the plugin answers, in any order, with the line
+//
+//   <id> TAB <exit code> TAB <length> LF
+//
+// followed by <length> bytes of output, which may span several lines. Exit
+// code and output mean the same as when the plugin is executed with the
+// operation and arguments on its command line. Requests are pipelined, and
+// a watch request is answered when the watched key changes.
+class PluginCoprocess {
+ public:
+  static PluginCoprocess* Instance();
+
+  // Send a request to the co-process of plugin, starting it if needed, and
+  // wait for the answer, at most timeout seconds unless timeout is 0. The
+  // co-process is stopped if it does not answer in time. Returns false if
+  // the co-process can not be used, in which case the caller shall execute
+  // the plugin instead. After a failed start the co-process is not started
+  // again until a delay, doubled on each failure, has passed.
+  bool Execute(const std::string& plugin, const std::vector<std::string>& args,
+               unsigned int timeout, int& exit_code, std::string& output);
+
+ private:
+  struct Request {
+    uint64_t generation;
+    bool done;
+    bool failed;
+    int exit_code;
+    std::string output;
+  };
+
+  static constexpr int kHandshakeTimeout = 10000;  // in ms
+  static constexpr size_t kMaxHeaderSize = 64;
+  static constexpr size_t kMaxOutputSize = 1 << 20;
+  // delay before a failed start is retried, doubled on each failure
+  static constexpr int kMinRetryDelay = 1000;   // in ms
+  static constexpr int kMaxRetryDelay = 60000;  // in ms
+
+  PluginCoprocess() {}
+  ~PluginCoprocess() {}
+
+  // Start the co-process and wait for its handshake, called without mutex_
+  static bool Start(const std::string& plugin, int& fd, pid_t& pid);
+  void Stop();
+  // Send line on fd, unless the co-process of generation is gone. Called
+  // without mutex_, so that the reader thread can take responses meanwhile
+  bool Send(int fd, uint64_t generation, const std::string& line);
+  void ReadResponses(int fd, pid_t pid, uint64_t generation);
+  void HandleResponse(uint64_t id, int exit_code, std::string&& output);
+
+  // held while fd_ is written, and by the reader thread when it closes fd_,
+  // taken before mutex_
+  std::mutex send_mutex_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::map<uint64_t, Request*> pending_;
+  std::string plugin_;
+  bool starting_{false};
+  std::chrono::steady_clock::time_point retry_time_{};
+  int retry_delay_{kMinRetryDelay};  // in ms
+  int fd_{-1};
+  pid_t pid_{-1};
+  uint64_t generation_{0};
+  uint64_t next_id_{0};
+
+  DELETE_COPY_AND_MOVE_OPERATORS(PluginCoprocess);
+};
+
+#endif  // OSAF_CONSENSUS_PLUGIN_COPROCESS_H_
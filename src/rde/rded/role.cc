@@ -27,6 +27,7 @@
 #include "base/logtrace.h"
 #include "base/ncs_main_papi.h"
 #include "base/ncssysf_def.h"
+#include "base/osaf_failover_timeline.h"
 #include "base/process.h"
 #include "base/time.h"
 #include "osaf/consensus/consensus.h"
@@ -125,6 +126,7 @@ void Role::PromoteNode(const uint64_t cluster_size,
   }
 
   RDE_CONTROL_BLOCK* cb = rde_get_control_block();
+  osaf_failover_timeline_mark("consensus promotion done");
 
   // send msg to main thread
   rde_msg* msg = static_cast<rde_msg*>(malloc(sizeof(rde_msg)));
@@ -296,11 +298,14 @@ uint32_t Role::SetRole(PCS_RDA_ROLE new_role) {
     RDE_CONTROL_BLOCK* cb = rde_get_control_block();
     cb->promote_start = base::ReadMonotonicClock();
     cb->promote_pending = 0;
+    osaf_failover_timeline_mark("promotion requested");
   }
   if (new_role != old_role) {
     LOG_NO("RDE role set to %s", to_string(new_role));
     if (new_role == PCS_RDA_ACTIVE) {
+      osaf_failover_timeline_mark("pre-active script start");
       ExecutePreActiveScript();
+      osaf_failover_timeline_mark("pre-active script done");
 
       // register for callback if active controller is changed
       // in consensus service
@@ -324,6 +329,8 @@ uint32_t Role::SetRole(PCS_RDA_ROLE new_role) {
       ResetElectionTimer();
     } else {
       rde_rda_send_role(new_role);
+      if (new_role == PCS_RDA_ACTIVE)
+        osaf_failover_timeline_mark("role active sent");
     }
   }
   return UpdateMdsRegistration(new_role, old_role);
@@ -0,0 +1,233 @@
+/*      -*- OpenSAF  -*-
+ *
+ * (C) Copyright 2026 The OpenSAF Foundation
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. This file and program are licensed
+ * under the GNU Lesser General Public License Version 2.1, February 1999.
+ * The complete license can be accessed from the following location:
+ * http://opensource.org/licenses/lgpl-license.php
+ * See the Copying file included with the OpenSAF distribution for full
+ * licensing terms.
+ *
+ */
+
+/*
+ * This file contains a command line utility printing the timeline of the
+ * latest controller failovers on this node, as recorded by the OpenSAF
+ * daemons, see base/osaf_failover_timeline.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <libgen.h>
+
+#include "base/osaf_failover_timeline.h"
+#include "base/osaf_time.h"
+
+#define MAX_PROCESSES 32
+
+struct process_span {
+	const char *process;
+	const struct OsafFailoverStage *first;
+	const struct OsafFailoverStage *last;
+};
+
+static unsigned int numFailovers = 1;
+
+static void usage(const char *progname)
+{
+	printf("\nNAME\n");
+	printf("\t%s - print the timeline of controller failovers\n",
+	       progname);
+
+	printf("\nSYNOPSIS\n");
+	printf("\t%s [options]\n", progname);
+
+	printf("\nDESCRIPTION\n");
+	printf(
+	    "\t%s prints the stages of the latest controller failovers on this\n"
+	    "\tnode, as recorded by the OpenSAF daemons taking part in them. For\n"
+	    "\teach failover the time of each stage since the failover started is\n"
+	    "\tprinted, followed by the first and last stage and the duration of\n"
+	    "\teach daemon. The last stage of the failover ends the critical path.\n",
+	    progname);
+
+	printf("\nOPTIONS\n");
+	printf("\t-h, --help             this help\n");
+	printf(
+	    "\t-n, --failovers <n>    number of failovers to print (default 1)\n");
+
+	printf("\nEXAMPLE\n");
+	printf("\t%s -n 3\n", progname);
+}
+
+/* Copy the stages that are consistent, oldest first */
+static unsigned int read_stages(const struct OsafFailoverTimeline *timeline,
+				struct OsafFailoverStage *stages)
+{
+	uint64_t last = __atomic_load_n(&timeline->stages, __ATOMIC_ACQUIRE);
+	uint64_t first = last > kOsafFailoverTimelineSize
+			     ? last - kOsafFailoverTimelineSize + 1
+			     : 1;
+	unsigned int count = 0;
+	uint64_t sequence;
+
+	for (sequence = first; sequence <= last; ++sequence) {
+		const struct OsafFailoverStage *s =
+		    &timeline->stage[(sequence - 1) % kOsafFailoverTimelineSize];
+
+		if (__atomic_load_n(&s->sequence, __ATOMIC_ACQUIRE) != sequence)
+			continue;
+		memcpy(&stages[count], s, sizeof(*s));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&s->sequence, __ATOMIC_RELAXED) != sequence)
+			continue;
+		stages[count].process[kOsafFailoverProcessLength - 1] = '\0';
+		stages[count].stage[kOsafFailoverStageLength - 1] = '\0';
+		++count;
+	}
+	return count;
+}
+
+static double millis_since(const struct OsafFailoverStage *start,
+			   const struct OsafFailoverStage *s)
+{
+	struct timespec diff;
+
+	if (osaf_timespec_compare(&s->monotonic, &start->monotonic) < 0)
+		return 0;
+	osaf_timespec_subtract(&s->monotonic, &start->monotonic, &diff);
+	return osaf_timespec_to_double(&diff) * 1000;
+}
+
+static void print_failover(uint32_t failover,
+			   const struct OsafFailoverStage *stages,
+			   unsigned int count)
+{
+	struct process_span spans[MAX_PROCESSES];
+	const struct OsafFailoverStage *start = NULL;
+	const struct OsafFailoverStage *end = NULL;
+	unsigned int num_spans = 0;
+	unsigned int i, j;
+	char buf[32];
+	struct tm tm;
+	time_t secs;
+
+	for (i = 0; i < count; ++i) {
+		const struct OsafFailoverStage *s = &stages[i];
+
+		if (s->failover != failover)
+			continue;
+		if (start == NULL)
+			start = s;
+		if (end == NULL ||
+		    osaf_timespec_compare(&s->monotonic, &end->monotonic) >= 0)
+			end = s;
+
+		for (j = 0; j < num_spans; ++j) {
+			if (strcmp(spans[j].process, s->process) == 0)
+				break;
+		}
+		if (j == num_spans) {
+			if (num_spans == MAX_PROCESSES)
+				continue;
+			spans[j].process = s->process;
+			spans[j].first = s;
+			++num_spans;
+		}
+		spans[j].last = s;
+	}
+
+	if (start == NULL) {
+		printf("Failover %u: no stages recorded\n\n", failover);
+		return;
+	}
+
+	secs = start->realtime.tv_sec;
+	localtime_r(&secs, &tm);
+	strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+	printf("Failover %u started %s.%03ld\n", failover, buf,
+	       start->realtime.tv_nsec / 1000000);
+
+	for (i = 0; i < count; ++i) {
+		const struct OsafFailoverStage *s = &stages[i];
+
+		if (s->failover != failover)
+			continue;
+		printf("  %+10.3f ms  %-16s %s\n", millis_since(start, s),
+		       s->process, s->stage);
+	}
+
+	printf("  Per daemon:\n");
+	for (j = 0; j < num_spans; ++j) {
+		printf("    %-16s %10.3f ms .. %10.3f ms  (%.3f ms)\n",
+		       spans[j].process, millis_since(start, spans[j].first),
+		       millis_since(start, spans[j].last),
+		       millis_since(spans[j].first, spans[j].last));
+	}
+
+	printf("  Critical path: %.3f ms, ends in %s: %s\n\n",
+	       millis_since(start, end), end->process, end->stage);
+}
+
+int main(int argc, char *argv[])
+{
+	struct option long_options[] = {{"help", no_argument, 0, 'h'},
+					{"failovers", required_argument, 0, 'n'},
+					{0, 0, 0, 0}};
+	const struct OsafFailoverTimeline *timeline;
+	struct OsafFailoverStage *stages;
+	unsigned int count;
+	uint32_t latest, failover;
+	int c;
+
+	while ((c = getopt_long(argc, argv, "hn:", long_options, NULL)) != -1) {
+		switch (c) {
+		case 'n':
+			numFailovers = strtoul(optarg, NULL, 0);
+			break;
+		case 'h':
+			usage(basename(argv[0]));
+			exit(EXIT_SUCCESS);
+		default:
+			fprintf(stderr, "Try '%s --help' for more information\n",
+				argv[0]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (numFailovers == 0) {
+		fprintf(stderr, "Arguments must be larger than zero\n");
+		exit(EXIT_FAILURE);
+	}
+
+	timeline = osaf_failover_timeline_open();
+	if (timeline == NULL) {
+		printf("No failover timeline recorded on this node\n");
+		exit(EXIT_FAILURE);
+	}
+
+	latest = __atomic_load_n(&timeline->failover, __ATOMIC_ACQUIRE);
+	if (latest == 0) {
+		printf("No failover recorded on this node\n");
+		exit(EXIT_SUCCESS);
+	}
+
+	stages = calloc(kOsafFailoverTimelineSize, sizeof(*stages));
+	if (stages == NULL) {
+		fprintf(stderr, "calloc FAILED\n");
+		exit(EXIT_FAILURE);
+	}
+	count = read_stages(timeline, stages);
+
+	failover = latest >= numFailovers ? latest - numFailovers + 1 : 1;
+	for (; failover <= latest; ++failover)
+		print_failover(failover, stages, count);
+
+	free(stages);
+	return EXIT_SUCCESS;
+}